@@ -43,11 +43,39 @@
 #include "testing_swap_batched.hpp"
 #include "testing_swap_strided_batched.hpp"
 // blas2
+#include "testing_gbmv.hpp"
+#include "testing_gbmv_batched.hpp"
+#include "testing_gbmv_strided_batched.hpp"
 #include "testing_gemv.hpp"
 #include "testing_gemv_batched.hpp"
+#include "testing_gemv_multi.hpp"
+#include "testing_gemv_multi_strided_batched.hpp"
 #include "testing_gemv_strided_batched.hpp"
 #include "testing_ger.hpp"
+#include "testing_sbmv.hpp"
+#include "testing_sbmv_batched.hpp"
+#include "testing_sbmv_strided_batched.hpp"
+#include "testing_spmv.hpp"
+#include "testing_spmv_batched.hpp"
+#include "testing_spmv_strided_batched.hpp"
+#include "testing_symv.hpp"
+#include "testing_symv_batched.hpp"
+#include "testing_symv_strided_batched.hpp"
 #include "testing_syr.hpp"
+#include "testing_syr2.hpp"
+#include "testing_syr2_batched.hpp"
+#include "testing_syr2_strided_batched.hpp"
+#include "testing_syr_batched.hpp"
+#include "testing_syr_strided_batched.hpp"
+#include "testing_tbmv.hpp"
+#include "testing_tbmv_batched.hpp"
+#include "testing_tbmv_strided_batched.hpp"
+#include "testing_tpmv.hpp"
+#include "testing_tpmv_batched.hpp"
+#include "testing_tpmv_strided_batched.hpp"
+#include "testing_tpsv.hpp"
+#include "testing_tpsv_batched.hpp"
+#include "testing_tpsv_strided_batched.hpp"
 #include "type_dispatch.hpp"
 #include "utility.hpp"
 #include <algorithm>
@@ -92,13 +120,28 @@ void run_function(const func_map& map, const Arguments& arg, const std::string&
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
 #include "testing_gemm_ex.hpp"
+#include "testing_gemm_out_of_core.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
+#include "testing_ger_accumulate.hpp"
+#include "testing_symm.hpp"
+#include "testing_symm_batched.hpp"
+#include "testing_symm_strided_batched.hpp"
+#include "testing_syr2k.hpp"
+#include "testing_syr2k_batched.hpp"
+#include "testing_syr2k_strided_batched.hpp"
+#include "testing_syrk.hpp"
+#include "testing_syrk_batched.hpp"
+#include "testing_syrk_strided_batched.hpp"
 #include "testing_trmm.hpp"
+#include "testing_trmm_batched.hpp"
+#include "testing_trmm_outofplace.hpp"
+#include "testing_trmm_strided_batched.hpp"
 #include "testing_trsm.hpp"
 #include "testing_trsm_batched.hpp"
 #include "testing_trsm_batched_ex.hpp"
 #include "testing_trsm_ex.hpp"
+#include "testing_trsm_solve.hpp"
 #include "testing_trsm_strided_batched.hpp"
 #include "testing_trsm_strided_batched_ex.hpp"
 #include "testing_trsv.hpp"
@@ -202,19 +245,63 @@ struct perf_blas<
                 {"gemv", testing_gemv<T>},
                 {"gemv_batched", testing_gemv_batched<T>},
                 {"gemv_strided_batched", testing_gemv_strided_batched<T>},
+                {"gemv_multi", testing_gemv_multi<T>},
+                {"gemv_multi_strided_batched", testing_gemv_multi_strided_batched<T>},
                 {"ger", testing_ger<T>},
+                {"symv", testing_symv<T>},
+                {"symv_batched", testing_symv_batched<T>},
+                {"symv_strided_batched", testing_symv_strided_batched<T>},
                 {"syr", testing_syr<T>},
+                {"syr_batched", testing_syr_batched<T>},
+                {"syr_strided_batched", testing_syr_strided_batched<T>},
+                {"syr2", testing_syr2<T>},
+                {"syr2_batched", testing_syr2_batched<T>},
+                {"syr2_strided_batched", testing_syr2_strided_batched<T>},
+                {"gbmv", testing_gbmv<T>},
+                {"gbmv_batched", testing_gbmv_batched<T>},
+                {"gbmv_strided_batched", testing_gbmv_strided_batched<T>},
+                {"sbmv", testing_sbmv<T>},
+                {"sbmv_batched", testing_sbmv_batched<T>},
+                {"sbmv_strided_batched", testing_sbmv_strided_batched<T>},
+                {"spmv", testing_spmv<T>},
+                {"spmv_batched", testing_spmv_batched<T>},
+                {"spmv_strided_batched", testing_spmv_strided_batched<T>},
+                {"tbmv", testing_tbmv<T>},
+                {"tbmv_batched", testing_tbmv_batched<T>},
+                {"tbmv_strided_batched", testing_tbmv_strided_batched<T>},
+                {"tpmv", testing_tpmv<T>},
+                {"tpmv_batched", testing_tpmv_batched<T>},
+                {"tpmv_strided_batched", testing_tpmv_strided_batched<T>},
+                {"tpsv", testing_tpsv<T>},
+                {"tpsv_batched", testing_tpsv_batched<T>},
+                {"tpsv_strided_batched", testing_tpsv_strided_batched<T>},
 #if BUILD_WITH_TENSILE
                 {"geam", testing_geam<T>},
                 {"trmm", testing_trmm<T>},
+                {"trmm_batched", testing_trmm_batched<T>},
+                {"trmm_strided_batched", testing_trmm_strided_batched<T>},
+                {"trmm_outofplace", testing_trmm_outofplace<T>},
                 {"trtri", testing_trtri<T>},
                 {"trtri_batched", testing_trtri_batched<T>},
                 {"trtri_strided_batched", testing_trtri_strided_batched<T>},
                 {"gemm", testing_gemm<T>},
                 {"gemm_batched", testing_gemm_batched<T>},
                 {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+                {"gemm_out_of_core", testing_gemm_out_of_core<T>},
+                {"gemm_bf16x3", testing_gemm_bf16x3<T>},
+                {"ger_accumulate", testing_ger_accumulate<T>},
+                {"syrk", testing_syrk<T>},
+                {"syrk_batched", testing_syrk_batched<T>},
+                {"syrk_strided_batched", testing_syrk_strided_batched<T>},
+                {"syr2k", testing_syr2k<T>},
+                {"syr2k_batched", testing_syr2k_batched<T>},
+                {"syr2k_strided_batched", testing_syr2k_strided_batched<T>},
+                {"symm", testing_symm<T>},
+                {"symm_batched", testing_symm_batched<T>},
+                {"symm_strided_batched", testing_symm_strided_batched<T>},
                 {"trsm", testing_trsm<T>},
                 {"trsm_ex", testing_trsm_ex<T>},
+                {"trsm_solve", testing_trsm_solve<T>},
                 {"trsm_batched", testing_trsm_batched<T>},
                 {"trsm_batched_ex", testing_trsm_batched_ex<T>},
                 {"trsm_strided_batched", testing_trsm_strided_batched<T>},
@@ -288,10 +375,40 @@ struct perf_blas<T,
                 {"iamax", testing_iamax<T>},
                 {"iamin", testing_iamin<T>},
                 {"gemv", testing_gemv<T>},
+                {"gemv_multi", testing_gemv_multi<T>},
+                {"gemv_multi_strided_batched", testing_gemv_multi_strided_batched<T>},
+                {"hemv", testing_symv<T, true>},
+                {"hemv_batched", testing_symv_batched<T, true>},
+                {"hemv_strided_batched", testing_symv_strided_batched<T, true>},
+                {"her", testing_syr<T, typename T::value_type>},
+                {"her_batched", testing_syr_batched<T, typename T::value_type>},
+                {"her_strided_batched", testing_syr_strided_batched<T, typename T::value_type>},
+                {"her2", testing_syr2<T, true>},
+                {"her2_batched", testing_syr2_batched<T, true>},
+                {"her2_strided_batched", testing_syr2_strided_batched<T, true>},
 #if BUILD_WITH_TENSILE
                 {"gemm", testing_gemm<T>},
                 {"gemm_batched", testing_gemm_batched<T>},
                 {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+                {"gemm_out_of_core", testing_gemm_out_of_core<T>},
+                {"syrk", testing_syrk<T>},
+                {"syrk_batched", testing_syrk_batched<T>},
+                {"syrk_strided_batched", testing_syrk_strided_batched<T>},
+                {"herk", testing_syrk<T, typename T::value_type>},
+                {"herk_batched", testing_syrk_batched<T, typename T::value_type>},
+                {"herk_strided_batched", testing_syrk_strided_batched<T, typename T::value_type>},
+                {"syr2k", testing_syr2k<T>},
+                {"syr2k_batched", testing_syr2k_batched<T>},
+                {"syr2k_strided_batched", testing_syr2k_strided_batched<T>},
+                {"her2k", testing_syr2k<T, typename T::value_type>},
+                {"her2k_batched", testing_syr2k_batched<T, typename T::value_type>},
+                {"her2k_strided_batched", testing_syr2k_strided_batched<T, typename T::value_type>},
+                {"symm", testing_symm<T>},
+                {"symm_batched", testing_symm_batched<T>},
+                {"symm_strided_batched", testing_symm_strided_batched<T>},
+                {"hemm", testing_symm<T, true>},
+                {"hemm_batched", testing_symm_batched<T, true>},
+                {"hemm_strided_batched", testing_symm_strided_batched<T, true>},
 #endif
               };
         run_function(map, arg);
@@ -401,7 +518,8 @@ int run_bench_test(Arguments& arg)
         function += sizeof(prefix) - 1;
 
 #if BUILD_WITH_TENSILE
-    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched"))
+    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched")
+       || !strcmp(function, "gemm_out_of_core") || !strcmp(function, "gemm_bf16x3"))
     {
         // adjust dimension for GEMM routines
         rocblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -474,6 +592,72 @@ int run_bench_test(Arguments& arg)
             arg.stride_c = min_stride_c;
         }
     }
+    else if(!strncmp(function, "syrk", 4) || !strncmp(function, "herk", 4)
+            || !strncmp(function, "syr2k", 5) || !strncmp(function, "her2k", 5))
+    {
+        // adjust dimension for SYRK/HERK/SYR2K/HER2K routines
+        rocblas_int min_lda = arg.transA == 'N' ? arg.N : arg.K;
+        rocblas_int min_ldc = arg.N;
+
+        if(arg.lda < min_lda)
+        {
+            std::cout << "rocblas-bench INFO: lda < min_lda, set lda = " << min_lda << std::endl;
+            arg.lda = min_lda;
+        }
+        if(arg.ldb < min_lda)
+        {
+            std::cout << "rocblas-bench INFO: ldb < min_ldb, set ldb = " << min_lda << std::endl;
+            arg.ldb = min_lda;
+        }
+        if(arg.ldc < min_ldc)
+        {
+            std::cout << "rocblas-bench INFO: ldc < min_ldc, set ldc = " << min_ldc << std::endl;
+            arg.ldc = min_ldc;
+        }
+
+        rocblas_int min_stride_a = arg.lda * (arg.transA == 'N' ? arg.K : arg.N);
+        rocblas_int min_stride_b = arg.ldb * (arg.transA == 'N' ? arg.K : arg.N);
+        rocblas_int min_stride_c = arg.ldc * arg.N;
+        if(arg.stride_a < min_stride_a)
+            arg.stride_a = min_stride_a;
+        if(arg.stride_b < min_stride_b)
+            arg.stride_b = min_stride_b;
+        if(arg.stride_c < min_stride_c)
+            arg.stride_c = min_stride_c;
+    }
+    else if(!strncmp(function, "symm", 4) || !strncmp(function, "hemm", 4))
+    {
+        // adjust dimension for SYMM/HEMM routines
+        rocblas_int min_lda = arg.side == 'L' ? arg.M : arg.N;
+        rocblas_int min_ldb = arg.M;
+        rocblas_int min_ldc = arg.M;
+
+        if(arg.lda < min_lda)
+        {
+            std::cout << "rocblas-bench INFO: lda < min_lda, set lda = " << min_lda << std::endl;
+            arg.lda = min_lda;
+        }
+        if(arg.ldb < min_ldb)
+        {
+            std::cout << "rocblas-bench INFO: ldb < min_ldb, set ldb = " << min_ldb << std::endl;
+            arg.ldb = min_ldb;
+        }
+        if(arg.ldc < min_ldc)
+        {
+            std::cout << "rocblas-bench INFO: ldc < min_ldc, set ldc = " << min_ldc << std::endl;
+            arg.ldc = min_ldc;
+        }
+
+        rocblas_int min_stride_a = arg.lda * min_lda;
+        rocblas_int min_stride_b = arg.ldb * arg.N;
+        rocblas_int min_stride_c = arg.ldc * arg.N;
+        if(arg.stride_a < min_stride_a)
+            arg.stride_a = min_stride_a;
+        if(arg.stride_b < min_stride_b)
+            arg.stride_b = min_stride_b;
+        if(arg.stride_c < min_stride_c)
+            arg.stride_c = min_stride_c;
+    }
 
     if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
     {
@@ -618,7 +802,15 @@ try
         ("sizek,k",
          value<rocblas_int>(&arg.K)->default_value(128),
          "Specific matrix size: sizek is only applicable to BLAS-3: the number of columns in "
-         "A and rows in B.")
+         "A and rows in B. For SBMV and TBMV: the number of super- or sub-diagonals of A.")
+
+        ("kl",
+         value<rocblas_int>(&arg.KL)->default_value(32),
+         "Number of sub-diagonals of the band matrix A, is only applicable to GBMV.")
+
+        ("ku",
+         value<rocblas_int>(&arg.KU)->default_value(32),
+         "Number of super-diagonals of the band matrix A, is only applicable to GBMV.")
 
         ("lda",
          value<rocblas_int>(&arg.lda)->default_value(128),
@@ -734,7 +926,7 @@ try
         ("uplo",
          value<char>(&arg.uplo)->default_value('U'),
          "U = upper, L = lower. Only applicable to certain routines") // xsymv xsyrk xsyr2k xtrsm xtrsm_ex
-                                                                     // xtrmm xtrsv
+                                                                     // xtrmm xtrsv xsymm
         ("diag",
          value<char>(&arg.diag)->default_value('N'),
          "U = unit diagonal, N = non unit diagonal. Only applicable to certain routines") // xtrsm xtrsm_ex xtrsv
@@ -55,6 +55,48 @@ double get_time_us_sync(hipStream_t stream)
     return (tv.tv_sec * 1000 * 1000) + tv.tv_usec;
 };
 
+/* ============================================================================================ */
+/*  stream blocker */
+
+// Spins until *flag is set, or for timeout clock cycles
+__global__ void rocblas_stream_blocker_kernel(volatile int* flag, long long timeout)
+{
+    long long start = clock64();
+    while(!*flag && clock64() - start < timeout)
+    {
+    }
+}
+
+rocblas_stream_blocker::rocblas_stream_blocker(rocblas_handle handle)
+    : handle(handle)
+{
+    rocblas_get_stream(handle, &old_stream);
+    hipStreamCreate(&stream);
+    rocblas_set_stream(handle, stream);
+
+    // The flag is in host memory mapped to the device, so that the kernel sees it change
+    hipHostMalloc((void**)&flag, sizeof(int), hipHostMallocMapped);
+    *flag = 0;
+    int* dflag;
+    hipHostGetDevicePointer((void**)&dflag, flag, 0);
+
+    hipLaunchKernelGGL(rocblas_stream_blocker_kernel, 1, 1, 0, stream, dflag, 1LL << 33);
+}
+
+rocblas_stream_blocker::~rocblas_stream_blocker()
+{
+    *flag = 1;
+    hipStreamSynchronize(stream);
+    rocblas_set_stream(handle, old_stream);
+    hipStreamDestroy(stream);
+    hipHostFree(flag);
+}
+
+bool rocblas_stream_blocker::busy() const
+{
+    return hipStreamQuery(stream) == hipErrorNotReady;
+}
+
 /* ============================================================================================ */
 /*  device query and print out their ID and name; return number of compute-capable devices. */
 rocblas_int query_device_property()
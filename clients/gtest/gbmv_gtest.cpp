@@ -0,0 +1,147 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_gbmv.hpp"
+#include "testing_gbmv_batched.hpp"
+#include "testing_gbmv_strided_batched.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible gbmv test cases
+    enum gbmv_test_type
+    {
+        GBMV,
+        GBMV_BATCHED,
+        GBMV_STRIDED_BATCHED,
+    };
+
+    // Names of the functions tested by each test type, without the _bad_arg suffix
+    constexpr const char* gbmv_test_function[] = {
+        "gbmv",
+        "gbmv_batched",
+        "gbmv_strided_batched",
+    };
+
+    // gbmv test template
+    template <template <typename...> class FILTER, gbmv_test_type GBMV_TYPE>
+    struct gbmv_template : RocBLAS_Test<gbmv_template<FILTER, GBMV_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<gbmv_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            const char* function = gbmv_test_function[GBMV_TYPE];
+            size_t      len      = strlen(function);
+            return !strncmp(arg.function, function, len)
+                   && (!arg.function[len] || !strcmp(arg.function + len, "_bad_arg"));
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gbmv_template> name;
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                bool strided = GBMV_TYPE == GBMV_STRIDED_BATCHED;
+                bool batched = GBMV_TYPE != GBMV;
+
+                name << '_' << (char)std::toupper(arg.transA) << '_' << arg.M << '_' << arg.N
+                     << '_' << arg.KL << '_' << arg.KU << '_' << arg.alpha << '_' << arg.lda;
+
+                if(strided)
+                    name << '_' << arg.stride_a;
+
+                name << '_' << arg.incx;
+
+                if(strided)
+                    name << '_' << arg.stride_x;
+
+                name << '_' << arg.beta << '_' << arg.incy;
+
+                if(strided)
+                    name << '_' << arg.stride_y;
+
+                if(batched)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if below.
+    template <typename, typename = void>
+    struct gbmv_testing : rocblas_test_invalid
+    {
+    };
+
+    // gbmv applies to real types only
+    template <typename T>
+    struct gbmv_testing<
+        T,
+        typename std::enable_if<std::is_same<T, float>{} || std::is_same<T, double>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gbmv"))
+                testing_gbmv<T>(arg);
+            else if(!strcmp(arg.function, "gbmv_bad_arg"))
+                testing_gbmv_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gbmv_batched"))
+                testing_gbmv_batched<T>(arg);
+            else if(!strcmp(arg.function, "gbmv_batched_bad_arg"))
+                testing_gbmv_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gbmv_strided_batched"))
+                testing_gbmv_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "gbmv_strided_batched_bad_arg"))
+                testing_gbmv_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gbmv = gbmv_template<gbmv_testing, GBMV>;
+    TEST_P(gbmv, blas2)
+    {
+        rocblas_simple_dispatch<gbmv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(gbmv);
+
+    using gbmv_batched = gbmv_template<gbmv_testing, GBMV_BATCHED>;
+    TEST_P(gbmv_batched, blas2)
+    {
+        rocblas_simple_dispatch<gbmv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(gbmv_batched);
+
+    using gbmv_strided_batched = gbmv_template<gbmv_testing, GBMV_STRIDED_BATCHED>;
+    TEST_P(gbmv_strided_batched, blas2)
+    {
+        rocblas_simple_dispatch<gbmv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(gbmv_strided_batched);
+
+} // namespace
@@ -59,7 +59,10 @@ namespace
             switch(GEMM_TYPE)
             {
             case GEMM:
-                return !strcmp(arg.function, "gemm") || !strcmp(arg.function, "gemm_bad_arg");
+                return !strcmp(arg.function, "gemm") || !strcmp(arg.function, "gemm_bad_arg")
+                       || !strcmp(arg.function, "gemm_bf16x3")
+                       || !strcmp(arg.function, "gemm_bf16x3_bad_arg")
+                       || !strcmp(arg.function, "gemm_bf16x3_scope");
 
             case GEMM_EX:
                 return !strcmp(arg.function, "gemm_ex") || !strcmp(arg.function, "gemm_ex_bad_arg");
@@ -146,6 +149,12 @@ namespace
                 testing_gemm<T>(arg);
             else if(!strcmp(arg.function, "gemm_bad_arg"))
                 testing_gemm_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemm_bf16x3"))
+                testing_gemm_bf16x3<T>(arg);
+            else if(!strcmp(arg.function, "gemm_bf16x3_bad_arg"))
+                testing_gemm_bf16x3_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemm_bf16x3_scope"))
+                testing_gemm_bf16x3_scope<T>(arg);
             else if(!strcmp(arg.function, "gemm_batched"))
                 testing_gemm_batched<T>(arg);
             else if(!strcmp(arg.function, "gemm_batched_bad_arg"))
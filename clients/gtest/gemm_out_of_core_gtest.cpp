@@ -0,0 +1,115 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_gemm_out_of_core.hpp"
+#include "testing_gemm_out_of_core_pipeline.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // Types of out-of-core GEMM tests
+    enum gemm_out_of_core_test_type
+    {
+        GEMM_OUT_OF_CORE,
+        GEMM_OUT_OF_CORE_PIPELINE,
+    };
+
+    // Out-of-core GEMM testing template
+    template <template <typename...> class FILTER, gemm_out_of_core_test_type GEMM_TYPE>
+    struct gemm_out_of_core_template
+        : RocBLAS_Test<gemm_out_of_core_template<FILTER, GEMM_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<gemm_out_of_core_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(GEMM_TYPE)
+            {
+            case GEMM_OUT_OF_CORE:
+                return !strcmp(arg.function, "gemm_out_of_core")
+                       || !strcmp(arg.function, "gemm_out_of_core_bad_arg");
+            case GEMM_OUT_OF_CORE_PIPELINE:
+                return !strcmp(arg.function, "gemm_out_of_core_pipeline");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_out_of_core_template> name;
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.transA) << (char)std::toupper(arg.transB)
+                     << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                     << arg.lda << '_' << arg.ldb << '_' << arg.beta << '_' << arg.ldc;
+            }
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if below.
+    template <typename, typename = void>
+    struct gemm_out_of_core_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct gemm_out_of_core_testing<
+        T,
+        typename std::enable_if<
+            std::is_same<T, float>{} || std::is_same<T, double>{}
+            || std::is_same<T, rocblas_float_complex>{}
+            || std::is_same<T, rocblas_double_complex>{}>::type> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_out_of_core"))
+                testing_gemm_out_of_core<T>(arg);
+            else if(!strcmp(arg.function, "gemm_out_of_core_bad_arg"))
+                testing_gemm_out_of_core_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemm_out_of_core_pipeline"))
+                testing_gemm_out_of_core_pipeline<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_out_of_core = gemm_out_of_core_template<gemm_out_of_core_testing, GEMM_OUT_OF_CORE>;
+    TEST_P(gemm_out_of_core, blas3)
+    {
+        rocblas_simple_dispatch<gemm_out_of_core_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_out_of_core);
+
+    using gemm_out_of_core_pipeline
+        = gemm_out_of_core_template<gemm_out_of_core_testing, GEMM_OUT_OF_CORE_PIPELINE>;
+    TEST_P(gemm_out_of_core_pipeline, blas3)
+    {
+        rocblas_simple_dispatch<gemm_out_of_core_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_out_of_core_pipeline);
+
+} // namespace
@@ -7,6 +7,8 @@
 #include "rocblas_test.hpp"
 #include "testing_gemv.hpp"
 #include "testing_gemv_batched.hpp"
+#include "testing_gemv_multi.hpp"
+#include "testing_gemv_multi_strided_batched.hpp"
 #include "testing_gemv_strided_batched.hpp"
 #include "type_dispatch.hpp"
 #include <cctype>
@@ -21,6 +23,8 @@ namespace
         GEMV,
         GEMV_BATCHED,
         GEMV_STRIDED_BATCHED,
+        GEMV_MULTI,
+        GEMV_MULTI_STRIDED_BATCHED,
     };
 
     //gemv test template
@@ -46,6 +50,12 @@ namespace
             case GEMV_STRIDED_BATCHED:
                 return !strcmp(arg.function, "gemv_strided_batched")
                        || !strcmp(arg.function, "gemv_strided_batched_bad_arg");
+            case GEMV_MULTI:
+                return !strcmp(arg.function, "gemv_multi")
+                       || !strcmp(arg.function, "gemv_multi_bad_arg");
+            case GEMV_MULTI_STRIDED_BATCHED:
+                return !strcmp(arg.function, "gemv_multi_strided_batched")
+                       || !strcmp(arg.function, "gemv_multi_strided_batched_bad_arg");
             }
             return false;
         }
@@ -56,9 +66,14 @@ namespace
             RocBLAS_TestName<gemv_template> name;
 
             name << rocblas_datatype2string(arg.a_type) << '_' << (char)std::toupper(arg.transA)
-                 << '_' << arg.M << '_' << arg.N << '_' << arg.alpha << '_' << arg.lda;
+                 << '_' << arg.M << '_' << arg.N;
 
-            if(GEMV_TYPE == GEMV_STRIDED_BATCHED)
+            if(GEMV_TYPE == GEMV_MULTI || GEMV_TYPE == GEMV_MULTI_STRIDED_BATCHED)
+                name << '_' << arg.K;
+
+            name << '_' << arg.alpha << '_' << arg.lda;
+
+            if(GEMV_TYPE == GEMV_STRIDED_BATCHED || GEMV_TYPE == GEMV_MULTI_STRIDED_BATCHED)
                 name << '_' << arg.stride_a;
 
             name << '_' << arg.incx;
@@ -71,7 +86,8 @@ namespace
             if(GEMV_TYPE == GEMV_STRIDED_BATCHED)
                 name << '_' << arg.stride_y;
 
-            if(GEMV_TYPE == GEMV_STRIDED_BATCHED || GEMV_TYPE == GEMV_BATCHED)
+            if(GEMV_TYPE == GEMV_STRIDED_BATCHED || GEMV_TYPE == GEMV_BATCHED
+               || GEMV_TYPE == GEMV_MULTI_STRIDED_BATCHED)
                 name << '_' << arg.batch_count;
 
             return std::move(name);
@@ -109,6 +125,14 @@ namespace
                 testing_gemv_strided_batched<T>(arg);
             else if(!strcmp(arg.function, "gemv_strided_batched_bad_arg"))
                 testing_gemv_strided_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemv_multi"))
+                testing_gemv_multi<T>(arg);
+            else if(!strcmp(arg.function, "gemv_multi_bad_arg"))
+                testing_gemv_multi_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemv_multi_strided_batched"))
+                testing_gemv_multi_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "gemv_multi_strided_batched_bad_arg"))
+                testing_gemv_multi_strided_batched_bad_arg<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -135,4 +159,18 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemv_strided_batched);
 
+    using gemv_multi = gemv_template<gemv_testing, GEMV_MULTI>;
+    TEST_P(gemv_multi, blas2)
+    {
+        rocblas_simple_dispatch<gemv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_multi);
+
+    using gemv_multi_strided_batched = gemv_template<gemv_testing, GEMV_MULTI_STRIDED_BATCHED>;
+    TEST_P(gemv_multi_strided_batched, blas2)
+    {
+        rocblas_simple_dispatch<gemv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_multi_strided_batched);
+
 } // namespace
@@ -0,0 +1,88 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_ger_accumulate.hpp"
+#include "type_dispatch.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // ger_accumulate test template
+    template <template <typename...> class FILTER>
+    struct ger_accumulate_template : RocBLAS_Test<ger_accumulate_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<ger_accumulate_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "ger_accumulate")
+                   || !strcmp(arg.function, "ger_accumulate_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<ger_accumulate_template> name;
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.alpha << '_' << arg.incx << '_'
+                     << arg.stride_x << '_' << arg.incy << '_' << arg.stride_y << '_' << arg.lda
+                     << '_' << arg.K << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if below.
+    template <typename, typename = void>
+    struct ger_accumulate_testing : rocblas_test_invalid
+    {
+    };
+
+    // ger_accumulate applies to real types only, like ger
+    template <typename T>
+    struct ger_accumulate_testing<
+        T,
+        typename std::enable_if<std::is_same<T, float>{} || std::is_same<T, double>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "ger_accumulate"))
+                testing_ger_accumulate<T>(arg);
+            else if(!strcmp(arg.function, "ger_accumulate_bad_arg"))
+                testing_ger_accumulate_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using ger_accumulate = ger_accumulate_template<ger_accumulate_testing>;
+    TEST_P(ger_accumulate, blas2)
+    {
+        rocblas_simple_dispatch<ger_accumulate_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(ger_accumulate);
+
+} // namespace
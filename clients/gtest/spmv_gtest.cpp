@@ -0,0 +1,146 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_spmv.hpp"
+#include "testing_spmv_batched.hpp"
+#include "testing_spmv_strided_batched.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible spmv test cases
+    enum spmv_test_type
+    {
+        SPMV,
+        SPMV_BATCHED,
+        SPMV_STRIDED_BATCHED,
+    };
+
+    // Names of the functions tested by each test type, without the _bad_arg suffix
+    constexpr const char* spmv_test_function[] = {
+        "spmv",
+        "spmv_batched",
+        "spmv_strided_batched",
+    };
+
+    // spmv test template
+    template <template <typename...> class FILTER, spmv_test_type SPMV_TYPE>
+    struct spmv_template : RocBLAS_Test<spmv_template<FILTER, SPMV_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<spmv_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            const char* function = spmv_test_function[SPMV_TYPE];
+            size_t      len      = strlen(function);
+            return !strncmp(arg.function, function, len)
+                   && (!arg.function[len] || !strcmp(arg.function + len, "_bad_arg"));
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<spmv_template> name;
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                bool strided = SPMV_TYPE == SPMV_STRIDED_BATCHED;
+                bool batched = SPMV_TYPE != SPMV;
+
+                name << '_' << (char)std::toupper(arg.uplo) << '_' << arg.N << '_' << arg.alpha;
+
+                if(strided)
+                    name << '_' << arg.stride_a;
+
+                name << '_' << arg.incx;
+
+                if(strided)
+                    name << '_' << arg.stride_x;
+
+                name << '_' << arg.beta << '_' << arg.incy;
+
+                if(strided)
+                    name << '_' << arg.stride_y;
+
+                if(batched)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if below.
+    template <typename, typename = void>
+    struct spmv_testing : rocblas_test_invalid
+    {
+    };
+
+    // spmv applies to real types only
+    template <typename T>
+    struct spmv_testing<
+        T,
+        typename std::enable_if<std::is_same<T, float>{} || std::is_same<T, double>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "spmv"))
+                testing_spmv<T>(arg);
+            else if(!strcmp(arg.function, "spmv_bad_arg"))
+                testing_spmv_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "spmv_batched"))
+                testing_spmv_batched<T>(arg);
+            else if(!strcmp(arg.function, "spmv_batched_bad_arg"))
+                testing_spmv_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "spmv_strided_batched"))
+                testing_spmv_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "spmv_strided_batched_bad_arg"))
+                testing_spmv_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using spmv = spmv_template<spmv_testing, SPMV>;
+    TEST_P(spmv, blas2)
+    {
+        rocblas_simple_dispatch<spmv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(spmv);
+
+    using spmv_batched = spmv_template<spmv_testing, SPMV_BATCHED>;
+    TEST_P(spmv_batched, blas2)
+    {
+        rocblas_simple_dispatch<spmv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(spmv_batched);
+
+    using spmv_strided_batched = spmv_template<spmv_testing, SPMV_STRIDED_BATCHED>;
+    TEST_P(spmv_strided_batched, blas2)
+    {
+        rocblas_simple_dispatch<spmv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(spmv_strided_batched);
+
+} // namespace
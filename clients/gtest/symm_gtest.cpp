@@ -0,0 +1,205 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_symm.hpp"
+#include "testing_symm_batched.hpp"
+#include "testing_symm_strided_batched.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible symm/hemm test cases
+    enum symm_test_type
+    {
+        SYMM,
+        SYMM_BATCHED,
+        SYMM_STRIDED_BATCHED,
+        HEMM,
+        HEMM_BATCHED,
+        HEMM_STRIDED_BATCHED,
+    };
+
+    // Names of the functions tested by each test type, without the _bad_arg suffix
+    constexpr const char* symm_test_function[] = {
+        "symm",
+        "symm_batched",
+        "symm_strided_batched",
+        "hemm",
+        "hemm_batched",
+        "hemm_strided_batched",
+    };
+
+    // symm test template
+    template <template <typename...> class FILTER, symm_test_type SYMM_TYPE>
+    struct symm_template : RocBLAS_Test<symm_template<FILTER, SYMM_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<symm_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            const char* function = symm_test_function[SYMM_TYPE];
+            size_t      len      = strlen(function);
+            return !strncmp(arg.function, function, len)
+                   && (!arg.function[len] || !strcmp(arg.function + len, "_bad_arg"));
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<symm_template> name;
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                bool strided = SYMM_TYPE % 3 == 2;
+                bool batched = SYMM_TYPE % 3 != 0;
+
+                name << '_' << (char)std::toupper(arg.side) << (char)std::toupper(arg.uplo) << '_'
+                     << arg.M << '_' << arg.N << '_' << arg.alpha << '_' << arg.lda;
+
+                if(strided)
+                    name << '_' << arg.stride_a;
+
+                name << '_' << arg.ldb;
+
+                if(strided)
+                    name << '_' << arg.stride_b;
+
+                name << '_' << arg.beta << '_' << arg.ldc;
+
+                if(strided)
+                    name << '_' << arg.stride_c;
+
+                if(batched)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if below.
+    template <typename, typename = void>
+    struct symm_testing : rocblas_test_invalid
+    {
+    };
+
+    // symm applies to real and complex types
+    template <typename T>
+    struct symm_testing<
+        T,
+        typename std::enable_if<
+            std::is_same<T, float>{} || std::is_same<T, double>{}
+            || std::is_same<T, rocblas_float_complex>{}
+            || std::is_same<T, rocblas_double_complex>{}>::type> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "symm"))
+                testing_symm<T>(arg);
+            else if(!strcmp(arg.function, "symm_bad_arg"))
+                testing_symm_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "symm_batched"))
+                testing_symm_batched<T>(arg);
+            else if(!strcmp(arg.function, "symm_batched_bad_arg"))
+                testing_symm_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "symm_strided_batched"))
+                testing_symm_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "symm_strided_batched_bad_arg"))
+                testing_symm_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct hemm_testing : rocblas_test_invalid
+    {
+    };
+
+    // hemm applies to complex types only
+    template <typename T>
+    struct hemm_testing<T,
+                        typename std::enable_if<std::is_same<T, rocblas_float_complex>{}
+                                                || std::is_same<T, rocblas_double_complex>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "hemm"))
+                testing_symm<T, true>(arg);
+            else if(!strcmp(arg.function, "hemm_bad_arg"))
+                testing_symm_bad_arg<T, true>(arg);
+            else if(!strcmp(arg.function, "hemm_batched"))
+                testing_symm_batched<T, true>(arg);
+            else if(!strcmp(arg.function, "hemm_batched_bad_arg"))
+                testing_symm_batched_bad_arg<T, true>(arg);
+            else if(!strcmp(arg.function, "hemm_strided_batched"))
+                testing_symm_strided_batched<T, true>(arg);
+            else if(!strcmp(arg.function, "hemm_strided_batched_bad_arg"))
+                testing_symm_strided_batched_bad_arg<T, true>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using symm = symm_template<symm_testing, SYMM>;
+    TEST_P(symm, blas3)
+    {
+        rocblas_simple_dispatch<symm_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(symm);
+
+    using symm_batched = symm_template<symm_testing, SYMM_BATCHED>;
+    TEST_P(symm_batched, blas3)
+    {
+        rocblas_simple_dispatch<symm_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(symm_batched);
+
+    using symm_strided_batched = symm_template<symm_testing, SYMM_STRIDED_BATCHED>;
+    TEST_P(symm_strided_batched, blas3)
+    {
+        rocblas_simple_dispatch<symm_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(symm_strided_batched);
+
+    using hemm = symm_template<hemm_testing, HEMM>;
+    TEST_P(hemm, blas3)
+    {
+        rocblas_simple_dispatch<hemm_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(hemm);
+
+    using hemm_batched = symm_template<hemm_testing, HEMM_BATCHED>;
+    TEST_P(hemm_batched, blas3)
+    {
+        rocblas_simple_dispatch<hemm_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(hemm_batched);
+
+    using hemm_strided_batched = symm_template<hemm_testing, HEMM_STRIDED_BATCHED>;
+    TEST_P(hemm_strided_batched, blas3)
+    {
+        rocblas_simple_dispatch<hemm_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(hemm_strided_batched);
+
+} // namespace
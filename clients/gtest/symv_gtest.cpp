@@ -7,6 +7,8 @@
 #include "rocblas_datatype2string.hpp"
 #include "rocblas_test.hpp"
 #include "testing_symv.hpp"
+#include "testing_symv_batched.hpp"
+#include "testing_symv_strided_batched.hpp"
 #include "type_dispatch.hpp"
 #include <cctype>
 #include <cstring>
@@ -14,62 +16,190 @@
 
 namespace
 {
-    // By default, this test does not apply to any types.
-    // The unnamed second parameter is used for enable_if below.
-    template <typename, typename = void>
-    struct symv_testing : rocblas_test_invalid
+    // possible symv/hemv test cases
+    enum symv_test_type
     {
+        SYMV,
+        SYMV_BATCHED,
+        SYMV_STRIDED_BATCHED,
+        HEMV,
+        HEMV_BATCHED,
+        HEMV_STRIDED_BATCHED,
     };
 
-#if 0 // TODO: Right now rocblas_symv is unimplemented
-
-// When the condition in the second argument is satisfied, the type combination
-// is valid. When the condition is false, this specialization does not apply.
-template <typename T>
-struct symv_testing<
-    T,
-    typename std::enable_if<std::is_same<T, float>{} || std::is_same<T, double>{}>::type>
-    : rocblas_test_valid
-{
-    void operator()(const Arguments& arg)
-    {
-        if(!strcmp(arg.function, "symv"))
-            testing_symv<T>(arg);
-        else
-            FAIL() << "Internal error: Test called with unknown function: " << arg.function;
-    }
-};
-
-#endif
+    // Names of the functions tested by each test type, without the _bad_arg suffix
+    constexpr const char* symv_test_function[] = {
+        "symv",
+        "symv_batched",
+        "symv_strided_batched",
+        "hemv",
+        "hemv_batched",
+        "hemv_strided_batched",
+    };
 
-    struct symv : RocBLAS_Test<symv, symv_testing>
+    // symv test template
+    template <template <typename...> class FILTER, symv_test_type SYMV_TYPE>
+    struct symv_template : RocBLAS_Test<symv_template<FILTER, SYMV_TYPE>, FILTER>
     {
         // Filter for which types apply to this suite
         static bool type_filter(const Arguments& arg)
         {
-            return rocblas_simple_dispatch<type_filter_functor>(arg);
+            return rocblas_simple_dispatch<symv_template::template type_filter_functor>(arg);
         }
 
         // Filter for which functions apply to this suite
         static bool function_filter(const Arguments& arg)
         {
-            return !strcmp(arg.function, "symv");
+            const char* function = symv_test_function[SYMV_TYPE];
+            size_t      len      = strlen(function);
+            return !strncmp(arg.function, function, len)
+                   && (!arg.function[len] || !strcmp(arg.function + len, "_bad_arg"));
         }
 
         // Google Test name suffix based on parameters
         static std::string name_suffix(const Arguments& arg)
         {
-            return RocBLAS_TestName<symv>{} << rocblas_datatype2string(arg.a_type) << '_'
-                                            << (char)std::toupper(arg.uplo) << '_' << arg.N << '_'
-                                            << arg.alpha << '_' << arg.lda << '_' << arg.incx << '_'
-                                            << arg.beta << '_' << arg.incy;
+            RocBLAS_TestName<symv_template> name;
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                bool strided = SYMV_TYPE % 3 == 2;
+                bool batched = SYMV_TYPE % 3 != 0;
+
+                name << '_' << (char)std::toupper(arg.uplo) << '_' << arg.N << '_' << arg.alpha
+                     << '_' << arg.lda;
+
+                if(strided)
+                    name << '_' << arg.stride_a;
+
+                name << '_' << arg.incx;
+
+                if(strided)
+                    name << '_' << arg.stride_x;
+
+                name << '_' << arg.beta << '_' << arg.incy;
+
+                if(strided)
+                    name << '_' << arg.stride_y;
+
+                if(batched)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if below.
+    template <typename, typename = void>
+    struct symv_testing : rocblas_test_invalid
+    {
+    };
+
+    // symv applies to real types only
+    template <typename T>
+    struct symv_testing<
+        T,
+        typename std::enable_if<std::is_same<T, float>{} || std::is_same<T, double>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "symv"))
+                testing_symv<T>(arg);
+            else if(!strcmp(arg.function, "symv_bad_arg"))
+                testing_symv_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "symv_batched"))
+                testing_symv_batched<T>(arg);
+            else if(!strcmp(arg.function, "symv_batched_bad_arg"))
+                testing_symv_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "symv_strided_batched"))
+                testing_symv_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "symv_strided_batched_bad_arg"))
+                testing_symv_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
     };
 
+    template <typename, typename = void>
+    struct hemv_testing : rocblas_test_invalid
+    {
+    };
+
+    // hemv applies to complex types only
+    template <typename T>
+    struct hemv_testing<T,
+                        typename std::enable_if<std::is_same<T, rocblas_float_complex>{}
+                                                || std::is_same<T, rocblas_double_complex>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "hemv"))
+                testing_symv<T, true>(arg);
+            else if(!strcmp(arg.function, "hemv_bad_arg"))
+                testing_symv_bad_arg<T, true>(arg);
+            else if(!strcmp(arg.function, "hemv_batched"))
+                testing_symv_batched<T, true>(arg);
+            else if(!strcmp(arg.function, "hemv_batched_bad_arg"))
+                testing_symv_batched_bad_arg<T, true>(arg);
+            else if(!strcmp(arg.function, "hemv_strided_batched"))
+                testing_symv_strided_batched<T, true>(arg);
+            else if(!strcmp(arg.function, "hemv_strided_batched_bad_arg"))
+                testing_symv_strided_batched_bad_arg<T, true>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using symv = symv_template<symv_testing, SYMV>;
     TEST_P(symv, blas2)
     {
         rocblas_simple_dispatch<symv_testing>(GetParam());
     }
     INSTANTIATE_TEST_CATEGORIES(symv);
 
+    using symv_batched = symv_template<symv_testing, SYMV_BATCHED>;
+    TEST_P(symv_batched, blas2)
+    {
+        rocblas_simple_dispatch<symv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(symv_batched);
+
+    using symv_strided_batched = symv_template<symv_testing, SYMV_STRIDED_BATCHED>;
+    TEST_P(symv_strided_batched, blas2)
+    {
+        rocblas_simple_dispatch<symv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(symv_strided_batched);
+
+    using hemv = symv_template<hemv_testing, HEMV>;
+    TEST_P(hemv, blas2)
+    {
+        rocblas_simple_dispatch<hemv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(hemv);
+
+    using hemv_batched = symv_template<hemv_testing, HEMV_BATCHED>;
+    TEST_P(hemv_batched, blas2)
+    {
+        rocblas_simple_dispatch<hemv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(hemv_batched);
+
+    using hemv_strided_batched = symv_template<hemv_testing, HEMV_STRIDED_BATCHED>;
+    TEST_P(hemv_strided_batched, blas2)
+    {
+        rocblas_simple_dispatch<hemv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(hemv_strided_batched);
+
 } // namespace
@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_syr2.hpp"
+#include "testing_syr2_batched.hpp"
+#include "testing_syr2_strided_batched.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible syr2/her2 test cases
+    enum syr2_test_type
+    {
+        SYR2,
+        SYR2_BATCHED,
+        SYR2_STRIDED_BATCHED,
+        HER2,
+        HER2_BATCHED,
+        HER2_STRIDED_BATCHED,
+    };
+
+    // syr2 test template
+    template <template <typename...> class FILTER, syr2_test_type SYR2_TYPE>
+    struct syr2_template : RocBLAS_Test<syr2_template<FILTER, SYR2_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<syr2_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(SYR2_TYPE)
+            {
+            case SYR2:
+                return !strcmp(arg.function, "syr2") || !strcmp(arg.function, "syr2_bad_arg");
+            case SYR2_BATCHED:
+                return !strcmp(arg.function, "syr2_batched")
+                       || !strcmp(arg.function, "syr2_batched_bad_arg");
+            case SYR2_STRIDED_BATCHED:
+                return !strcmp(arg.function, "syr2_strided_batched")
+                       || !strcmp(arg.function, "syr2_strided_batched_bad_arg");
+            case HER2:
+                return !strcmp(arg.function, "her2") || !strcmp(arg.function, "her2_bad_arg");
+            case HER2_BATCHED:
+                return !strcmp(arg.function, "her2_batched")
+                       || !strcmp(arg.function, "her2_batched_bad_arg");
+            case HER2_STRIDED_BATCHED:
+                return !strcmp(arg.function, "her2_strided_batched")
+                       || !strcmp(arg.function, "her2_strided_batched_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<syr2_template> name;
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                bool strided
+                    = SYR2_TYPE == SYR2_STRIDED_BATCHED || SYR2_TYPE == HER2_STRIDED_BATCHED;
+                bool batched = SYR2_TYPE != SYR2 && SYR2_TYPE != HER2;
+
+                name << '_' << (char)std::toupper(arg.uplo) << '_' << arg.N << '_' << arg.alpha
+                     << '_' << arg.incx;
+
+                if(strided)
+                    name << '_' << arg.stride_x;
+
+                name << '_' << arg.incy;
+
+                if(strided)
+                    name << '_' << arg.stride_y;
+
+                name << '_' << arg.lda;
+
+                if(strided)
+                    name << '_' << arg.stride_a;
+
+                if(batched)
+                    name << '_' << arg.batch_count;
+            }
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if below.
+    template <typename, typename = void>
+    struct syr2_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct syr2_testing<
+        T,
+        typename std::enable_if<std::is_same<T, float>{} || std::is_same<T, double>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "syr2"))
+                testing_syr2<T>(arg);
+            else if(!strcmp(arg.function, "syr2_bad_arg"))
+                testing_syr2_bad_arg<T>();
+            else if(!strcmp(arg.function, "syr2_batched"))
+                testing_syr2_batched<T>(arg);
+            else if(!strcmp(arg.function, "syr2_batched_bad_arg"))
+                testing_syr2_batched_bad_arg<T>();
+            else if(!strcmp(arg.function, "syr2_strided_batched"))
+                testing_syr2_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "syr2_strided_batched_bad_arg"))
+                testing_syr2_strided_batched_bad_arg<T>();
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct her2_testing : rocblas_test_invalid
+    {
+    };
+
+    // her2 applies to complex types only
+    template <typename T>
+    struct her2_testing<T,
+                       typename std::enable_if<std::is_same<T, rocblas_float_complex>{}
+                                               || std::is_same<T, rocblas_double_complex>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "her2"))
+                testing_syr2<T, true>(arg);
+            else if(!strcmp(arg.function, "her2_bad_arg"))
+                testing_syr2_bad_arg<T, true>();
+            else if(!strcmp(arg.function, "her2_batched"))
+                testing_syr2_batched<T, true>(arg);
+            else if(!strcmp(arg.function, "her2_batched_bad_arg"))
+                testing_syr2_batched_bad_arg<T, true>();
+            else if(!strcmp(arg.function, "her2_strided_batched"))
+                testing_syr2_strided_batched<T, true>(arg);
+            else if(!strcmp(arg.function, "her2_strided_batched_bad_arg"))
+                testing_syr2_strided_batched_bad_arg<T, true>();
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using syr2 = syr2_template<syr2_testing, SYR2>;
+    TEST_P(syr2, blas2)
+    {
+        rocblas_simple_dispatch<syr2_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr2);
+
+    using syr2_batched = syr2_template<syr2_testing, SYR2_BATCHED>;
+    TEST_P(syr2_batched, blas2)
+    {
+        rocblas_simple_dispatch<syr2_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr2_batched);
+
+    using syr2_strided_batched = syr2_template<syr2_testing, SYR2_STRIDED_BATCHED>;
+    TEST_P(syr2_strided_batched, blas2)
+    {
+        rocblas_simple_dispatch<syr2_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr2_strided_batched);
+
+    using her2 = syr2_template<her2_testing, HER2>;
+    TEST_P(her2, blas2)
+    {
+        rocblas_simple_dispatch<her2_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(her2);
+
+    using her2_batched = syr2_template<her2_testing, HER2_BATCHED>;
+    TEST_P(her2_batched, blas2)
+    {
+        rocblas_simple_dispatch<her2_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(her2_batched);
+
+    using her2_strided_batched = syr2_template<her2_testing, HER2_STRIDED_BATCHED>;
+    TEST_P(her2_strided_batched, blas2)
+    {
+        rocblas_simple_dispatch<her2_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(her2_strided_batched);
+
+} // namespace
@@ -16,12 +16,15 @@
 
 namespace
 {
-    // possible test cases
+    // possible syr/her test cases
     enum syr_test_type
     {
         SYR,
         SYR_BATCHED,
         SYR_STRIDED_BATCHED,
+        HER,
+        HER_BATCHED,
+        HER_STRIDED_BATCHED,
     };
 
     //syr test template
@@ -47,6 +50,14 @@ namespace
             case SYR_STRIDED_BATCHED:
                 return !strcmp(arg.function, "syr_strided_batched")
                        || !strcmp(arg.function, "syr_strided_batched_bad_arg");
+            case HER:
+                return !strcmp(arg.function, "her") || !strcmp(arg.function, "her_bad_arg");
+            case HER_BATCHED:
+                return !strcmp(arg.function, "her_batched")
+                       || !strcmp(arg.function, "her_batched_bad_arg");
+            case HER_STRIDED_BATCHED:
+                return !strcmp(arg.function, "her_strided_batched")
+                       || !strcmp(arg.function, "her_strided_batched_bad_arg");
             }
             return false;
         }
@@ -64,18 +75,21 @@ namespace
             }
             else
             {
+                bool strided = SYR_TYPE == SYR_STRIDED_BATCHED || SYR_TYPE == HER_STRIDED_BATCHED;
+                bool batched = SYR_TYPE != SYR && SYR_TYPE != HER;
+
                 name << '_' << (char)std::toupper(arg.uplo) << '_' << arg.N << '_' << arg.alpha
                      << '_' << arg.incx;
 
-                if(SYR_TYPE == SYR_STRIDED_BATCHED)
+                if(strided)
                     name << '_' << arg.stride_x;
 
                 name << '_' << arg.lda;
 
-                if(SYR_TYPE == SYR_STRIDED_BATCHED)
+                if(strided)
                     name << '_' << arg.stride_a;
 
-                if(SYR_TYPE == SYR_STRIDED_BATCHED || SYR_TYPE == SYR_BATCHED)
+                if(batched)
                     name << '_' << arg.batch_count;
             }
             return std::move(name);
@@ -116,6 +130,39 @@ namespace
         }
     };
 
+    template <typename, typename = void>
+    struct her_testing : rocblas_test_invalid
+    {
+    };
+
+    // her applies to complex types only, with a real alpha
+    template <typename T>
+    struct her_testing<T,
+                       typename std::enable_if<std::is_same<T, rocblas_float_complex>{}
+                                               || std::is_same<T, rocblas_double_complex>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            using U = typename T::value_type;
+
+            if(!strcmp(arg.function, "her"))
+                testing_syr<T, U>(arg);
+            else if(!strcmp(arg.function, "her_bad_arg"))
+                testing_syr_bad_arg<T, U>();
+            else if(!strcmp(arg.function, "her_batched"))
+                testing_syr_batched<T, U>(arg);
+            else if(!strcmp(arg.function, "her_batched_bad_arg"))
+                testing_syr_batched_bad_arg<T, U>();
+            else if(!strcmp(arg.function, "her_strided_batched"))
+                testing_syr_strided_batched<T, U>(arg);
+            else if(!strcmp(arg.function, "her_strided_batched_bad_arg"))
+                testing_syr_strided_batched_bad_arg<T, U>();
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
     using syr = syr_template<syr_testing, SYR>;
     TEST_P(syr, blas2)
     {
@@ -137,4 +184,25 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(syr_strided_batched);
 
+    using her = syr_template<her_testing, HER>;
+    TEST_P(her, blas2)
+    {
+        rocblas_simple_dispatch<her_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(her);
+
+    using her_batched = syr_template<her_testing, HER_BATCHED>;
+    TEST_P(her_batched, blas2)
+    {
+        rocblas_simple_dispatch<her_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(her_batched);
+
+    using her_strided_batched = syr_template<her_testing, HER_STRIDED_BATCHED>;
+    TEST_P(her_strided_batched, blas2)
+    {
+        rocblas_simple_dispatch<her_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(her_strided_batched);
+
 } // namespace
@@ -0,0 +1,291 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_syr2k.hpp"
+#include "testing_syr2k_batched.hpp"
+#include "testing_syr2k_strided_batched.hpp"
+#include "testing_syrk.hpp"
+#include "testing_syrk_batched.hpp"
+#include "testing_syrk_strided_batched.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible syrk/herk/syr2k/her2k test cases
+    enum syrk_test_type
+    {
+        SYRK,
+        SYRK_BATCHED,
+        SYRK_STRIDED_BATCHED,
+        HERK,
+        HERK_BATCHED,
+        HERK_STRIDED_BATCHED,
+        SYR2K,
+        SYR2K_BATCHED,
+        SYR2K_STRIDED_BATCHED,
+        HER2K,
+        HER2K_BATCHED,
+        HER2K_STRIDED_BATCHED,
+    };
+
+    // Names of the functions tested by each test type, without the _bad_arg suffix
+    constexpr const char* syrk_test_function[] = {
+        "syrk",
+        "syrk_batched",
+        "syrk_strided_batched",
+        "herk",
+        "herk_batched",
+        "herk_strided_batched",
+        "syr2k",
+        "syr2k_batched",
+        "syr2k_strided_batched",
+        "her2k",
+        "her2k_batched",
+        "her2k_strided_batched",
+    };
+
+    // syrk test template
+    template <template <typename...> class FILTER, syrk_test_type SYRK_TYPE>
+    struct syrk_template : RocBLAS_Test<syrk_template<FILTER, SYRK_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<syrk_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            const char* function = syrk_test_function[SYRK_TYPE];
+            size_t      len      = strlen(function);
+            return !strncmp(arg.function, function, len)
+                   && (!arg.function[len] || !strcmp(arg.function + len, "_bad_arg"));
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<syrk_template> name;
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                bool twok    = SYRK_TYPE >= SYR2K;
+                bool strided = SYRK_TYPE % 3 == 2;
+                bool batched = SYRK_TYPE % 3 != 0;
+
+                name << '_' << (char)std::toupper(arg.uplo) << (char)std::toupper(arg.transA)
+                     << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_' << arg.lda;
+
+                if(strided)
+                    name << '_' << arg.stride_a;
+
+                if(twok)
+                {
+                    name << '_' << arg.ldb;
+                    if(strided)
+                        name << '_' << arg.stride_b;
+                }
+
+                name << '_' << arg.beta << '_' << arg.ldc;
+
+                if(strided)
+                    name << '_' << arg.stride_c;
+
+                if(batched)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if below.
+    template <typename, typename = void>
+    struct syrk_testing : rocblas_test_invalid
+    {
+    };
+
+    // syrk and syr2k apply to real and complex types, with alpha and beta of the same type
+    template <typename T>
+    struct syrk_testing<
+        T,
+        typename std::enable_if<
+            std::is_same<T, float>{} || std::is_same<T, double>{}
+            || std::is_same<T, rocblas_float_complex>{}
+            || std::is_same<T, rocblas_double_complex>{}>::type> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "syrk"))
+                testing_syrk<T>(arg);
+            else if(!strcmp(arg.function, "syrk_bad_arg"))
+                testing_syrk_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "syrk_batched"))
+                testing_syrk_batched<T>(arg);
+            else if(!strcmp(arg.function, "syrk_batched_bad_arg"))
+                testing_syrk_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "syrk_strided_batched"))
+                testing_syrk_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "syrk_strided_batched_bad_arg"))
+                testing_syrk_strided_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "syr2k"))
+                testing_syr2k<T>(arg);
+            else if(!strcmp(arg.function, "syr2k_bad_arg"))
+                testing_syr2k_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "syr2k_batched"))
+                testing_syr2k_batched<T>(arg);
+            else if(!strcmp(arg.function, "syr2k_batched_bad_arg"))
+                testing_syr2k_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "syr2k_strided_batched"))
+                testing_syr2k_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "syr2k_strided_batched_bad_arg"))
+                testing_syr2k_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct herk_testing : rocblas_test_invalid
+    {
+    };
+
+    // herk and her2k apply to complex types only, with a real beta (and alpha for herk)
+    template <typename T>
+    struct herk_testing<T,
+                        typename std::enable_if<std::is_same<T, rocblas_float_complex>{}
+                                                || std::is_same<T, rocblas_double_complex>{}>::type>
+        : rocblas_test_valid
+    {
+        using U = typename T::value_type;
+
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "herk"))
+                testing_syrk<T, U>(arg);
+            else if(!strcmp(arg.function, "herk_bad_arg"))
+                testing_syrk_bad_arg<T, U>(arg);
+            else if(!strcmp(arg.function, "herk_batched"))
+                testing_syrk_batched<T, U>(arg);
+            else if(!strcmp(arg.function, "herk_batched_bad_arg"))
+                testing_syrk_batched_bad_arg<T, U>(arg);
+            else if(!strcmp(arg.function, "herk_strided_batched"))
+                testing_syrk_strided_batched<T, U>(arg);
+            else if(!strcmp(arg.function, "herk_strided_batched_bad_arg"))
+                testing_syrk_strided_batched_bad_arg<T, U>(arg);
+            else if(!strcmp(arg.function, "her2k"))
+                testing_syr2k<T, U>(arg);
+            else if(!strcmp(arg.function, "her2k_bad_arg"))
+                testing_syr2k_bad_arg<T, U>(arg);
+            else if(!strcmp(arg.function, "her2k_batched"))
+                testing_syr2k_batched<T, U>(arg);
+            else if(!strcmp(arg.function, "her2k_batched_bad_arg"))
+                testing_syr2k_batched_bad_arg<T, U>(arg);
+            else if(!strcmp(arg.function, "her2k_strided_batched"))
+                testing_syr2k_strided_batched<T, U>(arg);
+            else if(!strcmp(arg.function, "her2k_strided_batched_bad_arg"))
+                testing_syr2k_strided_batched_bad_arg<T, U>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using syrk = syrk_template<syrk_testing, SYRK>;
+    TEST_P(syrk, blas3)
+    {
+        rocblas_simple_dispatch<syrk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(syrk);
+
+    using syrk_batched = syrk_template<syrk_testing, SYRK_BATCHED>;
+    TEST_P(syrk_batched, blas3)
+    {
+        rocblas_simple_dispatch<syrk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(syrk_batched);
+
+    using syrk_strided_batched = syrk_template<syrk_testing, SYRK_STRIDED_BATCHED>;
+    TEST_P(syrk_strided_batched, blas3)
+    {
+        rocblas_simple_dispatch<syrk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(syrk_strided_batched);
+
+    using herk = syrk_template<herk_testing, HERK>;
+    TEST_P(herk, blas3)
+    {
+        rocblas_simple_dispatch<herk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(herk);
+
+    using herk_batched = syrk_template<herk_testing, HERK_BATCHED>;
+    TEST_P(herk_batched, blas3)
+    {
+        rocblas_simple_dispatch<herk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(herk_batched);
+
+    using herk_strided_batched = syrk_template<herk_testing, HERK_STRIDED_BATCHED>;
+    TEST_P(herk_strided_batched, blas3)
+    {
+        rocblas_simple_dispatch<herk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(herk_strided_batched);
+
+    using syr2k = syrk_template<syrk_testing, SYR2K>;
+    TEST_P(syr2k, blas3)
+    {
+        rocblas_simple_dispatch<syrk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr2k);
+
+    using syr2k_batched = syrk_template<syrk_testing, SYR2K_BATCHED>;
+    TEST_P(syr2k_batched, blas3)
+    {
+        rocblas_simple_dispatch<syrk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr2k_batched);
+
+    using syr2k_strided_batched = syrk_template<syrk_testing, SYR2K_STRIDED_BATCHED>;
+    TEST_P(syr2k_strided_batched, blas3)
+    {
+        rocblas_simple_dispatch<syrk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr2k_strided_batched);
+
+    using her2k = syrk_template<herk_testing, HER2K>;
+    TEST_P(her2k, blas3)
+    {
+        rocblas_simple_dispatch<herk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(her2k);
+
+    using her2k_batched = syrk_template<herk_testing, HER2K_BATCHED>;
+    TEST_P(her2k_batched, blas3)
+    {
+        rocblas_simple_dispatch<herk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(her2k_batched);
+
+    using her2k_strided_batched = syrk_template<herk_testing, HER2K_STRIDED_BATCHED>;
+    TEST_P(her2k_strided_batched, blas3)
+    {
+        rocblas_simple_dispatch<herk_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(her2k_strided_batched);
+
+} // namespace
@@ -0,0 +1,143 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_tpmv.hpp"
+#include "testing_tpmv_batched.hpp"
+#include "testing_tpmv_strided_batched.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible tpmv test cases
+    enum tpmv_test_type
+    {
+        TPMV,
+        TPMV_BATCHED,
+        TPMV_STRIDED_BATCHED,
+    };
+
+    // Names of the functions tested by each test type, without the _bad_arg suffix
+    constexpr const char* tpmv_test_function[] = {
+        "tpmv",
+        "tpmv_batched",
+        "tpmv_strided_batched",
+    };
+
+    // tpmv test template
+    template <template <typename...> class FILTER, tpmv_test_type TPMV_TYPE>
+    struct tpmv_template : RocBLAS_Test<tpmv_template<FILTER, TPMV_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<tpmv_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            const char* function = tpmv_test_function[TPMV_TYPE];
+            size_t      len      = strlen(function);
+            return !strncmp(arg.function, function, len)
+                   && (!arg.function[len] || !strcmp(arg.function + len, "_bad_arg"));
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<tpmv_template> name;
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                bool strided = TPMV_TYPE == TPMV_STRIDED_BATCHED;
+                bool batched = TPMV_TYPE != TPMV;
+
+                name << '_' << (char)std::toupper(arg.uplo) << '_'
+                     << (char)std::toupper(arg.transA) << '_' << (char)std::toupper(arg.diag)
+                     << '_' << arg.N;
+
+                if(strided)
+                    name << '_' << arg.stride_a;
+
+                name << '_' << arg.incx;
+
+                if(strided)
+                    name << '_' << arg.stride_x;
+
+                if(batched)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if below.
+    template <typename, typename = void>
+    struct tpmv_testing : rocblas_test_invalid
+    {
+    };
+
+    // tpmv applies to real types only
+    template <typename T>
+    struct tpmv_testing<
+        T,
+        typename std::enable_if<std::is_same<T, float>{} || std::is_same<T, double>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "tpmv"))
+                testing_tpmv<T>(arg);
+            else if(!strcmp(arg.function, "tpmv_bad_arg"))
+                testing_tpmv_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "tpmv_batched"))
+                testing_tpmv_batched<T>(arg);
+            else if(!strcmp(arg.function, "tpmv_batched_bad_arg"))
+                testing_tpmv_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "tpmv_strided_batched"))
+                testing_tpmv_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "tpmv_strided_batched_bad_arg"))
+                testing_tpmv_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using tpmv = tpmv_template<tpmv_testing, TPMV>;
+    TEST_P(tpmv, blas2)
+    {
+        rocblas_simple_dispatch<tpmv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(tpmv);
+
+    using tpmv_batched = tpmv_template<tpmv_testing, TPMV_BATCHED>;
+    TEST_P(tpmv_batched, blas2)
+    {
+        rocblas_simple_dispatch<tpmv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(tpmv_batched);
+
+    using tpmv_strided_batched = tpmv_template<tpmv_testing, TPMV_STRIDED_BATCHED>;
+    TEST_P(tpmv_strided_batched, blas2)
+    {
+        rocblas_simple_dispatch<tpmv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(tpmv_strided_batched);
+
+} // namespace
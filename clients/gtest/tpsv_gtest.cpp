@@ -0,0 +1,143 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_tpsv.hpp"
+#include "testing_tpsv_batched.hpp"
+#include "testing_tpsv_strided_batched.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible tpsv test cases
+    enum tpsv_test_type
+    {
+        TPSV,
+        TPSV_BATCHED,
+        TPSV_STRIDED_BATCHED,
+    };
+
+    // Names of the functions tested by each test type, without the _bad_arg suffix
+    constexpr const char* tpsv_test_function[] = {
+        "tpsv",
+        "tpsv_batched",
+        "tpsv_strided_batched",
+    };
+
+    // tpsv test template
+    template <template <typename...> class FILTER, tpsv_test_type TPSV_TYPE>
+    struct tpsv_template : RocBLAS_Test<tpsv_template<FILTER, TPSV_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<tpsv_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            const char* function = tpsv_test_function[TPSV_TYPE];
+            size_t      len      = strlen(function);
+            return !strncmp(arg.function, function, len)
+                   && (!arg.function[len] || !strcmp(arg.function + len, "_bad_arg"));
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<tpsv_template> name;
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                bool strided = TPSV_TYPE == TPSV_STRIDED_BATCHED;
+                bool batched = TPSV_TYPE != TPSV;
+
+                name << '_' << (char)std::toupper(arg.uplo) << '_'
+                     << (char)std::toupper(arg.transA) << '_' << (char)std::toupper(arg.diag)
+                     << '_' << arg.N;
+
+                if(strided)
+                    name << '_' << arg.stride_a;
+
+                name << '_' << arg.incx;
+
+                if(strided)
+                    name << '_' << arg.stride_x;
+
+                if(batched)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if below.
+    template <typename, typename = void>
+    struct tpsv_testing : rocblas_test_invalid
+    {
+    };
+
+    // tpsv applies to real types only
+    template <typename T>
+    struct tpsv_testing<
+        T,
+        typename std::enable_if<std::is_same<T, float>{} || std::is_same<T, double>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "tpsv"))
+                testing_tpsv<T>(arg);
+            else if(!strcmp(arg.function, "tpsv_bad_arg"))
+                testing_tpsv_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "tpsv_batched"))
+                testing_tpsv_batched<T>(arg);
+            else if(!strcmp(arg.function, "tpsv_batched_bad_arg"))
+                testing_tpsv_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "tpsv_strided_batched"))
+                testing_tpsv_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "tpsv_strided_batched_bad_arg"))
+                testing_tpsv_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using tpsv = tpsv_template<tpsv_testing, TPSV>;
+    TEST_P(tpsv, blas2)
+    {
+        rocblas_simple_dispatch<tpsv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(tpsv);
+
+    using tpsv_batched = tpsv_template<tpsv_testing, TPSV_BATCHED>;
+    TEST_P(tpsv_batched, blas2)
+    {
+        rocblas_simple_dispatch<tpsv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(tpsv_batched);
+
+    using tpsv_strided_batched = tpsv_template<tpsv_testing, TPSV_STRIDED_BATCHED>;
+    TEST_P(tpsv_strided_batched, blas2)
+    {
+        rocblas_simple_dispatch<tpsv_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(tpsv_strided_batched);
+
+} // namespace
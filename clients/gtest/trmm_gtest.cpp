@@ -7,6 +7,9 @@
 #include "rocblas_datatype2string.hpp"
 #include "rocblas_test.hpp"
 #include "testing_trmm.hpp"
+#include "testing_trmm_batched.hpp"
+#include "testing_trmm_outofplace.hpp"
+#include "testing_trmm_strided_batched.hpp"
 #include "type_dispatch.hpp"
 #include <cctype>
 #include <cstring>
@@ -33,6 +36,12 @@ namespace
         {
             if(!strcmp(arg.function, "trmm"))
                 testing_trmm<T>(arg);
+            else if(!strcmp(arg.function, "trmm_batched"))
+                testing_trmm_batched<T>(arg);
+            else if(!strcmp(arg.function, "trmm_strided_batched"))
+                testing_trmm_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "trmm_outofplace"))
+                testing_trmm_outofplace<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -49,17 +58,36 @@ namespace
         // Filter for which functions apply to this suite
         static bool function_filter(const Arguments& arg)
         {
-            return !strcmp(arg.function, "trmm");
+            return !strcmp(arg.function, "trmm") || !strcmp(arg.function, "trmm_batched")
+                   || !strcmp(arg.function, "trmm_strided_batched")
+                   || !strcmp(arg.function, "trmm_outofplace");
         }
 
         // Google Test name suffix based on parameters
         static std::string name_suffix(const Arguments& arg)
         {
-            return RocBLAS_TestName<trmm>{}
-                   << rocblas_datatype2string(arg.a_type) << '_' << (char)std::toupper(arg.side)
-                   << (char)std::toupper(arg.uplo) << (char)std::toupper(arg.transA)
-                   << (char)std::toupper(arg.diag) << '_' << arg.M << '_' << arg.N << '_'
-                   << arg.alpha << '_' << arg.lda << '_' << arg.ldb;
+            RocBLAS_TestName<trmm> name;
+
+            name << rocblas_datatype2string(arg.a_type) << '_' << (char)std::toupper(arg.side)
+                 << (char)std::toupper(arg.uplo) << (char)std::toupper(arg.transA)
+                 << (char)std::toupper(arg.diag) << '_' << arg.M << '_' << arg.N << '_'
+                 << arg.alpha << '_' << arg.lda;
+
+            if(strstr(arg.function, "_strided_batched") != nullptr)
+                name << '_' << arg.stride_a;
+
+            name << '_' << arg.ldb;
+
+            if(strstr(arg.function, "_strided_batched") != nullptr)
+                name << '_' << arg.stride_b;
+
+            if(strstr(arg.function, "_outofplace") != nullptr)
+                name << '_' << arg.ldc;
+
+            if(strstr(arg.function, "_batched") != nullptr)
+                name << '_' << arg.batch_count;
+
+            return std::move(name);
         }
     };
 
@@ -10,6 +10,8 @@
 #include "testing_trsm_batched.hpp"
 #include "testing_trsm_batched_ex.hpp"
 #include "testing_trsm_ex.hpp"
+#include "testing_trsm_refine.hpp"
+#include "testing_trsm_solve.hpp"
 #include "testing_trsm_strided_batched.hpp"
 #include "testing_trsm_strided_batched_ex.hpp"
 #include "type_dispatch.hpp"
@@ -28,6 +30,10 @@ namespace
         TRSM_BATCHED_EX,
         TRSM_STRIDED_BATCHED,
         TRSM_STRIDED_BATCHED_EX,
+        TRSM_SOLVE,
+        TRSM_SOLVE_BAD_ARG,
+        TRSM_REFINE,
+        TRSM_REFINE_BAD_ARG,
     };
 
     // trsm test template
@@ -57,6 +63,14 @@ namespace
                 return !strcmp(arg.function, "trsm_strided_batched");
             case TRSM_STRIDED_BATCHED_EX:
                 return !strcmp(arg.function, "trsm_strided_batched_ex");
+            case TRSM_SOLVE:
+                return !strcmp(arg.function, "trsm_solve");
+            case TRSM_SOLVE_BAD_ARG:
+                return !strcmp(arg.function, "trsm_solve_bad_arg");
+            case TRSM_REFINE:
+                return !strcmp(arg.function, "trsm_refine");
+            case TRSM_REFINE_BAD_ARG:
+                return !strcmp(arg.function, "trsm_refine_bad_arg");
             }
             return false;
         }
@@ -115,6 +129,31 @@ namespace
                 testing_trsm_strided_batched<T>(arg);
             else if(!strcmp(arg.function, "trsm_strided_batched_ex"))
                 testing_trsm_strided_batched_ex<T>(arg);
+            else if(!strcmp(arg.function, "trsm_solve"))
+                testing_trsm_solve<T>(arg);
+            else if(!strcmp(arg.function, "trsm_solve_bad_arg"))
+                testing_trsm_solve_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    // Mixed precision refinement is only provided for double
+    template <typename, typename = void>
+    struct trsm_refine_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct trsm_refine_testing<T, typename std::enable_if<std::is_same<T, double>{}>::type>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "trsm_refine"))
+                testing_trsm_refine<T>(arg);
+            else if(!strcmp(arg.function, "trsm_refine_bad_arg"))
+                testing_trsm_refine_bad_arg<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -162,4 +201,32 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(trsm_strided_batched_ex);
 
+    using trsm_solve = trsm_template<trsm_testing, TRSM_SOLVE>;
+    TEST_P(trsm_solve, blas3)
+    {
+        rocblas_simple_dispatch<trsm_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsm_solve);
+
+    using trsm_solve_bad_arg = trsm_template<trsm_testing, TRSM_SOLVE_BAD_ARG>;
+    TEST_P(trsm_solve_bad_arg, blas3)
+    {
+        rocblas_simple_dispatch<trsm_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsm_solve_bad_arg);
+
+    using trsm_refine = trsm_template<trsm_refine_testing, TRSM_REFINE>;
+    TEST_P(trsm_refine, blas3)
+    {
+        rocblas_simple_dispatch<trsm_refine_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsm_refine);
+
+    using trsm_refine_bad_arg = trsm_template<trsm_refine_testing, TRSM_REFINE_BAD_ARG>;
+    TEST_P(trsm_refine_bad_arg, blas3)
+    {
+        rocblas_simple_dispatch<trsm_refine_testing>(GetParam());
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsm_refine_bad_arg);
+
 } // namespace
@@ -750,7 +750,8 @@ inline void cblas_trmv(rocblas_fill      uplo,
 }
 
 // symv
-template <typename T>
+// HERM selects hemv instead of symv
+template <typename T, bool HERM = false>
 void cblas_symv(rocblas_fill uplo,
                 rocblas_int  n,
                 T            alpha,
@@ -792,6 +793,330 @@ inline void cblas_symv(rocblas_fill uplo,
     cblas_dsymv(CblasColMajor, CBLAS_UPLO(uplo), n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+template <>
+inline void cblas_symv<rocblas_float_complex, true>(rocblas_fill           uplo,
+                                                    rocblas_int            n,
+                                                    rocblas_float_complex  alpha,
+                                                    rocblas_float_complex* A,
+                                                    rocblas_int            lda,
+                                                    rocblas_float_complex* x,
+                                                    rocblas_int            incx,
+                                                    rocblas_float_complex  beta,
+                                                    rocblas_float_complex* y,
+                                                    rocblas_int            incy)
+{
+    cblas_chemv(CblasColMajor, CBLAS_UPLO(uplo), n, &alpha, A, lda, x, incx, &beta, y, incy);
+}
+
+template <>
+inline void cblas_symv<rocblas_double_complex, true>(rocblas_fill            uplo,
+                                                     rocblas_int             n,
+                                                     rocblas_double_complex  alpha,
+                                                     rocblas_double_complex* A,
+                                                     rocblas_int             lda,
+                                                     rocblas_double_complex* x,
+                                                     rocblas_int             incx,
+                                                     rocblas_double_complex  beta,
+                                                     rocblas_double_complex* y,
+                                                     rocblas_int             incy)
+{
+    cblas_zhemv(CblasColMajor, CBLAS_UPLO(uplo), n, &alpha, A, lda, x, incx, &beta, y, incy);
+}
+
+// gbmv
+template <typename T>
+void cblas_gbmv(rocblas_operation transA,
+                rocblas_int       m,
+                rocblas_int       n,
+                rocblas_int       kl,
+                rocblas_int       ku,
+                T                 alpha,
+                const T*          A,
+                rocblas_int       lda,
+                const T*          x,
+                rocblas_int       incx,
+                T                 beta,
+                T*                y,
+                rocblas_int       incy);
+
+template <>
+inline void cblas_gbmv(rocblas_operation transA,
+                       rocblas_int       m,
+                       rocblas_int       n,
+                       rocblas_int       kl,
+                       rocblas_int       ku,
+                       float             alpha,
+                       const float*      A,
+                       rocblas_int       lda,
+                       const float*      x,
+                       rocblas_int       incx,
+                       float             beta,
+                       float*            y,
+                       rocblas_int       incy)
+{
+    cblas_sgbmv(CblasColMajor,
+                CBLAS_TRANSPOSE(transA),
+                m,
+                n,
+                kl,
+                ku,
+                alpha,
+                A,
+                lda,
+                x,
+                incx,
+                beta,
+                y,
+                incy);
+}
+
+template <>
+inline void cblas_gbmv(rocblas_operation transA,
+                       rocblas_int       m,
+                       rocblas_int       n,
+                       rocblas_int       kl,
+                       rocblas_int       ku,
+                       double            alpha,
+                       const double*     A,
+                       rocblas_int       lda,
+                       const double*     x,
+                       rocblas_int       incx,
+                       double            beta,
+                       double*           y,
+                       rocblas_int       incy)
+{
+    cblas_dgbmv(CblasColMajor,
+                CBLAS_TRANSPOSE(transA),
+                m,
+                n,
+                kl,
+                ku,
+                alpha,
+                A,
+                lda,
+                x,
+                incx,
+                beta,
+                y,
+                incy);
+}
+
+// sbmv
+template <typename T>
+void cblas_sbmv(rocblas_fill uplo,
+                rocblas_int  n,
+                rocblas_int  k,
+                T            alpha,
+                const T*     A,
+                rocblas_int  lda,
+                const T*     x,
+                rocblas_int  incx,
+                T            beta,
+                T*           y,
+                rocblas_int  incy);
+
+template <>
+inline void cblas_sbmv(rocblas_fill uplo,
+                       rocblas_int  n,
+                       rocblas_int  k,
+                       float        alpha,
+                       const float* A,
+                       rocblas_int  lda,
+                       const float* x,
+                       rocblas_int  incx,
+                       float        beta,
+                       float*       y,
+                       rocblas_int  incy)
+{
+    cblas_ssbmv(CblasColMajor, CBLAS_UPLO(uplo), n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+inline void cblas_sbmv(rocblas_fill  uplo,
+                       rocblas_int   n,
+                       rocblas_int   k,
+                       double        alpha,
+                       const double* A,
+                       rocblas_int   lda,
+                       const double* x,
+                       rocblas_int   incx,
+                       double        beta,
+                       double*       y,
+                       rocblas_int   incy)
+{
+    cblas_dsbmv(CblasColMajor, CBLAS_UPLO(uplo), n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+// spmv
+template <typename T>
+void cblas_spmv(rocblas_fill uplo,
+                rocblas_int  n,
+                T            alpha,
+                const T*     AP,
+                const T*     x,
+                rocblas_int  incx,
+                T            beta,
+                T*           y,
+                rocblas_int  incy);
+
+template <>
+inline void cblas_spmv(rocblas_fill uplo,
+                       rocblas_int  n,
+                       float        alpha,
+                       const float* AP,
+                       const float* x,
+                       rocblas_int  incx,
+                       float        beta,
+                       float*       y,
+                       rocblas_int  incy)
+{
+    cblas_sspmv(CblasColMajor, CBLAS_UPLO(uplo), n, alpha, AP, x, incx, beta, y, incy);
+}
+
+template <>
+inline void cblas_spmv(rocblas_fill  uplo,
+                       rocblas_int   n,
+                       double        alpha,
+                       const double* AP,
+                       const double* x,
+                       rocblas_int   incx,
+                       double        beta,
+                       double*       y,
+                       rocblas_int   incy)
+{
+    cblas_dspmv(CblasColMajor, CBLAS_UPLO(uplo), n, alpha, AP, x, incx, beta, y, incy);
+}
+
+// tbmv
+template <typename T>
+void cblas_tbmv(rocblas_fill      uplo,
+                rocblas_operation transA,
+                rocblas_diagonal  diag,
+                rocblas_int       n,
+                rocblas_int       k,
+                const T*          A,
+                rocblas_int       lda,
+                T*                x,
+                rocblas_int       incx);
+
+template <>
+inline void cblas_tbmv(rocblas_fill      uplo,
+                       rocblas_operation transA,
+                       rocblas_diagonal  diag,
+                       rocblas_int       n,
+                       rocblas_int       k,
+                       const float*      A,
+                       rocblas_int       lda,
+                       float*            x,
+                       rocblas_int       incx)
+{
+    cblas_stbmv(CblasColMajor,
+                CBLAS_UPLO(uplo),
+                CBLAS_TRANSPOSE(transA),
+                CBLAS_DIAG(diag),
+                n,
+                k,
+                A,
+                lda,
+                x,
+                incx);
+}
+
+template <>
+inline void cblas_tbmv(rocblas_fill      uplo,
+                       rocblas_operation transA,
+                       rocblas_diagonal  diag,
+                       rocblas_int       n,
+                       rocblas_int       k,
+                       const double*     A,
+                       rocblas_int       lda,
+                       double*           x,
+                       rocblas_int       incx)
+{
+    cblas_dtbmv(CblasColMajor,
+                CBLAS_UPLO(uplo),
+                CBLAS_TRANSPOSE(transA),
+                CBLAS_DIAG(diag),
+                n,
+                k,
+                A,
+                lda,
+                x,
+                incx);
+}
+
+// tpmv
+template <typename T>
+void cblas_tpmv(rocblas_fill      uplo,
+                rocblas_operation transA,
+                rocblas_diagonal  diag,
+                rocblas_int       n,
+                const T*          AP,
+                T*                x,
+                rocblas_int       incx);
+
+template <>
+inline void cblas_tpmv(rocblas_fill      uplo,
+                       rocblas_operation transA,
+                       rocblas_diagonal  diag,
+                       rocblas_int       n,
+                       const float*      AP,
+                       float*            x,
+                       rocblas_int       incx)
+{
+    cblas_stpmv(
+        CblasColMajor, CBLAS_UPLO(uplo), CBLAS_TRANSPOSE(transA), CBLAS_DIAG(diag), n, AP, x, incx);
+}
+
+template <>
+inline void cblas_tpmv(rocblas_fill      uplo,
+                       rocblas_operation transA,
+                       rocblas_diagonal  diag,
+                       rocblas_int       n,
+                       const double*     AP,
+                       double*           x,
+                       rocblas_int       incx)
+{
+    cblas_dtpmv(
+        CblasColMajor, CBLAS_UPLO(uplo), CBLAS_TRANSPOSE(transA), CBLAS_DIAG(diag), n, AP, x, incx);
+}
+
+// tpsv
+template <typename T>
+void cblas_tpsv(rocblas_fill      uplo,
+                rocblas_operation transA,
+                rocblas_diagonal  diag,
+                rocblas_int       n,
+                const T*          AP,
+                T*                x,
+                rocblas_int       incx);
+
+template <>
+inline void cblas_tpsv(rocblas_fill      uplo,
+                       rocblas_operation transA,
+                       rocblas_diagonal  diag,
+                       rocblas_int       n,
+                       const float*      AP,
+                       float*            x,
+                       rocblas_int       incx)
+{
+    cblas_stpsv(
+        CblasColMajor, CBLAS_UPLO(uplo), CBLAS_TRANSPOSE(transA), CBLAS_DIAG(diag), n, AP, x, incx);
+}
+
+template <>
+inline void cblas_tpsv(rocblas_fill      uplo,
+                       rocblas_operation transA,
+                       rocblas_diagonal  diag,
+                       rocblas_int       n,
+                       const double*     AP,
+                       double*           x,
+                       rocblas_int       incx)
+{
+    cblas_dtpsv(
+        CblasColMajor, CBLAS_UPLO(uplo), CBLAS_TRANSPOSE(transA), CBLAS_DIAG(diag), n, AP, x, incx);
+}
+
 // ger
 template <typename T>
 void cblas_ger(rocblas_int m,
@@ -833,9 +1158,10 @@ inline void cblas_ger(rocblas_int m,
 }
 
 // syr
-template <typename T>
+// A real U for a complex T selects her instead of syr
+template <typename T, typename U = T>
 void cblas_syr(
-    rocblas_fill uplo, rocblas_int n, T alpha, T* x, rocblas_int incx, T* A, rocblas_int lda);
+    rocblas_fill uplo, rocblas_int n, U alpha, T* x, rocblas_int incx, T* A, rocblas_int lda);
 
 template <>
 inline void cblas_syr(rocblas_fill uplo,
@@ -861,6 +1187,100 @@ inline void cblas_syr(rocblas_fill uplo,
     cblas_dsyr(CblasColMajor, CBLAS_UPLO(uplo), n, alpha, x, incx, A, lda);
 }
 
+// her
+template <>
+inline void cblas_syr(rocblas_fill           uplo,
+                      rocblas_int            n,
+                      float                  alpha,
+                      rocblas_float_complex* x,
+                      rocblas_int            incx,
+                      rocblas_float_complex* A,
+                      rocblas_int            lda)
+{
+    cblas_cher(CblasColMajor, CBLAS_UPLO(uplo), n, alpha, x, incx, A, lda);
+}
+
+template <>
+inline void cblas_syr(rocblas_fill            uplo,
+                      rocblas_int             n,
+                      double                  alpha,
+                      rocblas_double_complex* x,
+                      rocblas_int             incx,
+                      rocblas_double_complex* A,
+                      rocblas_int             lda)
+{
+    cblas_zher(CblasColMajor, CBLAS_UPLO(uplo), n, alpha, x, incx, A, lda);
+}
+
+// syr2
+// HERM selects her2 instead of syr2
+template <typename T, bool HERM = false>
+void cblas_syr2(rocblas_fill uplo,
+                rocblas_int  n,
+                T            alpha,
+                T*           x,
+                rocblas_int  incx,
+                T*           y,
+                rocblas_int  incy,
+                T*           A,
+                rocblas_int  lda);
+
+template <>
+inline void cblas_syr2(rocblas_fill uplo,
+                       rocblas_int  n,
+                       float        alpha,
+                       float*       x,
+                       rocblas_int  incx,
+                       float*       y,
+                       rocblas_int  incy,
+                       float*       A,
+                       rocblas_int  lda)
+{
+    cblas_ssyr2(CblasColMajor, CBLAS_UPLO(uplo), n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+inline void cblas_syr2(rocblas_fill uplo,
+                       rocblas_int  n,
+                       double       alpha,
+                       double*      x,
+                       rocblas_int  incx,
+                       double*      y,
+                       rocblas_int  incy,
+                       double*      A,
+                       rocblas_int  lda)
+{
+    cblas_dsyr2(CblasColMajor, CBLAS_UPLO(uplo), n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+inline void cblas_syr2<rocblas_float_complex, true>(rocblas_fill           uplo,
+                                                    rocblas_int            n,
+                                                    rocblas_float_complex  alpha,
+                                                    rocblas_float_complex* x,
+                                                    rocblas_int            incx,
+                                                    rocblas_float_complex* y,
+                                                    rocblas_int            incy,
+                                                    rocblas_float_complex* A,
+                                                    rocblas_int            lda)
+{
+    cblas_cher2(CblasColMajor, CBLAS_UPLO(uplo), n, &alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+inline void cblas_syr2<rocblas_double_complex, true>(rocblas_fill            uplo,
+                                                     rocblas_int             n,
+                                                     rocblas_double_complex  alpha,
+                                                     rocblas_double_complex* x,
+                                                     rocblas_int             incx,
+                                                     rocblas_double_complex* y,
+                                                     rocblas_int             incy,
+                                                     rocblas_double_complex* A,
+                                                     rocblas_int             lda)
+{
+    cblas_zher2(CblasColMajor, CBLAS_UPLO(uplo), n, &alpha, x, incx, y, incy, A, lda);
+}
+
 // hemv
 template <typename T>
 void cblas_hemv(rocblas_fill uplo,
@@ -1362,6 +1782,549 @@ inline void cblas_trmm(rocblas_side                  side,
                 ldb);
 }
 
+// syrk
+template <typename T, typename U = T>
+void cblas_syrk(rocblas_fill      uplo,
+                rocblas_operation transA,
+                rocblas_int       n,
+                rocblas_int       k,
+                U                 alpha,
+                const T*          A,
+                rocblas_int       lda,
+                U                 beta,
+                T*                C,
+                rocblas_int       ldc);
+
+template <>
+inline void cblas_syrk(rocblas_fill      uplo,
+                       rocblas_operation transA,
+                       rocblas_int       n,
+                       rocblas_int       k,
+                       float             alpha,
+                       const float*      A,
+                       rocblas_int       lda,
+                       float             beta,
+                       float*            C,
+                       rocblas_int       ldc)
+{
+    cblas_ssyrk(CblasColMajor,
+                CBLAS_UPLO(uplo),
+                CBLAS_TRANSPOSE(transA),
+                n,
+                k,
+                alpha,
+                A,
+                lda,
+                beta,
+                C,
+                ldc);
+}
+
+template <>
+inline void cblas_syrk(rocblas_fill      uplo,
+                       rocblas_operation transA,
+                       rocblas_int       n,
+                       rocblas_int       k,
+                       double            alpha,
+                       const double*     A,
+                       rocblas_int       lda,
+                       double            beta,
+                       double*           C,
+                       rocblas_int       ldc)
+{
+    cblas_dsyrk(CblasColMajor,
+                CBLAS_UPLO(uplo),
+                CBLAS_TRANSPOSE(transA),
+                n,
+                k,
+                alpha,
+                A,
+                lda,
+                beta,
+                C,
+                ldc);
+}
+
+template <>
+inline void cblas_syrk(rocblas_fill                 uplo,
+                       rocblas_operation            transA,
+                       rocblas_int                  n,
+                       rocblas_int                  k,
+                       rocblas_float_complex        alpha,
+                       const rocblas_float_complex* A,
+                       rocblas_int                  lda,
+                       rocblas_float_complex        beta,
+                       rocblas_float_complex*       C,
+                       rocblas_int                  ldc)
+{
+    cblas_csyrk(CblasColMajor,
+                CBLAS_UPLO(uplo),
+                CBLAS_TRANSPOSE(transA),
+                n,
+                k,
+                &alpha,
+                A,
+                lda,
+                &beta,
+                C,
+                ldc);
+}
+
+template <>
+inline void cblas_syrk(rocblas_fill                  uplo,
+                       rocblas_operation             transA,
+                       rocblas_int                   n,
+                       rocblas_int                   k,
+                       rocblas_double_complex        alpha,
+                       const rocblas_double_complex* A,
+                       rocblas_int                   lda,
+                       rocblas_double_complex        beta,
+                       rocblas_double_complex*       C,
+                       rocblas_int                   ldc)
+{
+    cblas_zsyrk(CblasColMajor,
+                CBLAS_UPLO(uplo),
+                CBLAS_TRANSPOSE(transA),
+                n,
+                k,
+                &alpha,
+                A,
+                lda,
+                &beta,
+                C,
+                ldc);
+}
+
+// herk
+template <>
+inline void cblas_syrk(rocblas_fill                 uplo,
+                       rocblas_operation            transA,
+                       rocblas_int                  n,
+                       rocblas_int                  k,
+                       float                        alpha,
+                       const rocblas_float_complex* A,
+                       rocblas_int                  lda,
+                       float                        beta,
+                       rocblas_float_complex*       C,
+                       rocblas_int                  ldc)
+{
+    cblas_cherk(CblasColMajor,
+                CBLAS_UPLO(uplo),
+                CBLAS_TRANSPOSE(transA),
+                n,
+                k,
+                alpha,
+                A,
+                lda,
+                beta,
+                C,
+                ldc);
+}
+
+template <>
+inline void cblas_syrk(rocblas_fill                  uplo,
+                       rocblas_operation             transA,
+                       rocblas_int                   n,
+                       rocblas_int                   k,
+                       double                        alpha,
+                       const rocblas_double_complex* A,
+                       rocblas_int                   lda,
+                       double                        beta,
+                       rocblas_double_complex*       C,
+                       rocblas_int                   ldc)
+{
+    cblas_zherk(CblasColMajor,
+                CBLAS_UPLO(uplo),
+                CBLAS_TRANSPOSE(transA),
+                n,
+                k,
+                alpha,
+                A,
+                lda,
+                beta,
+                C,
+                ldc);
+}
+
+// syr2k
+template <typename T, typename U = T>
+void cblas_syr2k(rocblas_fill      uplo,
+                 rocblas_operation transA,
+                 rocblas_int       n,
+                 rocblas_int       k,
+                 T                 alpha,
+                 const T*          A,
+                 rocblas_int       lda,
+                 const T*          B,
+                 rocblas_int       ldb,
+                 U                 beta,
+                 T*                C,
+                 rocblas_int       ldc);
+
+template <>
+inline void cblas_syr2k(rocblas_fill      uplo,
+                        rocblas_operation transA,
+                        rocblas_int       n,
+                        rocblas_int       k,
+                        float             alpha,
+                        const float*      A,
+                        rocblas_int       lda,
+                        const float*      B,
+                        rocblas_int       ldb,
+                        float             beta,
+                        float*            C,
+                        rocblas_int       ldc)
+{
+    cblas_ssyr2k(CblasColMajor,
+                 CBLAS_UPLO(uplo),
+                 CBLAS_TRANSPOSE(transA),
+                 n,
+                 k,
+                 alpha,
+                 A,
+                 lda,
+                 B,
+                 ldb,
+                 beta,
+                 C,
+                 ldc);
+}
+
+template <>
+inline void cblas_syr2k(rocblas_fill      uplo,
+                        rocblas_operation transA,
+                        rocblas_int       n,
+                        rocblas_int       k,
+                        double            alpha,
+                        const double*     A,
+                        rocblas_int       lda,
+                        const double*     B,
+                        rocblas_int       ldb,
+                        double            beta,
+                        double*           C,
+                        rocblas_int       ldc)
+{
+    cblas_dsyr2k(CblasColMajor,
+                 CBLAS_UPLO(uplo),
+                 CBLAS_TRANSPOSE(transA),
+                 n,
+                 k,
+                 alpha,
+                 A,
+                 lda,
+                 B,
+                 ldb,
+                 beta,
+                 C,
+                 ldc);
+}
+
+template <>
+inline void cblas_syr2k(rocblas_fill                 uplo,
+                        rocblas_operation            transA,
+                        rocblas_int                  n,
+                        rocblas_int                  k,
+                        rocblas_float_complex        alpha,
+                        const rocblas_float_complex* A,
+                        rocblas_int                  lda,
+                        const rocblas_float_complex* B,
+                        rocblas_int                  ldb,
+                        rocblas_float_complex        beta,
+                        rocblas_float_complex*       C,
+                        rocblas_int                  ldc)
+{
+    cblas_csyr2k(CblasColMajor,
+                 CBLAS_UPLO(uplo),
+                 CBLAS_TRANSPOSE(transA),
+                 n,
+                 k,
+                 &alpha,
+                 A,
+                 lda,
+                 B,
+                 ldb,
+                 &beta,
+                 C,
+                 ldc);
+}
+
+template <>
+inline void cblas_syr2k(rocblas_fill                  uplo,
+                        rocblas_operation             transA,
+                        rocblas_int                   n,
+                        rocblas_int                   k,
+                        rocblas_double_complex        alpha,
+                        const rocblas_double_complex* A,
+                        rocblas_int                   lda,
+                        const rocblas_double_complex* B,
+                        rocblas_int                   ldb,
+                        rocblas_double_complex        beta,
+                        rocblas_double_complex*       C,
+                        rocblas_int                   ldc)
+{
+    cblas_zsyr2k(CblasColMajor,
+                 CBLAS_UPLO(uplo),
+                 CBLAS_TRANSPOSE(transA),
+                 n,
+                 k,
+                 &alpha,
+                 A,
+                 lda,
+                 B,
+                 ldb,
+                 &beta,
+                 C,
+                 ldc);
+}
+
+// her2k
+template <>
+inline void cblas_syr2k(rocblas_fill                 uplo,
+                        rocblas_operation            transA,
+                        rocblas_int                  n,
+                        rocblas_int                  k,
+                        rocblas_float_complex        alpha,
+                        const rocblas_float_complex* A,
+                        rocblas_int                  lda,
+                        const rocblas_float_complex* B,
+                        rocblas_int                  ldb,
+                        float                        beta,
+                        rocblas_float_complex*       C,
+                        rocblas_int                  ldc)
+{
+    cblas_cher2k(CblasColMajor,
+                 CBLAS_UPLO(uplo),
+                 CBLAS_TRANSPOSE(transA),
+                 n,
+                 k,
+                 &alpha,
+                 A,
+                 lda,
+                 B,
+                 ldb,
+                 beta,
+                 C,
+                 ldc);
+}
+
+template <>
+inline void cblas_syr2k(rocblas_fill                  uplo,
+                        rocblas_operation             transA,
+                        rocblas_int                   n,
+                        rocblas_int                   k,
+                        rocblas_double_complex        alpha,
+                        const rocblas_double_complex* A,
+                        rocblas_int                   lda,
+                        const rocblas_double_complex* B,
+                        rocblas_int                   ldb,
+                        double                        beta,
+                        rocblas_double_complex*       C,
+                        rocblas_int                   ldc)
+{
+    cblas_zher2k(CblasColMajor,
+                 CBLAS_UPLO(uplo),
+                 CBLAS_TRANSPOSE(transA),
+                 n,
+                 k,
+                 &alpha,
+                 A,
+                 lda,
+                 B,
+                 ldb,
+                 beta,
+                 C,
+                 ldc);
+}
+
+// symm and hemm
+template <typename T, bool HERM = false>
+void cblas_symm(rocblas_side side,
+                rocblas_fill uplo,
+                rocblas_int  m,
+                rocblas_int  n,
+                T            alpha,
+                const T*     A,
+                rocblas_int  lda,
+                const T*     B,
+                rocblas_int  ldb,
+                T            beta,
+                T*           C,
+                rocblas_int  ldc);
+
+template <>
+inline void cblas_symm<float>(rocblas_side side,
+                              rocblas_fill uplo,
+                              rocblas_int  m,
+                              rocblas_int  n,
+                              float        alpha,
+                              const float* A,
+                              rocblas_int  lda,
+                              const float* B,
+                              rocblas_int  ldb,
+                              float        beta,
+                              float*       C,
+                              rocblas_int  ldc)
+{
+    cblas_ssymm(CblasColMajor,
+                CBLAS_SIDE(side),
+                CBLAS_UPLO(uplo),
+                m,
+                n,
+                alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                beta,
+                C,
+                ldc);
+}
+
+template <>
+inline void cblas_symm<double>(rocblas_side  side,
+                               rocblas_fill  uplo,
+                               rocblas_int   m,
+                               rocblas_int   n,
+                               double        alpha,
+                               const double* A,
+                               rocblas_int   lda,
+                               const double* B,
+                               rocblas_int   ldb,
+                               double        beta,
+                               double*       C,
+                               rocblas_int   ldc)
+{
+    cblas_dsymm(CblasColMajor,
+                CBLAS_SIDE(side),
+                CBLAS_UPLO(uplo),
+                m,
+                n,
+                alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                beta,
+                C,
+                ldc);
+}
+
+template <>
+inline void cblas_symm<rocblas_float_complex>(rocblas_side                 side,
+                                              rocblas_fill                 uplo,
+                                              rocblas_int                  m,
+                                              rocblas_int                  n,
+                                              rocblas_float_complex        alpha,
+                                              const rocblas_float_complex* A,
+                                              rocblas_int                  lda,
+                                              const rocblas_float_complex* B,
+                                              rocblas_int                  ldb,
+                                              rocblas_float_complex        beta,
+                                              rocblas_float_complex*       C,
+                                              rocblas_int                  ldc)
+{
+    cblas_csymm(CblasColMajor,
+                CBLAS_SIDE(side),
+                CBLAS_UPLO(uplo),
+                m,
+                n,
+                &alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                &beta,
+                C,
+                ldc);
+}
+
+template <>
+inline void cblas_symm<rocblas_double_complex>(rocblas_side                  side,
+                                               rocblas_fill                  uplo,
+                                               rocblas_int                   m,
+                                               rocblas_int                   n,
+                                               rocblas_double_complex        alpha,
+                                               const rocblas_double_complex* A,
+                                               rocblas_int                   lda,
+                                               const rocblas_double_complex* B,
+                                               rocblas_int                   ldb,
+                                               rocblas_double_complex        beta,
+                                               rocblas_double_complex*       C,
+                                               rocblas_int                   ldc)
+{
+    cblas_zsymm(CblasColMajor,
+                CBLAS_SIDE(side),
+                CBLAS_UPLO(uplo),
+                m,
+                n,
+                &alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                &beta,
+                C,
+                ldc);
+}
+
+// hemm
+template <>
+inline void cblas_symm<rocblas_float_complex, true>(rocblas_side                 side,
+                                                    rocblas_fill                 uplo,
+                                                    rocblas_int                  m,
+                                                    rocblas_int                  n,
+                                                    rocblas_float_complex        alpha,
+                                                    const rocblas_float_complex* A,
+                                                    rocblas_int                  lda,
+                                                    const rocblas_float_complex* B,
+                                                    rocblas_int                  ldb,
+                                                    rocblas_float_complex        beta,
+                                                    rocblas_float_complex*       C,
+                                                    rocblas_int                  ldc)
+{
+    cblas_chemm(CblasColMajor,
+                CBLAS_SIDE(side),
+                CBLAS_UPLO(uplo),
+                m,
+                n,
+                &alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                &beta,
+                C,
+                ldc);
+}
+
+template <>
+inline void cblas_symm<rocblas_double_complex, true>(rocblas_side                  side,
+                                                     rocblas_fill                  uplo,
+                                                     rocblas_int                   m,
+                                                     rocblas_int                   n,
+                                                     rocblas_double_complex        alpha,
+                                                     const rocblas_double_complex* A,
+                                                     rocblas_int                   lda,
+                                                     const rocblas_double_complex* B,
+                                                     rocblas_int                   ldb,
+                                                     rocblas_double_complex        beta,
+                                                     rocblas_double_complex*       C,
+                                                     rocblas_int                   ldc)
+{
+    cblas_zhemm(CblasColMajor,
+                CBLAS_SIDE(side),
+                CBLAS_UPLO(uplo),
+                m,
+                n,
+                &alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                &beta,
+                C,
+                ldc);
+}
 // getrf
 template <typename T>
 rocblas_int cblas_getrf(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, rocblas_int* ipiv);
@@ -135,11 +135,74 @@ constexpr double ger_gflop_count(rocblas_int m, rocblas_int n)
     return (2.0 * m * n + min) / 1e9;
 }
 
-/* \brief floating point counts of SYR */
+/* \brief floating point counts of GBMV */
+template <typename T>
+constexpr double gbmv_gflop_count(
+    rocblas_operation transA, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku)
+{
+    rocblas_int rows = transA == rocblas_operation_none ? m : n;
+    rocblas_int cols = transA == rocblas_operation_none ? n : m;
+    rocblas_int nnz  = 0;
+    for(rocblas_int j = 0; j < cols; j++)
+    {
+        rocblas_int lo = transA == rocblas_operation_none ? j - ku : j - kl;
+        rocblas_int hi = transA == rocblas_operation_none ? j + kl : j + ku;
+        lo             = lo < 0 ? 0 : lo;
+        hi             = hi > rows - 1 ? rows - 1 : hi;
+        nnz += hi >= lo ? hi - lo + 1 : 0;
+    }
+    return (2.0 * nnz + 2.0 * rows) / 1e9;
+}
+
+/* \brief floating point counts of SBMV */
+template <typename T>
+constexpr double sbmv_gflop_count(rocblas_int n, rocblas_int k)
+{
+    rocblas_int kk = k < n ? k : (n > 0 ? n - 1 : 0);
+    return (2.0 * (n * (2.0 * kk + 1) - kk * (kk + 1.0)) + 2.0 * n) / 1e9;
+}
+
+/* \brief floating point counts of SPMV */
+template <typename T>
+constexpr double spmv_gflop_count(rocblas_int n)
+{
+    return symv_gflop_count<T>(n);
+}
+
+/* \brief floating point counts of TBMV */
+template <typename T>
+constexpr double tbmv_gflop_count(rocblas_int n, rocblas_int k)
+{
+    rocblas_int kk = k < n ? k : (n > 0 ? n - 1 : 0);
+    return (2.0 * (n * (kk + 1.0) - kk * (kk + 1.0) / 2)) / 1e9;
+}
+
+/* \brief floating point counts of TPMV */
+template <typename T>
+constexpr double tpmv_gflop_count(rocblas_int n)
+{
+    return (1.0 * n * (n + 1)) / 1e9;
+}
+
+/* \brief floating point counts of TPSV */
+template <typename T>
+constexpr double tpsv_gflop_count(rocblas_int n)
+{
+    return trsv_gflop_count<T>(n);
+}
+
+/* \brief floating point counts of SYR and HER */
 template <typename T>
 constexpr double syr_gflop_count(rocblas_int n)
 {
-    return (n * (n + 1) + n) / 1e9;
+    return (is_complex<T> ? 4.0 : 1.0) * (n * (n + 1.0) + n) / 1e9;
+}
+
+/* \brief floating point counts of SYR2 and HER2 */
+template <typename T>
+constexpr double syr2_gflop_count(rocblas_int n)
+{
+    return (is_complex<T> ? 4.0 : 1.0) * (2.0 * n * (n + 1) + n) / 1e9;
 }
 
 /*
@@ -169,6 +232,28 @@ constexpr double
     return (8.0 * m * n * k) / 1e9;
 }
 
+/* \brief floating point counts of SYRK and HERK */
+template <typename T>
+constexpr double syrk_gflop_count(rocblas_int n, rocblas_int k)
+{
+    return (is_complex<T> ? 4.0 : 1.0) * n * (n + 1.0) * k / 1e9;
+}
+
+/* \brief floating point counts of SYR2K and HER2K */
+template <typename T>
+constexpr double syr2k_gflop_count(rocblas_int n, rocblas_int k)
+{
+    return 2 * syrk_gflop_count<T>(n, k);
+}
+
+/* \brief floating point counts of SYMM and HEMM */
+template <typename T>
+constexpr double symm_gflop_count(rocblas_side side, rocblas_int m, rocblas_int n)
+{
+    rocblas_int k = side == rocblas_side_left ? m : n;
+    return gemm_gflop_count<T>(m, n, k);
+}
+
 /* \brief floating point counts of GEAM */
 template <typename T>
 constexpr double geam_gflop_count(rocblas_int m, rocblas_int n)
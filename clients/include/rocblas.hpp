@@ -1070,12 +1070,43 @@ static constexpr auto rocblas_ger_strided_batched<float> = rocblas_sger_strided_
 template <>
 static constexpr auto rocblas_ger_strided_batched<double> = rocblas_dger_strided_batched;
 
-// syr
+// ger_accumulator
+template <typename T>
+rocblas_status (*rocblas_ger_accumulator_create)(rocblas_handle           handle,
+                                                 rocblas_int              m,
+                                                 rocblas_int              n,
+                                                 T*                       A,
+                                                 rocblas_int              lda,
+                                                 rocblas_int              max_k,
+                                                 rocblas_ger_accumulator* acc);
+
+template <>
+static constexpr auto rocblas_ger_accumulator_create<float> = rocblas_sger_accumulator_create;
+
+template <>
+static constexpr auto rocblas_ger_accumulator_create<double> = rocblas_dger_accumulator_create;
+
 template <typename T>
+rocblas_status (*rocblas_ger_accumulate)(rocblas_handle          handle,
+                                         rocblas_ger_accumulator acc,
+                                         const T*                alpha,
+                                         const T*                x,
+                                         rocblas_int             incx,
+                                         const T*                y,
+                                         rocblas_int             incy);
+
+template <>
+static constexpr auto rocblas_ger_accumulate<float> = rocblas_sger_accumulate;
+
+template <>
+static constexpr auto rocblas_ger_accumulate<double> = rocblas_dger_accumulate;
+
+// syr
+template <typename T, typename U = T>
 rocblas_status (*rocblas_syr)(rocblas_handle handle,
                               rocblas_fill   uplo,
                               rocblas_int    n,
-                              const T*       alpha,
+                              const U*       alpha,
                               const T*       x,
                               rocblas_int    incx,
                               T*             A,
@@ -1087,12 +1118,18 @@ static constexpr auto rocblas_syr<float> = rocblas_ssyr;
 template <>
 static constexpr auto rocblas_syr<double> = rocblas_dsyr;
 
+template <>
+static constexpr auto rocblas_syr<rocblas_float_complex, float> = rocblas_cher;
+
+template <>
+static constexpr auto rocblas_syr<rocblas_double_complex, double> = rocblas_zher;
+
 // syr strided batched
-template <typename T>
+template <typename T, typename U = T>
 rocblas_status (*rocblas_syr_strided_batched)(rocblas_handle handle,
                                               rocblas_fill   uplo,
                                               rocblas_int    n,
-                                              const T*       alpha,
+                                              const U*       alpha,
                                               const T*       x,
                                               rocblas_int    incx,
                                               rocblas_stride stridex,
@@ -1107,12 +1144,20 @@ static constexpr auto rocblas_syr_strided_batched<float> = rocblas_ssyr_strided_
 template <>
 static constexpr auto rocblas_syr_strided_batched<double> = rocblas_dsyr_strided_batched;
 
+template <>
+static constexpr auto
+    rocblas_syr_strided_batched<rocblas_float_complex, float> = rocblas_cher_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_syr_strided_batched<rocblas_double_complex, double> = rocblas_zher_strided_batched;
+
 // syr batched
-template <typename T>
+template <typename T, typename U = T>
 rocblas_status (*rocblas_syr_batched)(rocblas_handle handle,
                                       rocblas_fill   uplo,
                                       rocblas_int    n,
-                                      const T*       alpha,
+                                      const U*       alpha,
                                       const T* const x[],
                                       rocblas_int    incx,
                                       T*             A[],
@@ -1125,6 +1170,94 @@ static constexpr auto rocblas_syr_batched<float> = rocblas_ssyr_batched;
 template <>
 static constexpr auto rocblas_syr_batched<double> = rocblas_dsyr_batched;
 
+template <>
+static constexpr auto rocblas_syr_batched<rocblas_float_complex, float> = rocblas_cher_batched;
+
+template <>
+static constexpr auto rocblas_syr_batched<rocblas_double_complex, double> = rocblas_zher_batched;
+
+// syr2
+template <typename T, bool HERM = false>
+rocblas_status (*rocblas_syr2)(rocblas_handle handle,
+                               rocblas_fill   uplo,
+                               rocblas_int    n,
+                               const T*       alpha,
+                               const T*       x,
+                               rocblas_int    incx,
+                               const T*       y,
+                               rocblas_int    incy,
+                               T*             A,
+                               rocblas_int    lda);
+
+template <>
+static constexpr auto rocblas_syr2<float> = rocblas_ssyr2;
+
+template <>
+static constexpr auto rocblas_syr2<double> = rocblas_dsyr2;
+
+template <>
+static constexpr auto rocblas_syr2<rocblas_float_complex, true> = rocblas_cher2;
+
+template <>
+static constexpr auto rocblas_syr2<rocblas_double_complex, true> = rocblas_zher2;
+
+// syr2_batched
+template <typename T, bool HERM = false>
+rocblas_status (*rocblas_syr2_batched)(rocblas_handle handle,
+                                       rocblas_fill   uplo,
+                                       rocblas_int    n,
+                                       const T*       alpha,
+                                       const T* const x[],
+                                       rocblas_int    incx,
+                                       const T* const y[],
+                                       rocblas_int    incy,
+                                       T* const       A[],
+                                       rocblas_int    lda,
+                                       rocblas_int    batch_count);
+
+template <>
+static constexpr auto rocblas_syr2_batched<float> = rocblas_ssyr2_batched;
+
+template <>
+static constexpr auto rocblas_syr2_batched<double> = rocblas_dsyr2_batched;
+
+template <>
+static constexpr auto rocblas_syr2_batched<rocblas_float_complex, true> = rocblas_cher2_batched;
+
+template <>
+static constexpr auto rocblas_syr2_batched<rocblas_double_complex, true> = rocblas_zher2_batched;
+
+// syr2_strided_batched
+template <typename T, bool HERM = false>
+rocblas_status (*rocblas_syr2_strided_batched)(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               const T*       alpha,
+                                               const T*       x,
+                                               rocblas_int    incx,
+                                               rocblas_stride stridex,
+                                               const T*       y,
+                                               rocblas_int    incy,
+                                               rocblas_stride stridey,
+                                               T*             A,
+                                               rocblas_int    lda,
+                                               rocblas_stride strideA,
+                                               rocblas_int    batch_count);
+
+template <>
+static constexpr auto rocblas_syr2_strided_batched<float> = rocblas_ssyr2_strided_batched;
+
+template <>
+static constexpr auto rocblas_syr2_strided_batched<double> = rocblas_dsyr2_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_syr2_strided_batched<rocblas_float_complex, true> = rocblas_cher2_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_syr2_strided_batched<rocblas_double_complex, true> = rocblas_zher2_strided_batched;
+
 // gemv
 template <typename T>
 rocblas_status (*rocblas_gemv)(rocblas_handle    handle,
@@ -1213,6 +1346,74 @@ static constexpr auto rocblas_gemv_batched<rocblas_float_complex> = rocblas_cgem
 template <>
 static constexpr auto rocblas_gemv_batched<rocblas_double_complex> = rocblas_zgemv_batched;
 
+// gemv_multi
+template <typename T>
+rocblas_status (*rocblas_gemv_multi)(rocblas_handle    handle,
+                                     rocblas_operation transA,
+                                     rocblas_int       m,
+                                     rocblas_int       n,
+                                     rocblas_int       k,
+                                     const T*          alpha,
+                                     const T*          A,
+                                     rocblas_int       lda,
+                                     const T*          x,
+                                     rocblas_int       incx,
+                                     rocblas_int       ldx,
+                                     const T*          beta,
+                                     T*                y,
+                                     rocblas_int       incy,
+                                     rocblas_int       ldy);
+
+template <>
+static constexpr auto rocblas_gemv_multi<float> = rocblas_sgemv_multi;
+
+template <>
+static constexpr auto rocblas_gemv_multi<double> = rocblas_dgemv_multi;
+
+template <>
+static constexpr auto rocblas_gemv_multi<rocblas_float_complex> = rocblas_cgemv_multi;
+
+template <>
+static constexpr auto rocblas_gemv_multi<rocblas_double_complex> = rocblas_zgemv_multi;
+
+// gemv_multi_strided_batched
+template <typename T>
+rocblas_status (*rocblas_gemv_multi_strided_batched)(rocblas_handle    handle,
+                                                     rocblas_operation transA,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     rocblas_int       k,
+                                                     const T*          alpha,
+                                                     const T*          A,
+                                                     rocblas_int       lda,
+                                                     rocblas_stride    stride_a,
+                                                     const T*          x,
+                                                     rocblas_int       incx,
+                                                     rocblas_int       ldx,
+                                                     rocblas_stride    stride_x,
+                                                     const T*          beta,
+                                                     T*                y,
+                                                     rocblas_int       incy,
+                                                     rocblas_int       ldy,
+                                                     rocblas_stride    stride_y,
+                                                     rocblas_int       batch_count);
+
+template <>
+static constexpr auto
+    rocblas_gemv_multi_strided_batched<float> = rocblas_sgemv_multi_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_gemv_multi_strided_batched<double> = rocblas_dgemv_multi_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_gemv_multi_strided_batched<rocblas_float_complex> = rocblas_cgemv_multi_strided_batched;
+
+template <>
+static constexpr auto rocblas_gemv_multi_strided_batched<rocblas_double_complex> =
+    rocblas_zgemv_multi_strided_batched;
+
 // trsv
 template <typename T>
 rocblas_status (*rocblas_trsv)(rocblas_handle    handle,
@@ -1272,7 +1473,7 @@ template <>
 static constexpr auto rocblas_trsv_strided_batched<double> = rocblas_dtrsv_strided_batched;
 
 // symv
-template <typename T>
+template <typename T, bool HERM = false>
 rocblas_status (*rocblas_symv)(rocblas_handle handle,
                                rocblas_fill   uplo,
                                rocblas_int    n,
@@ -1285,155 +1486,950 @@ rocblas_status (*rocblas_symv)(rocblas_handle handle,
                                T*             y,
                                rocblas_int    incy);
 
-/* not implemented
 template <>
 static constexpr auto rocblas_symv<float> = rocblas_ssymv;
 
 template <>
 static constexpr auto rocblas_symv<double> = rocblas_dsymv;
-*/
 
-/*
- * ===========================================================================
- *    level 3 BLAS
- * ===========================================================================
- */
+template <>
+static constexpr auto rocblas_symv<rocblas_float_complex, true> = rocblas_chemv;
 
-// geam
-template <typename T>
-rocblas_status (*rocblas_geam)(rocblas_handle    handle,
-                               rocblas_operation transA,
-                               rocblas_operation transB,
-                               rocblas_int       m,
-                               rocblas_int       n,
-                               const T*          alpha,
-                               const T*          A,
-                               rocblas_int       lda,
-                               const T*          beta,
-                               const T*          B,
-                               rocblas_int       ldb,
-                               T*                C,
-                               rocblas_int       ldc);
+template <>
+static constexpr auto rocblas_symv<rocblas_double_complex, true> = rocblas_zhemv;
+
+// symv_batched
+template <typename T, bool HERM = false>
+rocblas_status (*rocblas_symv_batched)(rocblas_handle handle,
+                                       rocblas_fill   uplo,
+                                       rocblas_int    n,
+                                       const T*       alpha,
+                                       const T* const A[],
+                                       rocblas_int    lda,
+                                       const T* const x[],
+                                       rocblas_int    incx,
+                                       const T*       beta,
+                                       T* const       y[],
+                                       rocblas_int    incy,
+                                       rocblas_int    batch_count);
 
 template <>
-static constexpr auto rocblas_geam<float> = rocblas_sgeam;
+static constexpr auto rocblas_symv_batched<float> = rocblas_ssymv_batched;
 
 template <>
-static constexpr auto rocblas_geam<double> = rocblas_dgeam;
+static constexpr auto rocblas_symv_batched<double> = rocblas_dsymv_batched;
 
-// gemm
+template <>
+static constexpr auto rocblas_symv_batched<rocblas_float_complex, true> = rocblas_chemv_batched;
+
+template <>
+static constexpr auto rocblas_symv_batched<rocblas_double_complex, true> = rocblas_zhemv_batched;
+
+// symv_strided_batched
+template <typename T, bool HERM = false>
+rocblas_status (*rocblas_symv_strided_batched)(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               const T*       alpha,
+                                               const T*       A,
+                                               rocblas_int    lda,
+                                               rocblas_stride stride_A,
+                                               const T*       x,
+                                               rocblas_int    incx,
+                                               rocblas_stride stride_x,
+                                               const T*       beta,
+                                               T*             y,
+                                               rocblas_int    incy,
+                                               rocblas_stride stride_y,
+                                               rocblas_int    batch_count);
+
+template <>
+static constexpr auto rocblas_symv_strided_batched<float> = rocblas_ssymv_strided_batched;
+
+template <>
+static constexpr auto rocblas_symv_strided_batched<double> = rocblas_dsymv_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_symv_strided_batched<rocblas_float_complex, true> = rocblas_chemv_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_symv_strided_batched<rocblas_double_complex, true> = rocblas_zhemv_strided_batched;
+
+// gbmv
 template <typename T>
-rocblas_status (*rocblas_gemm)(rocblas_handle    handle,
+rocblas_status (*rocblas_gbmv)(rocblas_handle    handle,
                                rocblas_operation transA,
-                               rocblas_operation transB,
                                rocblas_int       m,
                                rocblas_int       n,
-                               rocblas_int       k,
+                               rocblas_int       kl,
+                               rocblas_int       ku,
                                const T*          alpha,
                                const T*          A,
                                rocblas_int       lda,
-                               const T*          B,
-                               rocblas_int       ldb,
+                               const T*          x,
+                               rocblas_int       incx,
                                const T*          beta,
-                               T*                C,
-                               rocblas_int       ldc);
-
-template <>
-static constexpr auto rocblas_gemm<rocblas_half> = rocblas_hgemm;
-
-template <>
-static constexpr auto rocblas_gemm<float> = rocblas_sgemm;
-
-template <>
-static constexpr auto rocblas_gemm<double> = rocblas_dgemm;
+                               T*                y,
+                               rocblas_int       incy);
 
 template <>
-static constexpr auto rocblas_gemm<rocblas_float_complex> = rocblas_cgemm;
+static constexpr auto rocblas_gbmv<float> = rocblas_sgbmv;
 
 template <>
-static constexpr auto rocblas_gemm<rocblas_double_complex> = rocblas_zgemm;
+static constexpr auto rocblas_gbmv<double> = rocblas_dgbmv;
 
-// gemm_batched
+// gbmv_batched
 template <typename T>
-rocblas_status (*rocblas_gemm_batched)(rocblas_handle    handle,
+rocblas_status (*rocblas_gbmv_batched)(rocblas_handle    handle,
                                        rocblas_operation transA,
-                                       rocblas_operation transB,
                                        rocblas_int       m,
                                        rocblas_int       n,
-                                       rocblas_int       k,
+                                       rocblas_int       kl,
+                                       rocblas_int       ku,
                                        const T*          alpha,
                                        const T* const    A[],
                                        rocblas_int       lda,
-                                       const T* const    B[],
-                                       rocblas_int       ldb,
+                                       const T* const    x[],
+                                       rocblas_int       incx,
                                        const T*          beta,
-                                       T*                C[],
-                                       rocblas_int       ldc,
+                                       T* const          y[],
+                                       rocblas_int       incy,
                                        rocblas_int       batch_count);
 
 template <>
-static constexpr auto rocblas_gemm_batched<rocblas_half> = rocblas_hgemm_batched;
-
-template <>
-static constexpr auto rocblas_gemm_batched<float> = rocblas_sgemm_batched;
-
-template <>
-static constexpr auto rocblas_gemm_batched<double> = rocblas_dgemm_batched;
-
-template <>
-static constexpr auto rocblas_gemm_batched<rocblas_float_complex> = rocblas_cgemm_batched;
+static constexpr auto rocblas_gbmv_batched<float> = rocblas_sgbmv_batched;
 
 template <>
-static constexpr auto rocblas_gemm_batched<rocblas_double_complex> = rocblas_zgemm_batched;
+static constexpr auto rocblas_gbmv_batched<double> = rocblas_dgbmv_batched;
 
-// gemm_strided_batched
+// gbmv_strided_batched
 template <typename T>
-rocblas_status (*rocblas_gemm_strided_batched)(rocblas_handle    handle,
+rocblas_status (*rocblas_gbmv_strided_batched)(rocblas_handle    handle,
                                                rocblas_operation transA,
-                                               rocblas_operation transB,
                                                rocblas_int       m,
                                                rocblas_int       n,
-                                               rocblas_int       k,
+                                               rocblas_int       kl,
+                                               rocblas_int       ku,
                                                const T*          alpha,
                                                const T*          A,
                                                rocblas_int       lda,
-                                               rocblas_stride    bsa,
-                                               const T*          B,
-                                               rocblas_int       ldb,
-                                               rocblas_int       bsb,
+                                               rocblas_stride    strideA,
+                                               const T*          x,
+                                               rocblas_int       incx,
+                                               rocblas_stride    stridex,
                                                const T*          beta,
-                                               T*                C,
-                                               rocblas_int       ldc,
-                                               rocblas_stride    bsc,
+                                               T*                y,
+                                               rocblas_int       incy,
+                                               rocblas_stride    stridey,
                                                rocblas_int       batch_count);
 
 template <>
-static constexpr auto rocblas_gemm_strided_batched<rocblas_half> = rocblas_hgemm_strided_batched;
+static constexpr auto rocblas_gbmv_strided_batched<float> = rocblas_sgbmv_strided_batched;
 
 template <>
-static constexpr auto rocblas_gemm_strided_batched<float> = rocblas_sgemm_strided_batched;
+static constexpr auto rocblas_gbmv_strided_batched<double> = rocblas_dgbmv_strided_batched;
 
-template <>
-static constexpr auto rocblas_gemm_strided_batched<double> = rocblas_dgemm_strided_batched;
+// sbmv
+template <typename T>
+rocblas_status (*rocblas_sbmv)(rocblas_handle handle,
+                               rocblas_fill   uplo,
+                               rocblas_int    n,
+                               rocblas_int    k,
+                               const T*       alpha,
+                               const T*       A,
+                               rocblas_int    lda,
+                               const T*       x,
+                               rocblas_int    incx,
+                               const T*       beta,
+                               T*             y,
+                               rocblas_int    incy);
 
 template <>
-static constexpr auto
-    rocblas_gemm_strided_batched<rocblas_float_complex> = rocblas_cgemm_strided_batched;
+static constexpr auto rocblas_sbmv<float> = rocblas_ssbmv;
 
 template <>
-static constexpr auto
-    rocblas_gemm_strided_batched<rocblas_double_complex> = rocblas_zgemm_strided_batched;
+static constexpr auto rocblas_sbmv<double> = rocblas_dsbmv;
 
-// trmm
+// sbmv_batched
 template <typename T>
-rocblas_status (*rocblas_trmm)(rocblas_handle    handle,
-                               rocblas_side      side,
-                               rocblas_fill      uplo,
-                               rocblas_operation transA,
-                               rocblas_diagonal  diag,
-                               rocblas_int       m,
-                               rocblas_int       n,
-                               const T*          alpha,
+rocblas_status (*rocblas_sbmv_batched)(rocblas_handle handle,
+                                       rocblas_fill   uplo,
+                                       rocblas_int    n,
+                                       rocblas_int    k,
+                                       const T*       alpha,
+                                       const T* const A[],
+                                       rocblas_int    lda,
+                                       const T* const x[],
+                                       rocblas_int    incx,
+                                       const T*       beta,
+                                       T* const       y[],
+                                       rocblas_int    incy,
+                                       rocblas_int    batch_count);
+
+template <>
+static constexpr auto rocblas_sbmv_batched<float> = rocblas_ssbmv_batched;
+
+template <>
+static constexpr auto rocblas_sbmv_batched<double> = rocblas_dsbmv_batched;
+
+// sbmv_strided_batched
+template <typename T>
+rocblas_status (*rocblas_sbmv_strided_batched)(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               rocblas_int    k,
+                                               const T*       alpha,
+                                               const T*       A,
+                                               rocblas_int    lda,
+                                               rocblas_stride strideA,
+                                               const T*       x,
+                                               rocblas_int    incx,
+                                               rocblas_stride stridex,
+                                               const T*       beta,
+                                               T*             y,
+                                               rocblas_int    incy,
+                                               rocblas_stride stridey,
+                                               rocblas_int    batch_count);
+
+template <>
+static constexpr auto rocblas_sbmv_strided_batched<float> = rocblas_ssbmv_strided_batched;
+
+template <>
+static constexpr auto rocblas_sbmv_strided_batched<double> = rocblas_dsbmv_strided_batched;
+
+// spmv
+template <typename T>
+rocblas_status (*rocblas_spmv)(rocblas_handle handle,
+                               rocblas_fill   uplo,
+                               rocblas_int    n,
+                               const T*       alpha,
+                               const T*       AP,
+                               const T*       x,
+                               rocblas_int    incx,
+                               const T*       beta,
+                               T*             y,
+                               rocblas_int    incy);
+
+template <>
+static constexpr auto rocblas_spmv<float> = rocblas_sspmv;
+
+template <>
+static constexpr auto rocblas_spmv<double> = rocblas_dspmv;
+
+// spmv_batched
+template <typename T>
+rocblas_status (*rocblas_spmv_batched)(rocblas_handle handle,
+                                       rocblas_fill   uplo,
+                                       rocblas_int    n,
+                                       const T*       alpha,
+                                       const T* const AP[],
+                                       const T* const x[],
+                                       rocblas_int    incx,
+                                       const T*       beta,
+                                       T* const       y[],
+                                       rocblas_int    incy,
+                                       rocblas_int    batch_count);
+
+template <>
+static constexpr auto rocblas_spmv_batched<float> = rocblas_sspmv_batched;
+
+template <>
+static constexpr auto rocblas_spmv_batched<double> = rocblas_dspmv_batched;
+
+// spmv_strided_batched
+template <typename T>
+rocblas_status (*rocblas_spmv_strided_batched)(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               const T*       alpha,
+                                               const T*       AP,
+                                               rocblas_stride strideA,
+                                               const T*       x,
+                                               rocblas_int    incx,
+                                               rocblas_stride stridex,
+                                               const T*       beta,
+                                               T*             y,
+                                               rocblas_int    incy,
+                                               rocblas_stride stridey,
+                                               rocblas_int    batch_count);
+
+template <>
+static constexpr auto rocblas_spmv_strided_batched<float> = rocblas_sspmv_strided_batched;
+
+template <>
+static constexpr auto rocblas_spmv_strided_batched<double> = rocblas_dspmv_strided_batched;
+
+// tbmv
+template <typename T>
+rocblas_status (*rocblas_tbmv)(rocblas_handle    handle,
+                               rocblas_fill      uplo,
+                               rocblas_operation transA,
+                               rocblas_diagonal  diag,
+                               rocblas_int       n,
+                               rocblas_int       k,
+                               const T*          A,
+                               rocblas_int       lda,
+                               T*                x,
+                               rocblas_int       incx);
+
+template <>
+static constexpr auto rocblas_tbmv<float> = rocblas_stbmv;
+
+template <>
+static constexpr auto rocblas_tbmv<double> = rocblas_dtbmv;
+
+// tbmv_batched
+template <typename T>
+rocblas_status (*rocblas_tbmv_batched)(rocblas_handle    handle,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       rocblas_diagonal  diag,
+                                       rocblas_int       n,
+                                       rocblas_int       k,
+                                       const T* const    A[],
+                                       rocblas_int       lda,
+                                       T* const          x[],
+                                       rocblas_int       incx,
+                                       rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_tbmv_batched<float> = rocblas_stbmv_batched;
+
+template <>
+static constexpr auto rocblas_tbmv_batched<double> = rocblas_dtbmv_batched;
+
+// tbmv_strided_batched
+template <typename T>
+rocblas_status (*rocblas_tbmv_strided_batched)(rocblas_handle    handle,
+                                               rocblas_fill      uplo,
+                                               rocblas_operation transA,
+                                               rocblas_diagonal  diag,
+                                               rocblas_int       n,
+                                               rocblas_int       k,
+                                               const T*          A,
+                                               rocblas_int       lda,
+                                               rocblas_stride    strideA,
+                                               T*                x,
+                                               rocblas_int       incx,
+                                               rocblas_stride    stridex,
+                                               rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_tbmv_strided_batched<float> = rocblas_stbmv_strided_batched;
+
+template <>
+static constexpr auto rocblas_tbmv_strided_batched<double> = rocblas_dtbmv_strided_batched;
+
+// tpmv
+template <typename T>
+rocblas_status (*rocblas_tpmv)(rocblas_handle    handle,
+                               rocblas_fill      uplo,
+                               rocblas_operation transA,
+                               rocblas_diagonal  diag,
+                               rocblas_int       n,
+                               const T*          AP,
+                               T*                x,
+                               rocblas_int       incx);
+
+template <>
+static constexpr auto rocblas_tpmv<float> = rocblas_stpmv;
+
+template <>
+static constexpr auto rocblas_tpmv<double> = rocblas_dtpmv;
+
+// tpmv_batched
+template <typename T>
+rocblas_status (*rocblas_tpmv_batched)(rocblas_handle    handle,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       rocblas_diagonal  diag,
+                                       rocblas_int       n,
+                                       const T* const    AP[],
+                                       T* const          x[],
+                                       rocblas_int       incx,
+                                       rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_tpmv_batched<float> = rocblas_stpmv_batched;
+
+template <>
+static constexpr auto rocblas_tpmv_batched<double> = rocblas_dtpmv_batched;
+
+// tpmv_strided_batched
+template <typename T>
+rocblas_status (*rocblas_tpmv_strided_batched)(rocblas_handle    handle,
+                                               rocblas_fill      uplo,
+                                               rocblas_operation transA,
+                                               rocblas_diagonal  diag,
+                                               rocblas_int       n,
+                                               const T*          AP,
+                                               rocblas_stride    strideA,
+                                               T*                x,
+                                               rocblas_int       incx,
+                                               rocblas_stride    stridex,
+                                               rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_tpmv_strided_batched<float> = rocblas_stpmv_strided_batched;
+
+template <>
+static constexpr auto rocblas_tpmv_strided_batched<double> = rocblas_dtpmv_strided_batched;
+
+// tpsv
+template <typename T>
+rocblas_status (*rocblas_tpsv)(rocblas_handle    handle,
+                               rocblas_fill      uplo,
+                               rocblas_operation transA,
+                               rocblas_diagonal  diag,
+                               rocblas_int       n,
+                               const T*          AP,
+                               T*                x,
+                               rocblas_int       incx);
+
+template <>
+static constexpr auto rocblas_tpsv<float> = rocblas_stpsv;
+
+template <>
+static constexpr auto rocblas_tpsv<double> = rocblas_dtpsv;
+
+// tpsv_batched
+template <typename T>
+rocblas_status (*rocblas_tpsv_batched)(rocblas_handle    handle,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       rocblas_diagonal  diag,
+                                       rocblas_int       n,
+                                       const T* const    AP[],
+                                       T* const          x[],
+                                       rocblas_int       incx,
+                                       rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_tpsv_batched<float> = rocblas_stpsv_batched;
+
+template <>
+static constexpr auto rocblas_tpsv_batched<double> = rocblas_dtpsv_batched;
+
+// tpsv_strided_batched
+template <typename T>
+rocblas_status (*rocblas_tpsv_strided_batched)(rocblas_handle    handle,
+                                               rocblas_fill      uplo,
+                                               rocblas_operation transA,
+                                               rocblas_diagonal  diag,
+                                               rocblas_int       n,
+                                               const T*          AP,
+                                               rocblas_stride    strideA,
+                                               T*                x,
+                                               rocblas_int       incx,
+                                               rocblas_stride    stridex,
+                                               rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_tpsv_strided_batched<float> = rocblas_stpsv_strided_batched;
+
+template <>
+static constexpr auto rocblas_tpsv_strided_batched<double> = rocblas_dtpsv_strided_batched;
+
+/*
+ * ===========================================================================
+ *    level 3 BLAS
+ * ===========================================================================
+ */
+
+// geam
+template <typename T>
+rocblas_status (*rocblas_geam)(rocblas_handle    handle,
+                               rocblas_operation transA,
+                               rocblas_operation transB,
+                               rocblas_int       m,
+                               rocblas_int       n,
+                               const T*          alpha,
+                               const T*          A,
+                               rocblas_int       lda,
+                               const T*          beta,
+                               const T*          B,
+                               rocblas_int       ldb,
+                               T*                C,
+                               rocblas_int       ldc);
+
+template <>
+static constexpr auto rocblas_geam<float> = rocblas_sgeam;
+
+template <>
+static constexpr auto rocblas_geam<double> = rocblas_dgeam;
+
+// gemm
+template <typename T>
+rocblas_status (*rocblas_gemm)(rocblas_handle    handle,
+                               rocblas_operation transA,
+                               rocblas_operation transB,
+                               rocblas_int       m,
+                               rocblas_int       n,
+                               rocblas_int       k,
+                               const T*          alpha,
+                               const T*          A,
+                               rocblas_int       lda,
+                               const T*          B,
+                               rocblas_int       ldb,
+                               const T*          beta,
+                               T*                C,
+                               rocblas_int       ldc);
+
+template <>
+static constexpr auto rocblas_gemm<rocblas_half> = rocblas_hgemm;
+
+template <>
+static constexpr auto rocblas_gemm<float> = rocblas_sgemm;
+
+template <>
+static constexpr auto rocblas_gemm<double> = rocblas_dgemm;
+
+template <>
+static constexpr auto rocblas_gemm<rocblas_float_complex> = rocblas_cgemm;
+
+template <>
+static constexpr auto rocblas_gemm<rocblas_double_complex> = rocblas_zgemm;
+
+// gemm_batched
+template <typename T>
+rocblas_status (*rocblas_gemm_batched)(rocblas_handle    handle,
+                                       rocblas_operation transA,
+                                       rocblas_operation transB,
+                                       rocblas_int       m,
+                                       rocblas_int       n,
+                                       rocblas_int       k,
+                                       const T*          alpha,
+                                       const T* const    A[],
+                                       rocblas_int       lda,
+                                       const T* const    B[],
+                                       rocblas_int       ldb,
+                                       const T*          beta,
+                                       T*                C[],
+                                       rocblas_int       ldc,
+                                       rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_gemm_batched<rocblas_half> = rocblas_hgemm_batched;
+
+template <>
+static constexpr auto rocblas_gemm_batched<float> = rocblas_sgemm_batched;
+
+template <>
+static constexpr auto rocblas_gemm_batched<double> = rocblas_dgemm_batched;
+
+template <>
+static constexpr auto rocblas_gemm_batched<rocblas_float_complex> = rocblas_cgemm_batched;
+
+template <>
+static constexpr auto rocblas_gemm_batched<rocblas_double_complex> = rocblas_zgemm_batched;
+
+// gemm_strided_batched
+template <typename T>
+rocblas_status (*rocblas_gemm_strided_batched)(rocblas_handle    handle,
+                                               rocblas_operation transA,
+                                               rocblas_operation transB,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               rocblas_int       k,
+                                               const T*          alpha,
+                                               const T*          A,
+                                               rocblas_int       lda,
+                                               rocblas_stride    bsa,
+                                               const T*          B,
+                                               rocblas_int       ldb,
+                                               rocblas_int       bsb,
+                                               const T*          beta,
+                                               T*                C,
+                                               rocblas_int       ldc,
+                                               rocblas_stride    bsc,
+                                               rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_gemm_strided_batched<rocblas_half> = rocblas_hgemm_strided_batched;
+
+template <>
+static constexpr auto rocblas_gemm_strided_batched<float> = rocblas_sgemm_strided_batched;
+
+template <>
+static constexpr auto rocblas_gemm_strided_batched<double> = rocblas_dgemm_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_gemm_strided_batched<rocblas_float_complex> = rocblas_cgemm_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_gemm_strided_batched<rocblas_double_complex> = rocblas_zgemm_strided_batched;
+
+// gemm_out_of_core
+template <typename T>
+rocblas_status (*rocblas_gemm_out_of_core)(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_operation transB,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          B,
+                                           rocblas_int       ldb,
+                                           const T*          beta,
+                                           T*                C,
+                                           rocblas_int       ldc);
+
+template <>
+static constexpr auto rocblas_gemm_out_of_core<float> = rocblas_sgemm_out_of_core;
+
+template <>
+static constexpr auto rocblas_gemm_out_of_core<double> = rocblas_dgemm_out_of_core;
+
+template <>
+static constexpr auto
+    rocblas_gemm_out_of_core<rocblas_float_complex> = rocblas_cgemm_out_of_core;
+
+template <>
+static constexpr auto
+    rocblas_gemm_out_of_core<rocblas_double_complex> = rocblas_zgemm_out_of_core;
+
+// syrk
+template <typename T, typename U = T>
+rocblas_status (*rocblas_syrk)(rocblas_handle    handle,
+                               rocblas_fill      uplo,
+                               rocblas_operation transA,
+                               rocblas_int       n,
+                               rocblas_int       k,
+                               const U*          alpha,
+                               const T*          A,
+                               rocblas_int       lda,
+                               const U*          beta,
+                               T*                C,
+                               rocblas_int       ldc);
+
+template <>
+static constexpr auto rocblas_syrk<float> = rocblas_ssyrk;
+
+template <>
+static constexpr auto rocblas_syrk<double> = rocblas_dsyrk;
+
+template <>
+static constexpr auto rocblas_syrk<rocblas_float_complex> = rocblas_csyrk;
+
+template <>
+static constexpr auto rocblas_syrk<rocblas_double_complex> = rocblas_zsyrk;
+
+template <>
+static constexpr auto rocblas_syrk<rocblas_float_complex, float> = rocblas_cherk;
+
+template <>
+static constexpr auto rocblas_syrk<rocblas_double_complex, double> = rocblas_zherk;
+
+// syrk_batched
+template <typename T, typename U = T>
+rocblas_status (*rocblas_syrk_batched)(rocblas_handle    handle,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       rocblas_int       n,
+                                       rocblas_int       k,
+                                       const U*          alpha,
+                                       const T* const    A[],
+                                       rocblas_int       lda,
+                                       const U*          beta,
+                                       T* const          C[],
+                                       rocblas_int       ldc,
+                                       rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_syrk_batched<float> = rocblas_ssyrk_batched;
+
+template <>
+static constexpr auto rocblas_syrk_batched<double> = rocblas_dsyrk_batched;
+
+template <>
+static constexpr auto rocblas_syrk_batched<rocblas_float_complex> = rocblas_csyrk_batched;
+
+template <>
+static constexpr auto rocblas_syrk_batched<rocblas_double_complex> = rocblas_zsyrk_batched;
+
+template <>
+static constexpr auto rocblas_syrk_batched<rocblas_float_complex, float> = rocblas_cherk_batched;
+
+template <>
+static constexpr auto rocblas_syrk_batched<rocblas_double_complex, double> = rocblas_zherk_batched;
+
+// syrk_strided_batched
+template <typename T, typename U = T>
+rocblas_status (*rocblas_syrk_strided_batched)(rocblas_handle    handle,
+                                               rocblas_fill      uplo,
+                                               rocblas_operation transA,
+                                               rocblas_int       n,
+                                               rocblas_int       k,
+                                               const U*          alpha,
+                                               const T*          A,
+                                               rocblas_int       lda,
+                                               rocblas_stride    stride_A,
+                                               const U*          beta,
+                                               T*                C,
+                                               rocblas_int       ldc,
+                                               rocblas_stride    stride_C,
+                                               rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_syrk_strided_batched<float> = rocblas_ssyrk_strided_batched;
+
+template <>
+static constexpr auto rocblas_syrk_strided_batched<double> = rocblas_dsyrk_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_syrk_strided_batched<rocblas_float_complex> = rocblas_csyrk_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_syrk_strided_batched<rocblas_double_complex> = rocblas_zsyrk_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_syrk_strided_batched<rocblas_float_complex, float> = rocblas_cherk_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_syrk_strided_batched<rocblas_double_complex, double> = rocblas_zherk_strided_batched;
+
+// syr2k
+template <typename T, typename U = T>
+rocblas_status (*rocblas_syr2k)(rocblas_handle    handle,
+                                rocblas_fill      uplo,
+                                rocblas_operation transA,
+                                rocblas_int       n,
+                                rocblas_int       k,
+                                const T*          alpha,
+                                const T*          A,
+                                rocblas_int       lda,
+                                const T*          B,
+                                rocblas_int       ldb,
+                                const U*          beta,
+                                T*                C,
+                                rocblas_int       ldc);
+
+template <>
+static constexpr auto rocblas_syr2k<float> = rocblas_ssyr2k;
+
+template <>
+static constexpr auto rocblas_syr2k<double> = rocblas_dsyr2k;
+
+template <>
+static constexpr auto rocblas_syr2k<rocblas_float_complex> = rocblas_csyr2k;
+
+template <>
+static constexpr auto rocblas_syr2k<rocblas_double_complex> = rocblas_zsyr2k;
+
+template <>
+static constexpr auto rocblas_syr2k<rocblas_float_complex, float> = rocblas_cher2k;
+
+template <>
+static constexpr auto rocblas_syr2k<rocblas_double_complex, double> = rocblas_zher2k;
+
+// syr2k_batched
+template <typename T, typename U = T>
+rocblas_status (*rocblas_syr2k_batched)(rocblas_handle    handle,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation transA,
+                                        rocblas_int       n,
+                                        rocblas_int       k,
+                                        const T*          alpha,
+                                        const T* const    A[],
+                                        rocblas_int       lda,
+                                        const T* const    B[],
+                                        rocblas_int       ldb,
+                                        const U*          beta,
+                                        T* const          C[],
+                                        rocblas_int       ldc,
+                                        rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_syr2k_batched<float> = rocblas_ssyr2k_batched;
+
+template <>
+static constexpr auto rocblas_syr2k_batched<double> = rocblas_dsyr2k_batched;
+
+template <>
+static constexpr auto rocblas_syr2k_batched<rocblas_float_complex> = rocblas_csyr2k_batched;
+
+template <>
+static constexpr auto rocblas_syr2k_batched<rocblas_double_complex> = rocblas_zsyr2k_batched;
+
+template <>
+static constexpr auto rocblas_syr2k_batched<rocblas_float_complex, float> = rocblas_cher2k_batched;
+
+template <>
+static constexpr auto
+    rocblas_syr2k_batched<rocblas_double_complex, double> = rocblas_zher2k_batched;
+
+// syr2k_strided_batched
+template <typename T, typename U = T>
+rocblas_status (*rocblas_syr2k_strided_batched)(rocblas_handle    handle,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation transA,
+                                                rocblas_int       n,
+                                                rocblas_int       k,
+                                                const T*          alpha,
+                                                const T*          A,
+                                                rocblas_int       lda,
+                                                rocblas_stride    stride_A,
+                                                const T*          B,
+                                                rocblas_int       ldb,
+                                                rocblas_stride    stride_B,
+                                                const U*          beta,
+                                                T*                C,
+                                                rocblas_int       ldc,
+                                                rocblas_stride    stride_C,
+                                                rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_syr2k_strided_batched<float> = rocblas_ssyr2k_strided_batched;
+
+template <>
+static constexpr auto rocblas_syr2k_strided_batched<double> = rocblas_dsyr2k_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_syr2k_strided_batched<rocblas_float_complex> = rocblas_csyr2k_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_syr2k_strided_batched<rocblas_double_complex> = rocblas_zsyr2k_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_syr2k_strided_batched<rocblas_float_complex, float> = rocblas_cher2k_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_syr2k_strided_batched<rocblas_double_complex, double> = rocblas_zher2k_strided_batched;
+
+// symm
+template <typename T, bool HERM = false>
+rocblas_status (*rocblas_symm)(rocblas_handle handle,
+                               rocblas_side   side,
+                               rocblas_fill   uplo,
+                               rocblas_int    m,
+                               rocblas_int    n,
+                               const T*       alpha,
+                               const T*       A,
+                               rocblas_int    lda,
+                               const T*       B,
+                               rocblas_int    ldb,
+                               const T*       beta,
+                               T*             C,
+                               rocblas_int    ldc);
+
+template <>
+static constexpr auto rocblas_symm<float> = rocblas_ssymm;
+
+template <>
+static constexpr auto rocblas_symm<double> = rocblas_dsymm;
+
+template <>
+static constexpr auto rocblas_symm<rocblas_float_complex> = rocblas_csymm;
+
+template <>
+static constexpr auto rocblas_symm<rocblas_double_complex> = rocblas_zsymm;
+
+template <>
+static constexpr auto rocblas_symm<rocblas_float_complex, true> = rocblas_chemm;
+
+template <>
+static constexpr auto rocblas_symm<rocblas_double_complex, true> = rocblas_zhemm;
+
+// symm_batched
+template <typename T, bool HERM = false>
+rocblas_status (*rocblas_symm_batched)(rocblas_handle handle,
+                                       rocblas_side   side,
+                                       rocblas_fill   uplo,
+                                       rocblas_int    m,
+                                       rocblas_int    n,
+                                       const T*       alpha,
+                                       const T* const A[],
+                                       rocblas_int    lda,
+                                       const T* const B[],
+                                       rocblas_int    ldb,
+                                       const T*       beta,
+                                       T* const       C[],
+                                       rocblas_int    ldc,
+                                       rocblas_int    batch_count);
+
+template <>
+static constexpr auto rocblas_symm_batched<float> = rocblas_ssymm_batched;
+
+template <>
+static constexpr auto rocblas_symm_batched<double> = rocblas_dsymm_batched;
+
+template <>
+static constexpr auto rocblas_symm_batched<rocblas_float_complex> = rocblas_csymm_batched;
+
+template <>
+static constexpr auto rocblas_symm_batched<rocblas_double_complex> = rocblas_zsymm_batched;
+
+template <>
+static constexpr auto rocblas_symm_batched<rocblas_float_complex, true> = rocblas_chemm_batched;
+
+template <>
+static constexpr auto rocblas_symm_batched<rocblas_double_complex, true> = rocblas_zhemm_batched;
+
+// symm_strided_batched
+template <typename T, bool HERM = false>
+rocblas_status (*rocblas_symm_strided_batched)(rocblas_handle handle,
+                                               rocblas_side   side,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    m,
+                                               rocblas_int    n,
+                                               const T*       alpha,
+                                               const T*       A,
+                                               rocblas_int    lda,
+                                               rocblas_stride stride_A,
+                                               const T*       B,
+                                               rocblas_int    ldb,
+                                               rocblas_stride stride_B,
+                                               const T*       beta,
+                                               T*             C,
+                                               rocblas_int    ldc,
+                                               rocblas_stride stride_C,
+                                               rocblas_int    batch_count);
+
+template <>
+static constexpr auto rocblas_symm_strided_batched<float> = rocblas_ssymm_strided_batched;
+
+template <>
+static constexpr auto rocblas_symm_strided_batched<double> = rocblas_dsymm_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_symm_strided_batched<rocblas_float_complex> = rocblas_csymm_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_symm_strided_batched<rocblas_double_complex> = rocblas_zsymm_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_symm_strided_batched<rocblas_float_complex, true> = rocblas_chemm_strided_batched;
+
+template <>
+static constexpr auto
+    rocblas_symm_strided_batched<rocblas_double_complex, true> = rocblas_zhemm_strided_batched;
+// trmm
+template <typename T>
+rocblas_status (*rocblas_trmm)(rocblas_handle    handle,
+                               rocblas_side      side,
+                               rocblas_fill      uplo,
+                               rocblas_operation transA,
+                               rocblas_diagonal  diag,
+                               rocblas_int       m,
+                               rocblas_int       n,
+                               const T*          alpha,
                                T*                A,
                                rocblas_int       lda,
                                T*                B,
@@ -1445,6 +2441,75 @@ static constexpr auto rocblas_trmm<float> = rocblas_strmm;
 template <>
 static constexpr auto rocblas_trmm<double> = rocblas_dtrmm;
 
+// trmm_batched
+template <typename T>
+rocblas_status (*rocblas_trmm_batched)(rocblas_handle    handle,
+                                       rocblas_side      side,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       rocblas_diagonal  diag,
+                                       rocblas_int       m,
+                                       rocblas_int       n,
+                                       const T*          alpha,
+                                       const T* const    A[],
+                                       rocblas_int       lda,
+                                       T* const          B[],
+                                       rocblas_int       ldb,
+                                       rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_trmm_batched<float> = rocblas_strmm_batched;
+
+template <>
+static constexpr auto rocblas_trmm_batched<double> = rocblas_dtrmm_batched;
+
+// trmm_strided_batched
+template <typename T>
+rocblas_status (*rocblas_trmm_strided_batched)(rocblas_handle    handle,
+                                               rocblas_side      side,
+                                               rocblas_fill      uplo,
+                                               rocblas_operation transA,
+                                               rocblas_diagonal  diag,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               const T*          alpha,
+                                               const T*          A,
+                                               rocblas_int       lda,
+                                               rocblas_stride    stride_a,
+                                               T*                B,
+                                               rocblas_int       ldb,
+                                               rocblas_stride    stride_b,
+                                               rocblas_int       batch_count);
+
+template <>
+static constexpr auto rocblas_trmm_strided_batched<float> = rocblas_strmm_strided_batched;
+
+template <>
+static constexpr auto rocblas_trmm_strided_batched<double> = rocblas_dtrmm_strided_batched;
+
+// trmm_outofplace
+template <typename T>
+rocblas_status (*rocblas_trmm_outofplace)(rocblas_handle    handle,
+                                          rocblas_side      side,
+                                          rocblas_fill      uplo,
+                                          rocblas_operation transA,
+                                          rocblas_diagonal  diag,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          const T*          alpha,
+                                          const T*          A,
+                                          rocblas_int       lda,
+                                          const T*          B,
+                                          rocblas_int       ldb,
+                                          T*                C,
+                                          rocblas_int       ldc);
+
+template <>
+static constexpr auto rocblas_trmm_outofplace<float> = rocblas_strmm_outofplace;
+
+template <>
+static constexpr auto rocblas_trmm_outofplace<double> = rocblas_dtrmm_outofplace;
+
 // trsm
 template <typename T>
 rocblas_status (*rocblas_trsm)(rocblas_handle    handle,
@@ -1466,6 +2531,61 @@ static constexpr auto rocblas_trsm<float> = rocblas_strsm;
 template <>
 static constexpr auto rocblas_trsm<double> = rocblas_dtrsm;
 
+// trsm_prepare
+template <typename T>
+rocblas_status (*rocblas_trsm_prepare)(rocblas_handle       handle,
+                                       rocblas_side         side,
+                                       rocblas_fill         uplo,
+                                       rocblas_diagonal     diag,
+                                       rocblas_int          k,
+                                       const T*             A,
+                                       rocblas_int          lda,
+                                       rocblas_trsm_factor* factor);
+
+template <>
+static constexpr auto rocblas_trsm_prepare<float> = rocblas_strsm_prepare;
+
+template <>
+static constexpr auto rocblas_trsm_prepare<double> = rocblas_dtrsm_prepare;
+
+// trsm_solve
+template <typename T>
+rocblas_status (*rocblas_trsm_solve)(rocblas_handle      handle,
+                                     rocblas_trsm_factor factor,
+                                     rocblas_operation   transA,
+                                     rocblas_int         m,
+                                     rocblas_int         n,
+                                     const T*            alpha,
+                                     T*                  B,
+                                     rocblas_int         ldb);
+
+template <>
+static constexpr auto rocblas_trsm_solve<float> = rocblas_strsm_solve;
+
+template <>
+static constexpr auto rocblas_trsm_solve<double> = rocblas_dtrsm_solve;
+
+// trsm_refine
+template <typename T>
+rocblas_status (*rocblas_trsm_refine)(rocblas_handle    handle,
+                                      rocblas_side      side,
+                                      rocblas_fill      uplo,
+                                      rocblas_operation transA,
+                                      rocblas_diagonal  diag,
+                                      rocblas_int       m,
+                                      rocblas_int       n,
+                                      const T*          alpha,
+                                      const T*          A,
+                                      rocblas_int       lda,
+                                      T*                B,
+                                      rocblas_int       ldb,
+                                      double            tolerance,
+                                      rocblas_int       max_iterations,
+                                      rocblas_int*      iterations);
+
+template <>
+static constexpr auto rocblas_trsm_refine<double> = rocblas_dtrsm_refine;
+
 // trsm_batched
 template <typename T>
 rocblas_status (*rocblas_trsm_batched)(rocblas_handle    handle,
@@ -28,6 +28,8 @@ struct Arguments
     rocblas_int M;
     rocblas_int N;
     rocblas_int K;
+    rocblas_int KL; // sub-diagonals of a band matrix
+    rocblas_int KU; // super-diagonals of a band matrix
 
     rocblas_int lda;
     rocblas_int ldb;
@@ -120,6 +122,8 @@ struct Arguments
         ROCBLAS_FORMAT_CHECK(M);
         ROCBLAS_FORMAT_CHECK(N);
         ROCBLAS_FORMAT_CHECK(K);
+        ROCBLAS_FORMAT_CHECK(KL);
+        ROCBLAS_FORMAT_CHECK(KU);
         ROCBLAS_FORMAT_CHECK(lda);
         ROCBLAS_FORMAT_CHECK(ldb);
         ROCBLAS_FORMAT_CHECK(ldc);
@@ -268,6 +272,8 @@ private:
         PRINT(M);
         PRINT(N);
         PRINT(K);
+        PRINT(KL);
+        PRINT(KU);
         PRINT(lda);
         PRINT(ldb);
         PRINT(ldc);
@@ -80,10 +80,14 @@ void testing_asum_strided_batched_template(const Arguments& arg)
 
     device_vector<T2> dr(batch_count);
     CHECK_HIP_ERROR(dr.memcheck());
+    device_vector<T2> dr2(batch_count);
+    CHECK_HIP_ERROR(dr2.memcheck());
     host_vector<T2> hr1(batch_count);
     CHECK_HIP_ERROR(hr1.memcheck());
     host_vector<T2> hr(batch_count);
     CHECK_HIP_ERROR(hr.memcheck());
+    host_vector<T2> hr2(batch_count);
+    CHECK_HIP_ERROR(hr2.memcheck());
 
     //
     // Initialize the host vector.
@@ -109,7 +113,14 @@ void testing_asum_strided_batched_template(const Arguments& arg)
         CHECK_ROCBLAS_ERROR(
             (rocblas_asum_strided_batched<T1, T2>(handle, N, dx, incx, stridex, batch_count, dr)));
 
+        // A second call on the same handle relies on the first having reset the tickets which
+        // pick the thread block finishing each batch
+        CHECK_HIP_ERROR(hipMemset(dr2, 0, sizeof(T2) * batch_count));
+        CHECK_ROCBLAS_ERROR(
+            (rocblas_asum_strided_batched<T1, T2>(handle, N, dx, incx, stridex, batch_count, dr2)));
+
         CHECK_HIP_ERROR(hr.transfer_from(dr));
+        CHECK_HIP_ERROR(hr2.transfer_from(dr2));
 
         // CPU BLAS
         T2 cpu_result[batch_count];
@@ -125,6 +136,7 @@ void testing_asum_strided_batched_template(const Arguments& arg)
         {
             unit_check_general<T2>(batch_count, 1, 1, cpu_result, hr1);
             unit_check_general<T2>(batch_count, 1, 1, cpu_result, hr);
+            unit_check_general<T2>(batch_count, 1, 1, cpu_result, hr2);
         }
 
         if(arg.norm_check)
@@ -0,0 +1,409 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gbmv_batched_bad_arg(const Arguments& arg)
+{
+    const rocblas_int M           = 100;
+    const rocblas_int N           = 100;
+    const rocblas_int KL          = 10;
+    const rocblas_int KU          = 10;
+    const rocblas_int lda         = 100;
+    const rocblas_int incx        = 1;
+    const rocblas_int incy        = 1;
+    const T           alpha       = 1.0;
+    const T           beta        = 1.0;
+    const rocblas_int batch_count = 5;
+
+    const rocblas_operation transA = rocblas_operation_none;
+
+    rocblas_local_handle handle;
+
+    // allocate memory on device
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dx(batch_count);
+    device_vector<T*, 0, T> dy(batch_count);
+    if(!dA || !dx || !dy)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gbmv_batched<T>(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  KL,
+                                                  KU,
+                                                  &alpha,
+                                                  nullptr,
+                                                  lda,
+                                                  dx,
+                                                  incx,
+                                                  &beta,
+                                                  dy,
+                                                  incy,
+                                                  batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gbmv_batched<T>(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  KL,
+                                                  KU,
+                                                  &alpha,
+                                                  dA,
+                                                  lda,
+                                                  nullptr,
+                                                  incx,
+                                                  &beta,
+                                                  dy,
+                                                  incy,
+                                                  batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gbmv_batched<T>(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  KL,
+                                                  KU,
+                                                  &alpha,
+                                                  dA,
+                                                  lda,
+                                                  dx,
+                                                  incx,
+                                                  &beta,
+                                                  nullptr,
+                                                  incy,
+                                                  batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gbmv_batched<T>(
+            handle, transA, M, N, KL, KU, nullptr, dA, lda, dx, incx, &beta, dy, incy, batch_count),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gbmv_batched<T>(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  KL,
+                                                  KU,
+                                                  &alpha,
+                                                  dA,
+                                                  lda,
+                                                  dx,
+                                                  incx,
+                                                  nullptr,
+                                                  dy,
+                                                  incy,
+                                                  batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gbmv_batched<T>(
+            nullptr, transA, M, N, KL, KU, &alpha, dA, lda, dx, incx, &beta, dy, incy, batch_count),
+        rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_gbmv_batched(const Arguments& arg)
+{
+    rocblas_int M           = arg.M;
+    rocblas_int N           = arg.N;
+    rocblas_int KL          = arg.KL;
+    rocblas_int KU          = arg.KU;
+    rocblas_int lda         = arg.lda;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+    rocblas_int batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+
+    rocblas_local_handle handle;
+
+    // argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || KL < 0 || KU < 0 || lda < KL + KU + 1 || !incx || !incy
+       || batch_count <= 0)
+    {
+        static constexpr size_t safe_size = 100; // arbitrarily set to 100
+        device_vector<T*, 0, T> dA(safe_size);
+        device_vector<T*, 0, T> dx(safe_size);
+        device_vector<T*, 0, T> dy(safe_size);
+        if(!dA || !dx || !dy)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gbmv_batched<T>(handle,
+                                                      transA,
+                                                      M,
+                                                      N,
+                                                      KL,
+                                                      KU,
+                                                      &h_alpha,
+                                                      dA,
+                                                      lda,
+                                                      dx,
+                                                      incx,
+                                                      &h_beta,
+                                                      dy,
+                                                      incy,
+                                                      batch_count),
+                              M < 0 || N < 0 || KL < 0 || KU < 0 || lda < KL + KU + 1 || !incx
+                              || !incy || batch_count < 0
+                                  ? rocblas_status_invalid_size
+                                  : rocblas_status_success);
+        return;
+    }
+
+    size_t abs_incx = incx >= 0 ? incx : -incx;
+    size_t abs_incy = incy >= 0 ? incy : -incy;
+    size_t dim_x    = transA == rocblas_operation_none ? N : M;
+    size_t dim_y    = transA == rocblas_operation_none ? M : N;
+
+    size_t size_A = lda * static_cast<size_t>(N);
+    size_t size_x = dim_x * abs_incx;
+    size_t size_y = dim_y * abs_incy;
+
+    // Device-arrays of pointers to device memory
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dx(batch_count);
+    device_vector<T*, 0, T> dy_1(batch_count);
+    device_vector<T*, 0, T> dy_2(batch_count);
+    device_vector<T>        d_alpha(1);
+    device_vector<T>        d_beta(1);
+
+    // Host-arrays of pointers to device memory
+    // (intermediate arrays used for the transfers)
+    device_batch_vector<T> A(batch_count, size_A);
+    device_batch_vector<T> x(batch_count, size_x);
+    device_batch_vector<T> y_1(batch_count, size_y);
+    device_batch_vector<T> y_2(batch_count, size_y);
+
+    int last = batch_count - 1;
+    if(!dA || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta || !A[last] || !x[last] || !y_1[last]
+       || !y_2[last])
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Host-arrays of pointers to host memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hx[batch_count];
+    host_vector<T> hy_1[batch_count];
+    host_vector<T> hy_2[batch_count];
+    host_vector<T> hy_gold[batch_count];
+    for(int b = 0; b < batch_count; ++b)
+    {
+        hA[b]      = host_vector<T>(size_A);
+        hx[b]      = host_vector<T>(size_x);
+        hy_1[b]    = host_vector<T>(size_y);
+        hy_2[b]    = host_vector<T>(size_y);
+        hy_gold[b] = host_vector<T>(size_y);
+    }
+
+    // Initial Data on CPU, as in testing_gbmv.
+    rocblas_seedrand();
+    for(int b = 0; b < batch_count; ++b)
+    {
+        rocblas_init<T>(hA[b], lda, N, lda);
+        rocblas_init<T>(hx[b], 1, dim_x, abs_incx);
+        if(rocblas_isnan(arg.beta))
+            rocblas_init_nan<T>(hy_1[b], 1, dim_y, abs_incy);
+        else
+            rocblas_init<T>(hy_1[b], 1, dim_y, abs_incy);
+        hy_2[b]    = hy_1[b];
+        hy_gold[b] = hy_1[b];
+    }
+
+    // copy data from CPU to device
+    for(int b = 0; b < batch_count; ++b)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(A[b], hA[b], sizeof(T) * size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(x[b], hx[b], sizeof(T) * size_x, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(y_1[b], hy_1[b], sizeof(T) * size_y, hipMemcpyHostToDevice));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dA, A, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, x, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, y_1, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops, rocblas_bandwidth;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(int b = 0; b < batch_count; ++b)
+            CHECK_HIP_ERROR(hipMemcpy(y_2[b], hy_2[b], sizeof(T) * size_y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, y_2, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_gbmv_batched<T>(handle,
+                                                    transA,
+                                                    M,
+                                                    N,
+                                                    KL,
+                                                    KU,
+                                                    &h_alpha,
+                                                    dA,
+                                                    lda,
+                                                    dx,
+                                                    incx,
+                                                    &h_beta,
+                                                    dy_1,
+                                                    incy,
+                                                    batch_count));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_gbmv_batched<T>(handle,
+                                                    transA,
+                                                    M,
+                                                    N,
+                                                    KL,
+                                                    KU,
+                                                    d_alpha,
+                                                    dA,
+                                                    lda,
+                                                    dx,
+                                                    incx,
+                                                    d_beta,
+                                                    dy_2,
+                                                    incy,
+                                                    batch_count));
+
+        // copy output from device to CPU
+        for(int b = 0; b < batch_count; ++b)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(hy_1[b], y_1[b], sizeof(T) * size_y, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hy_2[b], y_2[b], sizeof(T) * size_y, hipMemcpyDeviceToHost));
+        }
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+        for(int b = 0; b < batch_count; ++b)
+        {
+            cblas_gbmv<T>(
+                transA, M, N, KL, KU, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_gold[b], incy);
+        }
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops
+            = batch_count * gbmv_gflop_count<T>(transA, M, N, KL, KU) / cpu_time_used * 1e6;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, dim_y, batch_count, abs_incy, hy_gold, hy_1);
+            unit_check_general<T>(1, dim_y, batch_count, abs_incy, hy_gold, hy_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1
+                = norm_check_general<T>('F', 1, dim_y, abs_incy, batch_count, hy_gold, hy_1);
+            rocblas_error_2
+                = norm_check_general<T>('F', 1, dim_y, abs_incy, batch_count, hy_gold, hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gbmv_batched<T>(handle,
+                                    transA,
+                                    M,
+                                    N,
+                                    KL,
+                                    KU,
+                                    &h_alpha,
+                                    dA,
+                                    lda,
+                                    dx,
+                                    incx,
+                                    &h_beta,
+                                    dy_1,
+                                    incy,
+                                    batch_count);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_gbmv_batched<T>(handle,
+                                    transA,
+                                    M,
+                                    N,
+                                    KL,
+                                    KU,
+                                    &h_alpha,
+                                    dA,
+                                    lda,
+                                    dx,
+                                    incx,
+                                    &h_beta,
+                                    dy_1,
+                                    incy,
+                                    batch_count);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops
+            = batch_count * gbmv_gflop_count<T>(transA, M, N, KL, KU) / gpu_time_used * 1e6;
+
+        // Only the stored band of A is read
+        rocblas_bandwidth = batch_count * (KL + KU + 1.0) * N * sizeof(T) / gpu_time_used / 1e3;
+
+        // only norm_check return an norm error, unit check won't return anything
+        std::cout << "transA,M,N,KL,KU,alpha,lda,incx,beta,incy,batch_count,rocblas-Gflops,"
+                     "rocblas-GB/s,";
+        if(arg.norm_check)
+        {
+            std::cout << "CPU-Gflops,norm_error_host_ptr,norm_error_device_ptr";
+        }
+        std::cout << std::endl;
+
+        std::cout << arg.transA << "," << M << "," << N << "," << KL << "," << KU << "," << h_alpha
+                  << "," << lda << "," << incx << "," << h_beta << "," << incy << ","
+                  << batch_count << "," << rocblas_gflops << "," << rocblas_bandwidth << ",";
+
+        if(arg.norm_check)
+        {
+            std::cout << cblas_gflops << ',';
+            std::cout << rocblas_error_1 << ',' << rocblas_error_2;
+        }
+
+        std::cout << std::endl;
+    }
+}
@@ -282,3 +282,288 @@ void testing_gemm(const Arguments& arg)
         std::cout << std::endl;
     }
 }
+
+template <typename T>
+void testing_gemm_bf16x3_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle;
+    rocblas_math_mode    mode;
+
+    // The default is to use the precision of the data type
+    CHECK_ROCBLAS_ERROR(rocblas_get_math_mode(handle, &mode));
+    EXPECT_EQ(mode, rocblas_default_math);
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_math_mode(handle, rocblas_xf32_bf16x3_math));
+    CHECK_ROCBLAS_ERROR(rocblas_get_math_mode(handle, &mode));
+    EXPECT_EQ(mode, rocblas_xf32_bf16x3_math);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_math_mode(handle, rocblas_math_mode(-1)),
+                          rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_get_math_mode(handle, nullptr), rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_math_mode(nullptr, rocblas_default_math),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_get_math_mode(nullptr, &mode), rocblas_status_invalid_handle);
+}
+
+// gemm with rocblas_xf32_bf16x3_math, compared with cblas_sgemm
+template <typename T>
+void testing_gemm_bf16x3(const Arguments& arg)
+{
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double               gpu_time_used, cpu_time_used;
+    double               rocblas_gflops, cblas_gflops;
+    double               rocblas_error = 0.0;
+    rocblas_local_handle handle;
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_math_mode(handle, rocblas_xf32_bf16x3_math));
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        static const size_t safe_size = 100;
+
+        device_vector<T> dA(safe_size);
+        device_vector<T> dB(safe_size);
+        device_vector<T> dC(safe_size);
+        if(!dA || !dB || !dC)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm<T>(
+                handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc),
+            rocblas_status_invalid_size);
+
+        return;
+    }
+
+    const auto size_A = size_t(lda) * size_t(A_col);
+    const auto size_B = size_t(ldb) * size_t(B_col);
+    const auto size_C = size_t(ldc) * size_t(N);
+
+    // allocate memory on device
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    device_vector<T> dC(size_C);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    if(!dA || !dB || !dC || !d_alpha || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hC_1(size_C);
+    host_vector<T> hC_2(size_C);
+    host_vector<T> hC_gold(size_C);
+
+    // Initial Data on CPU. Small integers are exact in bfloat16, so random_int data has no
+    // low parts and must match cblas exactly. trig_float data exercises the low parts.
+    if(arg.initialization == rocblas_initialization_random_int)
+    {
+        rocblas_seedrand();
+        rocblas_init<T>(hA, A_row, A_col, lda);
+        rocblas_init_alternating_sign<T>(hB, B_row, B_col, ldb);
+        if(rocblas_isnan(arg.beta) || rocblas_isnan(arg.betai))
+            rocblas_init_nan<T>(hC_1, M, N, ldc);
+        else
+            rocblas_init<T>(hC_1, M, N, ldc);
+    }
+    else
+    {
+        rocblas_init_sin<T>(hA, A_row, A_col, lda);
+        rocblas_init_cos<T>(hB, B_row, B_col, ldb);
+        if(rocblas_isnan(arg.beta) || rocblas_isnan(arg.betai))
+            rocblas_init_nan<T>(hC_1, M, N, ldc);
+        else
+            rocblas_init_sin<T>(hC_1, M, N, ldc);
+    }
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_1, sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm<T>(
+            handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        CHECK_HIP_ERROR(hipMemcpy(hC_1, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_2, sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm<T>(
+            handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us();
+        }
+
+        cblas_gemm<T, T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us() - cpu_time_used;
+            cblas_gflops  = gemm_gflop_count<T>(M, N, K) / cpu_time_used * 1e6;
+        }
+
+        if(arg.unit_check)
+        {
+            if(arg.initialization == rocblas_initialization_random_int)
+            {
+                unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+                unit_check_general<T>(M, N, ldc, hC_gold, hC_2);
+            }
+            else
+            {
+                // |A|, |B| and |C| are bounded by 1, and each of the K products has a relative
+                // error of about 2^-16 from dropping A_lo * B_lo and from the split
+                const double tol = (std::abs(arg.alpha) * K + std::abs(arg.beta)) / 32768.0;
+                near_check_general<T>(M, N, ldc, hC_gold, hC_1, tol);
+                near_check_general<T>(M, N, ldc, hC_gold, hC_2, tol);
+            }
+        }
+
+        if(arg.norm_check)
+        {
+            auto err1     = std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_1));
+            auto err2     = std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_2));
+            rocblas_error = err1 > err2 ? err1 : err2;
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_gemm<T>(
+                handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_gemm<T>(
+                handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc);
+        }
+        gpu_time_used  = get_time_us() - gpu_time_used;
+        rocblas_gflops = gemm_gflop_count<T>(M, N, K) * number_hot_calls / gpu_time_used * 1e6;
+
+        std::cout << "transA,transB,M,N,K,alpha,lda,ldb,beta,ldc,rocblas-Gflops,us";
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << ",CPU-Gflops,us,norm-error";
+
+        std::cout << std::endl;
+
+        std::cout << arg.transA << "," << arg.transB << "," << M << "," << N << "," << K << ","
+                  << arg.get_alpha<T>() << "," << lda << "," << ldb << "," << arg.get_beta<T>()
+                  << "," << ldc << "," << rocblas_gflops << "," << gpu_time_used / number_hot_calls;
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error;
+
+        std::cout << std::endl;
+    }
+}
+
+// rocblas_xf32_bf16x3_math only applies to the gemm functions themselves: the float GEMMs
+// inside syrk must give the same results as with rocblas_default_math
+template <typename T>
+void testing_gemm_bf16x3_scope(const Arguments& arg)
+{
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+
+    rocblas_int N   = arg.N;
+    rocblas_int K   = arg.K;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle;
+
+    rocblas_int A_row = transA == rocblas_operation_none ? N : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : N;
+
+    const auto size_A = size_t(lda) * size_t(A_col);
+    const auto size_C = size_t(ldc) * size_t(N);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dC(size_C);
+    if(!dA || !dC)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // trig_float data has nonzero low parts, which bf16x3 would round differently
+    host_vector<T> hA(size_A);
+    host_vector<T> hC_default(size_C);
+    host_vector<T> hC_bf16x3(size_C);
+    rocblas_init_sin<T>(hA, A_row, A_col, lda);
+    rocblas_init_cos<T>(hC_default, N, N, ldc);
+    hC_bf16x3 = hC_default;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_default, sizeof(T) * size_C, hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_syrk<T>(handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc));
+    CHECK_HIP_ERROR(hipMemcpy(hC_default, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_math_mode(handle, rocblas_xf32_bf16x3_math));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_bf16x3, sizeof(T) * size_C, hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_syrk<T>(handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc));
+    CHECK_HIP_ERROR(hipMemcpy(hC_bf16x3, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+    if(arg.unit_check)
+        unit_check_general<T>(N, N, ldc, hC_default, hC_bf16x3);
+}
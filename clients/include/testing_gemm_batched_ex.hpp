@@ -428,10 +428,12 @@ void testing_gemm_batched_ex(const Arguments& arg)
 
     // copy data from CPU to device
     // 1. Use intermediate arrays to access device memory from host
+    bool pack_int8x4 = std::is_same<Ti, int8_t>{} && !(flags & rocblas_gemm_flags_unpacked_int8);
     for(int b = 0; b < batch_count; b++)
     {
-        // Packing stuff
-        if(std::is_same<Ti, int8_t>::value && transA == rocblas_operation_none)
+        // Without rocblas_gemm_flags_unpacked_int8, int8 A and B are packed here, and otherwise
+        // gemm_batched_ex packs them
+        if(pack_int8x4 && transA == rocblas_operation_none)
         {
             host_vector<Ti> hA_packed(hA[b]);
             rocblas_packInt8(hA_packed, M, K, lda);
@@ -443,7 +445,7 @@ void testing_gemm_batched_ex(const Arguments& arg)
             CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b], sizeof(Ti) * size_a, hipMemcpyHostToDevice));
         }
 
-        if(std::is_same<Ti, int8_t>::value && transB != rocblas_operation_none)
+        if(pack_int8x4 && transB != rocblas_operation_none)
         {
             host_vector<Ti> hB_packed(hB[b]);
 
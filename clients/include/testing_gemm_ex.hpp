@@ -479,30 +479,55 @@ void testing_gemm_ex(const Arguments& arg)
     hC_gold = hC;
 
     // copy data from CPU to device
-    // if int8 and A not transposed and valid case, pack A
-    if(std::is_same<Ti, int8_t>{} && transA == rocblas_operation_none)
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ti) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Ti) * size_B, hipMemcpyHostToDevice));
+
+    // if int8 without rocblas_gemm_flags_unpacked_int8, A not transposed and valid case, pack A
+    // with rocblas_pack_int8x4 and check it against rocblas_packInt8. Otherwise gemm_ex packs A.
+    bool pack_int8x4 = std::is_same<Ti, int8_t>{} && !(flags & rocblas_gemm_flags_unpacked_int8);
+    if(pack_int8x4 && transA == rocblas_operation_none)
     {
-        host_vector<Ti> hA_packed(hA);
+        device_vector<Ti> dA_packed(size_A);
+        host_vector<Ti>   hA_packed(hA);
+        host_vector<Ti>   hA_packed_gpu(hA);
+        if(!dA_packed)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_pack_int8x4(
+            handle, M, K, (const int8_t*)(Ti*)dA, lda, (int8_t*)(Ti*)dA_packed));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hA_packed_gpu, dA_packed, sizeof(Ti) * size_A, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dA, dA_packed, sizeof(Ti) * size_A, hipMemcpyDeviceToDevice));
 
         rocblas_packInt8(hA_packed, M, K, lda);
-        CHECK_HIP_ERROR(hipMemcpy(dA, hA_packed, sizeof(Ti) * size_A, hipMemcpyHostToDevice));
-    }
-    else
-    {
-        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ti) * size_A, hipMemcpyHostToDevice));
+        if(arg.unit_check)
+            unit_check_general<Ti>(4 * M, K / 4, 4 * lda, hA_packed, hA_packed_gpu);
     }
 
-    // if int8 and B transposed and valid case, pack B
-    if(std::is_same<Ti, int8_t>{} && transB != rocblas_operation_none)
+    // if int8 without rocblas_gemm_flags_unpacked_int8, B transposed and valid case, pack B
+    if(pack_int8x4 && transB != rocblas_operation_none)
     {
-        host_vector<Ti> hB_packed(hB);
+        device_vector<Ti> dB_packed(size_B);
+        host_vector<Ti>   hB_packed(hB);
+        host_vector<Ti>   hB_packed_gpu(hB);
+        if(!dB_packed)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_pack_int8x4(
+            handle, N, K, (const int8_t*)(Ti*)dB, ldb, (int8_t*)(Ti*)dB_packed));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hB_packed_gpu, dB_packed, sizeof(Ti) * size_B, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dB, dB_packed, sizeof(Ti) * size_B, hipMemcpyDeviceToDevice));
 
         rocblas_packInt8(hB_packed, N, K, ldb);
-        CHECK_HIP_ERROR(hipMemcpy(dB, hB_packed, sizeof(Ti) * size_B, hipMemcpyHostToDevice));
-    }
-    else
-    {
-        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Ti) * size_B, hipMemcpyHostToDevice));
+        if(arg.unit_check)
+            unit_check_general<Ti>(4 * N, K / 4, 4 * ldb, hB_packed, hB_packed_gpu);
     }
 
     CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(To) * size_C, hipMemcpyHostToDevice));
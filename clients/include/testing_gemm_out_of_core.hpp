@@ -0,0 +1,235 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gemm_out_of_core_bad_arg(const Arguments& arg)
+{
+    const rocblas_int M = 100;
+    const rocblas_int N = 100;
+    const rocblas_int K = 100;
+
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 100;
+    const rocblas_int ldc = 100;
+
+    const T alpha = 1.0;
+    const T beta  = 1.0;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    rocblas_local_handle handle;
+
+    // A, B and C live in host memory
+    host_vector<T> hA(size_t(lda) * K);
+    host_vector<T> hB(size_t(ldb) * N);
+    host_vector<T> hC(size_t(ldc) * N);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_out_of_core<T>(
+            handle, transA, transB, M, N, K, &alpha, nullptr, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_out_of_core<T>(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, nullptr, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_out_of_core<T>(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_out_of_core<T>(
+            handle, transA, transB, M, N, K, nullptr, hA, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_out_of_core<T>(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, nullptr, hC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_out_of_core<T>(
+            nullptr, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_gemm_out_of_core(const Arguments& arg)
+{
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double               gpu_time_used, cpu_time_used;
+    double               rocblas_gflops, cblas_gflops;
+    double               rocblas_error = 0.0;
+    rocblas_local_handle handle;
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    // Note: K==0 is not an early exit, since C still needs to be multiplied by beta
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        static const size_t safe_size = 100;
+
+        host_vector<T> hA(safe_size);
+        host_vector<T> hB(safe_size);
+        host_vector<T> hC(safe_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_out_of_core<T>(
+                handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC, ldc),
+            rocblas_status_invalid_size);
+
+        return;
+    }
+
+    const auto size_A = size_t(lda) * size_t(A_col);
+    const auto size_B = size_t(ldb) * size_t(B_col);
+    const auto size_C = size_t(ldc) * size_t(N);
+
+    // alpha and beta for rocblas_pointer_mode_device
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    if(!d_alpha || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    // A, B and C are passed to rocBLAS in host memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hC_1(size_C);
+    host_vector<T> hC_2(size_C);
+    host_vector<T> hC_gold(size_C);
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    rocblas_init<T>(hA, A_row, A_col, lda);
+    rocblas_init_alternating_sign<T>(hB, B_row, B_col, ldb);
+    if(rocblas_isnan(arg.beta) || rocblas_isnan(arg.betai))
+        rocblas_init_nan<T>(hC_1, M, N, ldc);
+    else
+        rocblas_init<T>(hC_1, M, N, ldc);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_out_of_core<T>(
+            handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC_1, ldc));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        // Restrict the workspace so that the problem is split into many small tiles
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, 6 * 32 * 32 * sizeof(T)));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_out_of_core<T>(
+            handle, transA, transB, M, N, K, d_alpha, hA, lda, hB, ldb, d_beta, hC_2, ldc));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, 0));
+
+        // CPU BLAS
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us();
+        }
+
+        cblas_gemm<T, T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us() - cpu_time_used;
+            cblas_gflops  = gemm_gflop_count<T>(M, N, K) / cpu_time_used * 1e6;
+        }
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_2);
+        }
+
+        if(arg.norm_check)
+        {
+            auto err1     = std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_1));
+            auto err2     = std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_2));
+            rocblas_error = err1 > err2 ? err1 : err2;
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_out_of_core<T>(
+                handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC_1, ldc));
+        }
+
+        // Timing includes all host <-> device transfers
+        gpu_time_used = get_time_us(); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_gemm_out_of_core<T>(
+                handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC_1, ldc);
+        }
+        gpu_time_used  = get_time_us() - gpu_time_used;
+        rocblas_gflops = gemm_gflop_count<T>(M, N, K) * number_hot_calls / gpu_time_used * 1e6;
+
+        std::cout << "transA,transB,M,N,K,alpha,lda,ldb,beta,ldc,rocblas-Gflops,us";
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << ",CPU-Gflops,us,norm-error";
+
+        std::cout << std::endl;
+
+        std::cout << arg.transA << "," << arg.transB << "," << M << "," << N << "," << K << ","
+                  << arg.get_alpha<T>() << "," << lda << "," << ldb << "," << arg.get_beta<T>()
+                  << "," << ldc << "," << rocblas_gflops << "," << gpu_time_used / number_hot_calls;
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error;
+
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,300 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "cblas_interface.hpp"
+#include "gemm_out_of_core.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+#include <array>
+#include <map>
+#include <vector>
+
+/* ============================================================================================ */
+/*! \brief Mock device for the out-of-core GEMM pipeline in library/src/blas3/gemm_out_of_core.hpp.
+
+    Every operation runs immediately on the host, in the order in which the pipeline
+    issues it, which is one valid ordering of the real device. Vector clocks track which
+    operations each queue is guaranteed to have waited for, and any access to a tile buffer
+    which is not ordered after a conflicting earlier access on another queue is reported
+    as a race. Tile buffers are plain host vectors, which act as the mock allocator. */
+template <typename T>
+class gemm_ooc_mock_device
+{
+    static constexpr int num_queues = 3;
+    static constexpr int num_events = 3;
+    using clock                     = std::array<size_t, num_queues>;
+
+    struct buffer_access
+    {
+        int    queue;
+        size_t time;
+        bool   write;
+    };
+
+    rocblas_operation              transA, transB;
+    T                              alpha, beta;
+    const T*                       A;
+    rocblas_int                    lda;
+    const T*                       B;
+    rocblas_int                    ldb;
+    T*                             C;
+    rocblas_int                    ldc;
+    const rocblas_gemm_ooc_tiling& t;
+
+    std::vector<T> dA[rocblas_gemm_ooc_slots];
+    std::vector<T> dB[rocblas_gemm_ooc_slots];
+    std::vector<T> dC[rocblas_gemm_ooc_slots];
+
+    clock queue_clock[num_queues]                        = {};
+    clock event_clock[num_events][rocblas_gemm_ooc_slots] = {};
+
+    std::map<const void*, std::vector<buffer_access>> accesses;
+
+    // Log an access to a tile buffer, checking it against all earlier conflicting accesses
+    void touch(rocblas_gemm_ooc_queue queue, const std::vector<T>& buffer, bool write)
+    {
+        size_t now = ++queue_clock[queue][queue];
+        for(auto& a : accesses[buffer.data()])
+            if((write || a.write) && queue_clock[queue][a.queue] < a.time)
+            {
+                ADD_FAILURE() << "Unordered access to a tile buffer on queue " << queue
+                              << " after access on queue " << a.queue;
+                break;
+            }
+        accesses[buffer.data()].push_back({queue, now, write});
+    }
+
+    // Copy a rows x cols column-major block
+    static void copy_tile(T*          dst,
+                          rocblas_int ld_dst,
+                          const T*    src,
+                          rocblas_int ld_src,
+                          rocblas_int rows,
+                          rocblas_int cols)
+    {
+        for(rocblas_int j = 0; j < cols; ++j)
+            for(rocblas_int i = 0; i < rows; ++i)
+                dst[i + size_t(j) * ld_dst] = src[i + size_t(j) * ld_src];
+    }
+
+    rocblas_int tile_lda() const
+    {
+        return transA == rocblas_operation_none ? t.mb : t.kb;
+    }
+    rocblas_int tile_ldb() const
+    {
+        return transB == rocblas_operation_none ? t.kb : t.nb;
+    }
+
+public:
+    size_t steps      = 0;
+    size_t uploads_C  = 0;
+    size_t downloads  = 0;
+    size_t max_step_k = 0;
+
+    gemm_ooc_mock_device(rocblas_operation              transA,
+                         rocblas_operation              transB,
+                         T                              alpha,
+                         const T*                       A,
+                         rocblas_int                    lda,
+                         const T*                       B,
+                         rocblas_int                    ldb,
+                         T                              beta,
+                         T*                             C,
+                         rocblas_int                    ldc,
+                         const rocblas_gemm_ooc_tiling& t)
+        : transA(transA)
+        , transB(transB)
+        , alpha(alpha)
+        , beta(beta)
+        , A(A)
+        , lda(lda)
+        , B(B)
+        , ldb(ldb)
+        , C(C)
+        , ldc(ldc)
+        , t(t)
+    {
+        // Tiles which are never fully written are filled with NaN, to catch reads of stale data
+        for(int s = 0; s < rocblas_gemm_ooc_slots; ++s)
+        {
+            dA[s].assign(t.A_tile_els(), T(rocblas_nan_rng()));
+            dB[s].assign(t.B_tile_els(), T(rocblas_nan_rng()));
+            dC[s].assign(t.C_tile_els(), T(rocblas_nan_rng()));
+        }
+    }
+
+    rocblas_status upload_A(int slot, const rocblas_gemm_ooc_step& s)
+    {
+        touch(rocblas_gemm_ooc_upload, dA[slot], true);
+        bool none = transA == rocblas_operation_none;
+        copy_tile(dA[slot].data(),
+                  tile_lda(),
+                  A + (none ? s.i : s.l) + size_t(none ? s.l : s.i) * lda,
+                  lda,
+                  none ? s.m : s.k,
+                  none ? s.k : s.m);
+        return rocblas_status_success;
+    }
+
+    rocblas_status upload_B(int slot, const rocblas_gemm_ooc_step& s)
+    {
+        touch(rocblas_gemm_ooc_upload, dB[slot], true);
+        bool none = transB == rocblas_operation_none;
+        copy_tile(dB[slot].data(),
+                  tile_ldb(),
+                  B + (none ? s.l : s.j) + size_t(none ? s.j : s.l) * ldb,
+                  ldb,
+                  none ? s.k : s.n,
+                  none ? s.n : s.k);
+        return rocblas_status_success;
+    }
+
+    rocblas_status upload_C(int slot, const rocblas_gemm_ooc_step& s)
+    {
+        touch(rocblas_gemm_ooc_upload, dC[slot], true);
+        copy_tile(dC[slot].data(), t.mb, C + s.i + size_t(s.j) * ldc, ldc, s.m, s.n);
+        ++uploads_C;
+        return rocblas_status_success;
+    }
+
+    rocblas_status download_C(int slot, const rocblas_gemm_ooc_step& s)
+    {
+        touch(rocblas_gemm_ooc_download, dC[slot], false);
+        copy_tile(C + s.i + size_t(s.j) * ldc, ldc, dC[slot].data(), t.mb, s.m, s.n);
+        ++downloads;
+        return rocblas_status_success;
+    }
+
+    rocblas_status gemm(int ab_slot, int c_slot, const rocblas_gemm_ooc_step& s, bool first_k)
+    {
+        touch(rocblas_gemm_ooc_compute, dA[ab_slot], false);
+        touch(rocblas_gemm_ooc_compute, dB[ab_slot], false);
+        touch(rocblas_gemm_ooc_compute, dC[c_slot], true);
+
+        const T* a = dA[ab_slot].data();
+        const T* b = dB[ab_slot].data();
+        T*       c = dC[c_slot].data();
+
+        for(rocblas_int j = 0; j < s.n; ++j)
+            for(rocblas_int i = 0; i < s.m; ++i)
+            {
+                T sum = 0;
+                for(rocblas_int l = 0; l < s.k; ++l)
+                    sum += (transA == rocblas_operation_none ? a[i + size_t(l) * tile_lda()]
+                                                             : a[l + size_t(i) * tile_lda()])
+                           * (transB == rocblas_operation_none ? b[l + size_t(j) * tile_ldb()]
+                                                               : b[j + size_t(l) * tile_ldb()]);
+
+                T& cij = c[i + size_t(j) * t.mb];
+                if(!first_k)
+                    cij += alpha * sum;
+                else if(beta == 0)
+                    cij = alpha * sum;
+                else
+                    cij = alpha * sum + beta * cij;
+            }
+
+        ++steps;
+        max_step_k = std::max(max_step_k, size_t(s.k));
+        return rocblas_status_success;
+    }
+
+    rocblas_status record(rocblas_gemm_ooc_queue queue, rocblas_gemm_ooc_event e, int slot)
+    {
+        event_clock[e][slot] = queue_clock[queue];
+        return rocblas_status_success;
+    }
+
+    rocblas_status wait(rocblas_gemm_ooc_queue queue, rocblas_gemm_ooc_event e, int slot)
+    {
+        for(int q = 0; q < num_queues; ++q)
+            queue_clock[queue][q] = std::max(queue_clock[queue][q], event_clock[e][slot][q]);
+        return rocblas_status_success;
+    }
+
+    rocblas_status synchronize()
+    {
+        return rocblas_status_success;
+    }
+};
+
+/* ============================================================================================ */
+/*! \brief Run the out-of-core GEMM pipeline on the mock device over several tilings,
+    including tiles which do not divide the problem, and compare against cblas. */
+template <typename T>
+void testing_gemm_out_of_core_pipeline(const Arguments& arg)
+{
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int K   = arg.K;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    host_vector<T> hA(size_t(lda) * A_col);
+    host_vector<T> hB(size_t(ldb) * B_col);
+    host_vector<T> hC(size_t(ldc) * N);
+    host_vector<T> hC_init(size_t(ldc) * N);
+    host_vector<T> hC_gold(size_t(ldc) * N);
+
+    rocblas_seedrand();
+    rocblas_init<T>(hA, A_row, A_col, lda);
+    rocblas_init_alternating_sign<T>(hB, B_row, B_col, ldb);
+    rocblas_init<T>(hC_init, M, N, ldc);
+
+    hC_gold = hC_init;
+    cblas_gemm<T, T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+    // Workspace budgets for the mock allocator, from a single element per tile up to the
+    // whole problem
+    const size_t budgets[] = {1, 6 * sizeof(T), 50 * sizeof(T), 500 * sizeof(T), size_t(-1)};
+
+    for(size_t budget : budgets)
+    {
+        auto t = rocblas_gemm_ooc_choose_tiling(
+            M, N, K, sizeof(T), 4096, [=](size_t bytes) { return bytes <= budget; });
+
+        if(!t.mb)
+        {
+            // Only a budget smaller than one element per tile is refused
+            EXPECT_LT(budget, 6 * sizeof(T));
+            continue;
+        }
+        EXPECT_LE(t.workspace_bytes(sizeof(T)), budget);
+
+        hC = hC_init;
+        gemm_ooc_mock_device<T> device(
+            transA, transB, h_alpha, hA, lda, hB, ldb, h_beta, hC, ldc, t);
+
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_ooc_pipeline(device, M, N, K, t, h_beta == 0));
+
+        size_t m_tiles = (M + t.mb - 1) / t.mb;
+        size_t n_tiles = (N + t.nb - 1) / t.nb;
+        size_t k_tiles = K ? (K + t.kb - 1) / t.kb : 1;
+
+        EXPECT_EQ(device.steps, m_tiles * n_tiles * k_tiles);
+        EXPECT_EQ(device.downloads, m_tiles * n_tiles);
+        EXPECT_EQ(device.uploads_C, h_beta == 0 ? 0 : m_tiles * n_tiles);
+        EXPECT_LE(device.max_step_k, size_t(t.kb));
+
+        unit_check_general<T>(M, N, ldc, hC_gold, hC);
+    }
+}
@@ -507,29 +507,70 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     hD_gold = hD_1;
 
     // copy data from CPU to device
-    if(std::is_same<Ti, int8_t>::value && transA == rocblas_operation_none)
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ti) * size_a, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Ti) * size_b, hipMemcpyHostToDevice));
+
+    // if int8 without rocblas_gemm_flags_unpacked_int8, A not transposed and valid case, pack A
+    // with rocblas_pack_int8x4_strided_batched and check it against rocblas_packInt8. Otherwise
+    // gemm_strided_batched_ex packs A.
+    bool pack_int8x4 = std::is_same<Ti, int8_t>{} && !(flags & rocblas_gemm_flags_unpacked_int8);
+    if(pack_int8x4 && transA == rocblas_operation_none)
     {
-        host_vector<Ti> hA_packed(hA);
+        device_vector<Ti> dA_packed(size_a);
+        host_vector<Ti>   hA_packed(hA);
+        host_vector<Ti>   hA_packed_gpu(hA);
+        if(!dA_packed)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_pack_int8x4_strided_batched(handle,
+                                                                M,
+                                                                K,
+                                                                (const int8_t*)(Ti*)dA,
+                                                                lda,
+                                                                stride_a,
+                                                                (int8_t*)(Ti*)dA_packed,
+                                                                batch_count));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hA_packed_gpu, dA_packed, sizeof(Ti) * size_a, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dA, dA_packed, sizeof(Ti) * size_a, hipMemcpyDeviceToDevice));
 
         rocblas_packInt8(hA_packed, M, K, batch_count, lda, stride_a);
-        CHECK_HIP_ERROR(hipMemcpy(dA, hA_packed, sizeof(Ti) * size_a, hipMemcpyHostToDevice));
-    }
-    else
-    {
-        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ti) * size_a, hipMemcpyHostToDevice));
+        if(arg.unit_check)
+            unit_check_general<Ti>(
+                4 * M, K / 4, batch_count, 4 * lda, stride_a, hA_packed, hA_packed_gpu);
     }
 
-    // if int8 and B transposed and valid case, pack B
-    if(std::is_same<Ti, int8_t>::value && transB != rocblas_operation_none)
+    // if int8 without rocblas_gemm_flags_unpacked_int8, B transposed and valid case, pack B
+    if(pack_int8x4 && transB != rocblas_operation_none)
     {
-        host_vector<Ti> hB_packed(hB);
+        device_vector<Ti> dB_packed(size_b);
+        host_vector<Ti>   hB_packed(hB);
+        host_vector<Ti>   hB_packed_gpu(hB);
+        if(!dB_packed)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_pack_int8x4_strided_batched(handle,
+                                                                N,
+                                                                K,
+                                                                (const int8_t*)(Ti*)dB,
+                                                                ldb,
+                                                                stride_b,
+                                                                (int8_t*)(Ti*)dB_packed,
+                                                                batch_count));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hB_packed_gpu, dB_packed, sizeof(Ti) * size_b, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dB, dB_packed, sizeof(Ti) * size_b, hipMemcpyDeviceToDevice));
 
         rocblas_packInt8(hB_packed, N, K, batch_count, ldb, stride_b);
-        CHECK_HIP_ERROR(hipMemcpy(dB, hB_packed, sizeof(Ti) * size_b, hipMemcpyHostToDevice));
-    }
-    else
-    {
-        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Ti) * size_b, hipMemcpyHostToDevice));
+        if(arg.unit_check)
+            unit_check_general<Ti>(
+                4 * N, K / 4, batch_count, 4 * ldb, stride_b, hB_packed, hB_packed_gpu);
     }
 
     CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(To) * size_c, hipMemcpyHostToDevice));
@@ -0,0 +1,498 @@
+/* ************************************************************************
+ * Copyright 2018-2019 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gemv_multi_strided_batched_bad_arg(const Arguments& arg)
+{
+    const rocblas_int M           = 100;
+    const rocblas_int N           = 100;
+    const rocblas_int K           = 3;
+    const rocblas_int lda         = 100;
+    const rocblas_int incx        = 1;
+    const rocblas_int incy        = 1;
+    const rocblas_int ldx         = 100;
+    const rocblas_int ldy         = 100;
+    const T           alpha       = 1.0;
+    const T           beta        = 1.0;
+    const rocblas_int stride_a    = 10000;
+    const rocblas_int stride_x    = 300;
+    const rocblas_int stride_y    = 300;
+    const rocblas_int batch_count = 5;
+
+    const rocblas_operation transA = rocblas_operation_none;
+
+    rocblas_local_handle handle;
+
+    size_t size_A = stride_a * static_cast<size_t>(batch_count);
+    size_t size_x = stride_x * static_cast<size_t>(batch_count);
+    size_t size_y = stride_y * static_cast<size_t>(batch_count);
+
+    // allocate memory on device
+    device_vector<T> dA(size_A);
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_y);
+    if(!dA || !dx || !dy)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_strided_batched<T>(handle,
+                                                                transA,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                &alpha,
+                                                                nullptr,
+                                                                lda,
+                                                                stride_a,
+                                                                dx,
+                                                                incx,
+                                                                ldx,
+                                                                stride_x,
+                                                                &beta,
+                                                                dy,
+                                                                incy,
+                                                                ldy,
+                                                                stride_y,
+                                                                batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_strided_batched<T>(handle,
+                                                                transA,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                &alpha,
+                                                                dA,
+                                                                lda,
+                                                                stride_a,
+                                                                nullptr,
+                                                                incx,
+                                                                ldx,
+                                                                stride_x,
+                                                                &beta,
+                                                                dy,
+                                                                incy,
+                                                                ldy,
+                                                                stride_y,
+                                                                batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_strided_batched<T>(handle,
+                                                                transA,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                &alpha,
+                                                                dA,
+                                                                lda,
+                                                                stride_a,
+                                                                dx,
+                                                                incx,
+                                                                ldx,
+                                                                stride_x,
+                                                                &beta,
+                                                                nullptr,
+                                                                incy,
+                                                                ldy,
+                                                                stride_y,
+                                                                batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_strided_batched<T>(handle,
+                                                                transA,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                nullptr,
+                                                                dA,
+                                                                lda,
+                                                                stride_a,
+                                                                dx,
+                                                                incx,
+                                                                ldx,
+                                                                stride_x,
+                                                                &beta,
+                                                                dy,
+                                                                incy,
+                                                                ldy,
+                                                                stride_y,
+                                                                batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_strided_batched<T>(handle,
+                                                                transA,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                &alpha,
+                                                                dA,
+                                                                lda,
+                                                                stride_a,
+                                                                dx,
+                                                                incx,
+                                                                ldx,
+                                                                stride_x,
+                                                                nullptr,
+                                                                dy,
+                                                                incy,
+                                                                ldy,
+                                                                stride_y,
+                                                                batch_count),
+                          rocblas_status_invalid_pointer);
+
+    // the vectors of y would overlap
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_strided_batched<T>(handle,
+                                                                transA,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                &alpha,
+                                                                dA,
+                                                                lda,
+                                                                stride_a,
+                                                                dx,
+                                                                incx,
+                                                                ldx,
+                                                                stride_x,
+                                                                &beta,
+                                                                dy,
+                                                                incy,
+                                                                M - 1,
+                                                                stride_y,
+                                                                batch_count),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_strided_batched<T>(nullptr,
+                                                                transA,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                &alpha,
+                                                                dA,
+                                                                lda,
+                                                                stride_a,
+                                                                dx,
+                                                                incx,
+                                                                ldx,
+                                                                stride_x,
+                                                                &beta,
+                                                                dy,
+                                                                incy,
+                                                                ldy,
+                                                                stride_y,
+                                                                batch_count),
+                          rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_gemv_multi_strided_batched(const Arguments& arg)
+{
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       K           = arg.K;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       incx        = arg.incx;
+    rocblas_int       incy        = arg.incy;
+    T                 h_alpha     = arg.get_alpha<T>();
+    T                 h_beta      = arg.get_beta<T>();
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_int       stride_a    = arg.stride_a;
+    rocblas_int       batch_count = arg.batch_count;
+
+    rocblas_local_handle handle;
+    size_t               size_A = lda * static_cast<size_t>(N);
+    size_t               size_x, dim_x, abs_incx;
+    size_t               size_y, dim_y, abs_incy;
+
+    if(transA == rocblas_operation_none)
+    {
+        dim_x = N;
+        dim_y = M;
+    }
+    else
+    {
+        dim_x = M;
+        dim_y = N;
+    }
+
+    abs_incx = incx >= 0 ? incx : -incx;
+    abs_incy = incy >= 0 ? incy : -incy;
+
+    // the K vectors of x and of y of each instance are stored one after the other, and the
+    // instances follow each other
+    rocblas_int    ldx      = dim_x * abs_incx;
+    rocblas_int    ldy      = dim_y * abs_incy;
+    rocblas_stride stride_x = ldx * static_cast<rocblas_stride>(K);
+    rocblas_stride stride_y = ldy * static_cast<rocblas_stride>(K);
+
+    // argument sanity check and quick return before allocating invalid memory
+    if(M <= 0 || N <= 0 || K <= 0 || lda < M || lda < 1 || !incx || !incy || batch_count <= 0)
+    {
+        static constexpr size_t safe_size = 100; // arbitrarily set to 100
+        device_vector<T>        dA1(safe_size);
+        device_vector<T>        dx1(safe_size);
+        device_vector<T>        dy1(safe_size);
+        if(!dA1 || !dx1 || !dy1)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_strided_batched<T>(handle,
+                                                                    transA,
+                                                                    M,
+                                                                    N,
+                                                                    K,
+                                                                    &h_alpha,
+                                                                    dA1,
+                                                                    lda,
+                                                                    stride_a,
+                                                                    dx1,
+                                                                    incx,
+                                                                    ldx,
+                                                                    stride_x,
+                                                                    &h_beta,
+                                                                    dy1,
+                                                                    incy,
+                                                                    ldy,
+                                                                    stride_y,
+                                                                    batch_count),
+                              M < 0 || N < 0 || K < 0 || lda < M || lda < 1 || !incx || !incy
+                                      || batch_count < 0
+                                  ? rocblas_status_invalid_size
+                                  : rocblas_status_success);
+        return;
+    }
+
+    size_A = size_A + static_cast<size_t>(stride_a) * static_cast<size_t>(batch_count - 1);
+    size_x = stride_x * static_cast<size_t>(batch_count);
+    size_y = stride_y * static_cast<size_t>(batch_count);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hx(size_x);
+    host_vector<T> hy_1(size_y);
+    host_vector<T> hy_2(size_y);
+    host_vector<T> hy_gold(size_y);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dx(size_x);
+    device_vector<T> dy_1(size_y);
+    device_vector<T> dy_2(size_y);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    if(!dA || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    rocblas_init<T>(hA, M, N, lda, stride_a, batch_count);
+    rocblas_init<T>(hx, 1, dim_x, abs_incx, ldx, K * batch_count);
+    rocblas_init<T>(hy_1, 1, dim_y, abs_incy, ldy, K * batch_count);
+
+    hy_gold = hy_1;
+    hy_2    = hy_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops, rocblas_bandwidth;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * size_y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_multi_strided_batched<T>(handle,
+                                                                  transA,
+                                                                  M,
+                                                                  N,
+                                                                  K,
+                                                                  &h_alpha,
+                                                                  dA,
+                                                                  lda,
+                                                                  stride_a,
+                                                                  dx,
+                                                                  incx,
+                                                                  ldx,
+                                                                  stride_x,
+                                                                  &h_beta,
+                                                                  dy_1,
+                                                                  incy,
+                                                                  ldy,
+                                                                  stride_y,
+                                                                  batch_count));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_multi_strided_batched<T>(handle,
+                                                                  transA,
+                                                                  M,
+                                                                  N,
+                                                                  K,
+                                                                  d_alpha,
+                                                                  dA,
+                                                                  lda,
+                                                                  stride_a,
+                                                                  dx,
+                                                                  incx,
+                                                                  ldx,
+                                                                  stride_x,
+                                                                  d_beta,
+                                                                  dy_2,
+                                                                  incy,
+                                                                  ldy,
+                                                                  stride_y,
+                                                                  batch_count));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+        for(int b = 0; b < batch_count; ++b)
+        {
+            for(int j = 0; j < K; ++j)
+            {
+                cblas_gemv<T>(transA,
+                              M,
+                              N,
+                              h_alpha,
+                              hA + b * stride_a,
+                              lda,
+                              hx + b * stride_x + j * ldx,
+                              incx,
+                              h_beta,
+                              hy_gold + b * stride_y + j * ldy,
+                              incy);
+            }
+        }
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = batch_count * K * gemv_gflop_count<T>(transA, M, N) / cpu_time_used * 1e6;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, dim_y, K * batch_count, abs_incy, ldy, hy_gold, hy_1);
+            unit_check_general<T>(1, dim_y, K * batch_count, abs_incy, ldy, hy_gold, hy_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>(
+                'F', 1, dim_y, abs_incy, ldy, K * batch_count, hy_gold, hy_1);
+            rocblas_error_2 = norm_check_general<T>(
+                'F', 1, dim_y, abs_incy, ldy, K * batch_count, hy_gold, hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemv_multi_strided_batched<T>(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &h_alpha,
+                                                  dA,
+                                                  lda,
+                                                  stride_a,
+                                                  dx,
+                                                  incx,
+                                                  ldx,
+                                                  stride_x,
+                                                  &h_beta,
+                                                  dy_1,
+                                                  incy,
+                                                  ldy,
+                                                  stride_y,
+                                                  batch_count);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_gemv_multi_strided_batched<T>(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &h_alpha,
+                                                  dA,
+                                                  lda,
+                                                  stride_a,
+                                                  dx,
+                                                  incx,
+                                                  ldx,
+                                                  stride_x,
+                                                  &h_beta,
+                                                  dy_1,
+                                                  incy,
+                                                  ldy,
+                                                  stride_y,
+                                                  batch_count);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = batch_count * K * gemv_gflop_count<T>(transA, M, N) / gpu_time_used * 1e6;
+        rocblas_bandwidth
+            = batch_count * (1.0 * M * N + K * (dim_x + dim_y)) * sizeof(T) / gpu_time_used / 1e3;
+
+        // only norm_check return an norm error, unit check won't return anything
+        std::cout << "M,N,K,alpha,lda,stride_a,incx,beta,incy,batch_count,rocblas-Gflops,rocblas-"
+                     "GB/s,";
+        if(arg.norm_check)
+        {
+            std::cout << "CPU-Gflops,norm_error_host_ptr,norm_error_device_ptr";
+        }
+        std::cout << std::endl;
+
+        std::cout << M << "," << N << "," << K << "," << h_alpha << "," << lda << "," << stride_a
+                  << "," << incx << "," << h_beta << "," << incy << "," << batch_count << ","
+                  << rocblas_gflops << "," << rocblas_bandwidth << ",";
+
+        if(arg.norm_check)
+        {
+            std::cout << cblas_gflops << ',';
+            std::cout << rocblas_error_1 << ',' << rocblas_error_2;
+        }
+
+        std::cout << std::endl;
+    }
+}
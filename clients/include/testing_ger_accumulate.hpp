@@ -0,0 +1,270 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_ger_accumulate_bad_arg(const Arguments& arg)
+{
+    rocblas_int M     = 100;
+    rocblas_int N     = 100;
+    rocblas_int incx  = 1;
+    rocblas_int incy  = 1;
+    rocblas_int lda   = 100;
+    rocblas_int max_k = 4;
+    T           alpha = 0.6;
+
+    rocblas_local_handle handle;
+
+    size_t size_A = lda * size_t(N);
+
+    // allocate memory on device
+    device_vector<T> dA(size_A);
+    device_vector<T> dx(M);
+    device_vector<T> dy(N);
+    if(!dA || !dx || !dy)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    rocblas_ger_accumulator acc = nullptr;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulator_create<T>(nullptr, M, N, dA, lda, max_k, &acc),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulator_create<T>(handle, M, N, dA, M - 1, max_k, &acc),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulator_create<T>(handle, M, N, dA, lda, 0, &acc),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_accumulator_create<T>(handle, M, N, nullptr, lda, max_k, &acc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulator_create<T>(handle, M, N, dA, lda, max_k, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    CHECK_ROCBLAS_ERROR(rocblas_ger_accumulator_create<T>(handle, M, N, dA, lda, max_k, &acc));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulate<T>(nullptr, acc, &alpha, dx, incx, dy, incy),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulate<T>(handle, nullptr, &alpha, dx, incx, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulate<T>(handle, acc, nullptr, dx, incx, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulate<T>(handle, acc, &alpha, nullptr, incx, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulate<T>(handle, acc, &alpha, dx, incx, nullptr, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulate<T>(handle, acc, &alpha, dx, 0, dy, incy),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulator_flush(nullptr, acc),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_accumulator_flush(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_ger_accumulator(acc));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_destroy_ger_accumulator(nullptr), rocblas_status_invalid_pointer);
+}
+
+// The updates are batch_count pairs of vectors x_i and y_i, stored stride_x and stride_y
+// elements apart, which are accumulated with max_k = K. The result is checked against
+// batch_count calls of cblas_ger.
+template <typename T>
+void testing_ger_accumulate(const Arguments& arg)
+{
+    rocblas_int M           = arg.M;
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+    rocblas_int lda         = arg.lda;
+    rocblas_int max_k       = arg.K;
+    rocblas_int batch_count = arg.batch_count;
+    T           h_alpha     = arg.get_alpha<T>();
+
+    rocblas_local_handle handle;
+
+    // argument check before allocating invalid memory
+    if(M < 0 || N < 0 || lda < M || lda < 1 || max_k < 1)
+    {
+        static const size_t safe_size = 100; // arbitrarily set to 100
+        device_vector<T>    dA(safe_size);
+        if(!dA)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        rocblas_ger_accumulator acc;
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_ger_accumulator_create<T>(handle, M, N, dA, lda, max_k, &acc),
+            rocblas_status_invalid_size);
+
+        return;
+    }
+
+    if(batch_count < 0)
+        batch_count = 0;
+
+    size_t         abs_incx = incx >= 0 ? incx : -incx;
+    size_t         abs_incy = incy >= 0 ? incy : -incy;
+    rocblas_stride stride_x = std::max(arg.stride_x, rocblas_stride(M * abs_incx));
+    rocblas_stride stride_y = std::max(arg.stride_y, rocblas_stride(N * abs_incy));
+    size_t         size_A   = lda * size_t(N);
+    size_t         size_x   = std::max(stride_x * batch_count, rocblas_stride(1));
+    size_t         size_y   = std::max(stride_y * batch_count, rocblas_stride(1));
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA_1(size_A);
+    host_vector<T> hA_2(size_A);
+    host_vector<T> hA_gold(size_A);
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_y);
+
+    // allocate memory on device
+    device_vector<T> dA_1(size_A);
+    device_vector<T> dA_2(size_A);
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_y);
+    device_vector<T> d_alpha(1);
+    if(!dA_1 || !dA_2 || !dx || !dy || !d_alpha)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    rocblas_init<T>(hA_1, M, N, lda);
+    rocblas_init<T>(hx, 1, size_x, 1);
+    rocblas_init<T>(hy, 1, size_y, 1);
+
+    hA_gold = hA_1;
+    hA_2    = hA_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA_1, hA_1, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    // Accumulates all of the updates of dA and applies them. Zero increments are only rejected
+    // when an update is accumulated.
+    auto accumulate = [&](T* dA, const T* alpha) {
+        rocblas_ger_accumulator acc;
+        rocblas_status          status
+            = rocblas_ger_accumulator_create<T>(handle, M, N, dA, lda, max_k, &acc);
+        if(status != rocblas_status_success)
+            return status;
+
+        for(rocblas_int b = 0; b < batch_count && status == rocblas_status_success; b++)
+            status = rocblas_ger_accumulate<T>(
+                handle, acc, alpha, dx + b * stride_x, incx, dy + b * stride_y, incy);
+
+        if(status == rocblas_status_success)
+            status = rocblas_ger_accumulator_flush(handle, acc);
+
+        rocblas_status destroy_status = rocblas_destroy_ger_accumulator(acc);
+        return status != rocblas_status_success ? status : destroy_status;
+    };
+
+    if(!incx || !incy)
+    {
+        EXPECT_ROCBLAS_STATUS(accumulate(dA_1, &h_alpha),
+                              batch_count ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(dA_2, hA_2, sizeof(T) * size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(accumulate(dA_1, &h_alpha));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(accumulate(dA_2, d_alpha));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hA_1, dA_1, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hA_2, dA_2, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+            cblas_ger<T>(
+                M, N, h_alpha, hx + b * stride_x, incx, hy + b * stride_y, incy, hA_gold, lda);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = batch_count * ger_gflop_count<T>(M, N) / cpu_time_used * 1e6;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, lda, hA_gold, hA_1);
+            unit_check_general<T>(M, N, lda, hA_gold, hA_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', M, N, lda, hA_gold, hA_1);
+            rocblas_error_2 = norm_check_general<T>('F', M, N, lda, hA_gold, hA_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            accumulate(dA_1, &h_alpha);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            accumulate(dA_1, &h_alpha);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = batch_count * ger_gflop_count<T>(M, N) / gpu_time_used * 1e6;
+
+        // only norm_check return an norm error, unit check won't return anything
+        std::cout << "M,N,alpha,incx,incy,lda,K,batch_count,rocblas-Gflops,us";
+
+        if(arg.norm_check)
+            std::cout << ",CPU-Gflops,norm_error_host_ptr,norm_error_dev_ptr";
+
+        std::cout << std::endl;
+
+        std::cout << M << "," << N << "," << h_alpha << "," << incx << "," << incy << "," << lda
+                  << "," << max_k << "," << batch_count << "," << rocblas_gflops << ","
+                  << gpu_time_used;
+
+        if(arg.norm_check)
+            std::cout << "," << cblas_gflops << "," << rocblas_error_1 << "," << rocblas_error_2;
+
+        std::cout << std::endl;
+    }
+}
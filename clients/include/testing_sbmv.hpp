@@ -0,0 +1,245 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_sbmv_bad_arg(const Arguments& arg)
+{
+    const rocblas_int N     = 100;
+    const rocblas_int K     = 10;
+    const rocblas_int lda   = 100;
+    const rocblas_int incx  = 1;
+    const rocblas_int incy  = 1;
+    const T           alpha = 1.0;
+    const T           beta  = 1.0;
+
+    const rocblas_fill uplo = rocblas_fill_upper;
+
+    rocblas_local_handle handle;
+
+    size_t size_A = lda * static_cast<size_t>(N);
+    size_t size_x = N * static_cast<size_t>(incx);
+    size_t size_y = N * static_cast<size_t>(incy);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_y);
+    if(!dA || !dx || !dy)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sbmv<T>(handle, uplo, N, K, &alpha, nullptr, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sbmv<T>(handle, uplo, N, K, &alpha, dA, lda, nullptr, incx, &beta, dy, incy),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sbmv<T>(handle, uplo, N, K, &alpha, dA, lda, dx, incx, &beta, nullptr, incy),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sbmv<T>(handle, uplo, N, K, nullptr, dA, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sbmv<T>(handle, uplo, N, K, &alpha, dA, lda, dx, incx, nullptr, dy, incy),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sbmv<T>(
+            handle, rocblas_fill_full, N, K, &alpha, dA, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_sbmv<T>(nullptr, uplo, N, K, &alpha, dA, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_sbmv(const Arguments& arg)
+{
+    rocblas_int N    = arg.N;
+    rocblas_int K    = arg.K;
+    rocblas_int lda  = arg.lda;
+    rocblas_int incx = arg.incx;
+    rocblas_int incy = arg.incy;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_fill uplo = char2rocblas_fill(arg.uplo);
+
+    rocblas_local_handle handle;
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || K < 0 || lda < K + 1 || !incx || !incy)
+    {
+        static const size_t safe_size = 100;
+        device_vector<T>    dA(safe_size);
+        device_vector<T>    dx(safe_size);
+        device_vector<T>    dy(safe_size);
+        if(!dA || !dx || !dy)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_sbmv<T>(handle, uplo, N, K, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy),
+            N < 0 || K < 0 || lda < K + 1 || !incx || !incy ? rocblas_status_invalid_size
+                                                            : rocblas_status_success);
+        return;
+    }
+
+    size_t abs_incx = incx >= 0 ? incx : -incx;
+    size_t abs_incy = incy >= 0 ? incy : -incy;
+
+    size_t size_A = lda * static_cast<size_t>(N);
+    size_t size_x = N * abs_incx;
+    size_t size_y = N * abs_incy;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hx(size_x);
+    host_vector<T> hy_1(size_y);
+    host_vector<T> hy_2(size_y);
+    host_vector<T> hy_gold(size_y);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dx(size_x);
+    device_vector<T> dy_1(size_y);
+    device_vector<T> dy_2(size_y);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    if(!dA || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Initial Data on CPU. All of the band storage is initialized, including the corner which is
+    // not part of A, so that reads of it would give results which differ from cblas.
+    rocblas_seedrand();
+    rocblas_init<T>(hA, lda, N, lda);
+    rocblas_init<T>(hx, 1, N, abs_incx);
+    if(rocblas_isnan(arg.beta))
+        rocblas_init_nan<T>(hy_1, 1, N, abs_incy);
+    else
+        rocblas_init<T>(hy_1, 1, N, abs_incy);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops, rocblas_bandwidth;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * size_y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_sbmv<T>(
+            handle, uplo, N, K, &h_alpha, dA, lda, dx, incx, &h_beta, dy_1, incy));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_sbmv<T>(
+            handle, uplo, N, K, d_alpha, dA, lda, dx, incx, d_beta, dy_2, incy));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+        cblas_sbmv<T>(uplo, N, K, h_alpha, hA, lda, hx, incx, h_beta, hy_gold, incy);
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = sbmv_gflop_count<T>(N, K) / cpu_time_used * 1e6;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy_gold, hy_1);
+            unit_check_general<T>(1, N, abs_incy, hy_gold, hy_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, N, abs_incy, hy_gold, hy_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, N, abs_incy, hy_gold, hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_sbmv<T>(handle, uplo, N, K, &h_alpha, dA, lda, dx, incx, &h_beta, dy_1, incy);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_sbmv<T>(handle, uplo, N, K, &h_alpha, dA, lda, dx, incx, &h_beta, dy_1, incy);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = sbmv_gflop_count<T>(N, K) / gpu_time_used * 1e6;
+
+        // Only the stored band of A is read
+        rocblas_bandwidth = (K + 1.0) * N * sizeof(T) / gpu_time_used / 1e3;
+
+        // only norm_check return an norm error, unit check won't return anything
+        std::cout << "uplo,N,K,alpha,lda,incx,beta,incy,rocblas-Gflops,rocblas-GB/s,";
+        if(arg.norm_check)
+        {
+            std::cout << "CPU-Gflops,norm_error_host_ptr,norm_error_device_ptr";
+        }
+        std::cout << std::endl;
+
+        std::cout << arg.uplo << "," << N << "," << K << "," << h_alpha << "," << lda << ","
+                  << incx << "," << h_beta << "," << incy << "," << rocblas_gflops << ","
+                  << rocblas_bandwidth << ",";
+
+        if(arg.norm_check)
+        {
+            std::cout << cblas_gflops << ',';
+            std::cout << rocblas_error_1 << ',' << rocblas_error_2;
+        }
+
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,255 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// HERM selects hemm instead of symm
+template <typename T, bool HERM = false>
+void testing_symm_bad_arg(const Arguments& arg)
+{
+    const rocblas_int M     = 100;
+    const rocblas_int N     = 100;
+    const rocblas_int lda   = 100;
+    const rocblas_int ldb   = 100;
+    const rocblas_int ldc   = 100;
+    const T           alpha = 1.0;
+    const T           beta  = 1.0;
+
+    const rocblas_side side = rocblas_side_left;
+    const rocblas_fill uplo = rocblas_fill_upper;
+
+    rocblas_local_handle handle;
+
+    size_t size_A = size_t(lda) * M;
+    size_t size_B = size_t(ldb) * N;
+    size_t size_C = size_t(ldc) * N;
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    device_vector<T> dC(size_C);
+    if(!dA || !dB || !dC)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symm<T, HERM>(
+            handle, side, uplo, M, N, &alpha, nullptr, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symm<T, HERM>(
+            handle, side, uplo, M, N, &alpha, dA, lda, nullptr, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symm<T, HERM>(
+            handle, side, uplo, M, N, &alpha, dA, lda, dB, ldb, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symm<T, HERM>(handle, side, uplo, M, N, nullptr, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symm<T, HERM>(
+            handle, side, uplo, M, N, &alpha, dA, lda, dB, ldb, nullptr, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symm<T, HERM>(
+            handle, side, rocblas_fill_full, M, N, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symm<T, HERM>(
+            handle, rocblas_side_both, uplo, M, N, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symm<T, HERM>(
+            nullptr, side, uplo, M, N, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+}
+
+template <typename T, bool HERM = false>
+void testing_symm(const Arguments& arg)
+{
+    rocblas_side side = char2rocblas_side(arg.side);
+    rocblas_fill uplo = char2rocblas_fill(arg.uplo);
+
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double               gpu_time_used, cpu_time_used;
+    double               rocblas_gflops, cblas_gflops;
+    double               rocblas_error = 0.0;
+    rocblas_local_handle handle;
+
+    // A is K by K, where K is M for the left side and N for the right side
+    rocblas_int K = side == rocblas_side_left ? M : N;
+
+    // check here to prevent undefined memory allocation error
+    if(M <= 0 || N <= 0 || lda < K || lda < 1 || ldb < M || ldb < 1 || ldc < M || ldc < 1)
+    {
+        static const size_t safe_size = 100;
+
+        device_vector<T> dA(safe_size);
+        device_vector<T> dB(safe_size);
+        device_vector<T> dC(safe_size);
+        if(!dA || !dB || !dC)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_symm<T, HERM>(
+                handle, side, uplo, M, N, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc),
+            M < 0 || N < 0 || lda < K || lda < 1 || ldb < M || ldb < 1 || ldc < M || ldc < 1
+                ? rocblas_status_invalid_size
+                : rocblas_status_success);
+        return;
+    }
+
+    const auto size_A = size_t(lda) * size_t(K);
+    const auto size_B = size_t(ldb) * size_t(N);
+    const auto size_C = size_t(ldc) * size_t(N);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hC_1(size_C);
+    host_vector<T> hC_2(size_C);
+    host_vector<T> hC_gold(size_C);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    device_vector<T> dC(size_C);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    if(!dA || !dB || !dC || !d_alpha || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Initial Data on CPU. All of A is initialized, so that reads of the triangle which is not
+    // referenced by uplo would give results which differ from cblas.
+    rocblas_seedrand();
+    rocblas_init<T>(hA, K, K, lda);
+    rocblas_init_alternating_sign<T>(hB, M, N, ldb);
+    if(rocblas_isnan(arg.beta) || rocblas_isnan(arg.betai))
+        rocblas_init_nan<T>(hC_1, M, N, ldc);
+    else
+        rocblas_init<T>(hC_1, M, N, ldc);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_1, sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_symm<T, HERM>(
+            handle, side, uplo, M, N, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        CHECK_HIP_ERROR(hipMemcpy(hC_1, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_2, sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_symm<T, HERM>(
+            handle, side, uplo, M, N, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us();
+        }
+
+        cblas_symm<T, HERM>(side, uplo, M, N, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us() - cpu_time_used;
+            cblas_gflops  = symm_gflop_count<T>(side, M, N) / cpu_time_used * 1e6;
+        }
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_2);
+        }
+
+        if(arg.norm_check)
+        {
+            auto err1     = std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_1));
+            auto err2     = std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_2));
+            rocblas_error = err1 > err2 ? err1 : err2;
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_symm<T, HERM>(
+                handle, side, uplo, M, N, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_symm<T, HERM>(
+                handle, side, uplo, M, N, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc);
+        }
+        gpu_time_used  = get_time_us() - gpu_time_used;
+        rocblas_gflops = symm_gflop_count<T>(side, M, N) * number_hot_calls / gpu_time_used * 1e6;
+
+        std::cout << "side,uplo,M,N,alpha,lda,ldb,beta,ldc,rocblas-Gflops,us";
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << ",CPU-Gflops,us,norm-error";
+
+        std::cout << std::endl;
+
+        std::cout << arg.side << "," << arg.uplo << "," << M << "," << N << ","
+                  << arg.get_alpha<T>() << "," << lda << "," << ldb << "," << arg.get_beta<T>()
+                  << "," << ldc << "," << rocblas_gflops << "," << gpu_time_used / number_hot_calls;
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error;
+
+        std::cout << std::endl;
+    }
+}
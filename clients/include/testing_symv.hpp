@@ -6,6 +6,7 @@
 #include "flops.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
 #include "rocblas_init.hpp"
 #include "rocblas_math.hpp"
 #include "rocblas_random.hpp"
@@ -14,7 +15,65 @@
 #include "unit.hpp"
 #include "utility.hpp"
 
-template <typename T>
+// HERM selects hemv instead of symv
+template <typename T, bool HERM = false>
+void testing_symv_bad_arg(const Arguments& arg)
+{
+    const rocblas_int N     = 100;
+    const rocblas_int lda   = 100;
+    const rocblas_int incx  = 1;
+    const rocblas_int incy  = 1;
+    const T           alpha = 1.0;
+    const T           beta  = 1.0;
+
+    const rocblas_fill uplo = rocblas_fill_upper;
+
+    rocblas_local_handle handle;
+
+    size_t size_A = lda * static_cast<size_t>(N);
+    size_t size_x = N * static_cast<size_t>(incx);
+    size_t size_y = N * static_cast<size_t>(incy);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_y);
+    if(!dA || !dx || !dy)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symv<T, HERM>(handle, uplo, N, &alpha, nullptr, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symv<T, HERM>(handle, uplo, N, &alpha, dA, lda, nullptr, incx, &beta, dy, incy),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symv<T, HERM>(handle, uplo, N, &alpha, dA, lda, dx, incx, &beta, nullptr, incy),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symv<T, HERM>(handle, uplo, N, nullptr, dA, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symv<T, HERM>(handle, uplo, N, &alpha, dA, lda, dx, incx, nullptr, dy, incy),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symv<T, HERM>(
+            handle, rocblas_fill_full, N, &alpha, dA, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_symv<T, HERM>(nullptr, uplo, N, &alpha, dA, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_invalid_handle);
+}
+
+template <typename T, bool HERM = false>
 void testing_symv(const Arguments& arg)
 {
     rocblas_int N    = arg.N;
@@ -22,19 +81,15 @@ void testing_symv(const Arguments& arg)
     rocblas_int incx = arg.incx;
     rocblas_int incy = arg.incy;
 
-    T alpha(arg.alpha);
-    T beta(arg.beta);
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
 
     rocblas_fill uplo = char2rocblas_fill(arg.uplo);
 
-    rocblas_int size_A = lda * N;
-    rocblas_int size_X = N * incx;
-    rocblas_int size_Y = N * incy;
-
     rocblas_local_handle handle;
 
     // argument sanity check before allocating invalid memory
-    if(N < 0 || lda < 0 || incx < 0 || incy < 0)
+    if(N <= 0 || lda < N || lda < 1 || !incx || !incy)
     {
         static const size_t safe_size = 100;
         device_vector<T>    dA(safe_size);
@@ -47,120 +102,161 @@ void testing_symv(const Arguments& arg)
         }
 
         EXPECT_ROCBLAS_STATUS(
-            rocblas_symv<T>(handle, uplo, N, &alpha, dA, lda, dx, incx, &beta, dy, incy),
-            rocblas_status_invalid_size);
+            rocblas_symv<T, HERM>(handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy),
+            N < 0 || lda < N || lda < 1 || !incx || !incy ? rocblas_status_invalid_size
+                                                          : rocblas_status_success);
         return;
     }
 
-    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
-    host_vector<T> hA(size_A);
-    host_vector<T> hx(size_X);
-    host_vector<T> hy(size_Y);
-    host_vector<T> hz(size_Y);
+    size_t abs_incx = incx >= 0 ? incx : -incx;
+    size_t abs_incy = incy >= 0 ? incy : -incy;
 
-    double gpu_time_used, cpu_time_used;
-    double rocblas_gflops, cblas_gflops;
-    double rocblas_error;
+    size_t size_A = lda * static_cast<size_t>(N);
+    size_t size_x = N * abs_incx;
+    size_t size_y = N * abs_incy;
 
-    char char_fill = arg.uplo;
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hx(size_x);
+    host_vector<T> hy_1(size_y);
+    host_vector<T> hy_2(size_y);
+    host_vector<T> hy_3(size_y);
+    host_vector<T> hy_gold(size_y);
 
     device_vector<T> dA(size_A);
-    device_vector<T> dx(size_X);
-    device_vector<T> dy(size_Y);
-    if(!dA || !dx || !dy)
+    device_vector<T> dx(size_x);
+    device_vector<T> dy_1(size_y);
+    device_vector<T> dy_2(size_y);
+    device_vector<T> dy_3(size_y);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    if(!dA || !dx || !dy_1 || !dy_2 || !dy_3 || !d_alpha || !d_beta)
     {
         CHECK_HIP_ERROR(hipErrorOutOfMemory);
         return;
     }
 
-    // Initial Data on CPU
+    // Initial Data on CPU. All of A is initialized, so that reads of the triangle which is not
+    // referenced by uplo would give results which differ from cblas.
     rocblas_seedrand();
-    rocblas_init_symmetric<T>(hA, N, lda);
-    rocblas_init<T>(hx, 1, N, incx);
-    rocblas_init<T>(hy, 1, N, incy);
+    rocblas_init<T>(hA, N, N, lda);
+    rocblas_init<T>(hx, 1, N, abs_incx);
+    if(rocblas_isnan(arg.beta))
+        rocblas_init_nan<T>(hy_1, 1, N, abs_incy);
+    else
+        rocblas_init<T>(hy_1, 1, N, abs_incy);
 
-    // copy vector is easy in STL; hz = hy: save a copy in hz which will be output of CPU BLAS
-    hz = hy;
+    hy_2    = hy_1;
+    hy_3    = hy_1;
+    hy_gold = hy_1;
 
     // copy data from CPU to device
-    hipMemcpy(dA, hA, sizeof(T) * lda * N, hipMemcpyHostToDevice);
-    hipMemcpy(dx, hx, sizeof(T) * N * incx, hipMemcpyHostToDevice);
-    hipMemcpy(dy, hy, sizeof(T) * N * incy, hipMemcpyHostToDevice);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops, rocblas_bandwidth;
+    double rocblas_error_1;
+    double rocblas_error_2;
 
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(arg.timing)
+    if(arg.unit_check || arg.norm_check)
     {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * size_y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_3, hy_3, sizeof(T) * size_y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
-    for(int iter = 0; iter < 1; iter++)
-    {
-        CHECK_ROCBLAS_ERROR(
-            rocblas_symv<T>(handle, uplo, N, &alpha, dA, lda, dx, incx, &beta, dy, incy));
-    }
-    if(arg.timing)
-    {
-        gpu_time_used  = get_time_us() - gpu_time_used;
-        rocblas_gflops = symv_gflop_count<T>(N) / gpu_time_used * 1e6 * 1;
-    }
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_symv<T, HERM>(
+            handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy_1, incy));
 
-    // copy output from device to CPU
-    hipMemcpy(hy, dy, sizeof(T) * N * incy, hipMemcpyDeviceToHost);
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_symv<T, HERM>(
+            handle, uplo, N, d_alpha, dA, lda, dx, incx, d_beta, dy_2, incy));
 
-    if(arg.unit_check || arg.norm_check)
-    {
-        /* =====================================================================
-           CPU BLAS
-        =================================================================== */
-        if(arg.timing)
-        {
-            cpu_time_used = get_time_us();
-        }
+        // Without room for the workspace, the kernel which reads A twice is used
+        size_t query_size;
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        rocblas_symv<T, HERM>(handle, uplo, N, d_alpha, dA, lda, dx, incx, d_beta, dy_3, incy);
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &query_size));
 
-        cblas_symv<T>(uplo, N, alpha, hA, lda, hx, incx, beta, hz, incy);
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, 64));
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_symv<T, HERM>(handle, uplo, N, d_alpha, dA, lda, dx, incx, d_beta, dy_3, incy),
+            query_size > 64 ? rocblas_status_perf_degraded : rocblas_status_success);
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, 0));
 
-        if(arg.timing)
-        {
-            cpu_time_used = get_time_us() - cpu_time_used;
-            cblas_gflops  = symv_gflop_count<T>(N) / cpu_time_used * 1e6;
-        }
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_3, dy_3, sizeof(T) * size_y, hipMemcpyDeviceToHost));
 
-        if(arg.unit_check)
-        {
-            unit_check_general<T>(1, N, incy, hz, hy);
-        }
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+        cblas_symv<T, HERM>(uplo, N, h_alpha, hA, lda, hx, incx, h_beta, hy_gold, incy);
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = symv_gflop_count<T>(N) / cpu_time_used * 1e6;
 
-#if 0
-        for(int i = 0; i < 32; i++)
+        if(arg.unit_check)
         {
-            printf("CPU[%d]=%f, GPU[%d]=%f\n", i, hz[i], i, hy[i]);
+            unit_check_general<T>(1, N, abs_incy, hy_gold, hy_1);
+            unit_check_general<T>(1, N, abs_incy, hy_gold, hy_2);
+            unit_check_general<T>(1, N, abs_incy, hy_gold, hy_3);
         }
-#endif
 
         if(arg.norm_check)
         {
-            rocblas_error = norm_check_general<T>('F', 1, N, incy, hz, hy);
+            rocblas_error_1 = norm_check_general<T>('F', 1, N, abs_incy, hy_gold, hy_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, N, abs_incy, hy_gold, hy_2);
         }
     }
 
     if(arg.timing)
     {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_symv<T, HERM>(
+                handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy_1, incy);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_symv<T, HERM>(
+                handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy_1, incy);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = symv_gflop_count<T>(N) / gpu_time_used * 1e6;
+
+        // Only one triangle of A is read
+        rocblas_bandwidth = (0.5 * N * (N + 1)) * sizeof(T) / gpu_time_used / 1e3;
+
         // only norm_check return an norm error, unit check won't return anything
-        std::cout << "N, lda, rocblas-Gflops (us) ";
+        std::cout << "uplo,N,alpha,lda,incx,beta,incy,rocblas-Gflops,rocblas-GB/s,";
         if(arg.norm_check)
         {
-            std::cout << "CPU-Gflops(us), norm-error";
+            std::cout << "CPU-Gflops,norm_error_host_ptr,norm_error_device_ptr";
         }
         std::cout << std::endl;
 
-        std::cout << N << ',' << lda << ',' << rocblas_gflops << "(" << gpu_time_used << "),";
+        std::cout << arg.uplo << "," << N << "," << h_alpha << "," << lda << "," << incx << ","
+                  << h_beta << "," << incy << "," << rocblas_gflops << "," << rocblas_bandwidth
+                  << ",";
 
         if(arg.norm_check)
         {
-            std::cout << cblas_gflops << "(" << cpu_time_used << "),";
-            std::cout << rocblas_error;
+            std::cout << cblas_gflops << ',';
+            std::cout << rocblas_error_1 << ',' << rocblas_error_2;
         }
 
         std::cout << std::endl;
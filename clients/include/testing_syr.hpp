@@ -14,14 +14,14 @@
 #include "unit.hpp"
 #include "utility.hpp"
 
-template <typename T>
+template <typename T, typename U = T>
 void testing_syr_bad_arg()
 {
     rocblas_fill         uplo  = rocblas_fill_upper;
     rocblas_int          N     = 100;
     rocblas_int          incx  = 1;
     rocblas_int          lda   = 100;
-    T                    alpha = 0.6;
+    U                    alpha = 0.6;
     rocblas_local_handle handle;
 
     size_t abs_incx = incx >= 0 ? incx : -incx;
@@ -37,23 +37,23 @@ void testing_syr_bad_arg()
         return;
     }
 
-    EXPECT_ROCBLAS_STATUS(rocblas_syr<T>(handle, uplo, N, &alpha, nullptr, incx, dA_1, lda),
+    EXPECT_ROCBLAS_STATUS(rocblas_syr<T, U>(handle, uplo, N, &alpha, nullptr, incx, dA_1, lda),
                           rocblas_status_invalid_pointer);
 
-    EXPECT_ROCBLAS_STATUS(rocblas_syr<T>(handle, uplo, N, &alpha, dx, incx, nullptr, lda),
+    EXPECT_ROCBLAS_STATUS(rocblas_syr<T, U>(handle, uplo, N, &alpha, dx, incx, nullptr, lda),
                           rocblas_status_invalid_pointer);
 
-    EXPECT_ROCBLAS_STATUS(rocblas_syr<T>(nullptr, uplo, N, &alpha, dx, incx, dA_1, lda),
+    EXPECT_ROCBLAS_STATUS(rocblas_syr<T, U>(nullptr, uplo, N, &alpha, dx, incx, dA_1, lda),
                           rocblas_status_invalid_handle);
 }
 
-template <typename T>
+template <typename T, typename U = T>
 void testing_syr(const Arguments& arg)
 {
     rocblas_int          N       = arg.N;
     rocblas_int          incx    = arg.incx;
     rocblas_int          lda     = arg.lda;
-    T                    h_alpha = arg.get_alpha<T>();
+    U                    h_alpha = arg.get_alpha<U>();
     rocblas_fill         uplo    = char2rocblas_fill(arg.uplo);
     rocblas_local_handle handle;
 
@@ -70,7 +70,7 @@ void testing_syr(const Arguments& arg)
             return;
         }
 
-        EXPECT_ROCBLAS_STATUS(rocblas_syr<T>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda),
+        EXPECT_ROCBLAS_STATUS(rocblas_syr<T, U>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda),
                               rocblas_status_invalid_size);
 
         return;
@@ -90,7 +90,7 @@ void testing_syr(const Arguments& arg)
     device_vector<T> dA_1(size_A);
     device_vector<T> dA_2(size_A);
     device_vector<T> dx(size_x);
-    device_vector<T> d_alpha(1);
+    device_vector<U> d_alpha(1);
     if(!dA_1 || !dA_2 || !dx || !d_alpha)
     {
         CHECK_HIP_ERROR(hipErrorOutOfMemory);
@@ -123,13 +123,13 @@ void testing_syr(const Arguments& arg)
     {
         // copy data from CPU to device
         CHECK_HIP_ERROR(hipMemcpy(dA_2, hA_2, sizeof(T) * lda * N, hipMemcpyHostToDevice));
-        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(U), hipMemcpyHostToDevice));
 
         CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
-        CHECK_ROCBLAS_ERROR(rocblas_syr<T>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda));
+        CHECK_ROCBLAS_ERROR(rocblas_syr<T, U>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda));
 
         CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
-        CHECK_ROCBLAS_ERROR(rocblas_syr<T>(handle, uplo, N, d_alpha, dx, incx, dA_2, lda));
+        CHECK_ROCBLAS_ERROR(rocblas_syr<T, U>(handle, uplo, N, d_alpha, dx, incx, dA_2, lda));
 
         // copy output from device to CPU
         hipMemcpy(hA_1, dA_1, sizeof(T) * N * lda, hipMemcpyDeviceToHost);
@@ -137,7 +137,7 @@ void testing_syr(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us();
-        cblas_syr<T>(uplo, N, h_alpha, hx, incx, hA_gold, lda);
+        cblas_syr<T, U>(uplo, N, h_alpha, hx, incx, hA_gold, lda);
         cpu_time_used = get_time_us() - cpu_time_used;
         cblas_gflops  = syr_gflop_count<T>(N) / cpu_time_used * 1e6;
 
@@ -162,14 +162,14 @@ void testing_syr(const Arguments& arg)
 
         for(int iter = 0; iter < number_cold_calls; iter++)
         {
-            rocblas_syr<T>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda);
+            rocblas_syr<T, U>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda);
         }
 
         gpu_time_used = get_time_us(); // in microseconds
 
         for(int iter = 0; iter < number_hot_calls; iter++)
         {
-            rocblas_syr<T>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda);
+            rocblas_syr<T, U>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda);
         }
 
         gpu_time_used     = (get_time_us() - gpu_time_used) / number_hot_calls;
@@ -0,0 +1,324 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// U is the type of beta, which is real for her2k
+template <typename T, typename U = T>
+void testing_syr2k_batched_bad_arg(const Arguments& arg)
+{
+    const rocblas_int N           = 100;
+    const rocblas_int K           = 100;
+    const rocblas_int lda         = 100;
+    const rocblas_int ldb         = 100;
+    const rocblas_int ldc         = 100;
+    const T           alpha       = 1.0;
+    const U           beta        = 1.0;
+    const rocblas_int batch_count = 5;
+
+    const rocblas_fill      uplo   = rocblas_fill_upper;
+    const rocblas_operation transA = rocblas_operation_none;
+
+    rocblas_local_handle handle;
+
+    // allocate memory on device
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dB(batch_count);
+    device_vector<T*, 0, T> dC(batch_count);
+    if(!dA || !dB || !dC)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syr2k_batched<T, U>(
+            handle, uplo, transA, N, K, &alpha, nullptr, lda, dB, ldb, &beta, dC, ldc, batch_count),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syr2k_batched<T, U>(
+            handle, uplo, transA, N, K, &alpha, dA, lda, nullptr, ldb, &beta, dC, ldc, batch_count),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syr2k_batched<T, U>(
+            handle, uplo, transA, N, K, &alpha, dA, lda, dB, ldb, &beta, nullptr, ldc, batch_count),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syr2k_batched<T, U>(
+            handle, uplo, transA, N, K, nullptr, dA, lda, dB, ldb, &beta, dC, ldc, batch_count),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syr2k_batched<T, U>(
+            handle, uplo, transA, N, K, &alpha, dA, lda, dB, ldb, nullptr, dC, ldc, batch_count),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syr2k_batched<T, U>(
+            nullptr, uplo, transA, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc, batch_count),
+        rocblas_status_invalid_handle);
+}
+
+template <typename T, typename U = T>
+void testing_syr2k_batched(const Arguments& arg)
+{
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+
+    rocblas_int N           = arg.N;
+    rocblas_int K           = arg.K;
+    rocblas_int lda         = arg.lda;
+    rocblas_int ldb         = arg.ldb;
+    rocblas_int ldc         = arg.ldc;
+    rocblas_int batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    U h_beta  = arg.get_beta<U>();
+
+    double               gpu_time_used, cpu_time_used;
+    double               rocblas_gflops, cblas_gflops;
+    double               rocblas_error = 0.0;
+    rocblas_local_handle handle;
+
+    rocblas_int A_row = transA == rocblas_operation_none ? N : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : N;
+
+    // check here to prevent undefined memory allocation error
+    // Note: K==0 is not an early exit, since C still needs to be multiplied by beta
+    if(N <= 0 || K < 0 || lda < A_row || lda < 1 || ldb < A_row || ldb < 1 || ldc < N
+       || batch_count <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        device_vector<T*, 0, T> dA(safe_size);
+        device_vector<T*, 0, T> dB(safe_size);
+        device_vector<T*, 0, T> dC(safe_size);
+        if(!dA || !dB || !dC)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCBLAS_STATUS(rocblas_syr2k_batched<T, U>(handle,
+                                                          uplo,
+                                                          transA,
+                                                          N,
+                                                          K,
+                                                          &h_alpha,
+                                                          dA,
+                                                          lda,
+                                                          dB,
+                                                          ldb,
+                                                          &h_beta,
+                                                          dC,
+                                                          ldc,
+                                                          batch_count),
+                              N < 0 || K < 0 || lda < A_row || lda < 1 || ldb < A_row || ldb < 1
+                                      || ldc < N || ldc < 1 || batch_count < 0
+                                  ? rocblas_status_invalid_size
+                                  : rocblas_status_success);
+        return;
+    }
+
+    const auto size_A = size_t(lda) * size_t(A_col);
+    const auto size_B = size_t(ldb) * size_t(A_col);
+    const auto size_C = size_t(ldc) * size_t(N);
+
+    // Device-arrays of pointers to device memory
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dB(batch_count);
+    device_vector<T*, 0, T> dC(batch_count);
+    device_vector<T>        d_alpha(1);
+    device_vector<U>        d_beta(1);
+
+    // Host-arrays of pointers to device memory
+    // (intermediate arrays used for the transfers)
+    device_batch_vector<T> A(batch_count, size_A);
+    device_batch_vector<T> B(batch_count, size_B);
+    device_batch_vector<T> C(batch_count, size_C);
+
+    int last = batch_count - 1;
+    if(!dA || !dB || !dC || !d_alpha || !d_beta || (!A[last] && size_A) || (!B[last] && size_B)
+       || (!C[last] && size_C))
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Host-arrays of pointers to host memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hB[batch_count];
+    host_vector<T> hC_1[batch_count];
+    host_vector<T> hC_2[batch_count];
+    host_vector<T> hC_gold[batch_count];
+    for(int b = 0; b < batch_count; ++b)
+    {
+        hA[b]      = host_vector<T>(size_A);
+        hB[b]      = host_vector<T>(size_B);
+        hC_1[b]    = host_vector<T>(size_C);
+        hC_2[b]    = host_vector<T>(size_C);
+        hC_gold[b] = host_vector<T>(size_C);
+    }
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    for(int b = 0; b < batch_count; ++b)
+    {
+        rocblas_init<T>(hA[b], A_row, A_col, lda);
+        rocblas_init_alternating_sign<T>(hB[b], A_row, A_col, ldb);
+        if(rocblas_isnan(arg.beta) || rocblas_isnan(arg.betai))
+            rocblas_init_nan<T>(hC_1[b], N, N, ldc);
+        else
+            rocblas_init<T>(hC_1[b], N, N, ldc);
+        hC_2[b]    = hC_1[b];
+        hC_gold[b] = hC_1[b];
+    }
+
+    // copy data from CPU to device
+    for(int b = 0; b < batch_count; ++b)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(A[b], hA[b], sizeof(T) * size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(B[b], hB[b], sizeof(T) * size_B, hipMemcpyHostToDevice));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dA, A, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, B, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, C, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host
+        for(int b = 0; b < batch_count; ++b)
+            CHECK_HIP_ERROR(hipMemcpy(C[b], hC_1[b], sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_syr2k_batched<T, U>(handle,
+                                                        uplo,
+                                                        transA,
+                                                        N,
+                                                        K,
+                                                        &h_alpha,
+                                                        dA,
+                                                        lda,
+                                                        dB,
+                                                        ldb,
+                                                        &h_beta,
+                                                        dC,
+                                                        ldc,
+                                                        batch_count));
+        for(int b = 0; b < batch_count; ++b)
+            CHECK_HIP_ERROR(hipMemcpy(hC_1[b], C[b], sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        for(int b = 0; b < batch_count; ++b)
+            CHECK_HIP_ERROR(hipMemcpy(C[b], hC_2[b], sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(U), hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_syr2k_batched<T, U>(
+            handle, uplo, transA, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc, batch_count));
+        for(int b = 0; b < batch_count; ++b)
+            CHECK_HIP_ERROR(hipMemcpy(hC_2[b], C[b], sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+        for(int b = 0; b < batch_count; ++b)
+        {
+            cblas_syr2k<T, U>(
+                uplo, transA, N, K, h_alpha, hA[b], lda, hB[b], ldb, h_beta, hC_gold[b], ldc);
+        }
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = batch_count * syr2k_gflop_count<T>(N, K) / cpu_time_used * 1e6;
+
+        // The whole of C is compared, so that writes to the other triangle are caught
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(N, N, batch_count, ldc, hC_gold, hC_1);
+            unit_check_general<T>(N, N, batch_count, ldc, hC_gold, hC_2);
+        }
+
+        if(arg.norm_check)
+        {
+            auto err1 = std::abs(norm_check_general<T>('F', N, N, ldc, batch_count, hC_gold, hC_1));
+            auto err2 = std::abs(norm_check_general<T>('F', N, N, ldc, batch_count, hC_gold, hC_2));
+            rocblas_error = err1 > err2 ? err1 : err2;
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_syr2k_batched<T, U>(handle,
+                                                            uplo,
+                                                            transA,
+                                                            N,
+                                                            K,
+                                                            &h_alpha,
+                                                            dA,
+                                                            lda,
+                                                            dB,
+                                                            ldb,
+                                                            &h_beta,
+                                                            dC,
+                                                            ldc,
+                                                            batch_count));
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_syr2k_batched<T, U>(handle,
+                                        uplo,
+                                        transA,
+                                        N,
+                                        K,
+                                        &h_alpha,
+                                        dA,
+                                        lda,
+                                        dB,
+                                        ldb,
+                                        &h_beta,
+                                        dC,
+                                        ldc,
+                                        batch_count);
+        }
+        gpu_time_used  = get_time_us() - gpu_time_used;
+        rocblas_gflops = batch_count * syr2k_gflop_count<T>(N, K) * number_hot_calls
+                         / gpu_time_used * 1e6;
+
+        std::cout << "uplo,transA,N,K,alpha,lda,ldb,beta,ldc,batch_count,rocblas-Gflops,us";
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << ",CPU-Gflops,us,norm-error";
+
+        std::cout << std::endl;
+
+        std::cout << arg.uplo << "," << arg.transA << "," << N << "," << K << ","
+                  << arg.get_alpha<T>() << "," << lda << "," << ldb << "," << arg.get_beta<U>()
+                  << "," << ldc << "," << batch_count << "," << rocblas_gflops << ","
+                  << gpu_time_used / number_hot_calls;
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error;
+
+        std::cout << std::endl;
+    }
+}
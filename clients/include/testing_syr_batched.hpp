@@ -14,14 +14,14 @@
 #include "unit.hpp"
 #include "utility.hpp"
 
-template <typename T>
+template <typename T, typename U = T>
 void testing_syr_batched_bad_arg()
 {
     rocblas_fill         uplo        = rocblas_fill_upper;
     rocblas_int          N           = 100;
     rocblas_int          incx        = 1;
     rocblas_int          lda         = 100;
-    T                    alpha       = 0.6;
+    U                    alpha       = 0.6;
     rocblas_int          batch_count = 2;
     rocblas_local_handle handle;
 
@@ -39,25 +39,25 @@ void testing_syr_batched_bad_arg()
     }
 
     EXPECT_ROCBLAS_STATUS(
-        rocblas_syr_batched<T>(handle, uplo, N, &alpha, nullptr, incx, dA_1, lda, batch_count),
+        rocblas_syr_batched<T, U>(handle, uplo, N, &alpha, nullptr, incx, dA_1, lda, batch_count),
         rocblas_status_invalid_pointer);
 
     EXPECT_ROCBLAS_STATUS(
-        rocblas_syr_batched<T>(handle, uplo, N, &alpha, dx, incx, nullptr, lda, batch_count),
+        rocblas_syr_batched<T, U>(handle, uplo, N, &alpha, dx, incx, nullptr, lda, batch_count),
         rocblas_status_invalid_pointer);
 
     EXPECT_ROCBLAS_STATUS(
-        rocblas_syr_batched<T>(nullptr, uplo, N, &alpha, dx, incx, dA_1, lda, batch_count),
+        rocblas_syr_batched<T, U>(nullptr, uplo, N, &alpha, dx, incx, dA_1, lda, batch_count),
         rocblas_status_invalid_handle);
 }
 
-template <typename T>
+template <typename T, typename U = T>
 void testing_syr_batched(const Arguments& arg)
 {
     rocblas_int  N           = arg.N;
     rocblas_int  incx        = arg.incx;
     rocblas_int  lda         = arg.lda;
-    T            h_alpha     = arg.get_alpha<T>();
+    U            h_alpha     = arg.get_alpha<U>();
     rocblas_fill uplo        = char2rocblas_fill(arg.uplo);
     rocblas_int  batch_count = arg.batch_count;
 
@@ -77,7 +77,7 @@ void testing_syr_batched(const Arguments& arg)
         }
 
         EXPECT_ROCBLAS_STATUS(
-            rocblas_syr_batched<T>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda, batch_count),
+            rocblas_syr_batched<T, U>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda, batch_count),
             N < 0 || lda < N || lda < 1 || !incx || batch_count < 0 ? rocblas_status_invalid_size
                                                                     : rocblas_status_success);
         return;
@@ -108,7 +108,7 @@ void testing_syr_batched(const Arguments& arg)
     device_batch_vector<T> dA_1(batch_count, size_A);
     device_batch_vector<T> dA_2(batch_count, size_A);
     device_batch_vector<T> dx(batch_count, size_x);
-    device_vector<T>       d_alpha(1);
+    device_vector<U>       d_alpha(1);
     if(!dA_1 || !dA_2 || !dx || !d_alpha)
     {
         CHECK_HIP_ERROR(hipErrorOutOfMemory);
@@ -166,14 +166,14 @@ void testing_syr_batched(const Arguments& arg)
     {
         // copy data from CPU to device
         //CHECK_HIP_ERROR(hipMemcpy(dA_2, hA_2, sizeof(T) * lda * N, hipMemcpyHostToDevice));
-        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(U), hipMemcpyHostToDevice));
 
         CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
-        CHECK_ROCBLAS_ERROR(rocblas_syr_batched<T>(
+        CHECK_ROCBLAS_ERROR(rocblas_syr_batched<T, U>(
             handle, uplo, N, &h_alpha, dx_pvec, incx, dA1_pvec, lda, batch_count));
 
         CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
-        CHECK_ROCBLAS_ERROR(rocblas_syr_batched<T>(
+        CHECK_ROCBLAS_ERROR(rocblas_syr_batched<T, U>(
             handle, uplo, N, d_alpha, dx_pvec, incx, dA2_pvec, lda, batch_count));
 
         // copy output from device to CPU
@@ -187,7 +187,7 @@ void testing_syr_batched(const Arguments& arg)
         cpu_time_used = get_time_us();
         for(int i = 0; i < batch_count; i++)
         {
-            cblas_syr<T>(uplo, N, h_alpha, hx[i], incx, hA_gold[i], lda);
+            cblas_syr<T, U>(uplo, N, h_alpha, hx[i], incx, hA_gold[i], lda);
         }
         cpu_time_used = get_time_us() - cpu_time_used;
         cblas_gflops  = batch_count * syr_gflop_count<T>(N) / cpu_time_used * 1e6;
@@ -219,14 +219,14 @@ void testing_syr_batched(const Arguments& arg)
 
         for(int iter = 0; iter < number_cold_calls; iter++)
         {
-            rocblas_syr_batched<T>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda, batch_count);
+            rocblas_syr_batched<T, U>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda, batch_count);
         }
 
         gpu_time_used = get_time_us(); // in microseconds
 
         for(int iter = 0; iter < number_hot_calls; iter++)
         {
-            rocblas_syr_batched<T>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda, batch_count);
+            rocblas_syr_batched<T, U>(handle, uplo, N, &h_alpha, dx, incx, dA_1, lda, batch_count);
         }
 
         gpu_time_used     = (get_time_us() - gpu_time_used) / number_hot_calls;
@@ -0,0 +1,230 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// U is the type of alpha and beta, which is real for herk
+template <typename T, typename U = T>
+void testing_syrk_bad_arg(const Arguments& arg)
+{
+    const rocblas_int N     = 100;
+    const rocblas_int K     = 100;
+    const rocblas_int lda   = 100;
+    const rocblas_int ldc   = 100;
+    const U           alpha = 1.0;
+    const U           beta  = 1.0;
+
+    const rocblas_fill      uplo   = rocblas_fill_upper;
+    const rocblas_operation transA = rocblas_operation_none;
+
+    rocblas_local_handle handle;
+
+    size_t size_A = size_t(lda) * K;
+    size_t size_C = size_t(ldc) * N;
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dC(size_C);
+    if(!dA || !dC)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk<T, U>(handle, uplo, transA, N, K, &alpha, nullptr, lda, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk<T, U>(handle, uplo, transA, N, K, &alpha, dA, lda, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk<T, U>(handle, uplo, transA, N, K, nullptr, dA, lda, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk<T, U>(handle, uplo, transA, N, K, &alpha, dA, lda, nullptr, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk<T, U>(
+            handle, rocblas_fill_full, transA, N, K, &alpha, dA, lda, &beta, dC, ldc),
+        rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_syrk<T, U>(nullptr, uplo, transA, N, K, &alpha, dA, lda, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+}
+
+template <typename T, typename U = T>
+void testing_syrk(const Arguments& arg)
+{
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+
+    rocblas_int N   = arg.N;
+    rocblas_int K   = arg.K;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldc = arg.ldc;
+
+    U h_alpha = arg.get_alpha<U>();
+    U h_beta  = arg.get_beta<U>();
+
+    double               gpu_time_used, cpu_time_used;
+    double               rocblas_gflops, cblas_gflops;
+    double               rocblas_error = 0.0;
+    rocblas_local_handle handle;
+
+    rocblas_int A_row = transA == rocblas_operation_none ? N : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : N;
+
+    // check here to prevent undefined memory allocation error
+    // Note: K==0 is not an early exit, since C still needs to be multiplied by beta
+    if(N <= 0 || K < 0 || lda < A_row || lda < 1 || ldc < N)
+    {
+        static const size_t safe_size = 100;
+
+        device_vector<T> dA(safe_size);
+        device_vector<T> dC(safe_size);
+        if(!dA || !dC)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_syrk<T, U>(handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc),
+            N < 0 || K < 0 || lda < A_row || lda < 1 || ldc < N || ldc < 1
+                ? rocblas_status_invalid_size
+                : rocblas_status_success);
+        return;
+    }
+
+    const auto size_A = size_t(lda) * size_t(A_col);
+    const auto size_C = size_t(ldc) * size_t(N);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hC_1(size_C);
+    host_vector<T> hC_2(size_C);
+    host_vector<T> hC_gold(size_C);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dC(size_C);
+    device_vector<U> d_alpha(1);
+    device_vector<U> d_beta(1);
+    if(!dA || !dC || !d_alpha || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    rocblas_init<T>(hA, A_row, A_col, lda);
+    if(rocblas_isnan(arg.beta) || rocblas_isnan(arg.betai))
+        rocblas_init_nan<T>(hC_1, N, N, ldc);
+    else
+        rocblas_init<T>(hC_1, N, N, ldc);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_1, sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_syrk<T, U>(handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc));
+        CHECK_HIP_ERROR(hipMemcpy(hC_1, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_2, sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(U), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(U), hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_syrk<T, U>(handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us();
+        }
+
+        cblas_syrk<T, U>(uplo, transA, N, K, h_alpha, hA, lda, h_beta, hC_gold, ldc);
+
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us() - cpu_time_used;
+            cblas_gflops  = syrk_gflop_count<T>(N, K) / cpu_time_used * 1e6;
+        }
+
+        // The whole of C is compared, so that writes to the other triangle are caught
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(N, N, ldc, hC_gold, hC_1);
+            unit_check_general<T>(N, N, ldc, hC_gold, hC_2);
+        }
+
+        if(arg.norm_check)
+        {
+            auto err1     = std::abs(norm_check_general<T>('F', N, N, ldc, hC_gold, hC_1));
+            auto err2     = std::abs(norm_check_general<T>('F', N, N, ldc, hC_gold, hC_2));
+            rocblas_error = err1 > err2 ? err1 : err2;
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_syrk<T, U>(
+                handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc));
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_syrk<T, U>(handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc);
+        }
+        gpu_time_used  = get_time_us() - gpu_time_used;
+        rocblas_gflops = syrk_gflop_count<T>(N, K) * number_hot_calls / gpu_time_used * 1e6;
+
+        std::cout << "uplo,transA,N,K,alpha,lda,beta,ldc,rocblas-Gflops,us";
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << ",CPU-Gflops,us,norm-error";
+
+        std::cout << std::endl;
+
+        std::cout << arg.uplo << "," << arg.transA << "," << N << "," << K << ","
+                  << arg.get_alpha<U>() << "," << lda << "," << arg.get_beta<U>() << "," << ldc
+                  << "," << rocblas_gflops << "," << gpu_time_used / number_hot_calls;
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error;
+
+        std::cout << std::endl;
+    }
+}
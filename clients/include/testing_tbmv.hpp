@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_tbmv_bad_arg(const Arguments& arg)
+{
+    const rocblas_int N    = 100;
+    const rocblas_int K    = 10;
+    const rocblas_int lda  = 100;
+    const rocblas_int incx = 1;
+
+    const rocblas_fill      uplo   = rocblas_fill_upper;
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_diagonal  diag   = rocblas_diagonal_non_unit;
+
+    rocblas_local_handle handle;
+
+    size_t size_A = lda * static_cast<size_t>(N);
+    size_t size_x = N * static_cast<size_t>(incx);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dx(size_x);
+    if(!dA || !dx)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_tbmv<T>(handle, uplo, transA, diag, N, K, nullptr, lda, dx, incx),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_tbmv<T>(handle, uplo, transA, diag, N, K, dA, lda, nullptr, incx),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_tbmv<T>(handle, rocblas_fill_full, transA, diag, N, K, dA, lda, dx, incx),
+        rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_tbmv<T>(nullptr, uplo, transA, diag, N, K, dA, lda, dx, incx),
+        rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_tbmv(const Arguments& arg)
+{
+    rocblas_int N    = arg.N;
+    rocblas_int K    = arg.K;
+    rocblas_int lda  = arg.lda;
+    rocblas_int incx = arg.incx;
+
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_diagonal  diag   = char2rocblas_diagonal(arg.diag);
+
+    rocblas_local_handle handle;
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || K < 0 || lda < K + 1 || !incx)
+    {
+        static const size_t safe_size = 100;
+        device_vector<T>    dA(safe_size);
+        device_vector<T>    dx(safe_size);
+        if(!dA || !dx)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_tbmv<T>(handle, uplo, transA, diag, N, K, dA, lda, dx, incx),
+            N < 0 || K < 0 || lda < K + 1 || !incx ? rocblas_status_invalid_size
+                                                   : rocblas_status_success);
+        return;
+    }
+
+    size_t abs_incx = incx >= 0 ? incx : -incx;
+
+    size_t size_A = lda * static_cast<size_t>(N);
+    size_t size_x = N * abs_incx;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hx_1(size_x);
+    host_vector<T> hx_2(size_x);
+    host_vector<T> hx_gold(size_x);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dx_1(size_x);
+    device_vector<T> dx_2(size_x);
+    if(!dA || !dx_1 || !dx_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Initial Data on CPU. All of the band storage is initialized, including the corner which is
+    // not part of A and the diagonal when it is unit, so that reads of them would give results
+    // which differ from cblas.
+    rocblas_seedrand();
+    rocblas_init<T>(hA, lda, N, lda);
+    rocblas_init<T>(hx_1, 1, N, abs_incx);
+
+    hx_2    = hx_1;
+    hx_gold = hx_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_1, hx_1, sizeof(T) * size_x, hipMemcpyHostToDevice));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops, rocblas_bandwidth;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dx_2, hx_2, sizeof(T) * size_x, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_tbmv<T>(handle, uplo, transA, diag, N, K, dA, lda, dx_1, incx));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_tbmv<T>(handle, uplo, transA, diag, N, K, dA, lda, dx_2, incx));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hx_1, dx_1, sizeof(T) * size_x, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hx_2, dx_2, sizeof(T) * size_x, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+        cblas_tbmv<T>(uplo, transA, diag, N, K, hA, lda, hx_gold, incx);
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = tbmv_gflop_count<T>(N, K) / cpu_time_used * 1e6;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incx, hx_gold, hx_1);
+            unit_check_general<T>(1, N, abs_incx, hx_gold, hx_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, N, abs_incx, hx_gold, hx_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, N, abs_incx, hx_gold, hx_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_tbmv<T>(handle, uplo, transA, diag, N, K, dA, lda, dx_1, incx);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_tbmv<T>(handle, uplo, transA, diag, N, K, dA, lda, dx_1, incx);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = tbmv_gflop_count<T>(N, K) / gpu_time_used * 1e6;
+
+        // Only the stored band of A is read
+        rocblas_bandwidth = (K + 1.0) * N * sizeof(T) / gpu_time_used / 1e3;
+
+        // only norm_check return an norm error, unit check won't return anything
+        std::cout << "uplo,transA,diag,N,K,lda,incx,rocblas-Gflops,rocblas-GB/s,";
+        if(arg.norm_check)
+        {
+            std::cout << "CPU-Gflops,norm_error_host_ptr,norm_error_device_ptr";
+        }
+        std::cout << std::endl;
+
+        std::cout << arg.uplo << "," << arg.transA << "," << arg.diag << "," << N << "," << K
+                  << "," << lda << "," << incx << "," << rocblas_gflops << "," << rocblas_bandwidth
+                  << ",";
+
+        if(arg.norm_check)
+        {
+            std::cout << cblas_gflops << ',';
+            std::cout << rocblas_error_1 << ',' << rocblas_error_2;
+        }
+
+        std::cout << std::endl;
+    }
+}
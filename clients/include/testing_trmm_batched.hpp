@@ -0,0 +1,197 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_trmm_batched(const Arguments& arg)
+{
+    rocblas_side      side   = char2rocblas_side(arg.side);
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_diagonal  diag   = char2rocblas_diagonal(arg.diag);
+
+    rocblas_int M           = arg.M;
+    rocblas_int N           = arg.N;
+    rocblas_int lda         = arg.lda;
+    rocblas_int ldb         = arg.ldb;
+    rocblas_int batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    double               gpu_time_used, cpu_time_used;
+    double               rocblas_gflops, cblas_gflops;
+    double               rocblas_error = 0.0;
+    rocblas_local_handle handle;
+
+    // A is K by K, where K is M for the left side and N for the right side
+    rocblas_int K = side == rocblas_side_left ? M : N;
+
+    // check here to prevent undefined memory allocation error
+    if(M <= 0 || N <= 0 || lda < K || lda < 1 || ldb < M || ldb < 1 || batch_count <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        device_vector<T*, 0, T> dA(safe_size);
+        device_vector<T*, 0, T> dB(safe_size);
+        if(!dA || !dB)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_trmm_batched<T>(
+                handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb, batch_count),
+            M < 0 || N < 0 || lda < K || lda < 1 || ldb < M || ldb < 1 || batch_count < 0
+                ? rocblas_status_invalid_size
+                : rocblas_status_success);
+        return;
+    }
+
+    const auto size_A = size_t(lda) * size_t(K);
+    const auto size_B = size_t(ldb) * size_t(N);
+
+    // Device-arrays of pointers to device memory
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dB(batch_count);
+    device_vector<T>        d_alpha(1);
+
+    // Host-arrays of pointers to device memory
+    // (intermediate arrays used for the transfers)
+    device_batch_vector<T> A(batch_count, size_A);
+    device_batch_vector<T> B(batch_count, size_B);
+
+    int last = batch_count - 1;
+    if(!dA || !dB || !d_alpha || (!A[last] && size_A) || (!B[last] && size_B))
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Host-arrays of pointers to host memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hB_1[batch_count];
+    host_vector<T> hB_2[batch_count];
+    host_vector<T> hB_gold[batch_count];
+    for(int b = 0; b < batch_count; ++b)
+    {
+        hA[b]      = host_vector<T>(size_A);
+        hB_1[b]    = host_vector<T>(size_B);
+        hB_2[b]    = host_vector<T>(size_B);
+        hB_gold[b] = host_vector<T>(size_B);
+    }
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    for(int b = 0; b < batch_count; ++b)
+    {
+        rocblas_init<T>(hA[b], K, K, lda);
+        rocblas_init<T>(hB_1[b], M, N, ldb);
+        hB_2[b]    = hB_1[b];
+        hB_gold[b] = hB_1[b];
+    }
+
+    // copy data from CPU to device
+    for(int b = 0; b < batch_count; ++b)
+        CHECK_HIP_ERROR(hipMemcpy(A[b], hA[b], sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, A, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, B, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host
+        for(int b = 0; b < batch_count; ++b)
+            CHECK_HIP_ERROR(hipMemcpy(B[b], hB_1[b], sizeof(T) * size_B, hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_trmm_batched<T>(
+            handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb, batch_count));
+        for(int b = 0; b < batch_count; ++b)
+            CHECK_HIP_ERROR(hipMemcpy(hB_1[b], B[b], sizeof(T) * size_B, hipMemcpyDeviceToHost));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        // Restrict the device memory to two matrices, so that the batch is processed in chunks
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, 2 * sizeof(T) * M * N + 256));
+        for(int b = 0; b < batch_count; ++b)
+            CHECK_HIP_ERROR(hipMemcpy(B[b], hB_2[b], sizeof(T) * size_B, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_trmm_batched<T>(
+            handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb, batch_count));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, 0));
+        for(int b = 0; b < batch_count; ++b)
+            CHECK_HIP_ERROR(hipMemcpy(hB_2[b], B[b], sizeof(T) * size_B, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+        for(int b = 0; b < batch_count; ++b)
+            cblas_trmm<T>(side, uplo, transA, diag, M, N, h_alpha, hA[b], lda, hB_gold[b], ldb);
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = batch_count * trmm_gflop_count<T>(M, N, side) / cpu_time_used * 1e6;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, batch_count, ldb, hB_gold, hB_1);
+            unit_check_general<T>(M, N, batch_count, ldb, hB_gold, hB_2);
+        }
+
+        if(arg.norm_check)
+        {
+            auto err1 = std::abs(norm_check_general<T>('F', M, N, ldb, batch_count, hB_gold, hB_1));
+            auto err2 = std::abs(norm_check_general<T>('F', M, N, ldb, batch_count, hB_gold, hB_2));
+            rocblas_error = err1 > err2 ? err1 : err2;
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_trmm_batched<T>(
+                handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb, batch_count));
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_trmm_batched<T>(
+                handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb, batch_count);
+        }
+        gpu_time_used  = get_time_us() - gpu_time_used;
+        rocblas_gflops = batch_count * trmm_gflop_count<T>(M, N, side) * number_hot_calls
+                         / gpu_time_used * 1e6;
+
+        std::cout << "side,uplo,transA,diag,M,N,alpha,lda,ldb,batch_count,rocblas-Gflops,us";
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << ",CPU-Gflops,us,norm-error";
+
+        std::cout << std::endl;
+
+        std::cout << arg.side << "," << arg.uplo << "," << arg.transA << "," << arg.diag << ","
+                  << M << "," << N << "," << arg.get_alpha<T>() << "," << lda << "," << ldb << ","
+                  << batch_count << "," << rocblas_gflops << ","
+                  << gpu_time_used / number_hot_calls;
+
+        if(arg.unit_check || arg.norm_check)
+            std::cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error;
+
+        std::cout << std::endl;
+    }
+}
@@ -201,6 +201,16 @@ void testing_trsm(const Arguments& arg)
 
         CHECK_HIP_ERROR(hipMemcpy(hXorB_2, dXorB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
 
+        // The workspace size query bounds the size from a device memory size query
+        size_t minimum_size, optimal_size, query_size;
+        CHECK_ROCBLAS_ERROR(rocblas_trsm_workspace_size(
+            handle, side, M, N, 1, arg.compute_type, &minimum_size, &optimal_size));
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        rocblas_trsm<T>(handle, side, uplo, transA, diag, M, N, alpha_d, dA, lda, dXorB, ldb);
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &query_size));
+        EXPECT_LE(minimum_size, optimal_size);
+        EXPECT_LE(query_size, optimal_size);
+
         // Error Check
         // hXorB contains calculated X, so error is hX - hXorB
 
@@ -0,0 +1,525 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#define ERROR_EPS_MULTIPLIER 40
+#define RESIDUAL_EPS_MULTIPLIER 20
+
+// Maximum number of correction steps used by the tests
+#define TRSM_REFINE_MAX_ITERATIONS 10
+
+template <typename T>
+void testing_trsm_refine_bad_arg(const Arguments& arg)
+{
+    const rocblas_int M     = 100;
+    const rocblas_int N     = 100;
+    const rocblas_int lda   = 100;
+    const rocblas_int ldb   = 100;
+    const T           alpha = 1.0;
+
+    const rocblas_side      side   = rocblas_side_left;
+    const rocblas_fill      uplo   = rocblas_fill_lower;
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_diagonal  diag   = rocblas_diagonal_non_unit;
+
+    rocblas_local_handle handle;
+    rocblas_int          iterations;
+
+    size_t size_A = size_t(lda) * M;
+    size_t size_B = size_t(ldb) * N;
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    if(!dA || !dB)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm_refine<T>(nullptr,
+                                                 side,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 M,
+                                                 N,
+                                                 &alpha,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 0,
+                                                 TRSM_REFINE_MAX_ITERATIONS,
+                                                 &iterations),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm_refine<T>(handle,
+                                                 side,
+                                                 rocblas_fill_full,
+                                                 transA,
+                                                 diag,
+                                                 M,
+                                                 N,
+                                                 &alpha,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 0,
+                                                 TRSM_REFINE_MAX_ITERATIONS,
+                                                 &iterations),
+                          rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm_refine<T>(handle,
+                                                 side,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 M,
+                                                 N,
+                                                 &alpha,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 0,
+                                                 -1,
+                                                 &iterations),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm_refine<T>(handle,
+                                                 side,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 M,
+                                                 N,
+                                                 nullptr,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 0,
+                                                 TRSM_REFINE_MAX_ITERATIONS,
+                                                 &iterations),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm_refine<T>(handle,
+                                                 side,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 M,
+                                                 N,
+                                                 &alpha,
+                                                 nullptr,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 0,
+                                                 TRSM_REFINE_MAX_ITERATIONS,
+                                                 &iterations),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm_refine<T>(handle,
+                                                 side,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 M,
+                                                 N,
+                                                 &alpha,
+                                                 dA,
+                                                 lda,
+                                                 nullptr,
+                                                 ldb,
+                                                 0,
+                                                 TRSM_REFINE_MAX_ITERATIONS,
+                                                 &iterations),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_trsm_refine<T>(handle,
+                                                 side,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 M,
+                                                 N,
+                                                 &alpha,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 0,
+                                                 TRSM_REFINE_MAX_ITERATIONS,
+                                                 nullptr),
+                          rocblas_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_trsm_refine(const Arguments& arg)
+{
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+
+    char char_side   = arg.side;
+    char char_uplo   = arg.uplo;
+    char char_transA = arg.transA;
+    char char_diag   = arg.diag;
+    T    alpha_h     = arg.alpha;
+
+    rocblas_side      side   = char2rocblas_side(char_side);
+    rocblas_fill      uplo   = char2rocblas_fill(char_uplo);
+    rocblas_operation transA = char2rocblas_operation(char_transA);
+    rocblas_diagonal  diag   = char2rocblas_diagonal(char_diag);
+
+    rocblas_int K      = side == rocblas_side_left ? M : N;
+    size_t      size_A = lda * size_t(K);
+    size_t      size_B = ldb * size_t(N);
+
+    rocblas_local_handle handle;
+    rocblas_int          iterations;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || lda < K || ldb < M)
+    {
+        static const size_t safe_size = 100; // arbitrarily set to 100
+        device_vector<T>    dA(safe_size);
+        device_vector<T>    dXorB(safe_size);
+        if(!dA || !dXorB)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(rocblas_trsm_refine<T>(handle,
+                                                     side,
+                                                     uplo,
+                                                     transA,
+                                                     diag,
+                                                     M,
+                                                     N,
+                                                     &alpha_h,
+                                                     dA,
+                                                     lda,
+                                                     dXorB,
+                                                     ldb,
+                                                     0,
+                                                     TRSM_REFINE_MAX_ITERATIONS,
+                                                     &iterations),
+                              rocblas_status_invalid_size);
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> AAT(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hX(size_B);
+    host_vector<T> hXorB_1(size_B);
+    host_vector<T> hXorB_2(size_B);
+    host_vector<T> hXorB_3(size_B);
+    host_vector<T> cpuXorB(size_B);
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops;
+    T      error_eps_multiplier    = ERROR_EPS_MULTIPLIER;
+    T      residual_eps_multiplier = RESIDUAL_EPS_MULTIPLIER;
+    T      eps                     = std::numeric_limits<T>::epsilon();
+
+    // allocate memory on device
+    device_vector<T> dA(size_A);
+    device_vector<T> dXorB(size_B);
+    device_vector<T> alpha_d(1);
+    if(!dA || !dXorB || !alpha_d)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    //  Make a triangular matrix with condition number that grows linearly with matrix size,
+    //  from the Cholesky factor of a strictly diagonally dominant matrix, as in testing_trsm.
+    rocblas_init<T>(hA, K, K, lda);
+
+    //  pad untouched area into zero
+    for(int i = K; i < lda; i++)
+        for(int j = 0; j < K; j++)
+            hA[i + j * lda] = 0.0;
+
+    //  calculate AAT = hA * hA ^ T
+    cblas_gemm<T, T>(rocblas_operation_none,
+                     rocblas_operation_transpose,
+                     K,
+                     K,
+                     K,
+                     1.0,
+                     hA,
+                     lda,
+                     hA,
+                     lda,
+                     0.0,
+                     AAT,
+                     lda);
+
+    //  copy AAT into hA, make hA strictly diagonal dominant, and therefore SPD
+    for(int i = 0; i < K; i++)
+    {
+        T t = 0.0;
+        for(int j = 0; j < K; j++)
+        {
+            hA[i + j * lda] = AAT[i + j * lda];
+            t += AAT[i + j * lda] > 0 ? AAT[i + j * lda] : -AAT[i + j * lda];
+        }
+        hA[i + i * lda] = t;
+    }
+
+    //  calculate Cholesky factorization of SPD matrix hA
+    cblas_potrf<T>(char_uplo, K, hA, lda);
+
+    //  make hA unit diagonal if diag == rocblas_diagonal_unit
+    if(char_diag == 'U' || char_diag == 'u')
+    {
+        if('L' == char_uplo || 'l' == char_uplo)
+            for(int i = 0; i < K; i++)
+            {
+                T diag = hA[i + i * lda];
+                for(int j = 0; j <= i; j++)
+                    hA[i + j * lda] = hA[i + j * lda] / diag;
+            }
+        else
+            for(int j = 0; j < K; j++)
+            {
+                T diag = hA[j + j * lda];
+                for(int i = 0; i <= j; i++)
+                    hA[i + j * lda] = hA[i + j * lda] / diag;
+            }
+    }
+
+    // Initial hX
+    rocblas_init<T>(hX, M, N, ldb);
+    // pad untouched area into zero
+    for(int i = M; i < ldb; i++)
+        for(int j = 0; j < N; j++)
+            hX[i + j * ldb] = 0.0;
+    hB = hX;
+
+    // Calculate hB = hA*hX;
+    cblas_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hB, ldb);
+
+    hXorB_1 = hB; // hXorB <- B
+    hXorB_2 = hB; // hXorB <- B
+    hXorB_3 = hB; // hXorB <- B
+    cpuXorB = hB; // cpuXorB <- B
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    // One norm of the scaled difference for a single column, and its maximum over the columns
+    auto max_col_err = [&](const host_vector<T>& hRef, const host_vector<T>& hOut) {
+        T max_err = 0.0;
+        for(int i = 0; i < N; i++)
+        {
+            T err = 0.0;
+            for(int j = 0; j < M; j++)
+            {
+                if(hRef[j + i * ldb] != 0)
+                    err += std::abs((hRef[j + i * ldb] - hOut[j + i * ldb]) / hRef[j + i * ldb]);
+                else
+                    err += std::abs(hOut[j + i * ldb]);
+            }
+            max_err = max_err > err ? max_err : err;
+        }
+        return max_err;
+    };
+
+    T max_err_1 = 0.0;
+    T max_err_2 = 0.0;
+    T max_err_3 = 0.0;
+    if(arg.unit_check || arg.norm_check)
+    {
+        // calculate dXorB <- A^(-1) B   rocblas_device_pointer_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dXorB, hXorB_1, sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_trsm_refine<T>(handle,
+                                                   side,
+                                                   uplo,
+                                                   transA,
+                                                   diag,
+                                                   M,
+                                                   N,
+                                                   &alpha_h,
+                                                   dA,
+                                                   lda,
+                                                   dXorB,
+                                                   ldb,
+                                                   0,
+                                                   TRSM_REFINE_MAX_ITERATIONS,
+                                                   &iterations));
+        EXPECT_GE(iterations, 1);
+        EXPECT_LE(iterations, TRSM_REFINE_MAX_ITERATIONS);
+
+        CHECK_HIP_ERROR(hipMemcpy(hXorB_1, dXorB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+
+        // calculate dXorB <- A^(-1) B   rocblas_device_pointer_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dXorB, hXorB_2, sizeof(T) * size_B, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(alpha_d, &alpha_h, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_trsm_refine<T>(handle,
+                                                   side,
+                                                   uplo,
+                                                   transA,
+                                                   diag,
+                                                   M,
+                                                   N,
+                                                   alpha_d,
+                                                   dA,
+                                                   lda,
+                                                   dXorB,
+                                                   ldb,
+                                                   0,
+                                                   TRSM_REFINE_MAX_ITERATIONS,
+                                                   &iterations));
+
+        CHECK_HIP_ERROR(hipMemcpy(hXorB_2, dXorB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+
+        // Without correction steps, B is solved again in double precision
+        CHECK_HIP_ERROR(hipMemcpy(dXorB, hXorB_3, sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+        EXPECT_ROCBLAS_STATUS(rocblas_trsm_refine<T>(handle,
+                                                     side,
+                                                     uplo,
+                                                     transA,
+                                                     diag,
+                                                     M,
+                                                     N,
+                                                     alpha_d,
+                                                     dA,
+                                                     lda,
+                                                     dXorB,
+                                                     ldb,
+                                                     0,
+                                                     0,
+                                                     &iterations),
+                              rocblas_status_perf_degraded);
+        EXPECT_EQ(iterations, 0);
+
+        CHECK_HIP_ERROR(hipMemcpy(hXorB_3, dXorB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+
+        // Error Check
+        // hXorB contains calculated X, so error is hX - hXorB
+        max_err_1 = max_col_err(hX, hXorB_1);
+        max_err_2 = max_col_err(hX, hXorB_2);
+        max_err_3 = max_col_err(hX, hXorB_3);
+        trsm_err_res_check<T>(max_err_1, M, error_eps_multiplier, eps);
+        trsm_err_res_check<T>(max_err_2, M, error_eps_multiplier, eps);
+        trsm_err_res_check<T>(max_err_3, M, error_eps_multiplier, eps);
+
+        // Residual Check
+        // hXorB <- hA * (A^(-1) B) ;
+        cblas_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hXorB_1, ldb);
+        cblas_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hXorB_2, ldb);
+
+        // hXorB contains A * (calculated X), so residual = A * (calculated X) - B
+        //                                                = hXorB - hB
+        trsm_err_res_check<T>(max_col_err(hB, hXorB_1), M, residual_eps_multiplier, eps);
+        trsm_err_res_check<T>(max_col_err(hB, hXorB_2), M, residual_eps_multiplier, eps);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dXorB, hB, sizeof(T) * size_B, hipMemcpyHostToDevice));
+            CHECK_ROCBLAS_ERROR(rocblas_trsm_refine<T>(handle,
+                                                       side,
+                                                       uplo,
+                                                       transA,
+                                                       diag,
+                                                       M,
+                                                       N,
+                                                       &alpha_h,
+                                                       dA,
+                                                       lda,
+                                                       dXorB,
+                                                       ldb,
+                                                       0,
+                                                       TRSM_REFINE_MAX_ITERATIONS,
+                                                       &iterations));
+        }
+
+        // Each solve starts from the same right hand side
+        gpu_time_used = 0;
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dXorB, hB, sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+            double start = get_time_us(); // in microseconds
+            rocblas_trsm_refine<T>(handle,
+                                   side,
+                                   uplo,
+                                   transA,
+                                   diag,
+                                   M,
+                                   N,
+                                   &alpha_h,
+                                   dA,
+                                   lda,
+                                   dXorB,
+                                   ldb,
+                                   0,
+                                   TRSM_REFINE_MAX_ITERATIONS,
+                                   &iterations);
+            gpu_time_used += get_time_us() - start;
+        }
+        rocblas_gflops = trsm_gflop_count<T>(M, N, K) * number_hot_calls / gpu_time_used * 1e6;
+
+        // CPU cblas
+        cpu_time_used = get_time_us();
+
+        cblas_trsm<T>(side, uplo, transA, diag, M, N, alpha_h, hA, lda, cpuXorB, ldb);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = trsm_gflop_count<T>(M, N, K) / cpu_time_used * 1e6;
+
+        // only norm_check return an norm error, unit check won't return anything
+        std::cout << "M,N,lda,ldb,side,uplo,transA,diag,iterations,rocblas-Gflops,us";
+
+        if(arg.norm_check)
+            std::cout << ",CPU-Gflops,us,norm_error_host_ptr,norm_error_dev_ptr";
+
+        std::cout << std::endl;
+
+        std::cout << M << ',' << N << ',' << lda << ',' << ldb << ',' << char_side << ','
+                  << char_uplo << ',' << char_transA << ',' << char_diag << ',' << iterations
+                  << ',' << rocblas_gflops << "," << gpu_time_used / number_hot_calls;
+
+        if(arg.norm_check)
+            std::cout << "," << cblas_gflops << "," << cpu_time_used << "," << max_err_1 << ","
+                      << max_err_2;
+
+        std::cout << std::endl;
+    }
+}
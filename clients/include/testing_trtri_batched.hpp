@@ -133,9 +133,11 @@ void testing_trtri_batched(const Arguments& arg)
     CHECK_ROCBLAS_ERROR(
         rocblas_trtri_batched<T>(handle, uplo, diag, N, dA, lda, dinvA, lda, batch_count));
 
-    // Test in place
+    // Test in place, in device pointer mode, which TRTRI must not depend on
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
     CHECK_ROCBLAS_ERROR(
         rocblas_trtri_batched<T>(handle, uplo, diag, N, dA, lda, dA, lda, batch_count));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
 
     if(arg.timing)
     {
@@ -199,6 +201,16 @@ void testing_trtri_batched(const Arguments& arg)
                 // printf("error=%f, %lu\n", rocblas_error, i);
             }
         }
+
+        // The batched GEMMs of the recursion, including those with blocks larger than 128, are
+        // queued without waiting for the device
+        if(N > 256)
+        {
+            rocblas_stream_blocker blocker(handle);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_trtri_batched<T>(handle, uplo, diag, N, dA, lda, dinvA, lda, batch_count));
+            EXPECT_TRUE(blocker.busy());
+        }
     } // end of norm_check
 
     if(arg.timing)
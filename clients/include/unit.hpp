@@ -131,6 +131,13 @@ inline void unit_check_general(
     UNIT_CHECK(M, N, 1, lda, 0, hCPU, hGPU, ASSERT_EQ);
 }
 
+template <>
+inline void
+    unit_check_general(rocblas_int M, rocblas_int N, rocblas_int lda, int8_t* hCPU, int8_t* hGPU)
+{
+    UNIT_CHECK(M, N, 1, lda, 0, hCPU, hGPU, ASSERT_EQ);
+}
+
 template <typename T>
 void unit_check_general(rocblas_int    M,
                         rocblas_int    N,
@@ -224,6 +231,18 @@ inline void unit_check_general(rocblas_int    M,
     UNIT_CHECK(M, N, batch_count, lda, strideA, hCPU, hGPU, ASSERT_EQ);
 }
 
+template <>
+inline void unit_check_general(rocblas_int    M,
+                               rocblas_int    N,
+                               rocblas_int    batch_count,
+                               rocblas_int    lda,
+                               rocblas_stride strideA,
+                               int8_t*        hCPU,
+                               int8_t*        hGPU)
+{
+    UNIT_CHECK(M, N, batch_count, lda, strideA, hCPU, hGPU, ASSERT_EQ);
+}
+
 template <typename T>
 void unit_check_general(rocblas_int    M,
                         rocblas_int    N,
@@ -62,6 +62,28 @@ double get_time_us(void);
 /*! \brief  CPU Timer(in microsecond): synchronize with given queue/stream and return wall time */
 double get_time_us_sync(hipStream_t stream);
 
+/* ============================================================================================ */
+/*! \brief  Keeps the stream of a handle busy until the object is destroyed, or for a few seconds
+            at most. A rocBLAS call queued behind it which synchronizes with the host returns
+            only after the timeout, when the stream is no longer busy. */
+class rocblas_stream_blocker
+{
+    rocblas_handle handle;
+    hipStream_t    old_stream;
+    hipStream_t    stream;
+    int*           flag;
+
+public:
+    explicit rocblas_stream_blocker(rocblas_handle handle);
+    ~rocblas_stream_blocker();
+
+    // Whether the stream is still held, with the work queued behind it not yet run
+    bool busy() const;
+
+    rocblas_stream_blocker(const rocblas_stream_blocker&) = delete;
+    rocblas_stream_blocker& operator=(const rocblas_stream_blocker&) = delete;
+};
+
 /* ============================================================================================ */
 // Return path of this executable
 std::string rocblas_exepath();
@@ -45,6 +45,24 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_pointer_mode(rocblas_handle       hand
 ROCBLAS_EXPORT rocblas_status rocblas_get_pointer_mode(rocblas_handle        handle,
                                                        rocblas_pointer_mode* pointer_mode);
 
+/*! \brief set rocblas_math_mode
+
+    \details
+    With rocblas_xf32_bf16x3_math, rocblas_sgemm, rocblas_sgemm_batched and
+    rocblas_sgemm_strided_batched split each element a of A and B into a bfloat16 high part
+    and a bfloat16 low part, a = a_hi + a_lo, and compute A*B as A_hi*B_hi + A_hi*B_lo +
+    A_lo*B_hi with the bfloat16 GEMM kernels, accumulating in FP32. The relative error of each
+    product is about 2^-16, rather than 2^-24. Other functions, including those which use
+    single precision GEMMs internally, are not affected. The default is rocblas_default_math.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_math_mode(rocblas_handle    handle,
+                                                    rocblas_math_mode math_mode);
+
+/*! \brief get rocblas_math_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_math_mode(rocblas_handle     handle,
+                                                    rocblas_math_mode* math_mode);
+
 /*! \brief  Indicates whether the pointer is on the host or device.
  */
 ROCBLAS_EXPORT rocblas_pointer_mode rocblas_pointer_to_mode(void* ptr);
@@ -2994,6 +2994,277 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgemv_strided_batched(rocblas_handle
                                                             rocblas_stride                stridey,
                                                             rocblas_int batch_count);
 
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGEMV_MULTI performs the matrix-vector operations
+
+        y_j := alpha*A*x_j    + beta*y_j,   or
+        y_j := alpha*A**T*x_j + beta*y_j,   or
+        y_j := alpha*A**H*x_j + beta*y_j,
+
+    for k pairs of vectors (x_j, y_j) which share the m by n matrix A.
+    alpha and beta are scalars. A is read once for up to 16 vectors, so
+    this is faster than k calls to xGEMV.
+
+    @param[in]
+    handle      rocblas_handle.
+                handle to the rocblas library context queue.
+    @param[in]
+    trans       rocblas_operation
+                indicates whether matrix A is tranposed (conjugated) or not
+    @param[in]
+    m           rocblas_int
+                number of rows of matrix A
+    @param[in]
+    n           rocblas_int
+                number of columns of matrix A
+    @param[in]
+    k           rocblas_int
+                number of vectors x_j and y_j
+    @param[in]
+    alpha       specifies the scalar alpha.
+    @param[in]
+    A           pointer storing matrix A on the GPU.
+    @param[in]
+    lda         rocblas_int
+                specifies the leading dimension of A.
+    @param[in]
+    x           pointer storing the first vector x_0 on the GPU.
+    @param[in]
+    incx        rocblas_int
+                specifies the increment for the elements of the vectors x_j.
+    @param[in]
+    ldx         rocblas_int
+                distance from the start of one vector (x_j) to the next one (x_j+1).
+    @param[in]
+    beta        specifies the scalar beta.
+    @param[inout]
+    y           pointer storing the first vector y_0 on the GPU.
+    @param[in]
+    incy        rocblas_int
+                specifies the increment for the elements of the vectors y_j.
+    @param[in]
+    ldy         rocblas_int
+                distance from the start of one vector (y_j) to the next one (y_j+1).
+                When k > 1 the vectors y_j must not overlap, so ldy must be at least
+                1 + (m - 1) * |incy| when trans equals rocblas_operation_none,
+                otherwise 1 + (n - 1) * |incy|.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_multi(rocblas_handle    handle,
+                                                  rocblas_operation transA,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  rocblas_int       k,
+                                                  const float*      alpha,
+                                                  const float*      A,
+                                                  rocblas_int       lda,
+                                                  const float*      x,
+                                                  rocblas_int       incx,
+                                                  rocblas_int       ldx,
+                                                  const float*      beta,
+                                                  float*            y,
+                                                  rocblas_int       incy,
+                                                  rocblas_int       ldy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_multi(rocblas_handle    handle,
+                                                  rocblas_operation transA,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  rocblas_int       k,
+                                                  const double*     alpha,
+                                                  const double*     A,
+                                                  rocblas_int       lda,
+                                                  const double*     x,
+                                                  rocblas_int       incx,
+                                                  rocblas_int       ldx,
+                                                  const double*     beta,
+                                                  double*           y,
+                                                  rocblas_int       incy,
+                                                  rocblas_int       ldy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv_multi(rocblas_handle               handle,
+                                                  rocblas_operation            transA,
+                                                  rocblas_int                  m,
+                                                  rocblas_int                  n,
+                                                  rocblas_int                  k,
+                                                  const rocblas_float_complex* alpha,
+                                                  const rocblas_float_complex* A,
+                                                  rocblas_int                  lda,
+                                                  const rocblas_float_complex* x,
+                                                  rocblas_int                  incx,
+                                                  rocblas_int                  ldx,
+                                                  const rocblas_float_complex* beta,
+                                                  rocblas_float_complex*       y,
+                                                  rocblas_int                  incy,
+                                                  rocblas_int                  ldy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv_multi(rocblas_handle                handle,
+                                                  rocblas_operation             transA,
+                                                  rocblas_int                   m,
+                                                  rocblas_int                   n,
+                                                  rocblas_int                   k,
+                                                  const rocblas_double_complex* alpha,
+                                                  const rocblas_double_complex* A,
+                                                  rocblas_int                   lda,
+                                                  const rocblas_double_complex* x,
+                                                  rocblas_int                   incx,
+                                                  rocblas_int                   ldx,
+                                                  const rocblas_double_complex* beta,
+                                                  rocblas_double_complex*       y,
+                                                  rocblas_int                   incy,
+                                                  rocblas_int                   ldy);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGEMV_MULTI_STRIDED_BATCHED performs a batch of the matrix-vector operations
+
+        y_ij := alpha*A_i*x_ij    + beta*y_ij,   or
+        y_ij := alpha*A_i**T*x_ij + beta*y_ij,   or
+        y_ij := alpha*A_i**H*x_ij + beta*y_ij,
+
+    for k pairs of vectors (x_ij, y_ij) which share the m by n matrix A_i of the
+    i-th instance of the batch. alpha and beta are scalars.
+
+    @param[in]
+    handle      rocblas_handle.
+                handle to the rocblas library context queue.
+    @param[in]
+    trans       rocblas_operation
+                indicates whether matrices A_i are tranposed (conjugated) or not
+    @param[in]
+    m           rocblas_int
+                number of rows of matrices A_i
+    @param[in]
+    n           rocblas_int
+                number of columns of matrices A_i
+    @param[in]
+    k           rocblas_int
+                number of vectors x_ij and y_ij of each instance
+    @param[in]
+    alpha       specifies the scalar alpha.
+    @param[in]
+    A           pointer to the first matrix (A_0) in the batch stored on the GPU.
+    @param[in]
+    lda         rocblas_int
+                specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA     rocblas_stride
+                stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    x           pointer to the first vector (x_00) in the batch stored on the GPU.
+    @param[in]
+    incx        rocblas_int
+                specifies the increment for the elements of vectors x_ij.
+    @param[in]
+    ldx         rocblas_int
+                distance from the start of one vector (x_ij) to the next one (x_ij+1).
+    @param[in]
+    stridex     rocblas_stride
+                stride from the vectors of one instance (x_i0) to those of the next one.
+    @param[in]
+    beta        specifies the scalar beta.
+    @param[inout]
+    y           pointer to the first vector (y_00) in the batch stored on the GPU.
+    @param[in]
+    incy        rocblas_int
+                specifies the increment for the elements of vectors y_ij.
+    @param[in]
+    ldy         rocblas_int
+                distance from the start of one vector (y_ij) to the next one (y_ij+1).
+                When k > 1 the vectors must not overlap, as for xGEMV_MULTI.
+    @param[in]
+    stridey     rocblas_stride
+                stride from the vectors of one instance (y_i0) to those of the next one.
+    @param[in]
+    batch_count rocblas_int
+                number of instances in the batch
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_multi_strided_batched(rocblas_handle    handle,
+                                                                  rocblas_operation transA,
+                                                                  rocblas_int       m,
+                                                                  rocblas_int       n,
+                                                                  rocblas_int       k,
+                                                                  const float*      alpha,
+                                                                  const float*      A,
+                                                                  rocblas_int       lda,
+                                                                  rocblas_stride    strideA,
+                                                                  const float*      x,
+                                                                  rocblas_int       incx,
+                                                                  rocblas_int       ldx,
+                                                                  rocblas_stride    stridex,
+                                                                  const float*      beta,
+                                                                  float*            y,
+                                                                  rocblas_int       incy,
+                                                                  rocblas_int       ldy,
+                                                                  rocblas_stride    stridey,
+                                                                  rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_multi_strided_batched(rocblas_handle    handle,
+                                                                  rocblas_operation transA,
+                                                                  rocblas_int       m,
+                                                                  rocblas_int       n,
+                                                                  rocblas_int       k,
+                                                                  const double*     alpha,
+                                                                  const double*     A,
+                                                                  rocblas_int       lda,
+                                                                  rocblas_stride    strideA,
+                                                                  const double*     x,
+                                                                  rocblas_int       incx,
+                                                                  rocblas_int       ldx,
+                                                                  rocblas_stride    stridex,
+                                                                  const double*     beta,
+                                                                  double*           y,
+                                                                  rocblas_int       incy,
+                                                                  rocblas_int       ldy,
+                                                                  rocblas_stride    stridey,
+                                                                  rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_cgemv_multi_strided_batched(rocblas_handle               handle,
+                                        rocblas_operation            transA,
+                                        rocblas_int                  m,
+                                        rocblas_int                  n,
+                                        rocblas_int                  k,
+                                        const rocblas_float_complex* alpha,
+                                        const rocblas_float_complex* A,
+                                        rocblas_int                  lda,
+                                        rocblas_stride               strideA,
+                                        const rocblas_float_complex* x,
+                                        rocblas_int                  incx,
+                                        rocblas_int                  ldx,
+                                        rocblas_stride               stridex,
+                                        const rocblas_float_complex* beta,
+                                        rocblas_float_complex*       y,
+                                        rocblas_int                  incy,
+                                        rocblas_int                  ldy,
+                                        rocblas_stride               stridey,
+                                        rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zgemv_multi_strided_batched(rocblas_handle                handle,
+                                        rocblas_operation             transA,
+                                        rocblas_int                   m,
+                                        rocblas_int                   n,
+                                        rocblas_int                   k,
+                                        const rocblas_double_complex* alpha,
+                                        const rocblas_double_complex* A,
+                                        rocblas_int                   lda,
+                                        rocblas_stride                strideA,
+                                        const rocblas_double_complex* x,
+                                        rocblas_int                   incx,
+                                        rocblas_int                   ldx,
+                                        rocblas_stride                stridex,
+                                        const rocblas_double_complex* beta,
+                                        rocblas_double_complex*       y,
+                                        rocblas_int                   incy,
+                                        rocblas_int                   ldy,
+                                        rocblas_stride                stridey,
+                                        rocblas_int                   batch_count);
+
 /*! \brief BLAS Level 2 API
 
     \details
@@ -3249,14 +3520,16 @@ ROCBLAS_EXPORT rocblas_status rocblas_dtrsv_strided_batched(rocblas_handle    ha
         y := alpha*A*x + beta*y,
 
     where alpha and beta are scalars, x and y are n element vectors and
-    A is an n by n Hermitian(Symmetric) matrix.
+    A is an n by n Hermitian(Symmetric) matrix. Only the triangle of A given
+    by uplo is read. The imaginary parts of the diagonal elements of a
+    Hermitian matrix are assumed to be zero.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
     uplo      rocblas_fill.
-              specifies whether the upper or lower
+              specifies whether the upper or lower triangle of A is stored.
     @param[in]
     n         rocblas_int.
     @param[in]
@@ -3274,983 +3547,3906 @@ ROCBLAS_EXPORT rocblas_status rocblas_dtrsv_strided_batched(rocblas_handle    ha
               specifies the increment for the elements of x.
     @param[in]
     beta      specifies the scalar beta.
-    @param[out]
+    @param[inout]
     y         pointer storing vector y on the GPU.
     @param[in]
     incy      rocblas_int
               specifies the increment for the elements of y.
 
     ********************************************************************/
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_ssymv(rocblas_handle handle,
-                 rocblas_fill uplo,
-                 rocblas_int n,
-                 const float *alpha,
-                 const float *A, rocblas_int lda,
-                 const float *x, rocblas_int incx,
-                 const float *beta,
-                 float *y, rocblas_int incy);
 
-ROCBLAS_EXPORT rocblas_status
-rocblas_dsymv(rocblas_handle handle,
-                 rocblas_fill uplo,
-                 rocblas_int n,
-                 const double *alpha,
-                 const double *A, rocblas_int lda,
-                 const double *x, rocblas_int incx,
-                 const double *beta,
-                 double *y, rocblas_int incy);
-*/
+ROCBLAS_EXPORT rocblas_status rocblas_ssymv(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            const float*   alpha,
+                                            const float*   A,
+                                            rocblas_int    lda,
+                                            const float*   x,
+                                            rocblas_int    incx,
+                                            const float*   beta,
+                                            float*         y,
+                                            rocblas_int    incy);
 
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_chemv(rocblas_handle handle,
-                 rocblas_fill uplo,
-                 rocblas_int n,
-                 const rocblas_float_complex *alpha,
-                 const rocblas_float_complex *A, rocblas_int lda,
-                 const rocblas_float_complex *x, rocblas_int incx,
-                 const rocblas_float_complex *beta,
-                 rocblas_float_complex *y, rocblas_int incy);
+ROCBLAS_EXPORT rocblas_status rocblas_dsymv(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            const double*  alpha,
+                                            const double*  A,
+                                            rocblas_int    lda,
+                                            const double*  x,
+                                            rocblas_int    incx,
+                                            const double*  beta,
+                                            double*        y,
+                                            rocblas_int    incy);
 
-ROCBLAS_EXPORT rocblas_status
-rocblas_zhemv(rocblas_handle handle,
-                 rocblas_fill uplo,
-                 rocblas_int n,
-                 const rocblas_double_complex *alpha,
-                 const rocblas_double_complex *A, rocblas_int lda,
-                 const rocblas_double_complex *x, rocblas_int incx,
-                 const rocblas_double_complex *beta,
-                 rocblas_double_complex *y, rocblas_int incy);
-*/
+ROCBLAS_EXPORT rocblas_status rocblas_chemv(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int                  incx,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex*       y,
+                                            rocblas_int                  incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zhemv(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int                   incx,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex*       y,
+                                            rocblas_int                   incy);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xGER performs the matrix-vector operations
+    xHE(SY)MV_BATCHED performs a batch of the matrix-vector operations:
 
-        A := A + alpha*x*y**T
+        y_i := alpha*A_i*x_i + beta*y_i,
 
-    where alpha is a scalar, x and y are vectors, and A is an
-    m by n matrix.
+    where alpha and beta are scalars, x_i and y_i are n element vectors and
+    A_i is an n by n Hermitian(Symmetric) matrix, for i = 1, ..., batch_count.
+    Only the triangle of A_i given by uplo is read.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    m         rocblas_int
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of each A_i is stored.
     @param[in]
-    n         rocblas_int
+    n         rocblas_int.
     @param[in]
     alpha
               specifies the scalar alpha.
     @param[in]
-    x         pointer storing vector x on the GPU.
+    A         array of pointers storing each matrix A_i on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A_i.
+    @param[in]
+    x         array of pointers storing each vector x_i on the GPU.
     @param[in]
     incx      rocblas_int
-              specifies the increment for the elements of x.
+              specifies the increment for the elements of each x_i.
     @param[in]
-    y         pointer storing vector y on the GPU.
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         array of pointers storing each vector y_i on the GPU.
     @param[in]
     incy      rocblas_int
-              specifies the increment for the elements of y.
-    @param[inout]
-    A         pointer storing matrix A on the GPU.
+              specifies the increment for the elements of each y_i.
     @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
+    batch_count
+              rocblas_int
+              number of instances in the batch.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_sger(rocblas_handle handle,
-                                           rocblas_int    m,
-                                           rocblas_int    n,
-                                           const float*   alpha,
-                                           const float*   x,
-                                           rocblas_int    incx,
-                                           const float*   y,
-                                           rocblas_int    incy,
-                                           float*         A,
-                                           rocblas_int    lda);
+ROCBLAS_EXPORT rocblas_status rocblas_ssymv_batched(rocblas_handle     handle,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_int        n,
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    rocblas_int        lda,
+                                                    const float* const x[],
+                                                    rocblas_int        incx,
+                                                    const float*       beta,
+                                                    float* const       y[],
+                                                    rocblas_int        incy,
+                                                    rocblas_int        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dger(rocblas_handle handle,
-                                           rocblas_int    m,
-                                           rocblas_int    n,
-                                           const double*  alpha,
-                                           const double*  x,
-                                           rocblas_int    incx,
-                                           const double*  y,
-                                           rocblas_int    incy,
-                                           double*        A,
-                                           rocblas_int    lda);
+ROCBLAS_EXPORT rocblas_status rocblas_dsymv_batched(rocblas_handle      handle,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_int         n,
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    rocblas_int         lda,
+                                                    const double* const x[],
+                                                    rocblas_int         incx,
+                                                    const double*       beta,
+                                                    double* const       y[],
+                                                    rocblas_int         incy,
+                                                    rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chemv_batched(rocblas_handle                     handle,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_int                        n,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const A[],
+                                                    rocblas_int                        lda,
+                                                    const rocblas_float_complex* const x[],
+                                                    rocblas_int                        incx,
+                                                    const rocblas_float_complex*       beta,
+                                                    rocblas_float_complex* const       y[],
+                                                    rocblas_int                        incy,
+                                                    rocblas_int                        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zhemv_batched(rocblas_handle                      handle,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_int                         n,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const A[],
+                                                    rocblas_int                         lda,
+                                                    const rocblas_double_complex* const x[],
+                                                    rocblas_int                         incx,
+                                                    const rocblas_double_complex*       beta,
+                                                    rocblas_double_complex* const       y[],
+                                                    rocblas_int                         incy,
+                                                    rocblas_int batch_count);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xGER_BATCHED performs a batch of the matrix-vector operations
+    xHE(SY)MV_STRIDED_BATCHED performs a batch of the matrix-vector operations:
 
-        A_i := A_i + alpha*x_i*y_i**T
+        y_i := alpha*A_i*x_i + beta*y_i,
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha is a scalar, x_i and y_i are vectors and A_i is an
-    m by n matrix.
+    where alpha and beta are scalars, x_i and y_i are n element vectors and
+    A_i is an n by n Hermitian(Symmetric) matrix, for i = 1, ..., batch_count.
+    Only the triangle of A_i given by uplo is read.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    m         rocblas_int
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of each A_i is stored.
     @param[in]
-    n         rocblas_int
+    n         rocblas_int.
     @param[in]
     alpha
               specifies the scalar alpha.
     @param[in]
-    x         array of pointers storing the different vectors x_i on the GPU.
+    A         pointer to the first matrix (A_1) in the batch, stored on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A_i.
+    @param[in]
+    strideA   rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[in]
+    x         pointer to the first vector (x_1) in the batch, stored on the GPU.
     @param[in]
     incx      rocblas_int
-              specifies the increment for the elements of vectors x_i.
+              specifies the increment for the elements of each x_i.
     @param[in]
-    y         array of pointesr storing the different vectors y_i on the GPU.
+    stridex   rocblas_stride
+              stride from the start of one vector (x_i) and the next one (x_i+1).
     @param[in]
-    incy      rocblas_int
-              specifies the increment for the elements of vectors y_i.
+    beta      specifies the scalar beta.
     @param[inout]
-    A         array of pointers storing the different matrices A_i on the GPU.
+    y         pointer to the first vector (y_1) in the batch, stored on the GPU.
     @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
+    incy      rocblas_int
+              specifies the increment for the elements of each y_i.
     @param[in]
-    batch_count rocblas_int
-                number of instances in the batch
+    stridey   rocblas_stride
+              stride from the start of one vector (y_i) and the next one (y_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_sger_batched(rocblas_handle     handle,
-                                                   rocblas_int        m,
-                                                   rocblas_int        n,
-                                                   const float*       alpha,
-                                                   const float* const x[],
-                                                   rocblas_int        incx,
-                                                   const float* const y[],
-                                                   rocblas_int        incy,
-                                                   float* const       A[],
-                                                   rocblas_int        lda,
-                                                   rocblas_int        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ssymv_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            const float*   alpha,
+                                                            const float*   A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride strideA,
+                                                            const float*   x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const float*   beta,
+                                                            float*         y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            rocblas_int    batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dger_batched(rocblas_handle      handle,
-                                                   rocblas_int         m,
-                                                   rocblas_int         n,
-                                                   const double*       alpha,
-                                                   const double* const x[],
-                                                   rocblas_int         incx,
-                                                   const double* const y[],
-                                                   rocblas_int         incy,
-                                                   double* const       A[],
-                                                   rocblas_int         lda,
-                                                   rocblas_int         batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_dsymv_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            const double*  alpha,
+                                                            const double*  A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride strideA,
+                                                            const double*  x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const double*  beta,
+                                                            double*        y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chemv_strided_batched(rocblas_handle               handle,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_int                  n,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* A,
+                                                            rocblas_int                  lda,
+                                                            rocblas_stride               strideA,
+                                                            const rocblas_float_complex* x,
+                                                            rocblas_int                  incx,
+                                                            rocblas_stride               stridex,
+                                                            const rocblas_float_complex* beta,
+                                                            rocblas_float_complex*       y,
+                                                            rocblas_int                  incy,
+                                                            rocblas_stride               stridey,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zhemv_strided_batched(rocblas_handle                handle,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_int                   n,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* A,
+                                                            rocblas_int                   lda,
+                                                            rocblas_stride                strideA,
+                                                            const rocblas_double_complex* x,
+                                                            rocblas_int                   incx,
+                                                            rocblas_stride                stridex,
+                                                            const rocblas_double_complex* beta,
+                                                            rocblas_double_complex*       y,
+                                                            rocblas_int                   incy,
+                                                            rocblas_stride                stridey,
+                                                            rocblas_int batch_count);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xGER_STRIDED_BATCHED performs the matrix-vector operations
+    xGBMV performs the matrix-vector operation:
 
-        A_i := A_i + alpha*x_i*y_i**T
+        y := alpha*A*x + beta*y,   or   y := alpha*A**T*x + beta*y,
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha is a scalar, x_i and y_i are vectors and A_i is an
-    m by n matrix.
+    where alpha and beta are scalars, x and y are vectors and A is an
+    m by n band matrix with kl sub-diagonals and ku super-diagonals.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    m         rocblas_int
+    transA    rocblas_operation.
+              specifies op(A). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A**T.
     @param[in]
-    n         rocblas_int
+    m         rocblas_int.
+              number of rows of A.
+    @param[in]
+    n         rocblas_int.
+              number of columns of A.
+    @param[in]
+    kl        rocblas_int.
+              number of sub-diagonals of A.
+    @param[in]
+    ku        rocblas_int.
+              number of super-diagonals of A.
     @param[in]
     alpha
               specifies the scalar alpha.
     @param[in]
-    x         pointer to the first vector (x_0) in the batch stored on the GPU.
+    A         pointer storing matrix A on the GPU.
+              Column j of A is stored in column j of the array, with the
+              diagonal in row ku, so that A(i, j) is stored at
+              A[ku + i - j + j*lda] for max(0, j - ku) <= i <= min(m - 1, j + kl).
     @param[in]
-    incx      rocblas_int
-              specifies the increments for the elements of vectors x_i.
+    lda       rocblas_int
+              specifies the leading dimension of A, which is at least kl + ku + 1.
     @param[in]
-    stridex   rocblas_stride
-              stride from the start of one vector (x_i) and the next one (x_i+1).
-              There are no restrictions placed on stride_x, however the user should
-              take care to ensure that stride_x is of appropriate size, for a typical
-              case this means stride_x >= m * incx.
-    @param[inout]
-    y         pointer to the first vector (y_0) in the batch stored on the GPU.
+    x         pointer storing vector x on the GPU.
     @param[in]
-    incy      rocblas_int
-              specifies the increment for the elements of vectors y_i.
+    incx      rocblas_int
+              specifies the increment for the elements of x.
     @param[in]
-    stridey   rocblas_stride
-              stride from the start of one vector (y_i) and the next one (y_i+1).
-              There are no restrictions placed on stride_y, however the user should
-              take care to ensure that stride_y is of appropriate size, for a typical
-              case this means stride_y >= n * incy.
+    beta      specifies the scalar beta.
     @param[inout]
-    A         pointer to the first matrix (A_0) in the batch stored on the GPU.
-    @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
-    @param[in]
-    strideA     rocblas_stride
-                stride from the start of one matrix (A_i) and the next one (A_i+1)
+    y         pointer storing vector y on the GPU.
     @param[in]
-    batch_count rocblas_int
-                number of instances in the batch
+    incy      rocblas_int
+              specifies the increment for the elements of y.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_sger_strided_batched(rocblas_handle handle,
-                                                           rocblas_int    m,
-                                                           rocblas_int    n,
-                                                           const float*   alpha,
-                                                           const float*   x,
-                                                           rocblas_int    incx,
-                                                           rocblas_stride stridex,
-                                                           const float*   y,
-                                                           rocblas_int    incy,
-                                                           rocblas_stride stridey,
-                                                           float*         A,
-                                                           rocblas_int    lda,
-                                                           rocblas_stride strideA,
-                                                           rocblas_int    batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dger_strided_batched(rocblas_handle handle,
-                                                           rocblas_int    m,
-                                                           rocblas_int    n,
-                                                           const double*  alpha,
-                                                           const double*  x,
-                                                           rocblas_int    incx,
-                                                           rocblas_stride stridex,
-                                                           const double*  y,
-                                                           rocblas_int    incy,
-                                                           rocblas_stride stridey,
-                                                           double*        A,
-                                                           rocblas_int    lda,
-                                                           rocblas_stride strideA,
-                                                           rocblas_int    batch_count);
-
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_cger(rocblas_handle handle,
-                 rocblas_int m, rocblas_int n,
-                 const rocblas_float_complex *alpha,
-                 const rocblas_float_complex *x, rocblas_int incx,
-                 const rocblas_float_complex *y, rocblas_int incy,
-                       rocblas_float_complex *A, rocblas_int lda);
+ROCBLAS_EXPORT rocblas_status rocblas_sgbmv(rocblas_handle    handle,
+                                            rocblas_operation transA,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       kl,
+                                            rocblas_int       ku,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            const float*      x,
+                                            rocblas_int       incx,
+                                            const float*      beta,
+                                            float*            y,
+                                            rocblas_int       incy);
 
-ROCBLAS_EXPORT rocblas_status
-rocblas_zger(rocblas_handle handle,
-                 rocblas_int m, rocblas_int n,
-                 const rocblas_double_complex *alpha,
-                 const rocblas_double_complex *x, rocblas_int incx,
-                 const rocblas_double_complex *y, rocblas_int incy,
-                       rocblas_double_complex *A, rocblas_int lda);
-*/
+ROCBLAS_EXPORT rocblas_status rocblas_dgbmv(rocblas_handle    handle,
+                                            rocblas_operation transA,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       kl,
+                                            rocblas_int       ku,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            const double*     x,
+                                            rocblas_int       incx,
+                                            const double*     beta,
+                                            double*           y,
+                                            rocblas_int       incy);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xSYR performs the matrix-vector operations
+    xGBMV_BATCHED performs a batch of the matrix-vector operations:
 
-        A := A + alpha*x*x**T
+        y_i := alpha*A_i*x_i + beta*y_i,   or   y_i := alpha*A_i**T*x_i + beta*y_i,
 
-    where alpha is a scalar, x is a vector, and A is an
-    n by n symmetric matrix.
+    where alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    m by n band matrix with kl sub-diagonals and ku super-diagonals,
+    for i = 1, ..., batch_count.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    n         rocblas_int
+    transA    rocblas_operation.
+              specifies op(A_i). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A_i**T.
+    @param[in]
+    m         rocblas_int.
+              number of rows of each A_i.
+    @param[in]
+    n         rocblas_int.
+              number of columns of each A_i.
+    @param[in]
+    kl        rocblas_int.
+              number of sub-diagonals of each A_i.
+    @param[in]
+    ku        rocblas_int.
+              number of super-diagonals of each A_i.
     @param[in]
     alpha
               specifies the scalar alpha.
     @param[in]
-    x         pointer storing vector x on the GPU.
+    A         array of pointers storing each matrix A_i on the GPU.
+              Column j of A_i is stored in column j of the array, with the
+              diagonal in row ku, so that A_i(i, j) is stored at
+              A_i[ku + i - j + j*lda] for max(0, j - ku) <= i <= min(m - 1, j + kl).
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A_i, which is at least kl + ku + 1.
+    @param[in]
+    x         array of pointers storing each vector x_i on the GPU.
     @param[in]
     incx      rocblas_int
-              specifies the increment for the elements of x.
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    beta      specifies the scalar beta.
     @param[inout]
-    A         pointer storing matrix A on the GPU.
+    y         array of pointers storing each vector y_i on the GPU.
     @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
+    incy      rocblas_int
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr(rocblas_handle handle,
-                                           rocblas_fill   uplo,
-                                           rocblas_int    n,
-                                           const float*   alpha,
-                                           const float*   x,
-                                           rocblas_int    incx,
-                                           float*         A,
-                                           rocblas_int    lda);
+ROCBLAS_EXPORT rocblas_status rocblas_sgbmv_batched(rocblas_handle     handle,
+                                                    rocblas_operation  transA,
+                                                    rocblas_int        m,
+                                                    rocblas_int        n,
+                                                    rocblas_int        kl,
+                                                    rocblas_int        ku,
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    rocblas_int        lda,
+                                                    const float* const x[],
+                                                    rocblas_int        incx,
+                                                    const float*       beta,
+                                                    float* const       y[],
+                                                    rocblas_int        incy,
+                                                    rocblas_int        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr(rocblas_handle handle,
-                                           rocblas_fill   uplo,
-                                           rocblas_int    n,
-                                           const double*  alpha,
-                                           const double*  x,
-                                           rocblas_int    incx,
-                                           double*        A,
-                                           rocblas_int    lda);
-
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_csyr(rocblas_handle handle,
-                 rocblas_int n,
-                 const rocblas_float_complex *alpha,
-                 const rocblas_float_complex *x, rocblas_int incx,
-                       rocblas_float_complex *A, rocblas_int lda);
-
-ROCBLAS_EXPORT rocblas_status
-rocblas_zsyr(rocblas_handle handle,
-                 rocblas_int n,
-                 const rocblas_double_complex *alpha,
-                 const rocblas_double_complex *x, rocblas_int incx,
-                       rocblas_double_complex *A, rocblas_int lda);
-*/
+ROCBLAS_EXPORT rocblas_status rocblas_dgbmv_batched(rocblas_handle      handle,
+                                                    rocblas_operation   transA,
+                                                    rocblas_int         m,
+                                                    rocblas_int         n,
+                                                    rocblas_int         kl,
+                                                    rocblas_int         ku,
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    rocblas_int         lda,
+                                                    const double* const x[],
+                                                    rocblas_int         incx,
+                                                    const double*       beta,
+                                                    double* const       y[],
+                                                    rocblas_int         incy,
+                                                    rocblas_int         batch_count);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xSYR_batched performs a batch of matrix-vector operations
+    xGBMV_STRIDED_BATCHED performs a batch of the matrix-vector operations:
 
-        A[i] := A[i] + alpha*x[i]*x[i]**T
+        y_i := alpha*A_i*x_i + beta*y_i,   or   y_i := alpha*A_i**T*x_i + beta*y_i,
 
-    where alpha is a scalar, x is an array of vectors, and A is an array of
-    n by n symmetric matrices. For i = 1 , … , batch_count
+    where alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    m by n band matrix with kl sub-diagonals and ku super-diagonals,
+    for i = 1, ..., batch_count.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    n         rocblas_int
+    transA    rocblas_operation.
+              specifies op(A_i). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A_i**T.
+    @param[in]
+    m         rocblas_int.
+              number of rows of each A_i.
+    @param[in]
+    n         rocblas_int.
+              number of columns of each A_i.
+    @param[in]
+    kl        rocblas_int.
+              number of sub-diagonals of each A_i.
+    @param[in]
+    ku        rocblas_int.
+              number of super-diagonals of each A_i.
     @param[in]
     alpha
               specifies the scalar alpha.
     @param[in]
-    x         array of pointers storing the different vector x_i on the GPU.
+    A         pointer to the first matrix (A_1) in the batch, stored on the GPU.
+              Column j of A_i is stored in column j of the array, with the
+              diagonal in row ku, so that A_i(i, j) is stored at
+              A_i[ku + i - j + j*lda] for max(0, j - ku) <= i <= min(m - 1, j + kl).
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A_i, which is at least kl + ku + 1.
+    @param[in]
+    strideA   rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[in]
+    x         pointer to the first vector (x_1) in the batch, stored on the GPU.
     @param[in]
     incx      rocblas_int
-              specifies the increment for the elements of x.
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   rocblas_stride
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    beta      specifies the scalar beta.
     @param[inout]
-    A         array of pointers storing matrices A on the GPU.
+    y         pointer to the first vector (y_1) in the batch, stored on the GPU.
     @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
+    incy      rocblas_int
+              specifies the increment for the elements of each y_i.
     @param[in]
-    batch_count rocblas_int
-                number of instances in the batch
+    stridey   rocblas_stride
+              stride from the start of one vector (y_i) and the next one (y_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr_batched(rocblas_handle     handle,
-                                                   rocblas_fill       uplo,
-                                                   rocblas_int        n,
-                                                   const float*       alpha,
-                                                   const float* const x[],
-                                                   rocblas_int        incx,
-                                                   float* const       A[],
-                                                   rocblas_int        lda,
-                                                   rocblas_int        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_sgbmv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_operation transA,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            rocblas_int       kl,
+                                                            rocblas_int       ku,
+                                                            const float*      alpha,
+                                                            const float*      A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    strideA,
+                                                            const float*      x,
+                                                            rocblas_int       incx,
+                                                            rocblas_stride    stridex,
+                                                            const float*      beta,
+                                                            float*            y,
+                                                            rocblas_int       incy,
+                                                            rocblas_stride    stridey,
+                                                            rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr_batched(rocblas_handle      handle,
-                                                   rocblas_fill        uplo,
-                                                   rocblas_int         n,
-                                                   const double*       alpha,
-                                                   const double* const x[],
-                                                   rocblas_int         incx,
-                                                   double* const       A[],
-                                                   rocblas_int         lda,
-                                                   rocblas_int         batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_dgbmv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_operation transA,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            rocblas_int       kl,
+                                                            rocblas_int       ku,
+                                                            const double*     alpha,
+                                                            const double*     A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    strideA,
+                                                            const double*     x,
+                                                            rocblas_int       incx,
+                                                            rocblas_stride    stridex,
+                                                            const double*     beta,
+                                                            double*           y,
+                                                            rocblas_int       incy,
+                                                            rocblas_stride    stridey,
+                                                            rocblas_int       batch_count);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xSYR_strided_batched performs the matrix-vector operations
+    xSBMV performs the matrix-vector operation:
 
-        A[i] := A[i] + alpha*x[i]*x[i]**T
+        y := alpha*A*x + beta*y,
 
-    where alpha is a scalar, vectors, and A is an array of
-    n by n symmetric matrices. For i = 1 , … , batch_count
+    where alpha and beta are scalars, x and y are n element vectors and
+    A is an n by n symmetric band matrix with k sub- and super-diagonals.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    n         rocblas_int
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of A is stored.
+    @param[in]
+    n         rocblas_int.
+              order of A.
+    @param[in]
+    k         rocblas_int.
+              number of super-diagonals (upper) or sub-diagonals (lower) of A.
     @param[in]
     alpha
               specifies the scalar alpha.
     @param[in]
-    x         a pointer to the first vector x_i on the GPU.
+    A         pointer storing matrix A on the GPU.
+              Column j of A is stored in column j of the array, with the
+              diagonal in row k (upper) or row 0 (lower), so that A(i, j) is
+              stored at A[k + i - j + j*lda] (upper) or A[i - j + j*lda] (lower).
     @param[in]
-    incx      rocblas_int
-              specifies the increment for the elements of x_i.
+    lda       rocblas_int
+              specifies the leading dimension of A, which is at least k + 1.
     @param[in]
-    stridex   rocblas_stride
-              specifies the pointer increment between vectors (x_i) and (x_i+1).
-    @param[inout]
-    A         pointer to the first matrix A on the GPU.
+    x         pointer storing vector x on the GPU.
     @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
+    incx      rocblas_int
+              specifies the increment for the elements of x.
     @param[in]
-    strideA   rocblas_stride
-              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
     @param[in]
-    batch_count rocblas_int
-              number of instances in the batch
+    incy      rocblas_int
+              specifies the increment for the elements of y.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr_strided_batched(rocblas_handle handle,
-                                                           rocblas_fill   uplo,
-                                                           rocblas_int    n,
-                                                           const float*   alpha,
-                                                           const float*   x,
-                                                           rocblas_int    incx,
-                                                           rocblas_stride stridex,
-                                                           float*         A,
-                                                           rocblas_int    lda,
-                                                           rocblas_stride strideA,
-                                                           rocblas_int    batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ssbmv(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            rocblas_int    k,
+                                            const float*   alpha,
+                                            const float*   A,
+                                            rocblas_int    lda,
+                                            const float*   x,
+                                            rocblas_int    incx,
+                                            const float*   beta,
+                                            float*         y,
+                                            rocblas_int    incy);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr_strided_batched(rocblas_handle handle,
-                                                           rocblas_fill   uplo,
-                                                           rocblas_int    n,
-                                                           const double*  alpha,
-                                                           const double*  x,
-                                                           rocblas_int    incx,
-                                                           rocblas_stride stridex,
-                                                           double*        A,
-                                                           rocblas_int    lda,
-                                                           rocblas_stride strideA,
-                                                           rocblas_int    batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_dsbmv(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            rocblas_int    k,
+                                            const double*  alpha,
+                                            const double*  A,
+                                            rocblas_int    lda,
+                                            const double*  x,
+                                            rocblas_int    incx,
+                                            const double*  beta,
+                                            double*        y,
+                                            rocblas_int    incy);
 
-/*
- * ===========================================================================
- *    level 3 BLAS
- * ===========================================================================
- */
-/*! \brief BLAS Level 3 API
+/*! \brief BLAS Level 2 API
 
     \details
+    xSBMV_BATCHED performs a batch of the matrix-vector operations:
 
-    trmm performs one of the matrix-matrix operations
-
-    B := alpha*op( A )*B,   or   B := alpha*B*op( A )
-
-    where  alpha  is a scalar,  B  is an m by n matrix,  A  is a unit, or
-    non-unit,  upper or lower triangular matrix  and  op( A )  is one  of
+        y_i := alpha*A_i*x_i + beta*y_i,
 
-        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+    where alpha and beta are scalars, x_i and y_i are n element vectors and
+    A_i is an n by n symmetric band matrix with k sub- and super-diagonals,
+    for i = 1, ..., batch_count.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
-
     @param[in]
-    side    rocblas_side.
-            rocblas_side_left:       C := alpha*op( A )*B.
-            rocblas_side_right:      C := alpha*B*op( A ).
-
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of each A_i is stored.
     @param[in]
-    uplo    rocblas_fill.
-            rocblas_fill_upper:  A is an upper triangular matrix.
-            rocblas_fill_lower:  A is a  lower triangular matrix.
-
+    n         rocblas_int.
+              order of each A_i.
     @param[in]
-    transA  rocblas_operation.
-            transB:    op(A) = A.
-            rocblas_operation_transpose:      op(A) = A^T.
-            rocblas_operation_conjugate_transpose:  op(A) = A^H.
-
+    k         rocblas_int.
+              number of super-diagonals (upper) or sub-diagonals (lower) of each A_i.
     @param[in]
-    diag    rocblas_diagonal.
-            rocblas_diagonal_unit:      A is assumed to be unit triangular.
-            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
-
+    alpha
+              specifies the scalar alpha.
     @param[in]
-    m       rocblas_int.
-            m specifies the number of rows of B. m >= 0.
-
+    A         array of pointers storing each matrix A_i on the GPU.
+              Column j of A_i is stored in column j of the array, with the
+              diagonal in row k (upper) or row 0 (lower), so that A_i(i, j) is
+              stored at A_i[k + i - j + j*lda] (upper) or A_i[i - j + j*lda] (lower).
     @param[in]
-    n       rocblas_int.
-            n specifies the number of columns of B. n >= 0.
-
+    lda       rocblas_int
+              specifies the leading dimension of each A_i, which is at least k + 1.
     @param[in]
-    alpha
-            alpha specifies the scalar alpha. When alpha is
-            zero then A is not referenced and B need not be set before
-            entry.
-
+    x         array of pointers storing each vector x_i on the GPU.
     @param[in]
-    A       pointer storing matrix A on the GPU.
-            of dimension ( lda, k ), where k is m
-            when  rocblas_side_left  and
-            is  n  when  rocblas_side_right
-            only the upper/lower triangular part is accessed.
-
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
     @param[in]
-    lda     rocblas_int.
-            lda specifies the first dimension of A.
-            if side = rocblas_side_left,  lda >= max( 1, m ),
-            if side = rocblas_side_right, lda >= max( 1, n ).
-
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         array of pointers storing each vector y_i on the GPU.
     @param[in]
-    B       pointer storing matrix B on the GPU.
-
+    incy      rocblas_int
+              specifies the increment for the elements of each y_i.
     @param[in]
-    ldb    rocblas_int.
-           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+    batch_count
+              rocblas_int
+              number of instances in the batch.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_strmm(rocblas_handle    handle,
-                                            rocblas_side      side,
-                                            rocblas_fill      uplo,
-                                            rocblas_operation transA,
-                                            rocblas_diagonal  diag,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            const float*      alpha,
-                                            const float*      A,
-                                            rocblas_int       lda,
-                                            float*            B,
-                                            rocblas_int       ldb);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dtrmm(rocblas_handle    handle,
-                                            rocblas_side      side,
-                                            rocblas_fill      uplo,
-                                            rocblas_operation transA,
-                                            rocblas_diagonal  diag,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            const double*     alpha,
-                                            const double*     A,
-                                            rocblas_int       lda,
-                                            double*           B,
-                                            rocblas_int       ldb);
+ROCBLAS_EXPORT rocblas_status rocblas_ssbmv_batched(rocblas_handle     handle,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_int        n,
+                                                    rocblas_int        k,
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    rocblas_int        lda,
+                                                    const float* const x[],
+                                                    rocblas_int        incx,
+                                                    const float*       beta,
+                                                    float* const       y[],
+                                                    rocblas_int        incy,
+                                                    rocblas_int        batch_count);
 
-/*! \brief BLAS Level 3 API
+ROCBLAS_EXPORT rocblas_status rocblas_dsbmv_batched(rocblas_handle      handle,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_int         n,
+                                                    rocblas_int         k,
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    rocblas_int         lda,
+                                                    const double* const x[],
+                                                    rocblas_int         incx,
+                                                    const double*       beta,
+                                                    double* const       y[],
+                                                    rocblas_int         incy,
+                                                    rocblas_int         batch_count);
+
+/*! \brief BLAS Level 2 API
 
     \details
-    trtri  compute the inverse of a matrix  A, namely, invA
+    xSBMV_STRIDED_BATCHED performs a batch of the matrix-vector operations:
 
-        and write the result into invA;
+        y_i := alpha*A_i*x_i + beta*y_i,
+
+    where alpha and beta are scalars, x_i and y_i are n element vectors and
+    A_i is an n by n symmetric band matrix with k sub- and super-diagonals,
+    for i = 1, ..., batch_count.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
     uplo      rocblas_fill.
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              if rocblas_fill_upper, the lower part of A is not referenced
-              if rocblas_fill_lower, the upper part of A is not referenced
-    @param[in]
-    diag      rocblas_diagonal.
-              = 'rocblas_diagonal_non_unit', A is non-unit triangular;
-              = 'rocblas_diagonal_unit', A is unit triangular;
+              specifies whether the upper or lower triangle of each A_i is stored.
     @param[in]
     n         rocblas_int.
-              size of matrix A and invA
+              order of each A_i.
     @param[in]
-    A         pointer storing matrix A on the GPU.
+    k         rocblas_int.
+              number of super-diagonals (upper) or sub-diagonals (lower) of each A_i.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    A         pointer to the first matrix (A_1) in the batch, stored on the GPU.
+              Column j of A_i is stored in column j of the array, with the
+              diagonal in row k (upper) or row 0 (lower), so that A_i(i, j) is
+              stored at A_i[k + i - j + j*lda] (upper) or A_i[i - j + j*lda] (lower).
     @param[in]
     lda       rocblas_int
-              specifies the leading dimension of A.
-    @param[output]
-    invA      pointer storing matrix invA on the GPU.
+              specifies the leading dimension of each A_i, which is at least k + 1.
     @param[in]
-    ldinvA    rocblas_int
-              specifies the leading dimension of invA.
+    strideA   rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[in]
+    x         pointer to the first vector (x_1) in the batch, stored on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   rocblas_stride
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         pointer to the first vector (y_1) in the batch, stored on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey   rocblas_stride
+              stride from the start of one vector (y_i) and the next one (y_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
 
-********************************************************************/
+    ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_strtri(rocblas_handle   handle,
-                                             rocblas_fill     uplo,
-                                             rocblas_diagonal diag,
-                                             rocblas_int      n,
-                                             const float*     A,
-                                             rocblas_int      lda,
-                                             float*           invA,
-                                             rocblas_int      ldinvA);
+ROCBLAS_EXPORT rocblas_status rocblas_ssbmv_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            rocblas_int    k,
+                                                            const float*   alpha,
+                                                            const float*   A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride strideA,
+                                                            const float*   x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const float*   beta,
+                                                            float*         y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            rocblas_int    batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dtrtri(rocblas_handle   handle,
-                                             rocblas_fill     uplo,
-                                             rocblas_diagonal diag,
-                                             rocblas_int      n,
-                                             const double*    A,
-                                             rocblas_int      lda,
-                                             double*          invA,
-                                             rocblas_int      ldinvA);
+ROCBLAS_EXPORT rocblas_status rocblas_dsbmv_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            rocblas_int    k,
+                                                            const double*  alpha,
+                                                            const double*  A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride strideA,
+                                                            const double*  x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const double*  beta,
+                                                            double*        y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            rocblas_int    batch_count);
 
-/*! \brief BLAS Level 3 API
+/*! \brief BLAS Level 2 API
 
     \details
-    trtri_batched  compute the inverse of A_i and write into invA_i where
-                   A_i and invA_i are the i-th matrices in the batch,
-                   for i in [0, batch_count - 1]
+    xSPMV performs the matrix-vector operation:
+
+        y := alpha*A*x + beta*y,
+
+    where alpha and beta are scalars, x and y are n element vectors and
+    A is an n by n symmetric matrix, supplied in packed form.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
     uplo      rocblas_fill.
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-    @param[in]
-    diag      rocblas_diagonal.
-              = 'rocblas_diagonal_non_unit', A is non-unit triangular;
-              = 'rocblas_diagonal_unit', A is unit triangular;
+              specifies whether the upper or lower triangle of A is stored.
     @param[in]
     n         rocblas_int.
+              order of A.
     @param[in]
-    A         array of pointers storing matrices A on the GPU.
+    alpha
+              specifies the scalar alpha.
     @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
-    @param[out]
-    invA      array of pointers storing the inverse matrices A on the GPU.
-              Partial inplace operation is supported, see below.
-              If UPLO = 'U', the leading N-by-N upper triangular part of the invA will store
-              the inverse of the upper triangular matrix, and the strictly lower
-              triangular part of invA is cleared.
-              If UPLO = 'L', the leading N-by-N lower triangular part of the invA will store
-              the inverse of the lower triangular matrix, and the strictly upper
-              triangular part of invA is cleared.
+    AP        pointer storing matrix A on the GPU.
+              The columns of the triangle of A are stored one after another,
+              so that A(i, j) is stored at AP[i + j*(j + 1)/2] (upper) or
+              AP[i + j*(2*n - j - 1)/2] (lower).
     @param[in]
-    ldinvA    rocblas_int
-              specifies the leading dimension of invA.
+    x         pointer storing vector x on the GPU.
     @param[in]
-    batch_count       rocblas_int
-              numbers of matrices in the batch
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_strtri_batched(rocblas_handle     handle,
-                                                     rocblas_fill       uplo,
-                                                     rocblas_diagonal   diag,
-                                                     rocblas_int        n,
-                                                     const float* const A[],
-                                                     rocblas_int        lda,
-                                                     float*             invA[],
-                                                     rocblas_int        ldinvA,
-                                                     rocblas_int        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_sspmv(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            const float*   alpha,
+                                            const float*   AP,
+                                            const float*   x,
+                                            rocblas_int    incx,
+                                            const float*   beta,
+                                            float*         y,
+                                            rocblas_int    incy);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dtrtri_batched(rocblas_handle      handle,
-                                                     rocblas_fill        uplo,
-                                                     rocblas_diagonal    diag,
-                                                     rocblas_int         n,
-                                                     const double* const A[],
-                                                     rocblas_int         lda,
-                                                     double*             invA[],
-                                                     rocblas_int         ldinvA,
-                                                     rocblas_int         batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_dspmv(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            const double*  alpha,
+                                            const double*  AP,
+                                            const double*  x,
+                                            rocblas_int    incx,
+                                            const double*  beta,
+                                            double*        y,
+                                            rocblas_int    incy);
 
-/*! \brief BLAS Level 3 API
+/*! \brief BLAS Level 2 API
 
     \details
-    trtri_strided_batched compute the inverse of A_i and write into invA_i where
-                   A_i and invA_i are the i-th matrices in the batch,
-                   for i in [0, batch_count - 1]
+    xSPMV_BATCHED performs a batch of the matrix-vector operations:
+
+        y_i := alpha*A_i*x_i + beta*y_i,
+
+    where alpha and beta are scalars, x_i and y_i are n element vectors and
+    A_i is an n by n symmetric matrix, supplied in packed form,
+    for i = 1, ..., batch_count.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
     uplo      rocblas_fill.
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-    @param[in]
-    diag      rocblas_diagonal.
-              = 'rocblas_diagonal_non_unit', A is non-unit triangular;
-              = 'rocblas_diagonal_unit', A is unit triangular;
+              specifies whether the upper or lower triangle of each A_i is stored.
     @param[in]
     n         rocblas_int.
+              order of each A_i.
     @param[in]
-    A         pointer storing matrix A on the GPU.
+    alpha
+              specifies the scalar alpha.
     @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
+    AP        array of pointers storing each matrix A_i on the GPU.
+              The columns of the triangle of A_i are stored one after another,
+              so that A_i(i, j) is stored at AP[i + j*(j + 1)/2] (upper) or
+              AP[i + j*(2*n - j - 1)/2] (lower).
     @param[in]
-    stride_a  rocblas_stride
-             "batch stride a": stride from the start of one "A" matrix to the next
-    @param[out]
-    invA      pointer storing the inverse matrix A on the GPU.
-              Partial inplace operation is supported, see below.
-              If UPLO = 'U', the leading N-by-N upper triangular part of the invA will store
-              the inverse of the upper triangular matrix, and the strictly lower
-              triangular part of invA is cleared.
-              If UPLO = 'L', the leading N-by-N lower triangular part of the invA will store
-              the inverse of the lower triangular matrix, and the strictly upper
-              triangular part of invA is cleared.
+    x         array of pointers storing each vector x_i on the GPU.
     @param[in]
-    ldinvA    rocblas_int
-              specifies the leading dimension of invA.
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
     @param[in]
-    stride_invA  rocblas_stride
-                 "batch stride invA": stride from the start of one "invA" matrix to the next
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         array of pointers storing each vector y_i on the GPU.
     @param[in]
-    batch_count  rocblas_int
-                 numbers of matrices in the batch
-    ********************************************************************/
-
-ROCBLAS_EXPORT rocblas_status rocblas_strtri_strided_batched(rocblas_handle   handle,
-                                                             rocblas_fill     uplo,
-                                                             rocblas_diagonal diag,
-                                                             rocblas_int      n,
-                                                             const float*     A,
-                                                             rocblas_int      lda,
-                                                             rocblas_stride   stride_a,
-                                                             float*           invA,
-                                                             rocblas_int      ldinvA,
-                                                             rocblas_stride   stride_invA,
-                                                             rocblas_int      batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dtrtri_strided_batched(rocblas_handle   handle,
-                                                             rocblas_fill     uplo,
-                                                             rocblas_diagonal diag,
-                                                             rocblas_int      n,
-                                                             const double*    A,
-                                                             rocblas_int      lda,
-                                                             rocblas_stride   stride_a,
-                                                             double*          invA,
-                                                             rocblas_int      ldinvA,
-                                                             rocblas_stride   stride_invA,
-                                                             rocblas_int      batch_count);
+    incy      rocblas_int
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
 
-/*! \brief BLAS Level 3 API
+    ********************************************************************/
 
-    \details
+ROCBLAS_EXPORT rocblas_status rocblas_sspmv_batched(rocblas_handle     handle,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_int        n,
+                                                    const float*       alpha,
+                                                    const float* const AP[],
+                                                    const float* const x[],
+                                                    rocblas_int        incx,
+                                                    const float*       beta,
+                                                    float* const       y[],
+                                                    rocblas_int        incy,
+                                                    rocblas_int        batch_count);
 
-    trsm solves
-
-        op(A)*X = alpha*B or  X*op(A) = alpha*B,
-
-    where alpha is a scalar, X and B are m by n matrices,
-    A is triangular matrix and op(A) is one of
+ROCBLAS_EXPORT rocblas_status rocblas_dspmv_batched(rocblas_handle      handle,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_int         n,
+                                                    const double*       alpha,
+                                                    const double* const AP[],
+                                                    const double* const x[],
+                                                    rocblas_int         incx,
+                                                    const double*       beta,
+                                                    double* const       y[],
+                                                    rocblas_int         incy,
+                                                    rocblas_int         batch_count);
 
-        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+/*! \brief BLAS Level 2 API
 
-    The matrix X is overwritten on B.
+    \details
+    xSPMV_STRIDED_BATCHED performs a batch of the matrix-vector operations:
 
-    Note about memory allocation:
-    When trsm is launched with a k evenly divisible by the internal block size of 128,
-    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
-    memory found in the handle to increase overall performance. This memory can be managed by using
-    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
-    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
-    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
-    to the desired chunk of right hand sides to be used at a time.
+        y_i := alpha*A_i*x_i + beta*y_i,
 
-    (where k is m when rocblas_side_left and is n when rocblas_side_right)
+    where alpha and beta are scalars, x_i and y_i are n element vectors and
+    A_i is an n by n symmetric matrix, supplied in packed form,
+    for i = 1, ..., batch_count.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
-
     @param[in]
-    side    rocblas_side.
-            rocblas_side_left:       op(A)*X = alpha*B.
-            rocblas_side_right:      X*op(A) = alpha*B.
-
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of each A_i is stored.
     @param[in]
-    uplo    rocblas_fill.
-            rocblas_fill_upper:  A is an upper triangular matrix.
-            rocblas_fill_lower:  A is a  lower triangular matrix.
-
+    n         rocblas_int.
+              order of each A_i.
     @param[in]
-    transA  rocblas_operation.
-            transB:    op(A) = A.
-            rocblas_operation_transpose:      op(A) = A^T.
-            rocblas_operation_conjugate_transpose:  op(A) = A^H.
-
+    alpha
+              specifies the scalar alpha.
     @param[in]
-    diag    rocblas_diagonal.
-            rocblas_diagonal_unit:     A is assumed to be unit triangular.
-            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
-
+    AP        pointer to the first matrix (A_1) in the batch, stored on the GPU.
+              The columns of the triangle of A_i are stored one after another,
+              so that A_i(i, j) is stored at AP[i + j*(j + 1)/2] (upper) or
+              AP[i + j*(2*n - j - 1)/2] (lower).
     @param[in]
-    m       rocblas_int.
-            m specifies the number of rows of B. m >= 0.
-
+    strideA   rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
     @param[in]
-    n       rocblas_int.
-            n specifies the number of columns of B. n >= 0.
-
+    x         pointer to the first vector (x_1) in the batch, stored on the GPU.
     @param[in]
-    alpha
-            alpha specifies the scalar alpha. When alpha is
-            &zero then A is not referenced and B need not be set before
-            entry.
-
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
     @param[in]
-    A       pointer storing matrix A on the GPU.
-            of dimension ( lda, k ), where k is m
-            when  rocblas_side_left  and
-            is  n  when  rocblas_side_right
-            only the upper/lower triangular part is accessed.
-
+    stridex   rocblas_stride
+              stride from the start of one vector (x_i) and the next one (x_i+1).
     @param[in]
-    lda     rocblas_int.
-            lda specifies the first dimension of A.
-            if side = rocblas_side_left,  lda >= max( 1, m ),
-            if side = rocblas_side_right, lda >= max( 1, n ).
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         pointer to the first vector (y_1) in the batch, stored on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey   rocblas_stride
+              stride from the start of one vector (y_i) and the next one (y_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
 
-    @param[in,output]
-    B       pointer storing matrix B on the GPU.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sspmv_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            const float*   alpha,
+                                                            const float*   AP,
+                                                            rocblas_stride strideA,
+                                                            const float*   x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const float*   beta,
+                                                            float*         y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dspmv_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            const double*  alpha,
+                                                            const double*  AP,
+                                                            rocblas_stride strideA,
+                                                            const double*  x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const double*  beta,
+                                                            double*        y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            rocblas_int    batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTBMV performs the matrix-vector operation:
+
+        x := A*x,   or   x := A**T*x,
+
+    where x is an n element vector and A is an n by n unit, or non-unit,
+    upper or lower triangular band matrix with (k + 1) diagonals.
 
     @param[in]
-    ldb    rocblas_int.
-           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether A is upper or lower triangular.
+    @param[in]
+    transA    rocblas_operation.
+              specifies op(A). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A**T.
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit if A has a unit diagonal, which is not read.
+    @param[in]
+    n         rocblas_int.
+              order of A.
+    @param[in]
+    k         rocblas_int.
+              number of super-diagonals (upper) or sub-diagonals (lower) of A.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+              Column j of A is stored in column j of the array, with the
+              diagonal in row k (upper) or row 0 (lower), so that A(i, j) is
+              stored at A[k + i - j + j*lda] (upper) or A[i - j + j*lda] (lower).
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, which is at least k + 1.
+    @param[inout]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_strsm(rocblas_handle    handle,
-                                            rocblas_side      side,
+ROCBLAS_EXPORT rocblas_status rocblas_stbmv(rocblas_handle    handle,
                                             rocblas_fill      uplo,
                                             rocblas_operation transA,
                                             rocblas_diagonal  diag,
-                                            rocblas_int       m,
                                             rocblas_int       n,
-                                            const float*      alpha,
+                                            rocblas_int       k,
                                             const float*      A,
                                             rocblas_int       lda,
-                                            float*            B,
-                                            rocblas_int       ldb);
+                                            float*            x,
+                                            rocblas_int       incx);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dtrsm(rocblas_handle    handle,
-                                            rocblas_side      side,
+ROCBLAS_EXPORT rocblas_status rocblas_dtbmv(rocblas_handle    handle,
                                             rocblas_fill      uplo,
                                             rocblas_operation transA,
                                             rocblas_diagonal  diag,
-                                            rocblas_int       m,
                                             rocblas_int       n,
-                                            const double*     alpha,
+                                            rocblas_int       k,
                                             const double*     A,
                                             rocblas_int       lda,
-                                            double*           B,
-                                            rocblas_int       ldb);
+                                            double*           x,
+                                            rocblas_int       incx);
+
+/*! \brief BLAS Level 2 API
 
-/*! \brief BLAS Level 3 API
     \details
-    trsm_batched performs the following batched operation:
-        op(A[i])*X = alpha*B[i] or  X*op(A[i]) = alpha*B[i], for
-    i in [0, batch_count - 1]
-    where alpha is a scalar, X and B are batched m by n matrices,
-    A is triangular batched matrix and op(A) is one of
-        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
-    Each matrix X[i] is overwritten on B[i] for i in [0, batch_count - 1].
-    Note about memory allocation:
-    When trsm is launched with a k evenly divisible by the internal block size of 128,
-    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
-    memory found in the handle to increase overall performance. This memory can be managed by using
-    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
-    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
-    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
-    to the desired chunk of right hand sides to be used at a time.
-    (where k is m when rocblas_side_left and is n when rocblas_side_right)
+    xTBMV_BATCHED performs a batch of the matrix-vector operations:
+
+        x_i := A_i*x_i,   or   x_i := A_i**T*x_i,
+
+    where x_i is an n element vector and A_i is an n by n unit, or non-unit,
+    upper or lower triangular band matrix with (k + 1) diagonals,
+    for i = 1, ..., batch_count.
+
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    side    rocblas_side.
-            rocblas_side_left:       op(A)*X = alpha*B.
-            rocblas_side_right:      X*op(A) = alpha*B.
-    @param[in]
-    uplo    rocblas_fill.
-            rocblas_fill_upper:  A is an upper triangular matrix.
-            rocblas_fill_lower:  A is a  lower triangular matrix.
-    @param[in]
-    transA  rocblas_operation.
-            transB:    op(A) = A.
-            rocblas_operation_transpose:      op(A) = A^T.
-            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+    uplo      rocblas_fill.
+              specifies whether each A_i is upper or lower triangular.
     @param[in]
-    diag    rocblas_diagonal.
-            rocblas_diagonal_unit:     A is assumed to be unit triangular.
-            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+    transA    rocblas_operation.
+              specifies op(A_i). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A_i**T.
     @param[in]
-    m       rocblas_int.
-            m specifies the number of rows of B. m >= 0.
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit if each A_i has a unit diagonal, which is not read.
     @param[in]
-    n       rocblas_int.
-            n specifies the number of columns of B. n >= 0.
+    n         rocblas_int.
+              order of each A_i.
     @param[in]
-    alpha
-            alpha specifies the scalar alpha. When alpha is
-            &zero then A is not referenced and B need not be set before
-            entry.
+    k         rocblas_int.
+              number of super-diagonals (upper) or sub-diagonals (lower) of each A_i.
     @param[in]
-    A       HOST array of DEVICE pointers storing matricies A on the GPU.
-            Matricies are of dimension ( lda, k ), where k is m
-            when  rocblas_side_left  and is  n  when  rocblas_side_right
-            only the upper/lower triangular part is accessed.
+    A         array of pointers storing each matrix A_i on the GPU.
+              Column j of A_i is stored in column j of the array, with the
+              diagonal in row k (upper) or row 0 (lower), so that A_i(i, j) is
+              stored at A_i[k + i - j + j*lda] (upper) or A_i[i - j + j*lda] (lower).
     @param[in]
-    lda     rocblas_int.
-            lda specifies the first dimension of A.
-            if side = rocblas_side_left,  lda >= max( 1, m ),
-            if side = rocblas_side_right, lda >= max( 1, n ).
-    @param[in,output]
-    B       HOST array of DEVICE pointers storing matricies B on the GPU.
+    lda       rocblas_int
+              specifies the leading dimension of each A_i, which is at least k + 1.
+    @param[inout]
+    x         array of pointers storing each vector x_i on the GPU.
     @param[in]
-    ldb    rocblas_int.
-           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
     @param[in]
-    batch_count rocblas_int.
-                number of trsm operatons in the batch.
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_strsm_batched(rocblas_handle     handle,
-                                                    rocblas_side       side,
+ROCBLAS_EXPORT rocblas_status rocblas_stbmv_batched(rocblas_handle     handle,
                                                     rocblas_fill       uplo,
                                                     rocblas_operation  transA,
                                                     rocblas_diagonal   diag,
-                                                    rocblas_int        m,
                                                     rocblas_int        n,
-                                                    const float*       alpha,
+                                                    rocblas_int        k,
                                                     const float* const A[],
                                                     rocblas_int        lda,
-                                                    float*             B[],
-                                                    rocblas_int        ldb,
+                                                    float* const       x[],
+                                                    rocblas_int        incx,
                                                     rocblas_int        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_batched(rocblas_handle      handle,
-                                                    rocblas_side        side,
+ROCBLAS_EXPORT rocblas_status rocblas_dtbmv_batched(rocblas_handle      handle,
                                                     rocblas_fill        uplo,
                                                     rocblas_operation   transA,
                                                     rocblas_diagonal    diag,
-                                                    rocblas_int         m,
                                                     rocblas_int         n,
-                                                    const double*       alpha,
+                                                    rocblas_int         k,
                                                     const double* const A[],
                                                     rocblas_int         lda,
-                                                    double*             B[],
-                                                    rocblas_int         ldb,
+                                                    double* const       x[],
+                                                    rocblas_int         incx,
                                                     rocblas_int         batch_count);
 
-/*! \brief BLAS Level 3 API
+/*! \brief BLAS Level 2 API
+
     \details
-    trsm_srided_batched performs the following strided batched operation:
-        op(A[i * stride_a])*X = alpha*B[i*stride_b] or  X*op(A[i*stride_a]) = alpha*B[i*stride_b], for
-    i in [0, batch_count - 1]
-    where alpha is a scalar, X and B are strided batched m by n matrices,
-    A is triangular strided batched matrix and op(A) is one of
-        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
-    Each matrix X[i] is overwritten on B[i] for i in [0, batch_count - 1].
-    Note about memory allocation:
-    When trsm is launched with a k evenly divisible by the internal block size of 128,
-    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
+    xTBMV_STRIDED_BATCHED performs a batch of the matrix-vector operations:
+
+        x_i := A_i*x_i,   or   x_i := A_i**T*x_i,
+
+    where x_i is an n element vector and A_i is an n by n unit, or non-unit,
+    upper or lower triangular band matrix with (k + 1) diagonals,
+    for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether each A_i is upper or lower triangular.
+    @param[in]
+    transA    rocblas_operation.
+              specifies op(A_i). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A_i**T.
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit if each A_i has a unit diagonal, which is not read.
+    @param[in]
+    n         rocblas_int.
+              order of each A_i.
+    @param[in]
+    k         rocblas_int.
+              number of super-diagonals (upper) or sub-diagonals (lower) of each A_i.
+    @param[in]
+    A         pointer to the first matrix (A_1) in the batch, stored on the GPU.
+              Column j of A_i is stored in column j of the array, with the
+              diagonal in row k (upper) or row 0 (lower), so that A_i(i, j) is
+              stored at A_i[k + i - j + j*lda] (upper) or A_i[i - j + j*lda] (lower).
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A_i, which is at least k + 1.
+    @param[in]
+    strideA   rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[inout]
+    x         pointer to the first vector (x_1) in the batch, stored on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   rocblas_stride
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stbmv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const float*      A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    strideA,
+                                                            float*            x,
+                                                            rocblas_int       incx,
+                                                            rocblas_stride    stridex,
+                                                            rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtbmv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const double*     A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    strideA,
+                                                            double*           x,
+                                                            rocblas_int       incx,
+                                                            rocblas_stride    stridex,
+                                                            rocblas_int       batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTPMV performs the matrix-vector operation:
+
+        x := A*x,   or   x := A**T*x,
+
+    where x is an n element vector and A is an n by n unit, or non-unit,
+    upper or lower triangular matrix, supplied in packed form.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether A is upper or lower triangular.
+    @param[in]
+    transA    rocblas_operation.
+              specifies op(A). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A**T.
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit if A has a unit diagonal, which is not read.
+    @param[in]
+    n         rocblas_int.
+              order of A.
+    @param[in]
+    AP        pointer storing matrix A on the GPU.
+              The columns of the triangle of A are stored one after another,
+              so that A(i, j) is stored at AP[i + j*(j + 1)/2] (upper) or
+              AP[i + j*(2*n - j - 1)/2] (lower).
+    @param[inout]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stpmv(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       n,
+                                            const float*      AP,
+                                            float*            x,
+                                            rocblas_int       incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpmv(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       n,
+                                            const double*     AP,
+                                            double*           x,
+                                            rocblas_int       incx);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTPMV_BATCHED performs a batch of the matrix-vector operations:
+
+        x_i := A_i*x_i,   or   x_i := A_i**T*x_i,
+
+    where x_i is an n element vector and A_i is an n by n unit, or non-unit,
+    upper or lower triangular matrix, supplied in packed form,
+    for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether each A_i is upper or lower triangular.
+    @param[in]
+    transA    rocblas_operation.
+              specifies op(A_i). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A_i**T.
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit if each A_i has a unit diagonal, which is not read.
+    @param[in]
+    n         rocblas_int.
+              order of each A_i.
+    @param[in]
+    AP        array of pointers storing each matrix A_i on the GPU.
+              The columns of the triangle of A_i are stored one after another,
+              so that A_i(i, j) is stored at AP[i + j*(j + 1)/2] (upper) or
+              AP[i + j*(2*n - j - 1)/2] (lower).
+    @param[inout]
+    x         array of pointers storing each vector x_i on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stpmv_batched(rocblas_handle     handle,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_operation  transA,
+                                                    rocblas_diagonal   diag,
+                                                    rocblas_int        n,
+                                                    const float* const AP[],
+                                                    float* const       x[],
+                                                    rocblas_int        incx,
+                                                    rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpmv_batched(rocblas_handle      handle,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_operation   transA,
+                                                    rocblas_diagonal    diag,
+                                                    rocblas_int         n,
+                                                    const double* const AP[],
+                                                    double* const       x[],
+                                                    rocblas_int         incx,
+                                                    rocblas_int         batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTPMV_STRIDED_BATCHED performs a batch of the matrix-vector operations:
+
+        x_i := A_i*x_i,   or   x_i := A_i**T*x_i,
+
+    where x_i is an n element vector and A_i is an n by n unit, or non-unit,
+    upper or lower triangular matrix, supplied in packed form,
+    for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether each A_i is upper or lower triangular.
+    @param[in]
+    transA    rocblas_operation.
+              specifies op(A_i). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A_i**T.
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit if each A_i has a unit diagonal, which is not read.
+    @param[in]
+    n         rocblas_int.
+              order of each A_i.
+    @param[in]
+    AP        pointer to the first matrix (A_1) in the batch, stored on the GPU.
+              The columns of the triangle of A_i are stored one after another,
+              so that A_i(i, j) is stored at AP[i + j*(j + 1)/2] (upper) or
+              AP[i + j*(2*n - j - 1)/2] (lower).
+    @param[in]
+    strideA   rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[inout]
+    x         pointer to the first vector (x_1) in the batch, stored on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   rocblas_stride
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stpmv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       n,
+                                                            const float*      AP,
+                                                            rocblas_stride    strideA,
+                                                            float*            x,
+                                                            rocblas_int       incx,
+                                                            rocblas_stride    stridex,
+                                                            rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpmv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       n,
+                                                            const double*     AP,
+                                                            rocblas_stride    strideA,
+                                                            double*           x,
+                                                            rocblas_int       incx,
+                                                            rocblas_stride    stridex,
+                                                            rocblas_int       batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTPSV solves the system of equations:
+
+        A*x = b,   or   A**T*x = b,
+
+    where b and x are n element vectors and A is an n by n unit, or
+    non-unit, upper or lower triangular matrix, supplied in packed form.
+    No test for singularity or near-singularity is included.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether A is upper or lower triangular.
+    @param[in]
+    transA    rocblas_operation.
+              specifies op(A). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A**T.
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit if A has a unit diagonal, which is not read.
+    @param[in]
+    n         rocblas_int.
+              order of A.
+    @param[in]
+    AP        pointer storing matrix A on the GPU.
+              The columns of the triangle of A are stored one after another,
+              so that A(i, j) is stored at AP[i + j*(j + 1)/2] (upper) or
+              AP[i + j*(2*n - j - 1)/2] (lower).
+    @param[inout]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stpsv(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       n,
+                                            const float*      AP,
+                                            float*            x,
+                                            rocblas_int       incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpsv(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       n,
+                                            const double*     AP,
+                                            double*           x,
+                                            rocblas_int       incx);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTPSV_BATCHED solves a batch of the systems of equations:
+
+        A_i*x_i = b_i,   or   A_i**T*x_i = b_i,
+
+    where b_i and x_i are n element vectors and A_i is an n by n unit, or
+    non-unit, upper or lower triangular matrix, supplied in packed form,
+    for i = 1, ..., batch_count.
+    No test for singularity or near-singularity is included.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether each A_i is upper or lower triangular.
+    @param[in]
+    transA    rocblas_operation.
+              specifies op(A_i). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A_i**T.
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit if each A_i has a unit diagonal, which is not read.
+    @param[in]
+    n         rocblas_int.
+              order of each A_i.
+    @param[in]
+    AP        array of pointers storing each matrix A_i on the GPU.
+              The columns of the triangle of A_i are stored one after another,
+              so that A_i(i, j) is stored at AP[i + j*(j + 1)/2] (upper) or
+              AP[i + j*(2*n - j - 1)/2] (lower).
+    @param[inout]
+    x         array of pointers storing each vector x_i on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stpsv_batched(rocblas_handle     handle,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_operation  transA,
+                                                    rocblas_diagonal   diag,
+                                                    rocblas_int        n,
+                                                    const float* const AP[],
+                                                    float* const       x[],
+                                                    rocblas_int        incx,
+                                                    rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpsv_batched(rocblas_handle      handle,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_operation   transA,
+                                                    rocblas_diagonal    diag,
+                                                    rocblas_int         n,
+                                                    const double* const AP[],
+                                                    double* const       x[],
+                                                    rocblas_int         incx,
+                                                    rocblas_int         batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTPSV_STRIDED_BATCHED solves a batch of the systems of equations:
+
+        A_i*x_i = b_i,   or   A_i**T*x_i = b_i,
+
+    where b_i and x_i are n element vectors and A_i is an n by n unit, or
+    non-unit, upper or lower triangular matrix, supplied in packed form,
+    for i = 1, ..., batch_count.
+    No test for singularity or near-singularity is included.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether each A_i is upper or lower triangular.
+    @param[in]
+    transA    rocblas_operation.
+              specifies op(A_i). rocblas_operation_transpose and
+              rocblas_operation_conjugate_transpose both select A_i**T.
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit if each A_i has a unit diagonal, which is not read.
+    @param[in]
+    n         rocblas_int.
+              order of each A_i.
+    @param[in]
+    AP        pointer to the first matrix (A_1) in the batch, stored on the GPU.
+              The columns of the triangle of A_i are stored one after another,
+              so that A_i(i, j) is stored at AP[i + j*(j + 1)/2] (upper) or
+              AP[i + j*(2*n - j - 1)/2] (lower).
+    @param[in]
+    strideA   rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[inout]
+    x         pointer to the first vector (x_1) in the batch, stored on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   rocblas_stride
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stpsv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       n,
+                                                            const float*      AP,
+                                                            rocblas_stride    strideA,
+                                                            float*            x,
+                                                            rocblas_int       incx,
+                                                            rocblas_stride    stridex,
+                                                            rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpsv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       n,
+                                                            const double*     AP,
+                                                            rocblas_stride    strideA,
+                                                            double*           x,
+                                                            rocblas_int       incx,
+                                                            rocblas_stride    stridex,
+                                                            rocblas_int       batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGER performs the matrix-vector operations
+
+        A := A + alpha*x*y**T
+
+    where alpha is a scalar, x and y are vectors, and A is an
+    m by n matrix.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    m         rocblas_int
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sger(rocblas_handle handle,
+                                           rocblas_int    m,
+                                           rocblas_int    n,
+                                           const float*   alpha,
+                                           const float*   x,
+                                           rocblas_int    incx,
+                                           const float*   y,
+                                           rocblas_int    incy,
+                                           float*         A,
+                                           rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger(rocblas_handle handle,
+                                           rocblas_int    m,
+                                           rocblas_int    n,
+                                           const double*  alpha,
+                                           const double*  x,
+                                           rocblas_int    incx,
+                                           const double*  y,
+                                           rocblas_int    incy,
+                                           double*        A,
+                                           rocblas_int    lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGER_BATCHED performs a batch of the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*y_i**T
+
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha is a scalar, x_i and y_i are vectors and A_i is an
+    m by n matrix.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    m         rocblas_int
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         array of pointers storing the different vectors x_i on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of vectors x_i.
+    @param[in]
+    y         array of pointesr storing the different vectors y_i on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of vectors y_i.
+    @param[inout]
+    A         array of pointers storing the different matrices A_i on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    batch_count rocblas_int
+                number of instances in the batch
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sger_batched(rocblas_handle     handle,
+                                                   rocblas_int        m,
+                                                   rocblas_int        n,
+                                                   const float*       alpha,
+                                                   const float* const x[],
+                                                   rocblas_int        incx,
+                                                   const float* const y[],
+                                                   rocblas_int        incy,
+                                                   float* const       A[],
+                                                   rocblas_int        lda,
+                                                   rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_batched(rocblas_handle      handle,
+                                                   rocblas_int         m,
+                                                   rocblas_int         n,
+                                                   const double*       alpha,
+                                                   const double* const x[],
+                                                   rocblas_int         incx,
+                                                   const double* const y[],
+                                                   rocblas_int         incy,
+                                                   double* const       A[],
+                                                   rocblas_int         lda,
+                                                   rocblas_int         batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGER_STRIDED_BATCHED performs the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*y_i**T
+
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha is a scalar, x_i and y_i are vectors and A_i is an
+    m by n matrix.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    m         rocblas_int
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer to the first vector (x_0) in the batch stored on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increments for the elements of vectors x_i.
+    @param[in]
+    stridex   rocblas_stride
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+              There are no restrictions placed on stride_x, however the user should
+              take care to ensure that stride_x is of appropriate size, for a typical
+              case this means stride_x >= m * incx.
+    @param[inout]
+    y         pointer to the first vector (y_0) in the batch stored on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of vectors y_i.
+    @param[in]
+    stridey   rocblas_stride
+              stride from the start of one vector (y_i) and the next one (y_i+1).
+              There are no restrictions placed on stride_y, however the user should
+              take care to ensure that stride_y is of appropriate size, for a typical
+              case this means stride_y >= n * incy.
+    @param[inout]
+    A         pointer to the first matrix (A_0) in the batch stored on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    strideA     rocblas_stride
+                stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    batch_count rocblas_int
+                number of instances in the batch
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sger_strided_batched(rocblas_handle handle,
+                                                           rocblas_int    m,
+                                                           rocblas_int    n,
+                                                           const float*   alpha,
+                                                           const float*   x,
+                                                           rocblas_int    incx,
+                                                           rocblas_stride stridex,
+                                                           const float*   y,
+                                                           rocblas_int    incy,
+                                                           rocblas_stride stridey,
+                                                           float*         A,
+                                                           rocblas_int    lda,
+                                                           rocblas_stride strideA,
+                                                           rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_strided_batched(rocblas_handle handle,
+                                                           rocblas_int    m,
+                                                           rocblas_int    n,
+                                                           const double*  alpha,
+                                                           const double*  x,
+                                                           rocblas_int    incx,
+                                                           rocblas_stride stridex,
+                                                           const double*  y,
+                                                           rocblas_int    incy,
+                                                           rocblas_stride stridey,
+                                                           double*        A,
+                                                           rocblas_int    lda,
+                                                           rocblas_stride strideA,
+                                                           rocblas_int    batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    ger_accumulator_create creates a rocblas_ger_accumulator for the m by n matrix A, which
+    collects the rank-1 updates
+
+        A := A + alpha*x*y**T
+
+    given to ger_accumulate, and applies up to max_k of them together as the rank-k update
+    A := A + X*Y**T by one matrix multiplication, which reads A once instead of once per update.
+
+    The pending updates are applied when max_k of them have been collected, and by
+    ger_accumulator_flush, which must be called before A is read or modified by anything other
+    than ger_accumulate. A is not copied into the accumulator, and must not be freed while the
+    accumulator is used. The accumulator allocates (m + n) * max_k elements of device memory,
+    and must be destroyed with rocblas_destroy_ger_accumulator.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    m         rocblas_int
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    max_k     rocblas_int
+              the number of updates collected before they are applied. max_k >= 1.
+    @param[out]
+    acc       pointer to the rocblas_ger_accumulator created.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sger_accumulator_create(rocblas_handle           handle,
+                                                              rocblas_int              m,
+                                                              rocblas_int              n,
+                                                              float*                   A,
+                                                              rocblas_int              lda,
+                                                              rocblas_int              max_k,
+                                                              rocblas_ger_accumulator* acc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_accumulator_create(rocblas_handle           handle,
+                                                              rocblas_int              m,
+                                                              rocblas_int              n,
+                                                              double*                  A,
+                                                              rocblas_int              lda,
+                                                              rocblas_int              max_k,
+                                                              rocblas_ger_accumulator* acc);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    ger_accumulate adds the rank-1 update
+
+        A := A + alpha*x*y**T
+
+    to a rocblas_ger_accumulator, where alpha is a scalar, x is a vector of length m and y is a
+    vector of length n. alpha*x and y are copied, so x and y may be changed after the call. When
+    the accumulator then holds max_k updates, they are applied to A before returning.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    acc       rocblas_ger_accumulator.
+              accumulator created by ger_accumulator_create for the same precision.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sger_accumulate(rocblas_handle          handle,
+                                                      rocblas_ger_accumulator acc,
+                                                      const float*            alpha,
+                                                      const float*            x,
+                                                      rocblas_int             incx,
+                                                      const float*            y,
+                                                      rocblas_int             incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_accumulate(rocblas_handle          handle,
+                                                      rocblas_ger_accumulator acc,
+                                                      const double*           alpha,
+                                                      const double*           x,
+                                                      rocblas_int             incx,
+                                                      const double*           y,
+                                                      rocblas_int             incy);
+
+/*! \brief Applies the updates pending in a rocblas_ger_accumulator to its matrix A, which
+    leaves the accumulator empty. */
+ROCBLAS_EXPORT rocblas_status rocblas_ger_accumulator_flush(rocblas_handle          handle,
+                                                            rocblas_ger_accumulator acc);
+
+/*! \brief Destroys a rocblas_ger_accumulator and frees its device memory. Updates which have
+    not been flushed are discarded. This synchronizes with the device. */
+ROCBLAS_EXPORT rocblas_status rocblas_destroy_ger_accumulator(rocblas_ger_accumulator acc);
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_cger(rocblas_handle handle,
+                 rocblas_int m, rocblas_int n,
+                 const rocblas_float_complex *alpha,
+                 const rocblas_float_complex *x, rocblas_int incx,
+                 const rocblas_float_complex *y, rocblas_int incy,
+                       rocblas_float_complex *A, rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zger(rocblas_handle handle,
+                 rocblas_int m, rocblas_int n,
+                 const rocblas_double_complex *alpha,
+                 const rocblas_double_complex *x, rocblas_int incx,
+                 const rocblas_double_complex *y, rocblas_int incy,
+                       rocblas_double_complex *A, rocblas_int lda);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR performs the matrix-vector operations
+
+        A := A + alpha*x*x**T
+
+    where alpha is a scalar, x is a vector, and A is an
+    n by n symmetric matrix.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           const float*   alpha,
+                                           const float*   x,
+                                           rocblas_int    incx,
+                                           float*         A,
+                                           rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           const double*  alpha,
+                                           const double*  x,
+                                           rocblas_int    incx,
+                                           double*        A,
+                                           rocblas_int    lda);
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_csyr(rocblas_handle handle,
+                 rocblas_int n,
+                 const rocblas_float_complex *alpha,
+                 const rocblas_float_complex *x, rocblas_int incx,
+                       rocblas_float_complex *A, rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zsyr(rocblas_handle handle,
+                 rocblas_int n,
+                 const rocblas_double_complex *alpha,
+                 const rocblas_double_complex *x, rocblas_int incx,
+                       rocblas_double_complex *A, rocblas_int lda);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR_batched performs a batch of matrix-vector operations
+
+        A[i] := A[i] + alpha*x[i]*x[i]**T
+
+    where alpha is a scalar, x is an array of vectors, and A is an array of
+    n by n symmetric matrices. For i = 1 , … , batch_count
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         array of pointers storing the different vector x_i on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[inout]
+    A         array of pointers storing matrices A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    batch_count rocblas_int
+                number of instances in the batch
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr_batched(rocblas_handle     handle,
+                                                   rocblas_fill       uplo,
+                                                   rocblas_int        n,
+                                                   const float*       alpha,
+                                                   const float* const x[],
+                                                   rocblas_int        incx,
+                                                   float* const       A[],
+                                                   rocblas_int        lda,
+                                                   rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr_batched(rocblas_handle      handle,
+                                                   rocblas_fill        uplo,
+                                                   rocblas_int         n,
+                                                   const double*       alpha,
+                                                   const double* const x[],
+                                                   rocblas_int         incx,
+                                                   double* const       A[],
+                                                   rocblas_int         lda,
+                                                   rocblas_int         batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR_strided_batched performs the matrix-vector operations
+
+        A[i] := A[i] + alpha*x[i]*x[i]**T
+
+    where alpha is a scalar, vectors, and A is an array of
+    n by n symmetric matrices. For i = 1 , … , batch_count
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         a pointer to the first vector x_i on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x_i.
+    @param[in]
+    stridex   rocblas_stride
+              specifies the pointer increment between vectors (x_i) and (x_i+1).
+    @param[inout]
+    A         pointer to the first matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    strideA   rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    batch_count rocblas_int
+              number of instances in the batch
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr_strided_batched(rocblas_handle handle,
+                                                           rocblas_fill   uplo,
+                                                           rocblas_int    n,
+                                                           const float*   alpha,
+                                                           const float*   x,
+                                                           rocblas_int    incx,
+                                                           rocblas_stride stridex,
+                                                           float*         A,
+                                                           rocblas_int    lda,
+                                                           rocblas_stride strideA,
+                                                           rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr_strided_batched(rocblas_handle handle,
+                                                           rocblas_fill   uplo,
+                                                           rocblas_int    n,
+                                                           const double*  alpha,
+                                                           const double*  x,
+                                                           rocblas_int    incx,
+                                                           rocblas_stride stridex,
+                                                           double*        A,
+                                                           rocblas_int    lda,
+                                                           rocblas_stride strideA,
+                                                           rocblas_int    batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER performs the matrix-vector operation
+
+        A := A + alpha*x*x**H
+
+    where alpha is a real scalar, x is an n element vector and A is an
+    n by n Hermitian matrix. The imaginary parts of the diagonal of A
+    are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of A is updated.
+    @param[in]
+    n         rocblas_int.
+              order of A.
+    @param[in]
+    alpha
+              specifies the scalar alpha, which is real.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+              Only the triangle selected by uplo is referenced and updated.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, which is at least max(1, n).
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher(rocblas_handle               handle,
+                                           rocblas_fill                 uplo,
+                                           rocblas_int                  n,
+                                           const float*                 alpha,
+                                           const rocblas_float_complex* x,
+                                           rocblas_int                  incx,
+                                           rocblas_float_complex*       A,
+                                           rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher(rocblas_handle                handle,
+                                           rocblas_fill                  uplo,
+                                           rocblas_int                   n,
+                                           const double*                 alpha,
+                                           const rocblas_double_complex* x,
+                                           rocblas_int                   incx,
+                                           rocblas_double_complex*       A,
+                                           rocblas_int                   lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER_BATCHED performs a batch of the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*x_i**H
+
+    where alpha is a real scalar, x_i is an n element vector and A_i is an
+    n by n Hermitian matrix,
+    for i = 1, ..., batch_count.
+    The imaginary parts of the diagonal of each A_i are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of each A_i is updated.
+    @param[in]
+    n         rocblas_int.
+              order of each A_i.
+    @param[in]
+    alpha
+              specifies the scalar alpha, which is real.
+    @param[in]
+    x         array of pointers storing each vector x_i on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[inout]
+    A         array of pointers storing each matrix A_i on the GPU.
+              Only the triangle selected by uplo is referenced and updated.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A_i, which is at least max(1, n).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher_batched(rocblas_handle                     handle,
+                                                   rocblas_fill                       uplo,
+                                                   rocblas_int                        n,
+                                                   const float*                       alpha,
+                                                   const rocblas_float_complex* const x[],
+                                                   rocblas_int                        incx,
+                                                   rocblas_float_complex* const       A[],
+                                                   rocblas_int                        lda,
+                                                   rocblas_int                        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher_batched(rocblas_handle                      handle,
+                                                   rocblas_fill                        uplo,
+                                                   rocblas_int                         n,
+                                                   const double*                       alpha,
+                                                   const rocblas_double_complex* const x[],
+                                                   rocblas_int                         incx,
+                                                   rocblas_double_complex* const       A[],
+                                                   rocblas_int                         lda,
+                                                   rocblas_int                         batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER_STRIDED_BATCHED performs a batch of the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*x_i**H
+
+    where alpha is a real scalar, x_i is an n element vector and A_i is an
+    n by n Hermitian matrix,
+    for i = 1, ..., batch_count.
+    The imaginary parts of the diagonal of each A_i are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of each A_i is updated.
+    @param[in]
+    n         rocblas_int.
+              order of each A_i.
+    @param[in]
+    alpha
+              specifies the scalar alpha, which is real.
+    @param[in]
+    x         pointer to the first vector (x_1) in the batch, stored on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   rocblas_stride
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[inout]
+    A         pointer to the first matrix (A_1) in the batch, stored on the GPU.
+              Only the triangle selected by uplo is referenced and updated.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A_i, which is at least max(1, n).
+    @param[in]
+    strideA   rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher_strided_batched(rocblas_handle               handle,
+                                                           rocblas_fill                 uplo,
+                                                           rocblas_int                  n,
+                                                           const float*                 alpha,
+                                                           const rocblas_float_complex* x,
+                                                           rocblas_int                  incx,
+                                                           rocblas_stride               stridex,
+                                                           rocblas_float_complex*       A,
+                                                           rocblas_int                  lda,
+                                                           rocblas_stride               strideA,
+                                                           rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher_strided_batched(rocblas_handle                handle,
+                                                           rocblas_fill                  uplo,
+                                                           rocblas_int                   n,
+                                                           const double*                 alpha,
+                                                           const rocblas_double_complex* x,
+                                                           rocblas_int                   incx,
+                                                           rocblas_stride                stridex,
+                                                           rocblas_double_complex*       A,
+                                                           rocblas_int                   lda,
+                                                           rocblas_stride                strideA,
+                                                           rocblas_int batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR2 performs the matrix-vector operation
+
+        A := A + alpha*x*y**T + alpha*y*x**T
+
+    where alpha is a scalar, x and y are n element vectors and A is an
+    n by n symmetric matrix.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of A is updated.
+    @param[in]
+    n         rocblas_int.
+              order of A.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+              Only the triangle selected by uplo is referenced and updated.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, which is at least max(1, n).
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            const float*   alpha,
+                                            const float*   x,
+                                            rocblas_int    incx,
+                                            const float*   y,
+                                            rocblas_int    incy,
+                                            float*         A,
+                                            rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            const double*  alpha,
+                                            const double*  x,
+                                            rocblas_int    incx,
+                                            const double*  y,
+                                            rocblas_int    incy,
+                                            double*        A,
+                                            rocblas_int    lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR2_BATCHED performs a batch of the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*y_i**T + alpha*y_i*x_i**T
+
+    where alpha is a scalar, x_i and y_i are n element vectors and A_i is an
+    n by n symmetric matrix,
+    for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of each A_i is updated.
+    @param[in]
+    n         rocblas_int.
+              order of each A_i.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         array of pointers storing each vector x_i on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    y         array of pointers storing each vector y_i on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of each y_i.
+    @param[inout]
+    A         array of pointers storing each matrix A_i on the GPU.
+              Only the triangle selected by uplo is referenced and updated.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A_i, which is at least max(1, n).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2_batched(rocblas_handle     handle,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_int        n,
+                                                    const float*       alpha,
+                                                    const float* const x[],
+                                                    rocblas_int        incx,
+                                                    const float* const y[],
+                                                    rocblas_int        incy,
+                                                    float* const       A[],
+                                                    rocblas_int        lda,
+                                                    rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2_batched(rocblas_handle      handle,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_int         n,
+                                                    const double*       alpha,
+                                                    const double* const x[],
+                                                    rocblas_int         incx,
+                                                    const double* const y[],
+                                                    rocblas_int         incy,
+                                                    double* const       A[],
+                                                    rocblas_int         lda,
+                                                    rocblas_int         batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR2_STRIDED_BATCHED performs a batch of the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*y_i**T + alpha*y_i*x_i**T
+
+    where alpha is a scalar, x_i and y_i are n element vectors and A_i is an
+    n by n symmetric matrix,
+    for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of each A_i is updated.
+    @param[in]
+    n         rocblas_int.
+              order of each A_i.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer to the first vector (x_1) in the batch, stored on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   rocblas_stride
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    y         pointer to the first vector (y_1) in the batch, stored on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey   rocblas_stride
+              stride from the start of one vector (y_i) and the next one (y_i+1).
+    @param[inout]
+    A         pointer to the first matrix (A_1) in the batch, stored on the GPU.
+              Only the triangle selected by uplo is referenced and updated.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A_i, which is at least max(1, n).
+    @param[in]
+    strideA   rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            const float*   alpha,
+                                                            const float*   x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const float*   y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            float*         A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride strideA,
+                                                            rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            const double*  alpha,
+                                                            const double*  x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const double*  y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            double*        A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride strideA,
+                                                            rocblas_int    batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER2 performs the matrix-vector operation
+
+        A := A + alpha*x*y**H + conj(alpha)*y*x**H
+
+    where alpha is a scalar, x and y are n element vectors and A is an
+    n by n Hermitian matrix. The imaginary parts of the diagonal of A
+    are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of A is updated.
+    @param[in]
+    n         rocblas_int.
+              order of A.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+              Only the triangle selected by uplo is referenced and updated.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, which is at least max(1, n).
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher2(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int                  incx,
+                                            const rocblas_float_complex* y,
+                                            rocblas_int                  incy,
+                                            rocblas_float_complex*       A,
+                                            rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher2(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int                   incx,
+                                            const rocblas_double_complex* y,
+                                            rocblas_int                   incy,
+                                            rocblas_double_complex*       A,
+                                            rocblas_int                   lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER2_BATCHED performs a batch of the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+
+    where alpha is a scalar, x_i and y_i are n element vectors and A_i is an
+    n by n Hermitian matrix,
+    for i = 1, ..., batch_count.
+    The imaginary parts of the diagonal of each A_i are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of each A_i is updated.
+    @param[in]
+    n         rocblas_int.
+              order of each A_i.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         array of pointers storing each vector x_i on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    y         array of pointers storing each vector y_i on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of each y_i.
+    @param[inout]
+    A         array of pointers storing each matrix A_i on the GPU.
+              Only the triangle selected by uplo is referenced and updated.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A_i, which is at least max(1, n).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher2_batched(rocblas_handle                     handle,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_int                        n,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const x[],
+                                                    rocblas_int                        incx,
+                                                    const rocblas_float_complex* const y[],
+                                                    rocblas_int                        incy,
+                                                    rocblas_float_complex* const       A[],
+                                                    rocblas_int                        lda,
+                                                    rocblas_int                        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher2_batched(rocblas_handle                      handle,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_int                         n,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const x[],
+                                                    rocblas_int                         incx,
+                                                    const rocblas_double_complex* const y[],
+                                                    rocblas_int                         incy,
+                                                    rocblas_double_complex* const       A[],
+                                                    rocblas_int                         lda,
+                                                    rocblas_int batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER2_STRIDED_BATCHED performs a batch of the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+
+    where alpha is a scalar, x_i and y_i are n element vectors and A_i is an
+    n by n Hermitian matrix,
+    for i = 1, ..., batch_count.
+    The imaginary parts of the diagonal of each A_i are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of each A_i is updated.
+    @param[in]
+    n         rocblas_int.
+              order of each A_i.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer to the first vector (x_1) in the batch, stored on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   rocblas_stride
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    y         pointer to the first vector (y_1) in the batch, stored on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey   rocblas_stride
+              stride from the start of one vector (y_i) and the next one (y_i+1).
+    @param[inout]
+    A         pointer to the first matrix (A_1) in the batch, stored on the GPU.
+              Only the triangle selected by uplo is referenced and updated.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A_i, which is at least max(1, n).
+    @param[in]
+    strideA   rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher2_strided_batched(rocblas_handle               handle,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_int                  n,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* x,
+                                                            rocblas_int                  incx,
+                                                            rocblas_stride               stridex,
+                                                            const rocblas_float_complex* y,
+                                                            rocblas_int                  incy,
+                                                            rocblas_stride               stridey,
+                                                            rocblas_float_complex*       A,
+                                                            rocblas_int                  lda,
+                                                            rocblas_stride               strideA,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher2_strided_batched(rocblas_handle                handle,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_int                   n,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* x,
+                                                            rocblas_int                   incx,
+                                                            rocblas_stride                stridex,
+                                                            const rocblas_double_complex* y,
+                                                            rocblas_int                   incy,
+                                                            rocblas_stride                stridey,
+                                                            rocblas_double_complex*       A,
+                                                            rocblas_int                   lda,
+                                                            rocblas_stride                strideA,
+                                                            rocblas_int batch_count);
+
+/*
+ * ===========================================================================
+ *    level 3 BLAS
+ * ===========================================================================
+ */
+/*! \brief BLAS Level 3 API
+
+    \details
+
+    trmm performs one of the matrix-matrix operations
+
+    B := alpha*op( A )*B,   or   B := alpha*B*op( A )
+
+    where  alpha  is a scalar,  B  is an m by n matrix,  A  is a unit, or
+    non-unit,  upper or lower triangular matrix  and  op( A )  is one  of
+
+        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+
+    @param[in]
+    side    rocblas_side.
+            rocblas_side_left:       C := alpha*op( A )*B.
+            rocblas_side_right:      C := alpha*B*op( A ).
+
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  rocblas_operation.
+            transB:    op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+
+    @param[in]
+    diag    rocblas_diagonal.
+            rocblas_diagonal_unit:      A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+
+    @param[in]
+    m       rocblas_int.
+            m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       rocblas_int.
+            n specifies the number of columns of B. n >= 0.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            zero then A is not referenced and B need not be set before
+            entry.
+
+    @param[in]
+    A       pointer storing matrix A on the GPU.
+            of dimension ( lda, k ), where k is m
+            when  rocblas_side_left  and
+            is  n  when  rocblas_side_right
+            only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     rocblas_int.
+            lda specifies the first dimension of A.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            if side = rocblas_side_right, lda >= max( 1, n ).
+
+    @param[in]
+    B       pointer storing matrix B on the GPU.
+
+    @param[in]
+    ldb    rocblas_int.
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strmm(rocblas_handle    handle,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            float*            B,
+                                            rocblas_int       ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrmm(rocblas_handle    handle,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            double*           B,
+                                            rocblas_int       ldb);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+
+    trmm_batched performs one of the matrix-matrix operations
+
+    B_i := alpha*op( A_i )*B_i,   or   B_i := alpha*B_i*op( A_i ),  for i = 1, ..., batch_count
+
+    where  alpha  is a scalar,  B_i  is an m by n matrix,  A_i  is a unit, or
+    non-unit,  upper or lower triangular matrix  and  op( A_i )  is one  of
+
+        op( A_i ) = A_i   or   op( A_i ) = A_i^T   or   op( A_i ) = A_i^H.
+
+    All of the batches are computed by one launch. Temporary device memory of
+    m * n * batch_count elements holds the products before they are copied to B_i.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+
+    @param[in]
+    side    rocblas_side.
+            rocblas_side_left:       op( A ) multiplies B from the left.
+            rocblas_side_right:      op( A ) multiplies B from the right.
+
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  rocblas_operation.
+            rocblas_operation_none:      op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+
+    @param[in]
+    diag    rocblas_diagonal.
+            rocblas_diagonal_unit:      A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+
+    @param[in]
+    m       rocblas_int.
+            m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       rocblas_int.
+            n specifies the number of columns of B. n >= 0.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            zero then A and B are not referenced.
+
+    @param[in]
+    A       device array of device pointers storing each matrix A_i,
+            of dimension ( lda, k ), where k is m when rocblas_side_left
+            and is n when rocblas_side_right.
+            Only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     rocblas_int.
+            lda specifies the first dimension of each A_i.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            if side = rocblas_side_right, lda >= max( 1, n ).
+
+    @param[inout]
+    B       device array of device pointers storing each matrix B_i.
+
+    @param[in]
+    ldb    rocblas_int.
+           ldb specifies the first dimension of each B_i. ldb >= max( 1, m ).
+
+    @param[in]
+    batch_count rocblas_int.
+                number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strmm_batched(rocblas_handle     handle,
+                                                    rocblas_side       side,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_operation  transA,
+                                                    rocblas_diagonal   diag,
+                                                    rocblas_int        m,
+                                                    rocblas_int        n,
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    rocblas_int        lda,
+                                                    float* const       B[],
+                                                    rocblas_int        ldb,
+                                                    rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrmm_batched(rocblas_handle      handle,
+                                                    rocblas_side        side,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_operation   transA,
+                                                    rocblas_diagonal    diag,
+                                                    rocblas_int         m,
+                                                    rocblas_int         n,
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    rocblas_int         lda,
+                                                    double* const       B[],
+                                                    rocblas_int         ldb,
+                                                    rocblas_int         batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+
+    trmm_strided_batched performs one of the matrix-matrix operations
+
+    B_i := alpha*op( A_i )*B_i,   or   B_i := alpha*B_i*op( A_i ),  for i = 1, ..., batch_count
+
+    where  alpha  is a scalar,  B_i  is an m by n matrix,  A_i  is a unit, or
+    non-unit,  upper or lower triangular matrix  and  op( A_i )  is one  of
+
+        op( A_i ) = A_i   or   op( A_i ) = A_i^T   or   op( A_i ) = A_i^H.
+
+    All of the batches are computed by one launch. Temporary device memory of
+    m * n * batch_count elements holds the products before they are copied to B_i.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+
+    @param[in]
+    side    rocblas_side.
+            rocblas_side_left:       op( A ) multiplies B from the left.
+            rocblas_side_right:      op( A ) multiplies B from the right.
+
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  rocblas_operation.
+            rocblas_operation_none:      op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+
+    @param[in]
+    diag    rocblas_diagonal.
+            rocblas_diagonal_unit:      A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+
+    @param[in]
+    m       rocblas_int.
+            m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       rocblas_int.
+            n specifies the number of columns of B. n >= 0.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            zero then A and B are not referenced.
+
+    @param[in]
+    A       device pointer to the first matrix A_1 on the GPU,
+            of dimension ( lda, k ), where k is m when rocblas_side_left
+            and is n when rocblas_side_right.
+            Only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     rocblas_int.
+            lda specifies the first dimension of each A_i.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            if side = rocblas_side_right, lda >= max( 1, n ).
+
+    @param[in]
+    stride_a  rocblas_stride.
+              stride from the start of one matrix (A_i) to the next (A_i+1).
+
+    @param[inout]
+    B       device pointer to the first matrix B_1 on the GPU.
+
+    @param[in]
+    ldb    rocblas_int.
+           ldb specifies the first dimension of each B_i. ldb >= max( 1, m ).
+
+    @param[in]
+    stride_b  rocblas_stride.
+              stride from the start of one matrix (B_i) to the next (B_i+1).
+
+    @param[in]
+    batch_count rocblas_int.
+                number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strmm_strided_batched(rocblas_handle    handle,
+                                                            rocblas_side      side,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            const float*      alpha,
+                                                            const float*      A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_a,
+                                                            float*            B,
+                                                            rocblas_int       ldb,
+                                                            rocblas_stride    stride_b,
+                                                            rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrmm_strided_batched(rocblas_handle    handle,
+                                                            rocblas_side      side,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            const double*     alpha,
+                                                            const double*     A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_a,
+                                                            double*           B,
+                                                            rocblas_int       ldb,
+                                                            rocblas_stride    stride_b,
+                                                            rocblas_int       batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+
+    trmm_outofplace performs one of the matrix-matrix operations
+
+    C := alpha*op( A )*B,   or   C := alpha*B*op( A )
+
+    where  alpha  is a scalar,  B  and  C  are m by n matrices,  A  is a unit, or
+    non-unit,  upper or lower triangular matrix  and  op( A )  is one  of
+
+        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+
+    B is not modified, so it does not need to be copied before the call. C must not
+    overlap B. No temporary device memory is used.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+
+    @param[in]
+    side    rocblas_side.
+            rocblas_side_left:       op( A ) multiplies B from the left.
+            rocblas_side_right:      op( A ) multiplies B from the right.
+
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  rocblas_operation.
+            rocblas_operation_none:      op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+
+    @param[in]
+    diag    rocblas_diagonal.
+            rocblas_diagonal_unit:      A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+
+    @param[in]
+    m       rocblas_int.
+            m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       rocblas_int.
+            n specifies the number of columns of B. n >= 0.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            zero then A and B are not referenced.
+
+    @param[in]
+    A       pointer storing matrix A on the GPU,
+            of dimension ( lda, k ), where k is m when rocblas_side_left
+            and is n when rocblas_side_right.
+            Only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     rocblas_int.
+            lda specifies the first dimension of A.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            if side = rocblas_side_right, lda >= max( 1, n ).
+
+    @param[in]
+    B       pointer storing matrix B on the GPU.
+
+    @param[in]
+    ldb    rocblas_int.
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    @param[out]
+    C       pointer storing matrix C on the GPU.
+
+    @param[in]
+    ldc    rocblas_int.
+           ldc specifies the first dimension of C. ldc >= max( 1, m ).
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strmm_outofplace(rocblas_handle    handle,
+                                                       rocblas_side      side,
+                                                       rocblas_fill      uplo,
+                                                       rocblas_operation transA,
+                                                       rocblas_diagonal  diag,
+                                                       rocblas_int       m,
+                                                       rocblas_int       n,
+                                                       const float*      alpha,
+                                                       const float*      A,
+                                                       rocblas_int       lda,
+                                                       const float*      B,
+                                                       rocblas_int       ldb,
+                                                       float*            C,
+                                                       rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrmm_outofplace(rocblas_handle    handle,
+                                                       rocblas_side      side,
+                                                       rocblas_fill      uplo,
+                                                       rocblas_operation transA,
+                                                       rocblas_diagonal  diag,
+                                                       rocblas_int       m,
+                                                       rocblas_int       n,
+                                                       const double*     alpha,
+                                                       const double*     A,
+                                                       rocblas_int       lda,
+                                                       const double*     B,
+                                                       rocblas_int       ldb,
+                                                       double*           C,
+                                                       rocblas_int       ldc);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    trtri  compute the inverse of a matrix  A, namely, invA
+
+        and write the result into invA;
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              if rocblas_fill_upper, the lower part of A is not referenced
+              if rocblas_fill_lower, the upper part of A is not referenced
+    @param[in]
+    diag      rocblas_diagonal.
+              = 'rocblas_diagonal_non_unit', A is non-unit triangular;
+              = 'rocblas_diagonal_unit', A is unit triangular;
+    @param[in]
+    n         rocblas_int.
+              size of matrix A and invA
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[output]
+    invA      pointer storing matrix invA on the GPU.
+    @param[in]
+    ldinvA    rocblas_int
+              specifies the leading dimension of invA.
+
+********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strtri(rocblas_handle   handle,
+                                             rocblas_fill     uplo,
+                                             rocblas_diagonal diag,
+                                             rocblas_int      n,
+                                             const float*     A,
+                                             rocblas_int      lda,
+                                             float*           invA,
+                                             rocblas_int      ldinvA);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrtri(rocblas_handle   handle,
+                                             rocblas_fill     uplo,
+                                             rocblas_diagonal diag,
+                                             rocblas_int      n,
+                                             const double*    A,
+                                             rocblas_int      lda,
+                                             double*          invA,
+                                             rocblas_int      ldinvA);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    trtri_batched  compute the inverse of A_i and write into invA_i where
+                   A_i and invA_i are the i-th matrices in the batch,
+                   for i in [0, batch_count - 1]
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+    @param[in]
+    diag      rocblas_diagonal.
+              = 'rocblas_diagonal_non_unit', A is non-unit triangular;
+              = 'rocblas_diagonal_unit', A is unit triangular;
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    A         array of pointers storing matrices A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[out]
+    invA      array of pointers storing the inverse matrices A on the GPU.
+              Partial inplace operation is supported, see below.
+              If UPLO = 'U', the leading N-by-N upper triangular part of the invA will store
+              the inverse of the upper triangular matrix, and the strictly lower
+              triangular part of invA is cleared.
+              If UPLO = 'L', the leading N-by-N lower triangular part of the invA will store
+              the inverse of the lower triangular matrix, and the strictly upper
+              triangular part of invA is cleared.
+    @param[in]
+    ldinvA    rocblas_int
+              specifies the leading dimension of invA.
+    @param[in]
+    batch_count       rocblas_int
+              numbers of matrices in the batch
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strtri_batched(rocblas_handle     handle,
+                                                     rocblas_fill       uplo,
+                                                     rocblas_diagonal   diag,
+                                                     rocblas_int        n,
+                                                     const float* const A[],
+                                                     rocblas_int        lda,
+                                                     float*             invA[],
+                                                     rocblas_int        ldinvA,
+                                                     rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrtri_batched(rocblas_handle      handle,
+                                                     rocblas_fill        uplo,
+                                                     rocblas_diagonal    diag,
+                                                     rocblas_int         n,
+                                                     const double* const A[],
+                                                     rocblas_int         lda,
+                                                     double*             invA[],
+                                                     rocblas_int         ldinvA,
+                                                     rocblas_int         batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    trtri_strided_batched compute the inverse of A_i and write into invA_i where
+                   A_i and invA_i are the i-th matrices in the batch,
+                   for i in [0, batch_count - 1]
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+    @param[in]
+    diag      rocblas_diagonal.
+              = 'rocblas_diagonal_non_unit', A is non-unit triangular;
+              = 'rocblas_diagonal_unit', A is unit triangular;
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    stride_a  rocblas_stride
+             "batch stride a": stride from the start of one "A" matrix to the next
+    @param[out]
+    invA      pointer storing the inverse matrix A on the GPU.
+              Partial inplace operation is supported, see below.
+              If UPLO = 'U', the leading N-by-N upper triangular part of the invA will store
+              the inverse of the upper triangular matrix, and the strictly lower
+              triangular part of invA is cleared.
+              If UPLO = 'L', the leading N-by-N lower triangular part of the invA will store
+              the inverse of the lower triangular matrix, and the strictly upper
+              triangular part of invA is cleared.
+    @param[in]
+    ldinvA    rocblas_int
+              specifies the leading dimension of invA.
+    @param[in]
+    stride_invA  rocblas_stride
+                 "batch stride invA": stride from the start of one "invA" matrix to the next
+    @param[in]
+    batch_count  rocblas_int
+                 numbers of matrices in the batch
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strtri_strided_batched(rocblas_handle   handle,
+                                                             rocblas_fill     uplo,
+                                                             rocblas_diagonal diag,
+                                                             rocblas_int      n,
+                                                             const float*     A,
+                                                             rocblas_int      lda,
+                                                             rocblas_stride   stride_a,
+                                                             float*           invA,
+                                                             rocblas_int      ldinvA,
+                                                             rocblas_stride   stride_invA,
+                                                             rocblas_int      batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrtri_strided_batched(rocblas_handle   handle,
+                                                             rocblas_fill     uplo,
+                                                             rocblas_diagonal diag,
+                                                             rocblas_int      n,
+                                                             const double*    A,
+                                                             rocblas_int      lda,
+                                                             rocblas_stride   stride_a,
+                                                             double*          invA,
+                                                             rocblas_int      ldinvA,
+                                                             rocblas_stride   stride_invA,
+                                                             rocblas_int      batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+
+    trsm solves
+
+        op(A)*X = alpha*B or  X*op(A) = alpha*B,
+
+    where alpha is a scalar, X and B are m by n matrices,
+    A is triangular matrix and op(A) is one of
+
+        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+
+    The matrix X is overwritten on B.
+
+    Note about memory allocation:
+    When trsm is launched with a k evenly divisible by the internal block size of 128,
+    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
+    memory found in the handle to increase overall performance. This memory can be managed by using
+    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
+    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
+    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
+    to the desired chunk of right hand sides to be used at a time.
+
+    (where k is m when rocblas_side_left and is n when rocblas_side_right)
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+
+    @param[in]
+    side    rocblas_side.
+            rocblas_side_left:       op(A)*X = alpha*B.
+            rocblas_side_right:      X*op(A) = alpha*B.
+
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  rocblas_operation.
+            transB:    op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+
+    @param[in]
+    diag    rocblas_diagonal.
+            rocblas_diagonal_unit:     A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+
+    @param[in]
+    m       rocblas_int.
+            m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       rocblas_int.
+            n specifies the number of columns of B. n >= 0.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            &zero then A is not referenced and B need not be set before
+            entry.
+
+    @param[in]
+    A       pointer storing matrix A on the GPU.
+            of dimension ( lda, k ), where k is m
+            when  rocblas_side_left  and
+            is  n  when  rocblas_side_right
+            only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     rocblas_int.
+            lda specifies the first dimension of A.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            if side = rocblas_side_right, lda >= max( 1, n ).
+
+    @param[in,output]
+    B       pointer storing matrix B on the GPU.
+
+    @param[in]
+    ldb    rocblas_int.
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strsm(rocblas_handle    handle,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            float*            B,
+                                            rocblas_int       ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm(rocblas_handle    handle,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            double*           B,
+                                            rocblas_int       ldb);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    trsm_prepare inverts the diagonal blocks of a triangular matrix A, as the first phase of
+    trsm does, and returns them in a rocblas_trsm_factor. The factor can then be passed to
+    trsm_solve for any number of right hand sides, which skips the inversion in each solve.
+
+    A is not copied into the factor. It must not be freed or modified while the factor is used.
+    The factor must be destroyed with rocblas_destroy_trsm_factor.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+
+    @param[in]
+    side    rocblas_side.
+            rocblas_side_left:       op(A)*X = alpha*B will be solved.
+            rocblas_side_right:      X*op(A) = alpha*B will be solved.
+
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+
+    @param[in]
+    diag    rocblas_diagonal.
+            rocblas_diagonal_unit:     A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+
+    @param[in]
+    k       rocblas_int.
+            k specifies the number of rows and columns of A. k >= 0.
+            k is m in the solves when rocblas_side_left and n when rocblas_side_right.
+
+    @param[in]
+    A       pointer storing matrix A on the GPU, of dimension ( lda, k ).
+            only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     rocblas_int.
+            lda specifies the first dimension of A. lda >= max( 1, k ).
+
+    @param[out]
+    factor  pointer to the rocblas_trsm_factor created.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strsm_prepare(rocblas_handle       handle,
+                                                    rocblas_side         side,
+                                                    rocblas_fill         uplo,
+                                                    rocblas_diagonal     diag,
+                                                    rocblas_int          k,
+                                                    const float*         A,
+                                                    rocblas_int          lda,
+                                                    rocblas_trsm_factor* factor);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_prepare(rocblas_handle       handle,
+                                                    rocblas_side         side,
+                                                    rocblas_fill         uplo,
+                                                    rocblas_diagonal     diag,
+                                                    rocblas_int          k,
+                                                    const double*        A,
+                                                    rocblas_int          lda,
+                                                    rocblas_trsm_factor* factor);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    trsm_solve solves
+
+        op(A)*X = alpha*B or  X*op(A) = alpha*B,
+
+    like trsm, where side, uplo, diag and A are those given to trsm_prepare when the factor
+    was created. The inverted diagonal blocks of A stored in the factor are used, so the
+    solve only does the triangular updates.
+
+    The matrix X is overwritten on B.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+
+    @param[in]
+    factor  rocblas_trsm_factor.
+            factor created by trsm_prepare for the same precision.
+
+    @param[in]
+    transA  rocblas_operation.
+            rocblas_operation_none:      op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+
+    @param[in]
+    m       rocblas_int.
+            m specifies the number of rows of B. m >= 0.
+            m must equal k of the factor when rocblas_side_left.
+
+    @param[in]
+    n       rocblas_int.
+            n specifies the number of columns of B. n >= 0.
+            n must equal k of the factor when rocblas_side_right.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha.
+
+    @param[in,output]
+    B       pointer storing matrix B on the GPU.
+
+    @param[in]
+    ldb    rocblas_int.
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strsm_solve(rocblas_handle      handle,
+                                                  rocblas_trsm_factor factor,
+                                                  rocblas_operation   transA,
+                                                  rocblas_int         m,
+                                                  rocblas_int         n,
+                                                  const float*        alpha,
+                                                  float*              B,
+                                                  rocblas_int         ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_solve(rocblas_handle      handle,
+                                                  rocblas_trsm_factor factor,
+                                                  rocblas_operation   transA,
+                                                  rocblas_int         m,
+                                                  rocblas_int         n,
+                                                  const double*       alpha,
+                                                  double*             B,
+                                                  rocblas_int         ldb);
+
+/*! \brief Destroys a rocblas_trsm_factor created by trsm_prepare and frees its device memory.
+    This synchronizes with the device. */
+ROCBLAS_EXPORT rocblas_status rocblas_destroy_trsm_factor(rocblas_trsm_factor factor);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    trsm_refine solves
+
+        op(A)*X = alpha*B or  X*op(A) = alpha*B,
+
+    like trsm, in single precision with iterative refinement to double precision.
+    The solution of the single precision solve is corrected by
+
+        R = alpha*B - op(A)*X (or alpha*B - X*op(A)) in double precision,
+        D = op(A)^-1*R (or R*op(A)^-1) in single precision,
+        X = X + D,
+
+    until max|D| <= tolerance * max|X|. For a well conditioned A, this has the accuracy of
+    dtrsm while most of the memory traffic is in single precision.
+
+    If the refinement does not converge within max_iterations steps, or the single precision
+    solution overflows, B is solved again in double precision and
+    rocblas_status_perf_degraded is returned.
+
+    This function synchronizes with the host after each step.
+
+    The matrix X is overwritten on B.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+
+    @param[in]
+    side    rocblas_side.
+            rocblas_side_left:       op(A)*X = alpha*B.
+            rocblas_side_right:      X*op(A) = alpha*B.
+
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  rocblas_operation.
+            rocblas_operation_none:      op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+
+    @param[in]
+    diag    rocblas_diagonal.
+            rocblas_diagonal_unit:     A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+
+    @param[in]
+    m       rocblas_int.
+            m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       rocblas_int.
+            n specifies the number of columns of B. n >= 0.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha.
+
+    @param[in]
+    A       pointer storing matrix A on the GPU.
+            of dimension ( lda, k ), where k is m
+            when  rocblas_side_left  and
+            is  n  when  rocblas_side_right
+            only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     rocblas_int.
+            lda specifies the first dimension of A.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            if side = rocblas_side_right, lda >= max( 1, n ).
+
+    @param[in,output]
+    B       pointer storing matrix B on the GPU.
+
+    @param[in]
+    ldb    rocblas_int.
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    @param[in]
+    tolerance double.
+              relative size of the last correction at which the refinement stops.
+              If tolerance <= 0, sqrt(k) times the double precision machine epsilon is used.
+
+    @param[in]
+    max_iterations rocblas_int.
+                   maximum number of correction steps. max_iterations >= 0.
+
+    @param[out]
+    iterations  pointer to rocblas_int on the host.
+                number of correction steps done.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_refine(rocblas_handle    handle,
+                                                   rocblas_side      side,
+                                                   rocblas_fill      uplo,
+                                                   rocblas_operation transA,
+                                                   rocblas_diagonal  diag,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   const double*     alpha,
+                                                   const double*     A,
+                                                   rocblas_int       lda,
+                                                   double*           B,
+                                                   rocblas_int       ldb,
+                                                   double            tolerance,
+                                                   rocblas_int       max_iterations,
+                                                   rocblas_int*      iterations);
+
+/*! \brief BLAS Level 3 API
+    \details
+    trsm_batched performs the following batched operation:
+        op(A[i])*X = alpha*B[i] or  X*op(A[i]) = alpha*B[i], for
+    i in [0, batch_count - 1]
+    where alpha is a scalar, X and B are batched m by n matrices,
+    A is triangular batched matrix and op(A) is one of
+        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+    Each matrix X[i] is overwritten on B[i] for i in [0, batch_count - 1].
+    Note about memory allocation:
+    When trsm is launched with a k evenly divisible by the internal block size of 128,
+    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
+    memory found in the handle to increase overall performance. This memory can be managed by using
+    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
+    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
+    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
+    to the desired chunk of right hand sides to be used at a time.
+    (where k is m when rocblas_side_left and is n when rocblas_side_right)
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    side    rocblas_side.
+            rocblas_side_left:       op(A)*X = alpha*B.
+            rocblas_side_right:      X*op(A) = alpha*B.
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+    @param[in]
+    transA  rocblas_operation.
+            transB:    op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+    @param[in]
+    diag    rocblas_diagonal.
+            rocblas_diagonal_unit:     A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+    @param[in]
+    m       rocblas_int.
+            m specifies the number of rows of B. m >= 0.
+    @param[in]
+    n       rocblas_int.
+            n specifies the number of columns of B. n >= 0.
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            &zero then A is not referenced and B need not be set before
+            entry.
+    @param[in]
+    A       HOST array of DEVICE pointers storing matricies A on the GPU.
+            Matricies are of dimension ( lda, k ), where k is m
+            when  rocblas_side_left  and is  n  when  rocblas_side_right
+            only the upper/lower triangular part is accessed.
+    @param[in]
+    lda     rocblas_int.
+            lda specifies the first dimension of A.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            if side = rocblas_side_right, lda >= max( 1, n ).
+    @param[in,output]
+    B       HOST array of DEVICE pointers storing matricies B on the GPU.
+    @param[in]
+    ldb    rocblas_int.
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+    @param[in]
+    batch_count rocblas_int.
+                number of trsm operatons in the batch.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strsm_batched(rocblas_handle     handle,
+                                                    rocblas_side       side,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_operation  transA,
+                                                    rocblas_diagonal   diag,
+                                                    rocblas_int        m,
+                                                    rocblas_int        n,
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    rocblas_int        lda,
+                                                    float*             B[],
+                                                    rocblas_int        ldb,
+                                                    rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_batched(rocblas_handle      handle,
+                                                    rocblas_side        side,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_operation   transA,
+                                                    rocblas_diagonal    diag,
+                                                    rocblas_int         m,
+                                                    rocblas_int         n,
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    rocblas_int         lda,
+                                                    double*             B[],
+                                                    rocblas_int         ldb,
+                                                    rocblas_int         batch_count);
+
+/*! \brief BLAS Level 3 API
+    \details
+    trsm_srided_batched performs the following strided batched operation:
+        op(A[i * stride_a])*X = alpha*B[i*stride_b] or  X*op(A[i*stride_a]) = alpha*B[i*stride_b], for
+    i in [0, batch_count - 1]
+    where alpha is a scalar, X and B are strided batched m by n matrices,
+    A is triangular strided batched matrix and op(A) is one of
+        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+    Each matrix X[i] is overwritten on B[i] for i in [0, batch_count - 1].
+    Note about memory allocation:
+    When trsm is launched with a k evenly divisible by the internal block size of 128,
+    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
     memory found in the handle to increase overall performance. This memory can be managed by using
     the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
     used for temporary storage will default to 1 MB and may result in chunking, which in turn may
@@ -4261,212 +7457,2035 @@ ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_batched(rocblas_handle      handle,
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    side    rocblas_side.
-            rocblas_side_left:       op(A)*X = alpha*B.
-            rocblas_side_right:      X*op(A) = alpha*B.
+    side    rocblas_side.
+            rocblas_side_left:       op(A)*X = alpha*B.
+            rocblas_side_right:      X*op(A) = alpha*B.
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+    @param[in]
+    transA  rocblas_operation.
+            transB:    op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+    @param[in]
+    diag    rocblas_diagonal.
+            rocblas_diagonal_unit:     A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+    @param[in]
+    m       rocblas_int.
+            m specifies the number of rows of B. m >= 0.
+    @param[in]
+    n       rocblas_int.
+            n specifies the number of columns of B. n >= 0.
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            &zero then A is not referenced and B need not be set before
+            entry.
+    @param[in]
+    A       pointer storing matrix A on the GPU.
+            of dimension ( lda, k ), where k is m
+            when  rocblas_side_left  and
+            is  n  when  rocblas_side_right
+            only the upper/lower triangular part is accessed.
+    @param[in]
+    lda     rocblas_int.
+            lda specifies the first dimension of A.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            if side = rocblas_side_right, lda >= max( 1, n ).
+    @param[in]
+    stride_a rocblas_stride
+             stride from the start of one "A" matrix to the next.
+    @param[in,output]
+    B       pointer storing matrix B on the GPU.
+    @param[in]
+    ldb    rocblas_int.
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+    @param[in]
+    stride_b rocblas_stride
+             stride from the start of one "B" matrix to the next.
+    @param[in]
+    batch_count rocblas_int.
+                number of trsm operatons in the batch.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strsm_strided_batched(rocblas_handle    handle,
+                                                            rocblas_side      side,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            const float*      alpha,
+                                                            const float*      A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_a,
+                                                            float*            B,
+                                                            rocblas_int       ldb,
+                                                            rocblas_stride    stride_b,
+                                                            rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_strided_batched(rocblas_handle    handle,
+                                                            rocblas_side      side,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            const double*     alpha,
+                                                            const double*     A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_a,
+                                                            double*           B,
+                                                            rocblas_int       ldb,
+                                                            rocblas_stride    stride_b,
+                                                            rocblas_int       batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xGEMM performs one of the matrix-matrix operations
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B and C are matrices, with
+    op( A ) an m by k matrix, op( B ) a k by n matrix and C an m by n matrix.
+
+    @param[in]
+    handle    rocblas_handle,
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    rocblas_operation,
+              specifies the form of op( A )
+    @param[in]
+    transB    rocblas_operation,
+              specifies the form of op( B )
+    @param[in]
+    m         rocblas_int,
+              number or rows of matrices op( A ) and C
+    @param[in]
+    n         rocblas_int,
+              number of columns of matrices op( B ) and C
+    @param[in]
+    k         rocblas_int,
+              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int,
+              specifies the leading dimension of A.
+    @param[in]
+    B         pointer storing matrix B on the GPU.
+    @param[in]
+    ldb       rocblas_int,
+              specifies the leading dimension of B.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int,
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm(rocblas_handle      handle,
+                                            rocblas_operation   transa,
+                                            rocblas_operation   transb,
+                                            rocblas_int         m,
+                                            rocblas_int         n,
+                                            rocblas_int         k,
+                                            const rocblas_half* alpha,
+                                            const rocblas_half* A,
+                                            rocblas_int         lda,
+                                            const rocblas_half* B,
+                                            rocblas_int         ldb,
+                                            const rocblas_half* beta,
+                                            rocblas_half*       C,
+                                            rocblas_int         ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm(rocblas_handle    handle,
+                                            rocblas_operation transa,
+                                            rocblas_operation transb,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            const float*      B,
+                                            rocblas_int       ldb,
+                                            const float*      beta,
+                                            float*            C,
+                                            rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm(rocblas_handle    handle,
+                                            rocblas_operation transa,
+                                            rocblas_operation transb,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            const double*     B,
+                                            rocblas_int       ldb,
+                                            const double*     beta,
+                                            double*           C,
+                                            rocblas_int       ldc);
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_qgemm(
+    rocblas_handle handle,
+    rocblas_operation transa, rocblas_operation transb,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    const rocblas_half_complex *alpha,
+    const rocblas_half_complex *A, rocblas_int lda,
+    const rocblas_half_complex *B, rocblas_int ldb,
+    const rocblas_half_complex *beta,
+          rocblas_half_complex *C, rocblas_int ldc);
+*/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm(rocblas_handle               handle,
+                                            rocblas_operation            transa,
+                                            rocblas_operation            transb,
+                                            rocblas_int                  m,
+                                            rocblas_int                  n,
+                                            rocblas_int                  k,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            const rocblas_float_complex* B,
+                                            rocblas_int                  ldb,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex*       C,
+                                            rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm(rocblas_handle                handle,
+                                            rocblas_operation             transa,
+                                            rocblas_operation             transb,
+                                            rocblas_int                   m,
+                                            rocblas_int                   n,
+                                            rocblas_int                   k,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            const rocblas_double_complex* B,
+                                            rocblas_int                   ldb,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex*       C,
+                                            rocblas_int                   ldc);
+
+/*! \brief BLAS Level 3 API
+     \details
+    xGEMM_BATCHED performs one of the batched matrix-matrix operations
+         C[i] = alpha*op( A[i] )*op( B[i] ) + beta*C[i], for i in
+   [0,batch_count-1]
+     where op( X ) is one of
+         op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+     alpha and beta are scalars, and A, B and C are strided batched matrices, with
+    op( A ) an m by k by batch_count strided_batched matrix,
+    op( B ) an k by n by batch_count strided_batched matrix and
+    C an m by n by batch_count strided_batched matrix.
+     @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    rocblas_operation
+              specifies the form of op( A )
+    @param[in]
+    transB    rocblas_operation
+              specifies the form of op( B )
+    @param[in]
+    m         rocblas_int.
+              matrix dimention m.
+    @param[in]
+    n         rocblas_int.
+              matrix dimention n.
+    @param[in]
+    k         rocblas_int.
+              matrix dimention k.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         Device array of device pointers storing A matricies on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of "A".
+    @param[in]
+    B         Device array of device pointers storing B matricies on the GPU.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of "B".
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         Device array of device pointers storing C matricies on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of "C".
+    @param[in]
+    batch_count
+              rocblas_int
+              number of gemm operations in the batch
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm_batched(rocblas_handle            handle,
+                                                    rocblas_operation         transa,
+                                                    rocblas_operation         transb,
+                                                    rocblas_int               m,
+                                                    rocblas_int               n,
+                                                    rocblas_int               k,
+                                                    const rocblas_half*       alpha,
+                                                    const rocblas_half* const A[],
+                                                    rocblas_int               lda,
+                                                    const rocblas_half* const B[],
+                                                    rocblas_int               ldb,
+                                                    const rocblas_half*       beta,
+                                                    rocblas_half* const       C[],
+                                                    rocblas_int               ldc,
+                                                    rocblas_int               batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_batched(rocblas_handle     handle,
+                                                    rocblas_operation  transa,
+                                                    rocblas_operation  transb,
+                                                    rocblas_int        m,
+                                                    rocblas_int        n,
+                                                    rocblas_int        k,
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    rocblas_int        lda,
+                                                    const float* const B[],
+                                                    rocblas_int        ldb,
+                                                    const float*       beta,
+                                                    float* const       C[],
+                                                    rocblas_int        ldc,
+                                                    rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_batched(rocblas_handle      handle,
+                                                    rocblas_operation   transa,
+                                                    rocblas_operation   transb,
+                                                    rocblas_int         m,
+                                                    rocblas_int         n,
+                                                    rocblas_int         k,
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    rocblas_int         lda,
+                                                    const double* const B[],
+                                                    rocblas_int         ldb,
+                                                    const double*       beta,
+                                                    double* const       C[],
+                                                    rocblas_int         ldc,
+                                                    rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_batched(rocblas_handle                     handle,
+                                                    rocblas_operation                  transa,
+                                                    rocblas_operation                  transb,
+                                                    rocblas_int                        m,
+                                                    rocblas_int                        n,
+                                                    rocblas_int                        k,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const A[],
+                                                    rocblas_int                        lda,
+                                                    const rocblas_float_complex* const B[],
+                                                    rocblas_int                        ldb,
+                                                    const rocblas_float_complex*       beta,
+                                                    rocblas_float_complex* const       C[],
+                                                    rocblas_int                        ldc,
+                                                    rocblas_int                        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_batched(rocblas_handle                      handle,
+                                                    rocblas_operation                   transa,
+                                                    rocblas_operation                   transb,
+                                                    rocblas_int                         m,
+                                                    rocblas_int                         n,
+                                                    rocblas_int                         k,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const A[],
+                                                    rocblas_int                         lda,
+                                                    const rocblas_double_complex* const B[],
+                                                    rocblas_int                         ldb,
+                                                    const rocblas_double_complex*       beta,
+                                                    rocblas_double_complex* const       C[],
+                                                    rocblas_int                         ldc,
+                                                    rocblas_int batch_count);
+
+/***************************************************************************
+ * batched
+ * stride_a - "batch stride a": stride from the start of one "A" matrix to the next
+ * stride_b
+ * stride_c
+ * batch_count - numbers of gemm's in the batch
+ **************************************************************************/
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xGEMM_STRIDED_BATCHED performs one of the strided batched matrix-matrix operations
+
+        C[i*stride_c] = alpha*op( A[i*stride_a] )*op( B[i*stride_b] ) + beta*C[i*stride_c], for i in
+   [0,batch_count-1]
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B and C are strided batched matrices, with
+    op( A ) an m by k by batch_count strided_batched matrix,
+    op( B ) an k by n by batch_count strided_batched matrix and
+    C an m by n by batch_count strided_batched matrix.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    rocblas_operation
+              specifies the form of op( A )
+    @param[in]
+    transB    rocblas_operation
+              specifies the form of op( B )
+    @param[in]
+    m         rocblas_int.
+              matrix dimention m.
+    @param[in]
+    n         rocblas_int.
+              matrix dimention n.
+    @param[in]
+    k         rocblas_int.
+              matrix dimention k.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing strided batched matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of "A".
+    @param[in]
+    stride_a  rocblas_stride
+              stride from the start of one "A" matrix to the next
+    @param[in]
+    B         pointer storing strided batched matrix B on the GPU.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of "B".
+    @param[in]
+    stride_b  rocblas_stride
+              stride from the start of one "B" matrix to the next
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing strided batched matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of "C".
+    @param[in]
+    stride_c  rocblas_stride
+              stride from the start of one "C" matrix to the next
+    @param[in]
+    batch_count
+              rocblas_int
+              number of gemm operatons in the batch
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm_strided_batched(rocblas_handle      handle,
+                                                            rocblas_operation   transa,
+                                                            rocblas_operation   transb,
+                                                            rocblas_int         m,
+                                                            rocblas_int         n,
+                                                            rocblas_int         k,
+                                                            const rocblas_half* alpha,
+                                                            const rocblas_half* A,
+                                                            rocblas_int         lda,
+                                                            rocblas_stride      stride_a,
+                                                            const rocblas_half* B,
+                                                            rocblas_int         ldb,
+                                                            rocblas_stride      stride_b,
+                                                            const rocblas_half* beta,
+                                                            rocblas_half*       C,
+                                                            rocblas_int         ldc,
+                                                            rocblas_stride      stride_c,
+                                                            rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_strided_batched(rocblas_handle    handle,
+                                                            rocblas_operation transa,
+                                                            rocblas_operation transb,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const float*      alpha,
+                                                            const float*      A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_a,
+                                                            const float*      B,
+                                                            rocblas_int       ldb,
+                                                            rocblas_stride    stride_b,
+                                                            const float*      beta,
+                                                            float*            C,
+                                                            rocblas_int       ldc,
+                                                            rocblas_stride    stride_c,
+                                                            rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_strided_batched(rocblas_handle    handle,
+                                                            rocblas_operation transa,
+                                                            rocblas_operation transb,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const double*     alpha,
+                                                            const double*     A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_a,
+                                                            const double*     B,
+                                                            rocblas_int       ldb,
+                                                            rocblas_stride    stride_b,
+                                                            const double*     beta,
+                                                            double*           C,
+                                                            rocblas_int       ldc,
+                                                            rocblas_stride    stride_c,
+                                                            rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm_kernel_name(rocblas_handle      handle,
+                                                        rocblas_operation   transa,
+                                                        rocblas_operation   transb,
+                                                        rocblas_int         m,
+                                                        rocblas_int         n,
+                                                        rocblas_int         k,
+                                                        const rocblas_half* alpha,
+                                                        const rocblas_half* A,
+                                                        rocblas_int         lda,
+                                                        rocblas_stride      stride_a,
+                                                        const rocblas_half* B,
+                                                        rocblas_int         ldb,
+                                                        rocblas_stride      stride_b,
+                                                        const rocblas_half* beta,
+                                                        rocblas_half*       C,
+                                                        rocblas_int         ldc,
+                                                        rocblas_stride      stride_c,
+                                                        rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_kernel_name(rocblas_handle    handle,
+                                                        rocblas_operation transa,
+                                                        rocblas_operation transb,
+                                                        rocblas_int       m,
+                                                        rocblas_int       n,
+                                                        rocblas_int       k,
+                                                        const float*      alpha,
+                                                        const float*      A,
+                                                        rocblas_int       lda,
+                                                        rocblas_stride    stride_a,
+                                                        const float*      B,
+                                                        rocblas_int       ldb,
+                                                        rocblas_stride    stride_b,
+                                                        const float*      beta,
+                                                        float*            C,
+                                                        rocblas_int       ldc,
+                                                        rocblas_stride    stride_c,
+                                                        rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_kernel_name(rocblas_handle    handle,
+                                                        rocblas_operation transa,
+                                                        rocblas_operation transb,
+                                                        rocblas_int       m,
+                                                        rocblas_int       n,
+                                                        rocblas_int       k,
+                                                        const double*     alpha,
+                                                        const double*     A,
+                                                        rocblas_int       lda,
+                                                        rocblas_stride    stride_a,
+                                                        const double*     B,
+                                                        rocblas_int       ldb,
+                                                        rocblas_stride    stride_b,
+                                                        const double*     beta,
+                                                        double*           C,
+                                                        rocblas_int       ldc,
+                                                        rocblas_stride    stride_c,
+                                                        rocblas_int       batch_count);
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_qgemm_strided_batched(
+    rocblas_handle handle,
+    rocblas_operation transa, rocblas_operation transb,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    const rocblas_half_complex *alpha,
+    const rocblas_half_complex *A, rocblas_int lda, rocblas_stride stride_a,
+    const rocblas_half_complex *B, rocblas_int ldb, rocblas_stride stride_b,
+    const rocblas_half_complex *beta,
+          rocblas_half_complex *C, rocblas_int ldc, rocblas_stride stride_c,
+    rocblas_int batch_count );
+*/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_strided_batched(rocblas_handle               handle,
+                                                            rocblas_operation            transa,
+                                                            rocblas_operation            transb,
+                                                            rocblas_int                  m,
+                                                            rocblas_int                  n,
+                                                            rocblas_int                  k,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* A,
+                                                            rocblas_int                  lda,
+                                                            rocblas_stride               stride_a,
+                                                            const rocblas_float_complex* B,
+                                                            rocblas_int                  ldb,
+                                                            rocblas_stride               stride_b,
+                                                            const rocblas_float_complex* beta,
+                                                            rocblas_float_complex*       C,
+                                                            rocblas_int                  ldc,
+                                                            rocblas_stride               stride_c,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_strided_batched(rocblas_handle                handle,
+                                                            rocblas_operation             transa,
+                                                            rocblas_operation             transb,
+                                                            rocblas_int                   m,
+                                                            rocblas_int                   n,
+                                                            rocblas_int                   k,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* A,
+                                                            rocblas_int                   lda,
+                                                            rocblas_stride                stride_a,
+                                                            const rocblas_double_complex* B,
+                                                            rocblas_int                   ldb,
+                                                            rocblas_stride                stride_b,
+                                                            const rocblas_double_complex* beta,
+                                                            rocblas_double_complex*       C,
+                                                            rocblas_int                   ldc,
+                                                            rocblas_stride                stride_c,
+                                                            rocblas_int batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xGEMM_OUT_OF_CORE performs the matrix-matrix operation
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    like xGEMM, except that A, B and C are stored in host memory. The
+    problem is split into tiles which are uploaded to the device, multiplied
+    and downloaded again. Tile uploads and downloads are issued on auxiliary
+    streams and overlap the GEMM of the previous tile on the handle's stream.
+    Tiles are sized to fit in the device memory of the handle, so matrices
+    larger than device memory can be multiplied. For full overlap of
+    transfers with computation, A, B and C should be allocated in pinned
+    host memory, e.g. with hipHostMalloc.
+
+    The call returns after C has been written back to host memory.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    rocblas_operation
+              specifies the form of op( A )
+    @param[in]
+    transB    rocblas_operation
+              specifies the form of op( B )
+    @param[in]
+    m         rocblas_int.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the host.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    B         pointer storing matrix B on the host.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of B.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the host.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_out_of_core(rocblas_handle    handle,
+                                                        rocblas_operation transa,
+                                                        rocblas_operation transb,
+                                                        rocblas_int       m,
+                                                        rocblas_int       n,
+                                                        rocblas_int       k,
+                                                        const float*      alpha,
+                                                        const float*      A,
+                                                        rocblas_int       lda,
+                                                        const float*      B,
+                                                        rocblas_int       ldb,
+                                                        const float*      beta,
+                                                        float*            C,
+                                                        rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_out_of_core(rocblas_handle    handle,
+                                                        rocblas_operation transa,
+                                                        rocblas_operation transb,
+                                                        rocblas_int       m,
+                                                        rocblas_int       n,
+                                                        rocblas_int       k,
+                                                        const double*     alpha,
+                                                        const double*     A,
+                                                        rocblas_int       lda,
+                                                        const double*     B,
+                                                        rocblas_int       ldb,
+                                                        const double*     beta,
+                                                        double*           C,
+                                                        rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_out_of_core(rocblas_handle               handle,
+                                                        rocblas_operation            transa,
+                                                        rocblas_operation            transb,
+                                                        rocblas_int                  m,
+                                                        rocblas_int                  n,
+                                                        rocblas_int                  k,
+                                                        const rocblas_float_complex* alpha,
+                                                        const rocblas_float_complex* A,
+                                                        rocblas_int                  lda,
+                                                        const rocblas_float_complex* B,
+                                                        rocblas_int                  ldb,
+                                                        const rocblas_float_complex* beta,
+                                                        rocblas_float_complex*       C,
+                                                        rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_out_of_core(rocblas_handle                handle,
+                                                        rocblas_operation             transa,
+                                                        rocblas_operation             transb,
+                                                        rocblas_int                   m,
+                                                        rocblas_int                   n,
+                                                        rocblas_int                   k,
+                                                        const rocblas_double_complex* alpha,
+                                                        const rocblas_double_complex* A,
+                                                        rocblas_int                   lda,
+                                                        const rocblas_double_complex* B,
+                                                        rocblas_int                   ldb,
+                                                        const rocblas_double_complex* beta,
+                                                        rocblas_double_complex*       C,
+                                                        rocblas_int                   ldc);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xGEAM performs one of the matrix-matrix operations
+
+        C = alpha*op( A ) + beta*op( B ),
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B and C are matrices, with
+    op( A ) an m by n matrix, op( B ) an m by n matrix, and C an m by n matrix.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    rocblas_operation
+              specifies the form of op( A )
+    @param[in]
+    transB    rocblas_operation
+              specifies the form of op( B )
+    @param[in]
+    m         rocblas_int.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in]
+    B         pointer storing matrix B on the GPU.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of B.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgeam(rocblas_handle    handle,
+                                            rocblas_operation transa,
+                                            rocblas_operation transb,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            const float*      beta,
+                                            const float*      B,
+                                            rocblas_int       ldb,
+                                            float*            C,
+                                            rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgeam(rocblas_handle    handle,
+                                            rocblas_operation transa,
+                                            rocblas_operation transb,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            const double*     beta,
+                                            const double*     B,
+                                            rocblas_int       ldb,
+                                            double*           C,
+                                            rocblas_int       ldc);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xSYRK performs one of the symmetric rank-k operations
+
+        C = alpha*op( A )*op( A )**T + beta*C,
+
+    where op( X ) = X or op( X ) = X**T, alpha and beta are scalars,
+    C is an n by n symmetric matrix stored in the triangle given by uplo,
+    and op( A ) is an n by k matrix.
+    Only the uplo triangle of C is read and written.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
+    @param[in]
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_transpose;
+              rocblas_operation_conjugate_transpose is only valid for real precisions.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrk(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            const float*      beta,
+                                            float*            C,
+                                            rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrk(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            const double*     beta,
+                                            double*           C,
+                                            rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyrk(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_operation            transA,
+                                            rocblas_int                  n,
+                                            rocblas_int                  k,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex*       C,
+                                            rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyrk(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_operation             transA,
+                                            rocblas_int                   n,
+                                            rocblas_int                   k,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex*       C,
+                                            rocblas_int                   ldc);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xSYRK_BATCHED performs one of the symmetric rank-k operations
+    for each matrix C_i in a batch
+
+        C_i = alpha*op( A_i )*op( A_i )**T + beta*C_i,
+
+    where op( X ) = X or op( X ) = X**T, alpha and beta are scalars,
+    C is an n by n symmetric matrix stored in the triangle given by uplo,
+    and op( A ) is an n by k matrix.
+    Only the uplo triangle of C is read and written.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
+    @param[in]
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_transpose;
+              rocblas_operation_conjugate_transpose is only valid for real precisions.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         device array of device pointers storing each matrix C_i.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of each C.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrk_batched(rocblas_handle     handle,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_operation  transA,
+                                                    rocblas_int        n,
+                                                    rocblas_int        k,
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    rocblas_int        lda,
+                                                    const float*       beta,
+                                                    float* const       C[],
+                                                    rocblas_int        ldc,
+                                                    rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrk_batched(rocblas_handle      handle,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_operation   transA,
+                                                    rocblas_int         n,
+                                                    rocblas_int         k,
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    rocblas_int         lda,
+                                                    const double*       beta,
+                                                    double* const       C[],
+                                                    rocblas_int         ldc,
+                                                    rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyrk_batched(rocblas_handle                     handle,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_operation                  transA,
+                                                    rocblas_int                        n,
+                                                    rocblas_int                        k,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const A[],
+                                                    rocblas_int                        lda,
+                                                    const rocblas_float_complex*       beta,
+                                                    rocblas_float_complex* const       C[],
+                                                    rocblas_int                        ldc,
+                                                    rocblas_int                        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyrk_batched(rocblas_handle                      handle,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_operation                   transA,
+                                                    rocblas_int                         n,
+                                                    rocblas_int                         k,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const A[],
+                                                    rocblas_int                         lda,
+                                                    const rocblas_double_complex*       beta,
+                                                    rocblas_double_complex* const       C[],
+                                                    rocblas_int                         ldc,
+                                                    rocblas_int batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xSYRK_STRIDED_BATCHED performs one of the symmetric rank-k operations
+    for each matrix C_i in a batch
+
+        C_i = alpha*op( A_i )*op( A_i )**T + beta*C_i,
+
+    where op( X ) = X or op( X ) = X**T, alpha and beta are scalars,
+    C is an n by n symmetric matrix stored in the triangle given by uplo,
+    and op( A ) is an n by k matrix.
+    Only the uplo triangle of C is read and written.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
+    @param[in]
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_transpose;
+              rocblas_operation_conjugate_transpose is only valid for real precisions.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         device pointer to the first matrix A_1 on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A.
+    @param[in]
+    stride_A  rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         device pointer to the first matrix C_1 on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of each C.
+    @param[in]
+    stride_C  rocblas_stride
+              stride from the start of one matrix (C_i) and the next one (C_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrk_strided_batched(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const float*      alpha,
+                                                            const float*      A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_A,
+                                                            const float*      beta,
+                                                            float*            C,
+                                                            rocblas_int       ldc,
+                                                            rocblas_stride    stride_C,
+                                                            rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrk_strided_batched(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const double*     alpha,
+                                                            const double*     A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_A,
+                                                            const double*     beta,
+                                                            double*           C,
+                                                            rocblas_int       ldc,
+                                                            rocblas_stride    stride_C,
+                                                            rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyrk_strided_batched(rocblas_handle               handle,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_operation            transA,
+                                                            rocblas_int                  n,
+                                                            rocblas_int                  k,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* A,
+                                                            rocblas_int                  lda,
+                                                            rocblas_stride               stride_A,
+                                                            const rocblas_float_complex* beta,
+                                                            rocblas_float_complex*       C,
+                                                            rocblas_int                  ldc,
+                                                            rocblas_stride               stride_C,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyrk_strided_batched(rocblas_handle                handle,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_operation             transA,
+                                                            rocblas_int                   n,
+                                                            rocblas_int                   k,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* A,
+                                                            rocblas_int                   lda,
+                                                            rocblas_stride                stride_A,
+                                                            const rocblas_double_complex* beta,
+                                                            rocblas_double_complex*       C,
+                                                            rocblas_int                   ldc,
+                                                            rocblas_stride                stride_C,
+                                                            rocblas_int batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xHERK performs one of the Hermitian rank-k operations
+
+        C = alpha*op( A )*op( A )**H + beta*C,
+
+    where op( X ) = X or op( X ) = X**H, alpha and beta are scalars (both real),
+    C is an n by n Hermitian matrix stored in the triangle given by uplo,
+    and op( A ) is an n by k matrix.
+    Only the uplo triangle of C is read and written, and the imaginary parts of the
+    diagonal elements of C are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
+    @param[in]
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_conjugate_transpose;
+              rocblas_operation_transpose is only valid for real precisions.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cherk(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_operation            transA,
+                                            rocblas_int                  n,
+                                            rocblas_int                  k,
+                                            const float*                 alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            const float*                 beta,
+                                            rocblas_float_complex*       C,
+                                            rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zherk(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_operation             transA,
+                                            rocblas_int                   n,
+                                            rocblas_int                   k,
+                                            const double*                 alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            const double*                 beta,
+                                            rocblas_double_complex*       C,
+                                            rocblas_int                   ldc);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xHERK_BATCHED performs one of the Hermitian rank-k operations
+    for each matrix C_i in a batch
+
+        C_i = alpha*op( A_i )*op( A_i )**H + beta*C_i,
+
+    where op( X ) = X or op( X ) = X**H, alpha and beta are scalars (both real),
+    C is an n by n Hermitian matrix stored in the triangle given by uplo,
+    and op( A ) is an n by k matrix.
+    Only the uplo triangle of C is read and written, and the imaginary parts of the
+    diagonal elements of C are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
+    @param[in]
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_conjugate_transpose;
+              rocblas_operation_transpose is only valid for real precisions.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         device array of device pointers storing each matrix C_i.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of each C.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cherk_batched(rocblas_handle                     handle,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_operation                  transA,
+                                                    rocblas_int                        n,
+                                                    rocblas_int                        k,
+                                                    const float*                       alpha,
+                                                    const rocblas_float_complex* const A[],
+                                                    rocblas_int                        lda,
+                                                    const float*                       beta,
+                                                    rocblas_float_complex* const       C[],
+                                                    rocblas_int                        ldc,
+                                                    rocblas_int                        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zherk_batched(rocblas_handle                      handle,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_operation                   transA,
+                                                    rocblas_int                         n,
+                                                    rocblas_int                         k,
+                                                    const double*                       alpha,
+                                                    const rocblas_double_complex* const A[],
+                                                    rocblas_int                         lda,
+                                                    const double*                       beta,
+                                                    rocblas_double_complex* const       C[],
+                                                    rocblas_int                         ldc,
+                                                    rocblas_int batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xHERK_STRIDED_BATCHED performs one of the Hermitian rank-k operations
+    for each matrix C_i in a batch
+
+        C_i = alpha*op( A_i )*op( A_i )**H + beta*C_i,
+
+    where op( X ) = X or op( X ) = X**H, alpha and beta are scalars (both real),
+    C is an n by n Hermitian matrix stored in the triangle given by uplo,
+    and op( A ) is an n by k matrix.
+    Only the uplo triangle of C is read and written, and the imaginary parts of the
+    diagonal elements of C are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
+    @param[in]
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_conjugate_transpose;
+              rocblas_operation_transpose is only valid for real precisions.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         device pointer to the first matrix A_1 on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A.
+    @param[in]
+    stride_A  rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         device pointer to the first matrix C_1 on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of each C.
+    @param[in]
+    stride_C  rocblas_stride
+              stride from the start of one matrix (C_i) and the next one (C_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cherk_strided_batched(rocblas_handle               handle,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_operation            transA,
+                                                            rocblas_int                  n,
+                                                            rocblas_int                  k,
+                                                            const float*                 alpha,
+                                                            const rocblas_float_complex* A,
+                                                            rocblas_int                  lda,
+                                                            rocblas_stride               stride_A,
+                                                            const float*                 beta,
+                                                            rocblas_float_complex*       C,
+                                                            rocblas_int                  ldc,
+                                                            rocblas_stride               stride_C,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zherk_strided_batched(rocblas_handle                handle,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_operation             transA,
+                                                            rocblas_int                   n,
+                                                            rocblas_int                   k,
+                                                            const double*                 alpha,
+                                                            const rocblas_double_complex* A,
+                                                            rocblas_int                   lda,
+                                                            rocblas_stride                stride_A,
+                                                            const double*                 beta,
+                                                            rocblas_double_complex*       C,
+                                                            rocblas_int                   ldc,
+                                                            rocblas_stride                stride_C,
+                                                            rocblas_int batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xSYR2K performs one of the symmetric rank-2k operations
+
+        C = alpha*op( A )*op( B )**T + alpha*op( B )*op( A )**T + beta*C,
+
+    where op( X ) = X or op( X ) = X**T, alpha and beta are scalars,
+    C is an n by n symmetric matrix stored in the triangle given by uplo,
+    and op( A ), op( B ) are n by k matrices.
+    Only the uplo triangle of C is read and written.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
+    @param[in]
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_transpose;
+              rocblas_operation_conjugate_transpose is only valid for real precisions.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    B         pointer storing matrix B on the GPU.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of B.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k(rocblas_handle    handle,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation transA,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const float*      alpha,
+                                             const float*      A,
+                                             rocblas_int       lda,
+                                             const float*      B,
+                                             rocblas_int       ldb,
+                                             const float*      beta,
+                                             float*            C,
+                                             rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k(rocblas_handle    handle,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation transA,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const double*     alpha,
+                                             const double*     A,
+                                             rocblas_int       lda,
+                                             const double*     B,
+                                             rocblas_int       ldb,
+                                             const double*     beta,
+                                             double*           C,
+                                             rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr2k(rocblas_handle               handle,
+                                             rocblas_fill                 uplo,
+                                             rocblas_operation            transA,
+                                             rocblas_int                  n,
+                                             rocblas_int                  k,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* A,
+                                             rocblas_int                  lda,
+                                             const rocblas_float_complex* B,
+                                             rocblas_int                  ldb,
+                                             const rocblas_float_complex* beta,
+                                             rocblas_float_complex*       C,
+                                             rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k(rocblas_handle                handle,
+                                             rocblas_fill                  uplo,
+                                             rocblas_operation             transA,
+                                             rocblas_int                   n,
+                                             rocblas_int                   k,
+                                             const rocblas_double_complex* alpha,
+                                             const rocblas_double_complex* A,
+                                             rocblas_int                   lda,
+                                             const rocblas_double_complex* B,
+                                             rocblas_int                   ldb,
+                                             const rocblas_double_complex* beta,
+                                             rocblas_double_complex*       C,
+                                             rocblas_int                   ldc);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xSYR2K_BATCHED performs one of the symmetric rank-2k operations
+    for each matrix C_i in a batch
+
+        C_i = alpha*op( A_i )*op( B_i )**T + alpha*op( B_i )*op( A_i )**T + beta*C_i,
+
+    where op( X ) = X or op( X ) = X**T, alpha and beta are scalars,
+    C is an n by n symmetric matrix stored in the triangle given by uplo,
+    and op( A ), op( B ) are n by k matrices.
+    Only the uplo triangle of C is read and written.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
+    @param[in]
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_transpose;
+              rocblas_operation_conjugate_transpose is only valid for real precisions.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A.
+    @param[in]
+    B         device array of device pointers storing each matrix B_i.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of each B.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         device array of device pointers storing each matrix C_i.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of each C.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k_batched(rocblas_handle     handle,
+                                                     rocblas_fill       uplo,
+                                                     rocblas_operation  transA,
+                                                     rocblas_int        n,
+                                                     rocblas_int        k,
+                                                     const float*       alpha,
+                                                     const float* const A[],
+                                                     rocblas_int        lda,
+                                                     const float* const B[],
+                                                     rocblas_int        ldb,
+                                                     const float*       beta,
+                                                     float* const       C[],
+                                                     rocblas_int        ldc,
+                                                     rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k_batched(rocblas_handle      handle,
+                                                     rocblas_fill        uplo,
+                                                     rocblas_operation   transA,
+                                                     rocblas_int         n,
+                                                     rocblas_int         k,
+                                                     const double*       alpha,
+                                                     const double* const A[],
+                                                     rocblas_int         lda,
+                                                     const double* const B[],
+                                                     rocblas_int         ldb,
+                                                     const double*       beta,
+                                                     double* const       C[],
+                                                     rocblas_int         ldc,
+                                                     rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr2k_batched(rocblas_handle                     handle,
+                                                     rocblas_fill                       uplo,
+                                                     rocblas_operation                  transA,
+                                                     rocblas_int                        n,
+                                                     rocblas_int                        k,
+                                                     const rocblas_float_complex*       alpha,
+                                                     const rocblas_float_complex* const A[],
+                                                     rocblas_int                        lda,
+                                                     const rocblas_float_complex* const B[],
+                                                     rocblas_int                        ldb,
+                                                     const rocblas_float_complex*       beta,
+                                                     rocblas_float_complex* const       C[],
+                                                     rocblas_int                        ldc,
+                                                     rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k_batched(rocblas_handle                      handle,
+                                                     rocblas_fill                        uplo,
+                                                     rocblas_operation                   transA,
+                                                     rocblas_int                         n,
+                                                     rocblas_int                         k,
+                                                     const rocblas_double_complex*       alpha,
+                                                     const rocblas_double_complex* const A[],
+                                                     rocblas_int                         lda,
+                                                     const rocblas_double_complex* const B[],
+                                                     rocblas_int                         ldb,
+                                                     const rocblas_double_complex*       beta,
+                                                     rocblas_double_complex* const       C[],
+                                                     rocblas_int                         ldc,
+                                                     rocblas_int batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xSYR2K_STRIDED_BATCHED performs one of the symmetric rank-2k operations
+    for each matrix C_i in a batch
+
+        C_i = alpha*op( A_i )*op( B_i )**T + alpha*op( B_i )*op( A_i )**T + beta*C_i,
+
+    where op( X ) = X or op( X ) = X**T, alpha and beta are scalars,
+    C is an n by n symmetric matrix stored in the triangle given by uplo,
+    and op( A ), op( B ) are n by k matrices.
+    Only the uplo triangle of C is read and written.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
+    @param[in]
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_transpose;
+              rocblas_operation_conjugate_transpose is only valid for real precisions.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         device pointer to the first matrix A_1 on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A.
+    @param[in]
+    stride_A  rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[in]
+    B         device pointer to the first matrix B_1 on the GPU.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of each B.
+    @param[in]
+    stride_B  rocblas_stride
+              stride from the start of one matrix (B_i) and the next one (B_i+1).
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         device pointer to the first matrix C_1 on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of each C.
+    @param[in]
+    stride_C  rocblas_stride
+              stride from the start of one matrix (C_i) and the next one (C_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k_strided_batched(rocblas_handle    handle,
+                                                             rocblas_fill      uplo,
+                                                             rocblas_operation transA,
+                                                             rocblas_int       n,
+                                                             rocblas_int       k,
+                                                             const float*      alpha,
+                                                             const float*      A,
+                                                             rocblas_int       lda,
+                                                             rocblas_stride    stride_A,
+                                                             const float*      B,
+                                                             rocblas_int       ldb,
+                                                             rocblas_stride    stride_B,
+                                                             const float*      beta,
+                                                             float*            C,
+                                                             rocblas_int       ldc,
+                                                             rocblas_stride    stride_C,
+                                                             rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k_strided_batched(rocblas_handle    handle,
+                                                             rocblas_fill      uplo,
+                                                             rocblas_operation transA,
+                                                             rocblas_int       n,
+                                                             rocblas_int       k,
+                                                             const double*     alpha,
+                                                             const double*     A,
+                                                             rocblas_int       lda,
+                                                             rocblas_stride    stride_A,
+                                                             const double*     B,
+                                                             rocblas_int       ldb,
+                                                             rocblas_stride    stride_B,
+                                                             const double*     beta,
+                                                             double*           C,
+                                                             rocblas_int       ldc,
+                                                             rocblas_stride    stride_C,
+                                                             rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr2k_strided_batched(rocblas_handle               handle,
+                                                             rocblas_fill                 uplo,
+                                                             rocblas_operation            transA,
+                                                             rocblas_int                  n,
+                                                             rocblas_int                  k,
+                                                             const rocblas_float_complex* alpha,
+                                                             const rocblas_float_complex* A,
+                                                             rocblas_int                  lda,
+                                                             rocblas_stride               stride_A,
+                                                             const rocblas_float_complex* B,
+                                                             rocblas_int                  ldb,
+                                                             rocblas_stride               stride_B,
+                                                             const rocblas_float_complex* beta,
+                                                             rocblas_float_complex*       C,
+                                                             rocblas_int                  ldc,
+                                                             rocblas_stride               stride_C,
+                                                             rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k_strided_batched(rocblas_handle                handle,
+                                                             rocblas_fill                  uplo,
+                                                             rocblas_operation             transA,
+                                                             rocblas_int                   n,
+                                                             rocblas_int                   k,
+                                                             const rocblas_double_complex* alpha,
+                                                             const rocblas_double_complex* A,
+                                                             rocblas_int                   lda,
+                                                             rocblas_stride                stride_A,
+                                                             const rocblas_double_complex* B,
+                                                             rocblas_int                   ldb,
+                                                             rocblas_stride                stride_B,
+                                                             const rocblas_double_complex* beta,
+                                                             rocblas_double_complex*       C,
+                                                             rocblas_int                   ldc,
+                                                             rocblas_stride                stride_C,
+                                                             rocblas_int batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xHER2K performs one of the Hermitian rank-2k operations
+
+        C = alpha*op( A )*op( B )**H + conj( alpha )*op( B )*op( A )**H + beta*C,
+
+    where op( X ) = X or op( X ) = X**H, alpha and beta are scalars (beta real),
+    C is an n by n Hermitian matrix stored in the triangle given by uplo,
+    and op( A ), op( B ) are n by k matrices.
+    Only the uplo triangle of C is read and written, and the imaginary parts of the
+    diagonal elements of C are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
+    @param[in]
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_conjugate_transpose;
+              rocblas_operation_transpose is only valid for real precisions.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    B         pointer storing matrix B on the GPU.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of B.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher2k(rocblas_handle               handle,
+                                             rocblas_fill                 uplo,
+                                             rocblas_operation            transA,
+                                             rocblas_int                  n,
+                                             rocblas_int                  k,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* A,
+                                             rocblas_int                  lda,
+                                             const rocblas_float_complex* B,
+                                             rocblas_int                  ldb,
+                                             const float*                 beta,
+                                             rocblas_float_complex*       C,
+                                             rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher2k(rocblas_handle                handle,
+                                             rocblas_fill                  uplo,
+                                             rocblas_operation             transA,
+                                             rocblas_int                   n,
+                                             rocblas_int                   k,
+                                             const rocblas_double_complex* alpha,
+                                             const rocblas_double_complex* A,
+                                             rocblas_int                   lda,
+                                             const rocblas_double_complex* B,
+                                             rocblas_int                   ldb,
+                                             const double*                 beta,
+                                             rocblas_double_complex*       C,
+                                             rocblas_int                   ldc);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xHER2K_BATCHED performs one of the Hermitian rank-2k operations
+    for each matrix C_i in a batch
+
+        C_i = alpha*op( A_i )*op( B_i )**H + conj( alpha )*op( B_i )*op( A_i )**H + beta*C_i,
+
+    where op( X ) = X or op( X ) = X**H, alpha and beta are scalars (beta real),
+    C is an n by n Hermitian matrix stored in the triangle given by uplo,
+    and op( A ), op( B ) are n by k matrices.
+    Only the uplo triangle of C is read and written, and the imaginary parts of the
+    diagonal elements of C are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
+    @param[in]
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_conjugate_transpose;
+              rocblas_operation_transpose is only valid for real precisions.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A.
+    @param[in]
+    B         device array of device pointers storing each matrix B_i.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of each B.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         device array of device pointers storing each matrix C_i.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of each C.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher2k_batched(rocblas_handle                     handle,
+                                                     rocblas_fill                       uplo,
+                                                     rocblas_operation                  transA,
+                                                     rocblas_int                        n,
+                                                     rocblas_int                        k,
+                                                     const rocblas_float_complex*       alpha,
+                                                     const rocblas_float_complex* const A[],
+                                                     rocblas_int                        lda,
+                                                     const rocblas_float_complex* const B[],
+                                                     rocblas_int                        ldb,
+                                                     const float*                       beta,
+                                                     rocblas_float_complex* const       C[],
+                                                     rocblas_int                        ldc,
+                                                     rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher2k_batched(rocblas_handle                      handle,
+                                                     rocblas_fill                        uplo,
+                                                     rocblas_operation                   transA,
+                                                     rocblas_int                         n,
+                                                     rocblas_int                         k,
+                                                     const rocblas_double_complex*       alpha,
+                                                     const rocblas_double_complex* const A[],
+                                                     rocblas_int                         lda,
+                                                     const rocblas_double_complex* const B[],
+                                                     rocblas_int                         ldb,
+                                                     const double*                       beta,
+                                                     rocblas_double_complex* const       C[],
+                                                     rocblas_int                         ldc,
+                                                     rocblas_int batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xHER2K_STRIDED_BATCHED performs one of the Hermitian rank-2k operations
+    for each matrix C_i in a batch
+
+        C_i = alpha*op( A_i )*op( B_i )**H + conj( alpha )*op( B_i )*op( A_i )**H + beta*C_i,
+
+    where op( X ) = X or op( X ) = X**H, alpha and beta are scalars (beta real),
+    C is an n by n Hermitian matrix stored in the triangle given by uplo,
+    and op( A ), op( B ) are n by k matrices.
+    Only the uplo triangle of C is read and written, and the imaginary parts of the
+    diagonal elements of C are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of C is stored.
     @param[in]
-    uplo    rocblas_fill.
-            rocblas_fill_upper:  A is an upper triangular matrix.
-            rocblas_fill_lower:  A is a  lower triangular matrix.
+    transA    rocblas_operation
+              rocblas_operation_none or rocblas_operation_conjugate_transpose;
+              rocblas_operation_transpose is only valid for real precisions.
     @param[in]
-    transA  rocblas_operation.
-            transB:    op(A) = A.
-            rocblas_operation_transpose:      op(A) = A^T.
-            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+    n         rocblas_int.
     @param[in]
-    diag    rocblas_diagonal.
-            rocblas_diagonal_unit:     A is assumed to be unit triangular.
-            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+    k         rocblas_int.
     @param[in]
-    m       rocblas_int.
-            m specifies the number of rows of B. m >= 0.
+    alpha     specifies the scalar alpha.
     @param[in]
-    n       rocblas_int.
-            n specifies the number of columns of B. n >= 0.
+    A         device pointer to the first matrix A_1 on the GPU.
     @param[in]
-    alpha
-            alpha specifies the scalar alpha. When alpha is
-            &zero then A is not referenced and B need not be set before
-            entry.
+    lda       rocblas_int
+              specifies the leading dimension of each A.
     @param[in]
-    A       pointer storing matrix A on the GPU.
-            of dimension ( lda, k ), where k is m
-            when  rocblas_side_left  and
-            is  n  when  rocblas_side_right
-            only the upper/lower triangular part is accessed.
+    stride_A  rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
     @param[in]
-    lda     rocblas_int.
-            lda specifies the first dimension of A.
-            if side = rocblas_side_left,  lda >= max( 1, m ),
-            if side = rocblas_side_right, lda >= max( 1, n ).
+    B         device pointer to the first matrix B_1 on the GPU.
     @param[in]
-    stride_a rocblas_stride
-             stride from the start of one "A" matrix to the next.
-    @param[in,output]
-    B       pointer storing matrix B on the GPU.
+    ldb       rocblas_int
+              specifies the leading dimension of each B.
     @param[in]
-    ldb    rocblas_int.
-           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+    stride_B  rocblas_stride
+              stride from the start of one matrix (B_i) and the next one (B_i+1).
     @param[in]
-    stride_b rocblas_stride
-             stride from the start of one "B" matrix to the next.
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         device pointer to the first matrix C_1 on the GPU.
     @param[in]
-    batch_count rocblas_int.
-                number of trsm operatons in the batch.
-    ********************************************************************/
+    ldc       rocblas_int
+              specifies the leading dimension of each C.
+    @param[in]
+    stride_C  rocblas_stride
+              stride from the start of one matrix (C_i) and the next one (C_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
 
-ROCBLAS_EXPORT rocblas_status rocblas_strsm_strided_batched(rocblas_handle    handle,
-                                                            rocblas_side      side,
-                                                            rocblas_fill      uplo,
-                                                            rocblas_operation transA,
-                                                            rocblas_diagonal  diag,
-                                                            rocblas_int       m,
-                                                            rocblas_int       n,
-                                                            const float*      alpha,
-                                                            const float*      A,
-                                                            rocblas_int       lda,
-                                                            rocblas_stride    stride_a,
-                                                            float*            B,
-                                                            rocblas_int       ldb,
-                                                            rocblas_stride    stride_b,
-                                                            rocblas_int       batch_count);
+    ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_strided_batched(rocblas_handle    handle,
-                                                            rocblas_side      side,
-                                                            rocblas_fill      uplo,
-                                                            rocblas_operation transA,
-                                                            rocblas_diagonal  diag,
-                                                            rocblas_int       m,
-                                                            rocblas_int       n,
-                                                            const double*     alpha,
-                                                            const double*     A,
-                                                            rocblas_int       lda,
-                                                            rocblas_stride    stride_a,
-                                                            double*           B,
-                                                            rocblas_int       ldb,
-                                                            rocblas_stride    stride_b,
-                                                            rocblas_int       batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_cher2k_strided_batched(rocblas_handle               handle,
+                                                             rocblas_fill                 uplo,
+                                                             rocblas_operation            transA,
+                                                             rocblas_int                  n,
+                                                             rocblas_int                  k,
+                                                             const rocblas_float_complex* alpha,
+                                                             const rocblas_float_complex* A,
+                                                             rocblas_int                  lda,
+                                                             rocblas_stride               stride_A,
+                                                             const rocblas_float_complex* B,
+                                                             rocblas_int                  ldb,
+                                                             rocblas_stride               stride_B,
+                                                             const float*                 beta,
+                                                             rocblas_float_complex*       C,
+                                                             rocblas_int                  ldc,
+                                                             rocblas_stride               stride_C,
+                                                             rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher2k_strided_batched(rocblas_handle                handle,
+                                                             rocblas_fill                  uplo,
+                                                             rocblas_operation             transA,
+                                                             rocblas_int                   n,
+                                                             rocblas_int                   k,
+                                                             const rocblas_double_complex* alpha,
+                                                             const rocblas_double_complex* A,
+                                                             rocblas_int                   lda,
+                                                             rocblas_stride                stride_A,
+                                                             const rocblas_double_complex* B,
+                                                             rocblas_int                   ldb,
+                                                             rocblas_stride                stride_B,
+                                                             const double*                 beta,
+                                                             rocblas_double_complex*       C,
+                                                             rocblas_int                   ldc,
+                                                             rocblas_stride                stride_C,
+                                                             rocblas_int batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
-    xGEMM performs one of the matrix-matrix operations
-
-        C = alpha*op( A )*op( B ) + beta*C,
-
-    where op( X ) is one of
+    xSYMM performs one of the matrix-matrix operations
 
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
+        C = alpha*A*B + beta*C, or
+        C = alpha*B*A + beta*C,
 
-    alpha and beta are scalars, and A, B and C are matrices, with
-    op( A ) an m by k matrix, op( B ) a k by n matrix and C an m by n matrix.
+    where alpha and beta are scalars, A is a symmetric matrix of which only the triangle
+    given by uplo is read, and B and C are m by n matrices.
 
     @param[in]
-    handle    rocblas_handle,
+    handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    transA    rocblas_operation,
-              specifies the form of op( A )
-    @param[in]
-    transB    rocblas_operation,
-              specifies the form of op( B )
+    side      rocblas_side.
+              rocblas_side_left:  C := alpha*A*B + beta*C, A is m by m.
+              rocblas_side_right: C := alpha*B*A + beta*C, A is n by n.
     @param[in]
-    m         rocblas_int,
-              number or rows of matrices op( A ) and C
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of A is stored.
     @param[in]
-    n         rocblas_int,
-              number of columns of matrices op( B ) and C
+    m         rocblas_int.
     @param[in]
-    k         rocblas_int,
-              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    n         rocblas_int.
     @param[in]
     alpha     specifies the scalar alpha.
     @param[in]
     A         pointer storing matrix A on the GPU.
     @param[in]
-    lda       rocblas_int,
+    lda       rocblas_int
               specifies the leading dimension of A.
     @param[in]
     B         pointer storing matrix B on the GPU.
     @param[in]
-    ldb       rocblas_int,
+    ldb       rocblas_int
               specifies the leading dimension of B.
     @param[in]
     beta      specifies the scalar beta.
     @param[in, out]
     C         pointer storing matrix C on the GPU.
     @param[in]
-    ldc       rocblas_int,
+    ldc       rocblas_int
               specifies the leading dimension of C.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_hgemm(rocblas_handle      handle,
-                                            rocblas_operation   transa,
-                                            rocblas_operation   transb,
-                                            rocblas_int         m,
-                                            rocblas_int         n,
-                                            rocblas_int         k,
-                                            const rocblas_half* alpha,
-                                            const rocblas_half* A,
-                                            rocblas_int         lda,
-                                            const rocblas_half* B,
-                                            rocblas_int         ldb,
-                                            const rocblas_half* beta,
-                                            rocblas_half*       C,
-                                            rocblas_int         ldc);
-
-ROCBLAS_EXPORT rocblas_status rocblas_sgemm(rocblas_handle    handle,
-                                            rocblas_operation transa,
-                                            rocblas_operation transb,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            rocblas_int       k,
-                                            const float*      alpha,
-                                            const float*      A,
-                                            rocblas_int       lda,
-                                            const float*      B,
-                                            rocblas_int       ldb,
-                                            const float*      beta,
-                                            float*            C,
-                                            rocblas_int       ldc);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dgemm(rocblas_handle    handle,
-                                            rocblas_operation transa,
-                                            rocblas_operation transb,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            rocblas_int       k,
-                                            const double*     alpha,
-                                            const double*     A,
-                                            rocblas_int       lda,
-                                            const double*     B,
-                                            rocblas_int       ldb,
-                                            const double*     beta,
-                                            double*           C,
-                                            rocblas_int       ldc);
-
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_qgemm(
-    rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
-    const rocblas_half_complex *alpha,
-    const rocblas_half_complex *A, rocblas_int lda,
-    const rocblas_half_complex *B, rocblas_int ldb,
-    const rocblas_half_complex *beta,
-          rocblas_half_complex *C, rocblas_int ldc);
-*/
-
-ROCBLAS_EXPORT rocblas_status rocblas_cgemm(rocblas_handle               handle,
-                                            rocblas_operation            transa,
-                                            rocblas_operation            transb,
+ROCBLAS_EXPORT rocblas_status rocblas_ssymm(rocblas_handle handle,
+                                            rocblas_side   side,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    m,
+                                            rocblas_int    n,
+                                            const float*   alpha,
+                                            const float*   A,
+                                            rocblas_int    lda,
+                                            const float*   B,
+                                            rocblas_int    ldb,
+                                            const float*   beta,
+                                            float*         C,
+                                            rocblas_int    ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsymm(rocblas_handle handle,
+                                            rocblas_side   side,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    m,
+                                            rocblas_int    n,
+                                            const double*  alpha,
+                                            const double*  A,
+                                            rocblas_int    lda,
+                                            const double*  B,
+                                            rocblas_int    ldb,
+                                            const double*  beta,
+                                            double*        C,
+                                            rocblas_int    ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csymm(rocblas_handle               handle,
+                                            rocblas_side                 side,
+                                            rocblas_fill                 uplo,
                                             rocblas_int                  m,
                                             rocblas_int                  n,
-                                            rocblas_int                  k,
                                             const rocblas_float_complex* alpha,
                                             const rocblas_float_complex* A,
                                             rocblas_int                  lda,
@@ -4476,12 +9495,11 @@ ROCBLAS_EXPORT rocblas_status rocblas_cgemm(rocblas_handle               handle,
                                             rocblas_float_complex*       C,
                                             rocblas_int                  ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_zgemm(rocblas_handle                handle,
-                                            rocblas_operation             transa,
-                                            rocblas_operation             transb,
+ROCBLAS_EXPORT rocblas_status rocblas_zsymm(rocblas_handle                handle,
+                                            rocblas_side                  side,
+                                            rocblas_fill                  uplo,
                                             rocblas_int                   m,
                                             rocblas_int                   n,
-                                            rocblas_int                   k,
                                             const rocblas_double_complex* alpha,
                                             const rocblas_double_complex* A,
                                             rocblas_int                   lda,
@@ -4492,82 +9510,62 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgemm(rocblas_handle                handle
                                             rocblas_int                   ldc);
 
 /*! \brief BLAS Level 3 API
-     \details
-    xGEMM_BATCHED performs one of the batched matrix-matrix operations
-         C[i] = alpha*op( A[i] )*op( B[i] ) + beta*C[i], for i in
-   [0,batch_count-1]
-     where op( X ) is one of
-         op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
-     alpha and beta are scalars, and A, B and C are strided batched matrices, with
-    op( A ) an m by k by batch_count strided_batched matrix,
-    op( B ) an k by n by batch_count strided_batched matrix and
-    C an m by n by batch_count strided_batched matrix.
-     @param[in]
+
+    \details
+    xSYMM_BATCHED performs one of the matrix-matrix operations
+    for each matrix C_i in a batch
+
+        C_i = alpha*A_i*B_i + beta*C_i, or
+        C_i = alpha*B_i*A_i + beta*C_i,
+
+    where alpha and beta are scalars, A is a symmetric matrix of which only the triangle
+    given by uplo is read, and B and C are m by n matrices.
+
+    @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    transA    rocblas_operation
-              specifies the form of op( A )
+    side      rocblas_side.
+              rocblas_side_left:  C := alpha*A*B + beta*C, A is m by m.
+              rocblas_side_right: C := alpha*B*A + beta*C, A is n by n.
     @param[in]
-    transB    rocblas_operation
-              specifies the form of op( B )
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of A is stored.
     @param[in]
     m         rocblas_int.
-              matrix dimention m.
     @param[in]
     n         rocblas_int.
-              matrix dimention n.
-    @param[in]
-    k         rocblas_int.
-              matrix dimention k.
     @param[in]
     alpha     specifies the scalar alpha.
     @param[in]
-    A         Device array of device pointers storing A matricies on the GPU.
+    A         device array of device pointers storing each matrix A_i.
     @param[in]
     lda       rocblas_int
-              specifies the leading dimension of "A".
+              specifies the leading dimension of each A.
     @param[in]
-    B         Device array of device pointers storing B matricies on the GPU.
+    B         device array of device pointers storing each matrix B_i.
     @param[in]
     ldb       rocblas_int
-              specifies the leading dimension of "B".
+              specifies the leading dimension of each B.
     @param[in]
     beta      specifies the scalar beta.
     @param[in, out]
-    C         Device array of device pointers storing C matricies on the GPU.
+    C         device array of device pointers storing each matrix C_i.
     @param[in]
     ldc       rocblas_int
-              specifies the leading dimension of "C".
+              specifies the leading dimension of each C.
     @param[in]
     batch_count
               rocblas_int
-              number of gemm operations in the batch
-     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_hgemm_batched(rocblas_handle            handle,
-                                                    rocblas_operation         transa,
-                                                    rocblas_operation         transb,
-                                                    rocblas_int               m,
-                                                    rocblas_int               n,
-                                                    rocblas_int               k,
-                                                    const rocblas_half*       alpha,
-                                                    const rocblas_half* const A[],
-                                                    rocblas_int               lda,
-                                                    const rocblas_half* const B[],
-                                                    rocblas_int               ldb,
-                                                    const rocblas_half*       beta,
-                                                    rocblas_half* const       C[],
-                                                    rocblas_int               ldc,
-                                                    rocblas_int               batch_count);
+              number of instances in the batch.
 
-ROCBLAS_EXPORT rocblas_status rocblas_sgemm_batched(rocblas_handle     handle,
-                                                    rocblas_operation  transa,
-                                                    rocblas_operation  transb,
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssymm_batched(rocblas_handle     handle,
+                                                    rocblas_side       side,
+                                                    rocblas_fill       uplo,
                                                     rocblas_int        m,
                                                     rocblas_int        n,
-                                                    rocblas_int        k,
                                                     const float*       alpha,
                                                     const float* const A[],
                                                     rocblas_int        lda,
@@ -4578,12 +9576,11 @@ ROCBLAS_EXPORT rocblas_status rocblas_sgemm_batched(rocblas_handle     handle,
                                                     rocblas_int        ldc,
                                                     rocblas_int        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dgemm_batched(rocblas_handle      handle,
-                                                    rocblas_operation   transa,
-                                                    rocblas_operation   transb,
+ROCBLAS_EXPORT rocblas_status rocblas_dsymm_batched(rocblas_handle      handle,
+                                                    rocblas_side        side,
+                                                    rocblas_fill        uplo,
                                                     rocblas_int         m,
                                                     rocblas_int         n,
-                                                    rocblas_int         k,
                                                     const double*       alpha,
                                                     const double* const A[],
                                                     rocblas_int         lda,
@@ -4594,12 +9591,11 @@ ROCBLAS_EXPORT rocblas_status rocblas_dgemm_batched(rocblas_handle      handle,
                                                     rocblas_int         ldc,
                                                     rocblas_int         batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cgemm_batched(rocblas_handle                     handle,
-                                                    rocblas_operation                  transa,
-                                                    rocblas_operation                  transb,
+ROCBLAS_EXPORT rocblas_status rocblas_csymm_batched(rocblas_handle                     handle,
+                                                    rocblas_side                       side,
+                                                    rocblas_fill                       uplo,
                                                     rocblas_int                        m,
                                                     rocblas_int                        n,
-                                                    rocblas_int                        k,
                                                     const rocblas_float_complex*       alpha,
                                                     const rocblas_float_complex* const A[],
                                                     rocblas_int                        lda,
@@ -4610,12 +9606,11 @@ ROCBLAS_EXPORT rocblas_status rocblas_cgemm_batched(rocblas_handle
                                                     rocblas_int                        ldc,
                                                     rocblas_int                        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_zgemm_batched(rocblas_handle                      handle,
-                                                    rocblas_operation                   transa,
-                                                    rocblas_operation                   transb,
+ROCBLAS_EXPORT rocblas_status rocblas_zsymm_batched(rocblas_handle                      handle,
+                                                    rocblas_side                        side,
+                                                    rocblas_fill                        uplo,
                                                     rocblas_int                         m,
                                                     rocblas_int                         n,
-                                                    rocblas_int                         k,
                                                     const rocblas_double_complex*       alpha,
                                                     const rocblas_double_complex* const A[],
                                                     rocblas_int                         lda,
@@ -4626,277 +9621,321 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgemm_batched(rocblas_handle
                                                     rocblas_int                         ldc,
                                                     rocblas_int batch_count);
 
-/***************************************************************************
- * batched
- * stride_a - "batch stride a": stride from the start of one "A" matrix to the next
- * stride_b
- * stride_c
- * batch_count - numbers of gemm's in the batch
- **************************************************************************/
-
 /*! \brief BLAS Level 3 API
 
     \details
-    xGEMM_STRIDED_BATCHED performs one of the strided batched matrix-matrix operations
-
-        C[i*stride_c] = alpha*op( A[i*stride_a] )*op( B[i*stride_b] ) + beta*C[i*stride_c], for i in
-   [0,batch_count-1]
+    xSYMM_STRIDED_BATCHED performs one of the matrix-matrix operations
+    for each matrix C_i in a batch
 
-    where op( X ) is one of
-
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
+        C_i = alpha*A_i*B_i + beta*C_i, or
+        C_i = alpha*B_i*A_i + beta*C_i,
 
-    alpha and beta are scalars, and A, B and C are strided batched matrices, with
-    op( A ) an m by k by batch_count strided_batched matrix,
-    op( B ) an k by n by batch_count strided_batched matrix and
-    C an m by n by batch_count strided_batched matrix.
+    where alpha and beta are scalars, A is a symmetric matrix of which only the triangle
+    given by uplo is read, and B and C are m by n matrices.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    transA    rocblas_operation
-              specifies the form of op( A )
+    side      rocblas_side.
+              rocblas_side_left:  C := alpha*A*B + beta*C, A is m by m.
+              rocblas_side_right: C := alpha*B*A + beta*C, A is n by n.
     @param[in]
-    transB    rocblas_operation
-              specifies the form of op( B )
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of A is stored.
     @param[in]
     m         rocblas_int.
-              matrix dimention m.
     @param[in]
     n         rocblas_int.
-              matrix dimention n.
-    @param[in]
-    k         rocblas_int.
-              matrix dimention k.
     @param[in]
     alpha     specifies the scalar alpha.
     @param[in]
-    A         pointer storing strided batched matrix A on the GPU.
+    A         device pointer to the first matrix A_1 on the GPU.
     @param[in]
     lda       rocblas_int
-              specifies the leading dimension of "A".
+              specifies the leading dimension of each A.
     @param[in]
-    stride_a  rocblas_stride
-              stride from the start of one "A" matrix to the next
+    stride_A  rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
     @param[in]
-    B         pointer storing strided batched matrix B on the GPU.
+    B         device pointer to the first matrix B_1 on the GPU.
     @param[in]
     ldb       rocblas_int
-              specifies the leading dimension of "B".
+              specifies the leading dimension of each B.
     @param[in]
-    stride_b  rocblas_stride
-              stride from the start of one "B" matrix to the next
+    stride_B  rocblas_stride
+              stride from the start of one matrix (B_i) and the next one (B_i+1).
     @param[in]
     beta      specifies the scalar beta.
     @param[in, out]
-    C         pointer storing strided batched matrix C on the GPU.
+    C         device pointer to the first matrix C_1 on the GPU.
     @param[in]
     ldc       rocblas_int
-              specifies the leading dimension of "C".
+              specifies the leading dimension of each C.
     @param[in]
-    stride_c  rocblas_stride
-              stride from the start of one "C" matrix to the next
+    stride_C  rocblas_stride
+              stride from the start of one matrix (C_i) and the next one (C_i+1).
     @param[in]
     batch_count
               rocblas_int
-              number of gemm operatons in the batch
+              number of instances in the batch.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_hgemm_strided_batched(rocblas_handle      handle,
-                                                            rocblas_operation   transa,
-                                                            rocblas_operation   transb,
-                                                            rocblas_int         m,
-                                                            rocblas_int         n,
-                                                            rocblas_int         k,
-                                                            const rocblas_half* alpha,
-                                                            const rocblas_half* A,
-                                                            rocblas_int         lda,
-                                                            rocblas_stride      stride_a,
-                                                            const rocblas_half* B,
-                                                            rocblas_int         ldb,
-                                                            rocblas_stride      stride_b,
-                                                            const rocblas_half* beta,
-                                                            rocblas_half*       C,
-                                                            rocblas_int         ldc,
-                                                            rocblas_stride      stride_c,
-                                                            rocblas_int         batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_sgemm_strided_batched(rocblas_handle    handle,
-                                                            rocblas_operation transa,
-                                                            rocblas_operation transb,
-                                                            rocblas_int       m,
-                                                            rocblas_int       n,
-                                                            rocblas_int       k,
-                                                            const float*      alpha,
-                                                            const float*      A,
-                                                            rocblas_int       lda,
-                                                            rocblas_stride    stride_a,
-                                                            const float*      B,
-                                                            rocblas_int       ldb,
-                                                            rocblas_stride    stride_b,
-                                                            const float*      beta,
-                                                            float*            C,
-                                                            rocblas_int       ldc,
-                                                            rocblas_stride    stride_c,
-                                                            rocblas_int       batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dgemm_strided_batched(rocblas_handle    handle,
-                                                            rocblas_operation transa,
-                                                            rocblas_operation transb,
-                                                            rocblas_int       m,
-                                                            rocblas_int       n,
-                                                            rocblas_int       k,
-                                                            const double*     alpha,
-                                                            const double*     A,
-                                                            rocblas_int       lda,
-                                                            rocblas_stride    stride_a,
-                                                            const double*     B,
-                                                            rocblas_int       ldb,
-                                                            rocblas_stride    stride_b,
-                                                            const double*     beta,
-                                                            double*           C,
-                                                            rocblas_int       ldc,
-                                                            rocblas_stride    stride_c,
-                                                            rocblas_int       batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_hgemm_kernel_name(rocblas_handle      handle,
-                                                        rocblas_operation   transa,
-                                                        rocblas_operation   transb,
-                                                        rocblas_int         m,
-                                                        rocblas_int         n,
-                                                        rocblas_int         k,
-                                                        const rocblas_half* alpha,
-                                                        const rocblas_half* A,
-                                                        rocblas_int         lda,
-                                                        rocblas_stride      stride_a,
-                                                        const rocblas_half* B,
-                                                        rocblas_int         ldb,
-                                                        rocblas_stride      stride_b,
-                                                        const rocblas_half* beta,
-                                                        rocblas_half*       C,
-                                                        rocblas_int         ldc,
-                                                        rocblas_stride      stride_c,
-                                                        rocblas_int         batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_sgemm_kernel_name(rocblas_handle    handle,
-                                                        rocblas_operation transa,
-                                                        rocblas_operation transb,
-                                                        rocblas_int       m,
-                                                        rocblas_int       n,
-                                                        rocblas_int       k,
-                                                        const float*      alpha,
-                                                        const float*      A,
-                                                        rocblas_int       lda,
-                                                        rocblas_stride    stride_a,
-                                                        const float*      B,
-                                                        rocblas_int       ldb,
-                                                        rocblas_stride    stride_b,
-                                                        const float*      beta,
-                                                        float*            C,
-                                                        rocblas_int       ldc,
-                                                        rocblas_stride    stride_c,
-                                                        rocblas_int       batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dgemm_kernel_name(rocblas_handle    handle,
-                                                        rocblas_operation transa,
-                                                        rocblas_operation transb,
-                                                        rocblas_int       m,
-                                                        rocblas_int       n,
-                                                        rocblas_int       k,
-                                                        const double*     alpha,
-                                                        const double*     A,
-                                                        rocblas_int       lda,
-                                                        rocblas_stride    stride_a,
-                                                        const double*     B,
-                                                        rocblas_int       ldb,
-                                                        rocblas_stride    stride_b,
-                                                        const double*     beta,
-                                                        double*           C,
-                                                        rocblas_int       ldc,
-                                                        rocblas_stride    stride_c,
-                                                        rocblas_int       batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ssymm_strided_batched(rocblas_handle handle,
+                                                            rocblas_side   side,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    m,
+                                                            rocblas_int    n,
+                                                            const float*   alpha,
+                                                            const float*   A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride stride_A,
+                                                            const float*   B,
+                                                            rocblas_int    ldb,
+                                                            rocblas_stride stride_B,
+                                                            const float*   beta,
+                                                            float*         C,
+                                                            rocblas_int    ldc,
+                                                            rocblas_stride stride_C,
+                                                            rocblas_int    batch_count);
 
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_qgemm_strided_batched(
-    rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
-    const rocblas_half_complex *alpha,
-    const rocblas_half_complex *A, rocblas_int lda, rocblas_stride stride_a,
-    const rocblas_half_complex *B, rocblas_int ldb, rocblas_stride stride_b,
-    const rocblas_half_complex *beta,
-          rocblas_half_complex *C, rocblas_int ldc, rocblas_stride stride_c,
-    rocblas_int batch_count );
-*/
+ROCBLAS_EXPORT rocblas_status rocblas_dsymm_strided_batched(rocblas_handle handle,
+                                                            rocblas_side   side,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    m,
+                                                            rocblas_int    n,
+                                                            const double*  alpha,
+                                                            const double*  A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride stride_A,
+                                                            const double*  B,
+                                                            rocblas_int    ldb,
+                                                            rocblas_stride stride_B,
+                                                            const double*  beta,
+                                                            double*        C,
+                                                            rocblas_int    ldc,
+                                                            rocblas_stride stride_C,
+                                                            rocblas_int    batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cgemm_strided_batched(rocblas_handle               handle,
-                                                            rocblas_operation            transa,
-                                                            rocblas_operation            transb,
+ROCBLAS_EXPORT rocblas_status rocblas_csymm_strided_batched(rocblas_handle               handle,
+                                                            rocblas_side                 side,
+                                                            rocblas_fill                 uplo,
                                                             rocblas_int                  m,
                                                             rocblas_int                  n,
-                                                            rocblas_int                  k,
                                                             const rocblas_float_complex* alpha,
                                                             const rocblas_float_complex* A,
                                                             rocblas_int                  lda,
-                                                            rocblas_stride               stride_a,
+                                                            rocblas_stride               stride_A,
                                                             const rocblas_float_complex* B,
                                                             rocblas_int                  ldb,
-                                                            rocblas_stride               stride_b,
+                                                            rocblas_stride               stride_B,
                                                             const rocblas_float_complex* beta,
                                                             rocblas_float_complex*       C,
                                                             rocblas_int                  ldc,
-                                                            rocblas_stride               stride_c,
+                                                            rocblas_stride               stride_C,
                                                             rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_zgemm_strided_batched(rocblas_handle                handle,
-                                                            rocblas_operation             transa,
-                                                            rocblas_operation             transb,
+ROCBLAS_EXPORT rocblas_status rocblas_zsymm_strided_batched(rocblas_handle                handle,
+                                                            rocblas_side                  side,
+                                                            rocblas_fill                  uplo,
                                                             rocblas_int                   m,
                                                             rocblas_int                   n,
-                                                            rocblas_int                   k,
                                                             const rocblas_double_complex* alpha,
                                                             const rocblas_double_complex* A,
                                                             rocblas_int                   lda,
-                                                            rocblas_stride                stride_a,
+                                                            rocblas_stride                stride_A,
                                                             const rocblas_double_complex* B,
                                                             rocblas_int                   ldb,
-                                                            rocblas_stride                stride_b,
+                                                            rocblas_stride                stride_B,
                                                             const rocblas_double_complex* beta,
                                                             rocblas_double_complex*       C,
                                                             rocblas_int                   ldc,
-                                                            rocblas_stride                stride_c,
+                                                            rocblas_stride                stride_C,
                                                             rocblas_int batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
-    xGEAM performs one of the matrix-matrix operations
+    xHEMM performs one of the matrix-matrix operations
+
+        C = alpha*A*B + beta*C, or
+        C = alpha*B*A + beta*C,
+
+    where alpha and beta are scalars, A is a Hermitian matrix of which only the triangle
+    given by uplo is read, and B and C are m by n matrices.
+    The imaginary parts of the diagonal elements of A are assumed to be zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    side      rocblas_side.
+              rocblas_side_left:  C := alpha*A*B + beta*C, A is m by m.
+              rocblas_side_right: C := alpha*B*A + beta*C, A is n by n.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of A is stored.
+    @param[in]
+    m         rocblas_int.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    B         pointer storing matrix B on the GPU.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of B.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_chemm(rocblas_handle               handle,
+                                            rocblas_side                 side,
+                                            rocblas_fill                 uplo,
+                                            rocblas_int                  m,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            const rocblas_float_complex* B,
+                                            rocblas_int                  ldb,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex*       C,
+                                            rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zhemm(rocblas_handle                handle,
+                                            rocblas_side                  side,
+                                            rocblas_fill                  uplo,
+                                            rocblas_int                   m,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            const rocblas_double_complex* B,
+                                            rocblas_int                   ldb,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex*       C,
+                                            rocblas_int                   ldc);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xHEMM_BATCHED performs one of the matrix-matrix operations
+    for each matrix C_i in a batch
 
-        C = alpha*op( A ) + beta*op( B ),
+        C_i = alpha*A_i*B_i + beta*C_i, or
+        C_i = alpha*B_i*A_i + beta*C_i,
 
-    where op( X ) is one of
+    where alpha and beta are scalars, A is a Hermitian matrix of which only the triangle
+    given by uplo is read, and B and C are m by n matrices.
+    The imaginary parts of the diagonal elements of A are assumed to be zero.
 
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    side      rocblas_side.
+              rocblas_side_left:  C := alpha*A*B + beta*C, A is m by m.
+              rocblas_side_right: C := alpha*B*A + beta*C, A is n by n.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of A is stored.
+    @param[in]
+    m         rocblas_int.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of each A.
+    @param[in]
+    B         device array of device pointers storing each matrix B_i.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of each B.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         device array of device pointers storing each matrix C_i.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of each C.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
 
-    alpha and beta are scalars, and A, B and C are matrices, with
-    op( A ) an m by n matrix, op( B ) an m by n matrix, and C an m by n matrix.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_chemm_batched(rocblas_handle                     handle,
+                                                    rocblas_side                       side,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_int                        m,
+                                                    rocblas_int                        n,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const A[],
+                                                    rocblas_int                        lda,
+                                                    const rocblas_float_complex* const B[],
+                                                    rocblas_int                        ldb,
+                                                    const rocblas_float_complex*       beta,
+                                                    rocblas_float_complex* const       C[],
+                                                    rocblas_int                        ldc,
+                                                    rocblas_int                        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zhemm_batched(rocblas_handle                      handle,
+                                                    rocblas_side                        side,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_int                         m,
+                                                    rocblas_int                         n,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const A[],
+                                                    rocblas_int                         lda,
+                                                    const rocblas_double_complex* const B[],
+                                                    rocblas_int                         ldb,
+                                                    const rocblas_double_complex*       beta,
+                                                    rocblas_double_complex* const       C[],
+                                                    rocblas_int                         ldc,
+                                                    rocblas_int batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xHEMM_STRIDED_BATCHED performs one of the matrix-matrix operations
+    for each matrix C_i in a batch
+
+        C_i = alpha*A_i*B_i + beta*C_i, or
+        C_i = alpha*B_i*A_i + beta*C_i,
+
+    where alpha and beta are scalars, A is a Hermitian matrix of which only the triangle
+    given by uplo is read, and B and C are m by n matrices.
+    The imaginary parts of the diagonal elements of A are assumed to be zero.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    transA    rocblas_operation
-              specifies the form of op( A )
+    side      rocblas_side.
+              rocblas_side_left:  C := alpha*A*B + beta*C, A is m by m.
+              rocblas_side_right: C := alpha*B*A + beta*C, A is n by n.
     @param[in]
-    transB    rocblas_operation
-              specifies the form of op( B )
+    uplo      rocblas_fill.
+              specifies whether the upper or lower triangle of A is stored.
     @param[in]
     m         rocblas_int.
     @param[in]
@@ -4904,52 +9943,73 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgemm_strided_batched(rocblas_handle
     @param[in]
     alpha     specifies the scalar alpha.
     @param[in]
-    A         pointer storing matrix A on the GPU.
+    A         device pointer to the first matrix A_1 on the GPU.
     @param[in]
     lda       rocblas_int
-              specifies the leading dimension of A.
+              specifies the leading dimension of each A.
     @param[in]
-    beta      specifies the scalar beta.
+    stride_A  rocblas_stride
+              stride from the start of one matrix (A_i) and the next one (A_i+1).
     @param[in]
-    B         pointer storing matrix B on the GPU.
+    B         device pointer to the first matrix B_1 on the GPU.
     @param[in]
     ldb       rocblas_int
-              specifies the leading dimension of B.
+              specifies the leading dimension of each B.
+    @param[in]
+    stride_B  rocblas_stride
+              stride from the start of one matrix (B_i) and the next one (B_i+1).
+    @param[in]
+    beta      specifies the scalar beta.
     @param[in, out]
-    C         pointer storing matrix C on the GPU.
+    C         device pointer to the first matrix C_1 on the GPU.
     @param[in]
     ldc       rocblas_int
-              specifies the leading dimension of C.
+              specifies the leading dimension of each C.
+    @param[in]
+    stride_C  rocblas_stride
+              stride from the start of one matrix (C_i) and the next one (C_i+1).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of instances in the batch.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_sgeam(rocblas_handle    handle,
-                                            rocblas_operation transa,
-                                            rocblas_operation transb,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            const float*      alpha,
-                                            const float*      A,
-                                            rocblas_int       lda,
-                                            const float*      beta,
-                                            const float*      B,
-                                            rocblas_int       ldb,
-                                            float*            C,
-                                            rocblas_int       ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_chemm_strided_batched(rocblas_handle               handle,
+                                                            rocblas_side                 side,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_int                  m,
+                                                            rocblas_int                  n,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* A,
+                                                            rocblas_int                  lda,
+                                                            rocblas_stride               stride_A,
+                                                            const rocblas_float_complex* B,
+                                                            rocblas_int                  ldb,
+                                                            rocblas_stride               stride_B,
+                                                            const rocblas_float_complex* beta,
+                                                            rocblas_float_complex*       C,
+                                                            rocblas_int                  ldc,
+                                                            rocblas_stride               stride_C,
+                                                            rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dgeam(rocblas_handle    handle,
-                                            rocblas_operation transa,
-                                            rocblas_operation transb,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            const double*     alpha,
-                                            const double*     A,
-                                            rocblas_int       lda,
-                                            const double*     beta,
-                                            const double*     B,
-                                            rocblas_int       ldb,
-                                            double*           C,
-                                            rocblas_int       ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_zhemm_strided_batched(rocblas_handle                handle,
+                                                            rocblas_side                  side,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_int                   m,
+                                                            rocblas_int                   n,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* A,
+                                                            rocblas_int                   lda,
+                                                            rocblas_stride                stride_A,
+                                                            const rocblas_double_complex* B,
+                                                            rocblas_int                   ldb,
+                                                            rocblas_stride                stride_B,
+                                                            const rocblas_double_complex* beta,
+                                                            rocblas_double_complex*       C,
+                                                            rocblas_int                   ldc,
+                                                            rocblas_stride                stride_C,
+                                                            rocblas_int batch_count);
 
 /*
  * ===========================================================================
@@ -4991,10 +10051,12 @@ ROCBLAS_EXPORT rocblas_status rocblas_dgeam(rocblas_handle    handle,
         - k must be a multiple of 4
         - lda must be a multiple of 4 if transA == rocblas_operation_transpose
         - ldb must be a multiple of 4 if transB == rocblas_operation_none
-        - for transA == rocblas_operation_transpose or transB == rocblas_operation_none the matrices
-   A and B must
-          have each 4 consecutive values in the k dimension packed. This packing can be achieved
-   with the following
+        - for transA == rocblas_operation_none or transB == rocblas_operation_transpose the
+          matrices A and B must have each 4 consecutive values in the k dimension packed, for
+          example with rocblas_pack_int8x4, unless flags contains
+          rocblas_gemm_flags_unpacked_int8, in which case rocBLAS packs A and B in temporary
+          device memory.
+          This packing can be achieved with the following
           pseudo-code. The code assumes the original matrices are in A and B, and the packed
    matrices are A_packed
           and B_packed. The size of the A_packed matrix is the same as the size of the A matrix, and
@@ -5107,7 +10169,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_dgeam(rocblas_handle    handle,
               reserved for future use.
     @param[in]
     flags     uint32_t.
-              reserved for future use.
+              optional rocblas_gemm_flags.
 
     ********************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex(rocblas_handle    handle,
@@ -5221,10 +10283,12 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex(rocblas_handle    handle,
         - k must be a multiple of 4
         - lda must be a multiple of 4 if transA == rocblas_operation_transpose
         - ldb must be a multiple of 4 if transB == rocblas_operation_none
-        - for transA == rocblas_operation_transpose or transB == rocblas_operation_none the matrices
-   A and B must
-          have each 4 consecutive values in the k dimension packed. This packing can be achieved
-   with the following
+        - for transA == rocblas_operation_none or transB == rocblas_operation_transpose the
+          matrices A and B must have each 4 consecutive values in the k dimension packed, for
+          example with rocblas_pack_int8x4, unless flags contains
+          rocblas_gemm_flags_unpacked_int8, in which case rocBLAS packs A and B in temporary
+          device memory.
+          This packing can be achieved with the following
           pseudo-code. The code assumes the original matrices are in A and B, and the packed
    matrices are A_packed
           and B_packed. The size of the A_packed matrix is the same as the size of the A matrix, and
@@ -5339,7 +10403,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex(rocblas_handle    handle,
               reserved for future use.
     @param[in]
     flags     uint32_t.
-              reserved for future use.
+              optional rocblas_gemm_flags.
     ********************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_gemm_batched_ex(rocblas_handle    handle,
                                                       rocblas_operation transA,
@@ -5407,10 +10471,12 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_batched_ex(rocblas_handle    handle,
         - k must be a multiple of 4
         - lda must be a multiple of 4 if transA == rocblas_operation_transpose
         - ldb must be a multiple of 4 if transB == rocblas_operation_none
-        - for transA == rocblas_operation_transpose or transB == rocblas_operation_none the matrices
-   A and B must
-          have each 4 consecutive values in the k dimension packed. This packing can be achieved
-   with the following
+        - for transA == rocblas_operation_none or transB == rocblas_operation_transpose the
+          matrices A and B must have each 4 consecutive values in the k dimension packed, for
+          example with rocblas_pack_int8x4, unless flags contains
+          rocblas_gemm_flags_unpacked_int8, in which case rocBLAS packs A and B in temporary
+          device memory.
+          This packing can be achieved with the following
           pseudo-code. The code assumes the original matrices are in A and B, and the packed
    matrices are A_packed
           and B_packed. The size of the A_packed matrix is the same as the size of the A matrix, and
@@ -5539,7 +10605,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_batched_ex(rocblas_handle    handle,
               reserved for future use.
     @param[in]
     flags     uint32_t.
-              reserved for future use.
+              optional rocblas_gemm_flags.
 
     ********************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_gemm_strided_batched_ex(rocblas_handle    handle,
@@ -5637,6 +10703,86 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_strided_batched_ex(rocblas_handle
 
 // clang-format on
 
+/*! \brief BLAS EX API
+
+    \details
+    PACK_INT8X4 packs an m by k int8 matrix A into the int8x4 layout read by the
+    rocblas_datatype_i8_r gemm_ex functions. Each group of 4 consecutive columns of A is
+    stored row by row:
+
+        A_packed[4*(i + (l/4)*lda) + l%4] = A[i + l*lda]
+
+    Use it for A with transA == rocblas_operation_none, with m the number of rows of A, and for
+    B with transB == rocblas_operation_transpose, with m the number of rows of B (n of gemm_ex).
+    Packing once and calling gemm_ex without rocblas_gemm_flags_unpacked_int8 avoids packing
+    on every gemm_ex call.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    m         rocblas_int.
+              number of rows of A.
+    @param[in]
+    k         rocblas_int.
+              number of columns of A. Must be a multiple of 4.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int.
+              specifies the leading dimension of A and of A_packed.
+    @param[out]
+    A_packed  pointer storing the packed matrix on the GPU. It has the same size as A, and must
+              not overlap A.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_pack_int8x4(rocblas_handle handle,
+                                                  rocblas_int    m,
+                                                  rocblas_int    k,
+                                                  const int8_t*  A,
+                                                  rocblas_int    lda,
+                                                  int8_t*        A_packed);
+
+/*! \brief BLAS EX API
+
+    \details
+    PACK_INT8X4_STRIDED_BATCHED packs batch_count m by k int8 matrices A_i into the int8x4
+    layout read by the rocblas_datatype_i8_r gemm_ex functions. See rocblas_pack_int8x4.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    m         rocblas_int.
+              number of rows of each A_i.
+    @param[in]
+    k         rocblas_int.
+              number of columns of each A_i. Must be a multiple of 4.
+    @param[in]
+    A         pointer storing matrix A_1 on the GPU.
+    @param[in]
+    lda       rocblas_int.
+              specifies the leading dimension of each A_i and of each packed matrix.
+    @param[in]
+    stride_a  rocblas_stride.
+              stride from the start of one A_i matrix to the next, in A and in A_packed.
+    @param[out]
+    A_packed  pointer storing the packed matrices on the GPU. It must not overlap A.
+    @param[in]
+    batch_count
+              rocblas_int.
+              number of instances in the batch.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_pack_int8x4_strided_batched(rocblas_handle handle,
+                                                                  rocblas_int    m,
+                                                                  rocblas_int    k,
+                                                                  const int8_t*  A,
+                                                                  rocblas_int    lda,
+                                                                  rocblas_stride stride_a,
+                                                                  int8_t*        A_packed,
+                                                                  rocblas_int    batch_count);
+
 /*! BLAS EX API
 
     \details
@@ -6112,6 +11258,137 @@ ROCBLAS_EXPORT rocblas_status rocblas_trsm_strided_batched_ex(rocblas_handle
                                                               rocblas_stride    stride_invA,
                                                               rocblas_datatype  compute_type);
 
+/*! BLAS Auxiliary API
+
+    \details
+    rocblas_trsm_workspace_size returns the minimum and optimal sizes of the handle's device
+    memory for rocblas_Xtrsm, rocblas_Xtrsm_batched and rocblas_Xtrsm_strided_batched, and for
+    the _ex functions without a supplied invA. With less than the optimal size, TRSM solves
+    one column (or row) of B at a time and returns rocblas_status_perf_degraded. With less
+    than the minimum size, TRSM returns rocblas_status_memory_error.
+
+    The sizes can be passed to rocblas_set_device_memory_size before the handle is used.
+
+    @param[in]
+    handle  rocblas_handle.
+            handle to the rocblas library context queue.
+
+    @param[in]
+    side    rocblas_side
+            rocblas_side_left or rocblas_side_right.
+
+    @param[in]
+    m       rocblas_int
+            m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       rocblas_int
+            n specifies the number of columns of B. n >= 0.
+
+    @param[in]
+    batch_count rocblas_int
+            number of systems, which is 1 for rocblas_Xtrsm. batch_count >= 0.
+
+    @param[in]
+    compute_type rocblas_datatype
+            rocblas_datatype_f32_r or rocblas_datatype_f64_r.
+
+    @param[out]
+    minimum_size size_t*
+            the minimum size in bytes.
+
+    @param[out]
+    optimal_size size_t*
+            the optimal size in bytes.
+*/
+
+ROCBLAS_EXPORT rocblas_status rocblas_trsm_workspace_size(rocblas_handle   handle,
+                                                          rocblas_side     side,
+                                                          rocblas_int      m,
+                                                          rocblas_int      n,
+                                                          rocblas_int      batch_count,
+                                                          rocblas_datatype compute_type,
+                                                          size_t*          minimum_size,
+                                                          size_t*          optimal_size);
+
+/*! BLAS Auxiliary API
+
+    \details
+    rocblas_trsv_workspace_size returns the minimum and optimal sizes of the handle's device
+    memory for rocblas_Xtrsv, rocblas_Xtrsv_batched and rocblas_Xtrsv_strided_batched, and for
+    the _ex functions without a supplied invA. The two sizes are the same.
+
+    @param[in]
+    handle  rocblas_handle.
+            handle to the rocblas library context queue.
+
+    @param[in]
+    m       rocblas_int
+            m specifies the number of rows of x. m >= 0.
+
+    @param[in]
+    batch_count rocblas_int
+            number of systems, which is 1 for rocblas_Xtrsv. batch_count >= 0.
+
+    @param[in]
+    compute_type rocblas_datatype
+            rocblas_datatype_f32_r or rocblas_datatype_f64_r.
+
+    @param[out]
+    minimum_size size_t*
+            the minimum size in bytes.
+
+    @param[out]
+    optimal_size size_t*
+            the optimal size in bytes.
+*/
+
+ROCBLAS_EXPORT rocblas_status rocblas_trsv_workspace_size(rocblas_handle   handle,
+                                                          rocblas_int      m,
+                                                          rocblas_int      batch_count,
+                                                          rocblas_datatype compute_type,
+                                                          size_t*          minimum_size,
+                                                          size_t*          optimal_size);
+
+/*! BLAS Auxiliary API
+
+    \details
+    rocblas_trtri_workspace_size returns the minimum and optimal sizes of the handle's device
+    memory for rocblas_Xtrtri, rocblas_Xtrtri_batched and rocblas_Xtrtri_strided_batched. The
+    two sizes are the same.
+
+    @param[in]
+    handle  rocblas_handle.
+            handle to the rocblas library context queue.
+
+    @param[in]
+    n       rocblas_int
+            n specifies the number of rows and columns of A. n >= 0.
+
+    @param[in]
+    batch_count rocblas_int
+            number of matrices, which is 1 for rocblas_Xtrtri. batch_count >= 0.
+
+    @param[in]
+    compute_type rocblas_datatype
+            rocblas_datatype_f32_r or rocblas_datatype_f64_r.
+
+    @param[out]
+    minimum_size size_t*
+            the minimum size in bytes.
+
+    @param[out]
+    optimal_size size_t*
+            the optimal size in bytes.
+*/
+
+ROCBLAS_EXPORT rocblas_status rocblas_trtri_workspace_size(rocblas_handle   handle,
+                                                           rocblas_int      n,
+                                                           rocblas_int      batch_count,
+                                                           rocblas_datatype compute_type,
+                                                           size_t*          minimum_size,
+                                                           size_t*          optimal_size);
+
 /*! BLAS Auxiliary API
 
     \details
@@ -27,6 +27,21 @@
  */
 typedef struct _rocblas_handle* rocblas_handle;
 
+/*! \brief rocblas_trsm_factor is an opaque structure holding the inverted diagonal blocks
+ * of a triangular matrix, for reuse by several triangular solves.
+ * It is created by rocblas_<type>trsm_prepare(), used by rocblas_<type>trsm_solve(),
+ * and must be destroyed with rocblas_destroy_trsm_factor().
+ */
+typedef struct _rocblas_trsm_factor* rocblas_trsm_factor;
+
+/*! \brief rocblas_ger_accumulator is an opaque structure collecting rank-1 updates of a matrix,
+ * which are applied together as one matrix multiplication.
+ * It is created by rocblas_<type>ger_accumulator_create(), updated by
+ * rocblas_<type>ger_accumulate(), applied by rocblas_ger_accumulator_flush(),
+ * and must be destroyed with rocblas_destroy_ger_accumulator().
+ */
+typedef struct _rocblas_ger_accumulator* rocblas_ger_accumulator;
+
 // Forward declaration of hipStream_t
 typedef struct ihipStream_t* hipStream_t;
 
@@ -165,4 +180,22 @@ typedef enum rocblas_gemm_algo_
     rocblas_gemm_algo_standard = 0b0000000000,
 } rocblas_gemm_algo;
 
+/*! \brief Control flags passed to the gemm_ex functions */
+typedef enum rocblas_gemm_flags_
+{
+    rocblas_gemm_flags_none = 0x0,
+    /*! For rocblas_datatype_i8_r inputs, A and B are unpacked column-major int8, and rocBLAS
+        packs them in temporary device memory. Otherwise A and B must already be packed int8x4,
+        for example with rocblas_pack_int8x4. */
+    rocblas_gemm_flags_unpacked_int8 = 0x1,
+} rocblas_gemm_flags;
+
+/*! \brief Indicates whether single precision GEMMs may use reduced precision arithmetic */
+typedef enum rocblas_math_mode_
+{
+    rocblas_default_math     = 0, /**< Use the precision of the data type. */
+    rocblas_xf32_bf16x3_math = 1, /**< Emulate FP32 GEMM with three bfloat16 products,
+                                       accumulated in FP32. */
+} rocblas_math_mode;
+
 #endif
@@ -47,8 +47,9 @@
 // As you may see, if there is a mechanism to synchronize all the thread blocks
 // after local index is obtained in kernel 1 (without ending the kernel), then
 // Kernel 2's computation can be merged into Kernel 1. One such mechanism is called
-// atomic operation. However, atomic operation is new and is not used in rocBLAS
-// yet. rocBLAS still use the classic standard parallel reduction right now.
+// atomic operation. The Level 1 routines merge the two kernels with an atomic
+// ticket taken by each thread block; see reduction_strided_batched.h. The two
+// kernels below remain for the classic standard parallel reduction.
 
 // Recursively compute reduction
 template <rocblas_int k, typename REDUCE, typename T>
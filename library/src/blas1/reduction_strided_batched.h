@@ -4,6 +4,8 @@
 #include "handle.h"
 #include "rocblas.h"
 #include "utility.h"
+#include <algorithm>
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
@@ -47,32 +49,57 @@
 //
 // As you may see, if there is a mechanism to synchronize all the thread blocks
 // after local index is obtained in kernel 1 (without ending the kernel), then
-// Kernel 2's computation can be merged into Kernel 1. One such mechanism is called
-// atomic operation. However, atomic operation is new and is not used in rocBLAS
-// yet. rocBLAS still use the classic standard parallel reduction right now.
+// Kernel 2's computation can be merged into Kernel 1. rocBLAS uses an atomic
+// ticket for this: after writing its partial result, each thread block takes a
+// ticket with atomicAdd, and the thread block which takes the last ticket of its
+// batch knows that all of the partial results are in the working buffer, and
+// finishes the reduction in place of Kernel 2. The tickets belong to the handle
+// and the last thread block resets its ticket, so no launch is spent clearing
+// them. The two kernel scheme remains for batch counts beyond the number of
+// tickets.
+//
+// The number of thread blocks is capped at REDUCTION_MAX_BLOCKS per batch, and each
+// thread accumulates the elements tid, tid + threads, ... of the vector in a
+// register before the parallel reduction, so a large vector does not need a
+// partial result per NB elements. Unit stride vectors are read with 16 byte loads.
+// Within the thread block, each wavefront reduces with shuffles and only the
+// results of the wavefronts go through shared memory.
+
+// Lanes of a wavefront, which exchange values with shuffles rather than shared memory. This is
+// the wavefront size of the target the device code is compiled for, 32 on wave32 targets and 64
+// otherwise, so each target of a multi-target build reduces with its own wavefront size.
+#ifdef __AMDGCN_WAVEFRONT_SIZE
+constexpr rocblas_int REDUCTION_WAVEFRONT_SIZE = __AMDGCN_WAVEFRONT_SIZE;
+#else
+constexpr rocblas_int REDUCTION_WAVEFRONT_SIZE = 64;
+#endif
 
-// Recursively compute reduction
-template <rocblas_int k, typename REDUCE, typename T>
-struct rocblas_reduction_s
-{
-    __forceinline__ __device__ void operator()(rocblas_int tx, T* x)
-    {
-        // Reduce the lower half with the upper half
-        if(tx < k)
-            REDUCE{}(x[tx], x[tx + k]);
-        __syncthreads();
+// Upper bound on the thread blocks of each batch; the threads loop over the vector, so a few
+// thread blocks per compute unit are enough to keep memory busy
+constexpr rocblas_int REDUCTION_MAX_BLOCKS = 512;
 
-        // Recurse down with k / 2
-        rocblas_reduction_s<k / 2, REDUCE, T>{}(tx, x);
-    }
-};
+// Reads var from the lane delta above, moving any type as 32-bit words
+template <typename T>
+__forceinline__ __device__ T rocblas_shfl_down(const T& var, rocblas_int delta)
+{
+    constexpr rocblas_int WORDS = (sizeof(T) + sizeof(int) - 1) / sizeof(int);
+
+    int words[WORDS];
+    T   res;
+    __builtin_memcpy(words, &var, sizeof(T));
+    for(rocblas_int i = 0; i < WORDS; i++)
+        words[i] = __shfl_down(words[i], delta);
+    __builtin_memcpy(&res, words, sizeof(T));
+    return res;
+}
 
-// leaf node for terminating recursion
-template <typename REDUCE, typename T>
-struct rocblas_reduction_s<0, REDUCE, T>
+// Reduces the values of the first N lanes of each wavefront into its first lane
+template <rocblas_int N, typename REDUCE, typename T>
+__forceinline__ __device__ void rocblas_wavefront_reduction(T& val)
 {
-    __forceinline__ __device__ void operator()(rocblas_int tx, T* x) {}
-};
+    for(rocblas_int offset = N / 2; offset > 0; offset /= 2)
+        REDUCE{}(val, rocblas_shfl_down(val, offset));
+}
 
 /*! \brief general parallel reduction
 
@@ -89,14 +116,36 @@ struct rocblas_reduction_s<0, REDUCE, T>
     @param[inout]
     x         pointer storing vector x on the GPU.
               usually x is stored in shared memory;
-              x[0] store the final result.
+              x[tx] is read by thread tx only, and
+              x[0] store the final result for thread 0.
     ********************************************************************/
 template <rocblas_int NB, typename REDUCE, typename T>
 __attribute__((flatten)) __device__ void rocblas_reduction(rocblas_int tx, T* x)
 {
     static_assert(NB > 1 && !(NB & (NB - 1)), "NB must be a power of 2");
-    __syncthreads();
-    rocblas_reduction_s<NB / 2, REDUCE, T>{}(tx, x);
+    constexpr rocblas_int WF = NB < REDUCTION_WAVEFRONT_SIZE ? NB : REDUCTION_WAVEFRONT_SIZE;
+    static_assert(NB <= WF * WF, "The results of the wavefronts must fit in one wavefront");
+
+    T val = x[tx];
+    rocblas_wavefront_reduction<WF, REDUCE>(val);
+
+    if(NB > WF)
+    {
+        // The first wavefront reduces the results of the wavefronts
+        __syncthreads();
+        if(tx % WF == 0)
+            x[tx / WF] = val;
+        __syncthreads();
+
+        if(tx < WF)
+        {
+            val = x[tx];
+            rocblas_wavefront_reduction<NB / WF, REDUCE>(val);
+        }
+    }
+
+    if(tx == 0)
+        x[0] = val;
 }
 
 /*! \brief parallel reduction: sum
@@ -152,7 +201,54 @@ inline size_t rocblas_reduction_kernel_block_count(rocblas_int n, rocblas_int NB
 {
     if(n <= 0)
         n = 1; // avoid sign loss issues
-    return size_t(n - 1) / NB + 1;
+    return std::min(size_t(n - 1) / NB + 1, size_t(REDUCTION_MAX_BLOCKS));
+}
+
+// Vector of N contiguous elements, read with one 16 byte load
+template <typename T, rocblas_int N = (sizeof(T) < 16 ? 16 / sizeof(T) : 1)>
+struct alignas(sizeof(T) * N) rocblas_reduction_vector
+{
+    static constexpr rocblas_int size = N;
+
+    T data[N];
+};
+
+// Whether x can be read as rocblas_reduction_vector<T>
+template <typename T>
+__forceinline__ __device__ bool rocblas_reduction_vector_aligned(const T* x)
+{
+    return rocblas_reduction_vector<T>::size > 1
+           && !(uintptr_t(x) % sizeof(rocblas_reduction_vector<T>));
+}
+
+// Accumulates the elements tid, tid + nthreads, ... of x into the value of one thread, reading
+// contiguous elements with vector loads when incx is 1
+template <typename FETCH, typename REDUCE, typename To, typename Ti>
+__forceinline__ __device__ To rocblas_reduction_grid_stride(
+    rocblas_int n, const Ti* x, rocblas_int incx, ptrdiff_t tid, ptrdiff_t nthreads)
+{
+    using VX = rocblas_reduction_vector<Ti>;
+
+    To        sum = rocblas_default_value<To>{}();
+    ptrdiff_t i   = 0;
+
+    if(incx == 1 && rocblas_reduction_vector_aligned(x))
+    {
+        ptrdiff_t nvec = n / VX::size;
+        for(ptrdiff_t j = tid; j < nvec; j += nthreads)
+        {
+            VX xv = ((const VX*)x)[j];
+            for(rocblas_int k = 0; k < VX::size; k++)
+                REDUCE{}(sum, FETCH{}(xv.data[k], j * VX::size + k));
+        }
+        i = nvec * VX::size;
+    }
+
+    // remaining elements, and all of them for non-unit strides
+    for(i += tid; i < n; i += nthreads)
+        REDUCE{}(sum, FETCH{}(x[i * incx], i));
+
+    return sum;
 }
 
 /*! \brief rocblas_reduction_batched_kernel_workspace_size
@@ -216,11 +312,8 @@ __global__ void
 
     const auto* x = load_ptr_batch(xvec, hipBlockIdx_y, shiftx, stridex);
 
-    // bound
-    if(tid < n)
-        tmp[tx] = FETCH{}(x[tid * incx], tid);
-    else
-        tmp[tx] = rocblas_default_value<To>{}(); // pad with default value
+    tmp[tx] = rocblas_reduction_grid_stride<FETCH, REDUCE, To>(
+        n, x, incx, tid, ptrdiff_t(hipGridDim_x) * NB);
 
     rocblas_reduction<NB, REDUCE>(tx, tmp);
 
@@ -228,25 +321,15 @@ __global__ void
         workspace[hipBlockIdx_y * nblocks + hipBlockIdx_x] = tmp[0];
 }
 
-// kernel 2 is used from non-strided reduction_batched see include file
-// kernel 2 gathers all the partial results in workspace and finishes the final reduction;
-// number of threads (NB) loop blocks
-template <rocblas_int NB,
-          typename REDUCE   = rocblas_reduce_sum,
-          typename FINALIZE = rocblas_finalize_identity,
-          typename To,
-          typename Tr>
-__attribute__((amdgpu_flat_work_group_size((NB < 128) ? NB : 128, (NB > 256) ? NB : 256)))
-__global__ void
-    rocblas_reduction_strided_batched_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
+// Gathers the nblocks partial results in work with the NB threads of one thread block and
+// stores the finalized result; tmp is the shared memory of the thread block
+template <rocblas_int NB, typename REDUCE, typename FINALIZE, typename To, typename Tr>
+__device__ void rocblas_reduction_strided_batched_finish(
+    rocblas_int tx, rocblas_int nblocks, const To* work, To* tmp, Tr* result)
 {
-    rocblas_int   tx = hipThreadIdx_x;
-    __shared__ To tmp[NB];
-
     if(tx < nblocks)
     {
-        To* work = workspace + hipBlockIdx_y * nblocks;
-        tmp[tx]  = work[tx];
+        tmp[tx] = work[tx];
 
         // bound, loop
         for(rocblas_int i = tx + NB; i < nblocks; i += NB)
@@ -274,7 +357,94 @@ __global__ void
 
     // Store result on device or in workspace
     if(tx == 0)
-        result[hipBlockIdx_y] = Tr(FINALIZE{}(tmp[0]));
+        *result = Tr(FINALIZE{}(tmp[0]));
+}
+
+// Ends a single-pass reduction once tmp[0] holds the partial result of this thread block.
+// The partial result is written to workspace, and the thread block taking the last ticket of
+// its batch finishes the reduction and resets the ticket to zero for the next call.
+template <rocblas_int NB, typename REDUCE, typename FINALIZE, typename To, typename Tr>
+__device__ void rocblas_reduction_strided_batched_single_pass_end(
+    rocblas_int tx, rocblas_int nblocks, To* tmp, To* workspace, rocblas_int* tickets, Tr* result)
+{
+    __shared__ bool last;
+
+    To* work = workspace + size_t(hipBlockIdx_y) * nblocks;
+
+    if(tx == 0)
+    {
+        work[hipBlockIdx_x] = tmp[0];
+
+        // Make the partial result visible to the other thread blocks before taking a ticket
+        __threadfence();
+        last = nblocks == 1 || atomicAdd(tickets + hipBlockIdx_y, 1) == nblocks - 1;
+    }
+    __syncthreads();
+
+    if(!last)
+        return;
+
+    // Make the partial results of the other thread blocks visible to this one
+    __threadfence();
+
+    if(tx == 0 && nblocks > 1)
+        tickets[hipBlockIdx_y] = 0;
+
+    rocblas_reduction_strided_batched_finish<NB, REDUCE, FINALIZE>(
+        tx, nblocks, work, tmp, result + hipBlockIdx_y);
+}
+
+// single-pass kernel: kernel 1 followed by kernel 2 in the last thread block of each batch
+template <rocblas_int NB,
+          typename FETCH,
+          typename REDUCE   = rocblas_reduce_sum,
+          typename FINALIZE = rocblas_finalize_identity,
+          typename TPtrX,
+          typename To,
+          typename Tr>
+__attribute__((amdgpu_flat_work_group_size((NB < 128) ? NB : 128, (NB > 256) ? NB : 256)))
+__global__ void
+    rocblas_reduction_strided_batched_kernel_single_pass(rocblas_int    n,
+                                                         rocblas_int    nblocks,
+                                                         TPtrX          xvec,
+                                                         rocblas_int    shiftx,
+                                                         rocblas_int    incx,
+                                                         rocblas_stride stridex,
+                                                         To*            workspace,
+                                                         rocblas_int*   tickets,
+                                                         Tr*            result)
+{
+    ptrdiff_t     tx  = hipThreadIdx_x;
+    ptrdiff_t     tid = hipBlockIdx_x * hipBlockDim_x + tx;
+    __shared__ To tmp[NB];
+
+    const auto* x = load_ptr_batch(xvec, hipBlockIdx_y, shiftx, stridex);
+
+    tmp[tx] = rocblas_reduction_grid_stride<FETCH, REDUCE, To>(
+        n, x, incx, tid, ptrdiff_t(hipGridDim_x) * NB);
+
+    rocblas_reduction<NB, REDUCE>(tx, tmp);
+
+    rocblas_reduction_strided_batched_single_pass_end<NB, REDUCE, FINALIZE>(
+        tx, nblocks, tmp, workspace, tickets, result);
+}
+
+// kernel 2 is used from non-strided reduction_batched see include file
+// kernel 2 gathers all the partial results in workspace and finishes the final reduction;
+// number of threads (NB) loop blocks
+template <rocblas_int NB,
+          typename REDUCE   = rocblas_reduce_sum,
+          typename FINALIZE = rocblas_finalize_identity,
+          typename To,
+          typename Tr>
+__attribute__((amdgpu_flat_work_group_size((NB < 128) ? NB : 128, (NB > 256) ? NB : 256)))
+__global__ void
+    rocblas_reduction_strided_batched_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
+{
+    __shared__ To tmp[NB];
+
+    rocblas_reduction_strided_batched_finish<NB, REDUCE, FINALIZE>(
+        hipThreadIdx_x, nblocks, workspace + hipBlockIdx_y * nblocks, tmp, result + hipBlockIdx_y);
 }
 
 /*! \brief
@@ -282,7 +452,8 @@ __global__ void
     \details
     rocblas_reduction_strided_batched_kernel computes a reduction over multiple vectors x_i
               Template parameters allow threads per block, data, and specific phase kernel overrides
-              At least two kernels are needed to finish the reduction
+              A single kernel finishes the reduction when the handle has a ticket for each batch;
+              otherwise two kernels are needed to finish the reduction
               kernel 1 write partial result per thread block in workspace, blocks partial results
               kernel 2 gathers all the partial result in workspace and finishes the final reduction.
     @param[in]
@@ -334,6 +505,36 @@ rocblas_status rocblas_reduction_strided_batched_kernel(rocblas_handle __restric
 {
     rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
 
+    if(batch_count <= handle->REDUCTION_TICKET_COUNT)
+    {
+        // If in host pointer mode, the results are placed in workspace after the partial
+        // results, and then copied from device to host.
+        bool host_mode = handle->pointer_mode == rocblas_pointer_mode_host;
+        Tr*  output    = host_mode ? (Tr*)(workspace + size_t(batch_count) * blocks) : result;
+
+        hipLaunchKernelGGL(
+            (rocblas_reduction_strided_batched_kernel_single_pass<NB, FETCH, REDUCE, FINALIZE>),
+            dim3(blocks, batch_count),
+            NB,
+            0,
+            handle->rocblas_stream,
+            n,
+            blocks,
+            x,
+            shiftx,
+            incx,
+            stridex,
+            workspace,
+            handle->reduction_tickets,
+            output);
+
+        if(host_mode)
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(result, output, batch_count * sizeof(Tr), hipMemcpyDeviceToHost));
+
+        return rocblas_status_success;
+    }
+
     hipLaunchKernelGGL((rocblas_reduction_strided_batched_kernel_part1<NB, FETCH, REDUCE>),
                        dim3(blocks, batch_count),
                        NB,
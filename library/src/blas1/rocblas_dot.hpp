@@ -7,38 +7,71 @@
 #include "rocblas.h"
 #include "utility.h"
 
-template <rocblas_int NB, bool CONJ, typename T, typename U, typename V = T>
-__global__ void dot_kernel_part1(rocblas_int    n,
-                                 const U        xa,
-                                 ptrdiff_t      shiftx,
-                                 rocblas_int    incx,
-                                 rocblas_stride stridex,
-                                 const U        ya,
-                                 ptrdiff_t      shifty,
-                                 rocblas_int    incy,
-                                 rocblas_int    stridey,
-                                 V*             workspace)
+template <bool CONJ, typename V, typename T>
+__forceinline__ __device__ V dot_mul(const T& x, const T& y)
+{
+    return V(y) * V(CONJ ? conj(x) : x);
+}
+
+// Each thread accumulates the products tid, tid + threads, ... in a grid-stride loop, reading
+// unit stride vectors with vector loads.
+// With tickets, the last thread block of each batch finishes the reduction into result;
+// without them, the partial results are left in workspace for kernel part2
+template <rocblas_int NB, bool CONJ, typename T, typename U, typename V = T, typename Tr>
+__global__ void dot_kernel(rocblas_int    n,
+                           const U        xa,
+                           ptrdiff_t      shiftx,
+                           rocblas_int    incx,
+                           rocblas_stride stridex,
+                           const U        ya,
+                           ptrdiff_t      shifty,
+                           rocblas_int    incy,
+                           rocblas_int    stridey,
+                           V*             workspace,
+                           rocblas_int*   tickets,
+                           Tr*            result)
 {
-    ptrdiff_t tx  = hipThreadIdx_x;
-    ptrdiff_t tid = hipBlockIdx_x * hipBlockDim_x + tx;
+    using VX = rocblas_reduction_vector<T>;
+
+    ptrdiff_t tx       = hipThreadIdx_x;
+    ptrdiff_t tid      = hipBlockIdx_x * hipBlockDim_x + tx;
+    ptrdiff_t nthreads = ptrdiff_t(hipGridDim_x) * NB;
 
     __shared__ V tmp[NB];
-    const T*     x;
-    const T*     y;
+    const T*     x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
+    const T*     y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+    V            sum(0);
+    ptrdiff_t    i = 0;
 
-    // bound
-    if(tid < n)
+    if(incx == 1 && incy == 1 && rocblas_reduction_vector_aligned(x)
+       && rocblas_reduction_vector_aligned(y))
     {
-        x       = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
-        y       = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
-        tmp[tx] = V(y[tid * incy]) * V(CONJ ? conj(x[tid * incx]) : x[tid * incx]);
+        ptrdiff_t nvec = n / VX::size;
+        for(ptrdiff_t j = tid; j < nvec; j += nthreads)
+        {
+            VX xv = ((const VX*)x)[j];
+            VX yv = ((const VX*)y)[j];
+            for(rocblas_int k = 0; k < VX::size; k++)
+                sum += dot_mul<CONJ, V>(xv.data[k], yv.data[k]);
+        }
+        i = nvec * VX::size;
     }
-    else
-        tmp[tx] = V(0); // pad with zero
 
+    // remaining elements, and all of them for non-unit strides
+    for(i += tid; i < n; i += nthreads)
+        sum += dot_mul<CONJ, V>(x[i * incx], y[i * incy]);
+
+    tmp[tx] = sum;
     rocblas_sum_reduce<NB>(tx, tmp);
 
-    if(tx == 0)
+    if(tickets)
+    {
+        rocblas_reduction_strided_batched_single_pass_end<NB,
+                                                          rocblas_reduce_sum,
+                                                          rocblas_finalize_identity>(
+            tx, hipGridDim_x, tmp, workspace, tickets, result);
+    }
+    else if(tx == 0)
         workspace[hipBlockIdx_x + hipBlockIdx_y * hipGridDim_x] = tmp[0];
 }
 
@@ -59,7 +92,8 @@ rocblas_status rocblas_dot_template(rocblas_handle __restrict__ handle,
                                     T*             results,
                                     V*             workspace)
 {
-    // At least two kernels are needed to finish the reduction
+    // A single kernel finishes the reduction when the handle has a ticket for each batch.
+    // Otherwise at least two kernels are needed to finish the reduction
     // kennel 1 write partial results per thread block in workspace, number of partial results is
     // blocks
     // kernel 2 gather all the partial results in workspace and finish the final reduction. number of
@@ -91,7 +125,61 @@ rocblas_status rocblas_dot_template(rocblas_handle __restrict__ handle,
     dim3        grid(blocks, batch_count);
     dim3        threads(NB);
 
-    hipLaunchKernelGGL((dot_kernel_part1<NB, CONJ, T>),
+    if(batch_count <= handle->REDUCTION_TICKET_COUNT)
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((dot_kernel<NB, CONJ, T>),
+                               grid,
+                               threads,
+                               0,
+                               handle->rocblas_stream,
+                               n,
+                               x,
+                               shiftx,
+                               incx,
+                               stridex,
+                               y,
+                               shifty,
+                               incy,
+                               stridey,
+                               workspace,
+                               handle->reduction_tickets,
+                               results);
+            return rocblas_status_success;
+        }
+
+        // In host pointer mode, the results are placed in workspace after the partial results,
+        // and then copied from device to host
+        V* output = workspace + size_t(batch_count) * blocks;
+
+        hipLaunchKernelGGL((dot_kernel<NB, CONJ, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           n,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           workspace,
+                           handle->reduction_tickets,
+                           output);
+
+        V res_V[batch_count];
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(res_V, output, sizeof(V) * batch_count, hipMemcpyDeviceToHost));
+        for(rocblas_int i = 0; i < batch_count; i++)
+            results[i] = T(res_V[i]);
+        return rocblas_status_success;
+    }
+
+    hipLaunchKernelGGL((dot_kernel<NB, CONJ, T>),
                        grid,
                        threads,
                        0,
@@ -105,7 +193,9 @@ rocblas_status rocblas_dot_template(rocblas_handle __restrict__ handle,
                        shifty,
                        incy,
                        stridey,
-                       workspace);
+                       workspace,
+                       (rocblas_int*)nullptr,
+                       (V*)nullptr);
 
     if(handle->pointer_mode == rocblas_pointer_mode_device)
     {
@@ -477,4 +477,359 @@ __global__ void gemvt_kernel(rocblas_int    m,
     gemvt_kernel_calc<NB_X>(m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+// Partial sums over the chunk of columns hipBlockIdx_y * chunk, without alpha and beta, are
+// written to column hipBlockIdx_y of the m x splits workspace of each batch
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T, typename V>
+__global__ void gemvn_split_kernel(rocblas_int    m,
+                                   rocblas_int    n,
+                                   rocblas_int    chunk,
+                                   const V*       Aa,
+                                   ptrdiff_t      shifta,
+                                   rocblas_int    lda,
+                                   rocblas_stride strideA,
+                                   const V*       xa,
+                                   ptrdiff_t      shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_stride stridex,
+                                   T*             workspace)
+{
+    rocblas_int num_threads = hipBlockDim_x * hipBlockDim_y * hipBlockDim_z;
+    if(DIM_X * DIM_Y != num_threads)
+        return; // need to launch exactly the same number of threads as template parameters indicate
+
+    const T* A = load_ptr_batch(Aa, hipBlockIdx_z, shifta, strideA);
+    const T* x = load_ptr_batch(xa, hipBlockIdx_z, shiftx, stridex);
+
+    rocblas_int col = hipBlockIdx_y * chunk;
+    rocblas_int len = n - col < chunk ? n - col : chunk;
+    workspace += (ptrdiff_t(hipBlockIdx_z) * hipGridDim_y + hipBlockIdx_y) * m;
+
+    gemvn_kernel_calc<DIM_X, DIM_Y>(m,
+                                    len,
+                                    T(1),
+                                    A + ptrdiff_t(col) * lda,
+                                    lda,
+                                    x + ptrdiff_t(col) * incx,
+                                    incx,
+                                    T(0),
+                                    workspace,
+                                    1);
+}
+
+// Partial sums over the chunk of rows hipBlockIdx_y * chunk, without alpha and beta, are
+// written to column hipBlockIdx_y of the n x splits workspace of each batch
+template <rocblas_int NB_X, bool CONJ, typename T, typename V>
+__global__ void gemvt_split_kernel(rocblas_int    m,
+                                   rocblas_int    n,
+                                   rocblas_int    chunk,
+                                   const V*       Aa,
+                                   ptrdiff_t      shifta,
+                                   rocblas_int    lda,
+                                   rocblas_stride strideA,
+                                   const V*       xa,
+                                   ptrdiff_t      shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_stride stridex,
+                                   T*             workspace)
+{
+    const T* A = load_ptr_batch(Aa, hipBlockIdx_z, shifta, strideA);
+    const T* x = load_ptr_batch(xa, hipBlockIdx_z, shiftx, stridex);
+
+    rocblas_int row = hipBlockIdx_y * chunk;
+    rocblas_int len = m - row < chunk ? m - row : chunk;
+    workspace += (ptrdiff_t(hipBlockIdx_z) * hipGridDim_y + hipBlockIdx_y) * n;
+
+    if(CONJ)
+        gemvc_kernel_calc<NB_X>(
+            len, n, T(1), A + row, lda, x + ptrdiff_t(row) * incx, incx, T(0), workspace, 1);
+    else
+        gemvt_kernel_calc<NB_X>(
+            len, n, T(1), A + row, lda, x + ptrdiff_t(row) * incx, incx, T(0), workspace, 1);
+}
+
+// y = alpha * (sum of the splits partial sums) + beta * y, for the len elements of y
+template <rocblas_int NB, typename T, typename U, typename W>
+__global__ void gemv_split_reduce_kernel(rocblas_int    len,
+                                         rocblas_int    splits,
+                                         U              alpha_device_host,
+                                         rocblas_stride stride_alpha,
+                                         U              beta_device_host,
+                                         rocblas_stride stride_beta,
+                                         const T*       workspace,
+                                         W*             ya,
+                                         ptrdiff_t      shifty,
+                                         rocblas_int    incy,
+                                         rocblas_stride stridey)
+{
+    rocblas_int i = hipBlockIdx_x * NB + hipThreadIdx_x;
+    if(i >= len)
+        return;
+
+    T* y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+
+    auto alpha = load_scalar(alpha_device_host, hipBlockIdx_y, stride_alpha);
+    auto beta  = load_scalar(beta_device_host, hipBlockIdx_y, stride_beta);
+
+    workspace += ptrdiff_t(hipBlockIdx_y) * splits * len + i;
+
+    T sum = 0;
+    for(rocblas_int s = 0; s < splits; s++)
+        sum += workspace[ptrdiff_t(s) * len];
+
+    if(beta != 0)
+        y[i * incy] = alpha * sum + beta * y[i * incy];
+    else
+        y[i * incy] = alpha * sum;
+}
+
+// GEMV with up to K vectors x_j and y_j, ldx and ldy elements apart, for k <= K. Each element of
+// A is read once and multiplied by all of the vectors, keeping k partial sums per thread.
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int K,
+          typename T,
+          typename U,
+          typename V,
+          typename W>
+__global__ void gemvn_multi_kernel(rocblas_int    m,
+                                   rocblas_int    n,
+                                   rocblas_int    k,
+                                   U              alpha_device_host,
+                                   const V*       Aa,
+                                   ptrdiff_t      shifta,
+                                   rocblas_int    lda,
+                                   rocblas_stride strideA,
+                                   const V*       xa,
+                                   ptrdiff_t      shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_int    ldx,
+                                   rocblas_stride stridex,
+                                   U              beta_device_host,
+                                   W*             ya,
+                                   ptrdiff_t      shifty,
+                                   rocblas_int    incy,
+                                   rocblas_int    ldy,
+                                   rocblas_stride stridey)
+{
+    __shared__ T sdata[DIM_Y][DIM_X];
+
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int ty  = hipThreadIdx_y;
+    rocblas_int row = hipBlockIdx_x * DIM_X + tx;
+
+    const T* A = load_ptr_batch(Aa, hipBlockIdx_y, shifta, strideA);
+    const T* x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
+    T*       y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    T sum[K];
+    for(rocblas_int j = 0; j < K; j++)
+        sum[j] = 0;
+
+    if(row < m)
+    {
+        for(rocblas_int col = ty; col < n; col += DIM_Y)
+        {
+            T a = A[row + ptrdiff_t(col) * lda];
+            for(rocblas_int j = 0; j < K; j++)
+                if(j < k)
+                    sum[j] += a * x[j * ptrdiff_t(ldx) + col * ptrdiff_t(incx)];
+        }
+    }
+
+    // Reduce the DIM_Y partial sums of each vector
+    for(rocblas_int j = 0; j < K && j < k; j++)
+    {
+        sdata[ty][tx] = sum[j];
+        __syncthreads();
+
+        if(ty == 0 && row < m)
+        {
+            T res = sdata[0][tx];
+            for(rocblas_int l = 1; l < DIM_Y; l++)
+                res += sdata[l][tx];
+
+            T& yj = y[j * ptrdiff_t(ldy) + row * ptrdiff_t(incy)];
+            yj    = beta != 0 ? alpha * res + beta * yj : alpha * res;
+        }
+        __syncthreads();
+    }
+}
+
+// Transposed GEMV with up to K vectors, with one workgroup per column of A
+template <rocblas_int NB_X,
+          bool CONJ,
+          rocblas_int K,
+          typename T,
+          typename U,
+          typename V,
+          typename W>
+__global__ void gemvt_multi_kernel(rocblas_int    m,
+                                   rocblas_int    n,
+                                   rocblas_int    k,
+                                   U              alpha_device_host,
+                                   const V*       Aa,
+                                   ptrdiff_t      shifta,
+                                   rocblas_int    lda,
+                                   rocblas_stride strideA,
+                                   const V*       xa,
+                                   ptrdiff_t      shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_int    ldx,
+                                   rocblas_stride stridex,
+                                   U              beta_device_host,
+                                   W*             ya,
+                                   ptrdiff_t      shifty,
+                                   rocblas_int    incy,
+                                   rocblas_int    ldy,
+                                   rocblas_stride stridey)
+{
+    __shared__ T sdata[NB_X];
+
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int col = hipBlockIdx_x;
+
+    const T* A = load_ptr_batch(Aa, hipBlockIdx_y, shifta, strideA);
+    const T* x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
+    T*       y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    A += ptrdiff_t(col) * lda;
+
+    T sum[K];
+    for(rocblas_int j = 0; j < K; j++)
+        sum[j] = 0;
+
+    for(rocblas_int i = tx; i < m; i += NB_X)
+    {
+        T a = CONJ ? conj(A[i]) : A[i];
+        for(rocblas_int j = 0; j < K; j++)
+            if(j < k)
+                sum[j] += a * x[j * ptrdiff_t(ldx) + i * ptrdiff_t(incx)];
+    }
+
+    // sdata[0] is only read by thread 0 after each reduction, so it may be refilled at once
+    for(rocblas_int j = 0; j < K && j < k; j++)
+    {
+        sdata[tx] = sum[j];
+        rocblas_sum_reduce<NB_X>(tx, sdata);
+
+        if(tx == 0)
+        {
+            T& yj = y[j * ptrdiff_t(ldy) + col * ptrdiff_t(incy)];
+            yj    = beta != 0 ? alpha * sdata[0] + beta * yj : alpha * sdata[0];
+        }
+    }
+}
+
+// GEMV of matrices with at most DIM_X rows, with DIM_X lanes for each matrix and DIM_Y matrices
+// per workgroup. Lane tx computes row tx, reading A a column at a time so that the loads of the
+// lanes are coalesced, and keeps its sum in a register.
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T, typename U, typename V, typename W>
+__global__ void gemvn_small_kernel(rocblas_int    m,
+                                   rocblas_int    n,
+                                   U              alpha_device_host,
+                                   rocblas_stride stride_alpha,
+                                   const V*       Aa,
+                                   ptrdiff_t      shifta,
+                                   rocblas_int    lda,
+                                   rocblas_stride strideA,
+                                   const V*       xa,
+                                   ptrdiff_t      shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_stride stridex,
+                                   U              beta_device_host,
+                                   rocblas_stride stride_beta,
+                                   W*             ya,
+                                   ptrdiff_t      shifty,
+                                   rocblas_int    incy,
+                                   rocblas_stride stridey,
+                                   rocblas_int    batch_count)
+{
+    rocblas_int tx    = hipThreadIdx_x;
+    rocblas_int batch = hipBlockIdx_x * DIM_Y + hipThreadIdx_y;
+    if(batch >= batch_count || tx >= m)
+        return;
+
+    const T* A = load_ptr_batch(Aa, batch, shifta, strideA);
+    const T* x = load_ptr_batch(xa, batch, shiftx, stridex);
+    T*       y = load_ptr_batch(ya, batch, shifty, stridey);
+
+    auto alpha = load_scalar(alpha_device_host, batch, stride_alpha);
+    auto beta  = load_scalar(beta_device_host, batch, stride_beta);
+
+    T sum = 0;
+    for(rocblas_int col = 0; col < n; col++)
+        sum += A[tx + ptrdiff_t(col) * lda] * x[col * ptrdiff_t(incx)];
+
+    T& yi = y[tx * ptrdiff_t(incy)];
+    yi    = beta != 0 ? alpha * sum + beta * yi : alpha * sum;
+}
+
+// Transposed GEMV of matrices with at most DIM_X rows and columns. The columns of A are copied to
+// LDS with coalesced loads, and lane tx then computes element tx of y from column tx in LDS. The
+// rows of sA are padded so that the lanes read different banks.
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          bool CONJ,
+          typename T,
+          typename U,
+          typename V,
+          typename W>
+__global__ void gemvt_small_kernel(rocblas_int    m,
+                                   rocblas_int    n,
+                                   U              alpha_device_host,
+                                   rocblas_stride stride_alpha,
+                                   const V*       Aa,
+                                   ptrdiff_t      shifta,
+                                   rocblas_int    lda,
+                                   rocblas_stride strideA,
+                                   const V*       xa,
+                                   ptrdiff_t      shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_stride stridex,
+                                   U              beta_device_host,
+                                   rocblas_stride stride_beta,
+                                   W*             ya,
+                                   ptrdiff_t      shifty,
+                                   rocblas_int    incy,
+                                   rocblas_stride stridey,
+                                   rocblas_int    batch_count)
+{
+    __shared__ T sA[DIM_Y][DIM_X][DIM_X + 1];
+
+    rocblas_int tx    = hipThreadIdx_x;
+    rocblas_int ty    = hipThreadIdx_y;
+    rocblas_int batch = hipBlockIdx_x * DIM_Y + ty;
+
+    // the matrices of a workgroup share a wavefront, so no lane may return before the barrier
+    if(batch < batch_count && tx < m)
+    {
+        const T* A = load_ptr_batch(Aa, batch, shifta, strideA);
+        for(rocblas_int col = 0; col < n; col++)
+            sA[ty][col][tx] = A[tx + ptrdiff_t(col) * lda];
+    }
+    __syncthreads();
+
+    if(batch >= batch_count || tx >= n)
+        return;
+
+    const T* x = load_ptr_batch(xa, batch, shiftx, stridex);
+    T*       y = load_ptr_batch(ya, batch, shifty, stridey);
+
+    auto alpha = load_scalar(alpha_device_host, batch, stride_alpha);
+    auto beta  = load_scalar(beta_device_host, batch, stride_beta);
+
+    T sum = 0;
+    for(rocblas_int row = 0; row < m; row++)
+        sum += (CONJ ? conj(sA[ty][tx][row]) : sA[ty][tx][row]) * x[row * ptrdiff_t(incx)];
+
+    T& yi = y[tx * ptrdiff_t(incy)];
+    yi    = beta != 0 ? alpha * sum + beta * yi : alpha * sum;
+}
+
 #endif
@@ -0,0 +1,426 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __PACKED_BAND_DEVICE_HPP__
+#define __PACKED_BAND_DEVICE_HPP__
+
+#include "../blas1/reduction.h"
+#include "../blas1/rocblas_copy.hpp"
+#include "handle.h"
+#include "rocblas.h"
+#include "utility.h"
+
+/*
+ * Matrix-vector products and solves with matrices in packed or band storage.
+ *
+ * The products (gbmv, sbmv, spmv, tbmv and tpmv) are all y = alpha * B * x + beta * y for a
+ * matrix B which is formed from the stored m x n matrix S:
+ *
+ *   general       B = S or B = S^T, where S has kl subdiagonals and ku superdiagonals
+ *   symmetric     B(i, j) = S(i, j) in the stored triangle of S, and S(j, i) in the other one
+ *   triangular    B = S or B = S^T, with a unit diagonal if diag is rocblas_diagonal_unit
+ *
+ * A packed triangular S is described by kl = 0 and ku = n - 1 (upper) or by kl = n - 1 and
+ * ku = 0 (lower), and a triangular or symmetric band S by kl = 0 and ku = k, or kl = k and
+ * ku = 0. As in gemvn_kernel, workgroup I of packed_band_mv_kernel computes PB_NB elements of
+ * y. It loads the tiles of B in the block row I which intersect the band of B into LDS, where
+ * the elements of B which are stored as elements of S^T are transposed, so that the lanes of a
+ * wavefront always read consecutive elements of a column of S.
+ */
+
+constexpr rocblas_int PB_NB      = 32;
+constexpr rocblas_int PB_DIM_Y   = 8;
+constexpr rocblas_int PB_COPY_NB = 256;
+constexpr rocblas_int TPSV_NB    = 256;
+
+// Offset of element (i, j) of the triangle selected by upper of a packed matrix of order n
+__device__ inline ptrdiff_t rocblas_packed_index(bool        upper,
+                                                 rocblas_int n,
+                                                 rocblas_int i,
+                                                 rocblas_int j)
+{
+    return upper ? i + ptrdiff_t(j) * (j + 1) / 2 : i + ptrdiff_t(j) * (2 * n - j - 1) / 2;
+}
+
+// Offset of element (i, j) of a band matrix with ku superdiagonals
+__device__ inline ptrdiff_t rocblas_band_index(rocblas_int ku,
+                                               rocblas_int lda,
+                                               rocblas_int i,
+                                               rocblas_int j)
+{
+    return ku + i - j + ptrdiff_t(j) * lda;
+}
+
+// Element (p, q) of S, which is zero outside of the stored elements, and one on the diagonal of
+// a unit triangular matrix. S is packed if lda is 0.
+template <typename T>
+__device__ T packed_band_element(rocblas_int m,
+                                 rocblas_int n,
+                                 rocblas_int kl,
+                                 rocblas_int ku,
+                                 bool        unit,
+                                 const T*    A,
+                                 rocblas_int lda,
+                                 rocblas_int p,
+                                 rocblas_int q)
+{
+    if(p >= m || q >= n || p - q > kl || q - p > ku)
+        return 0;
+    if(unit && p == q)
+        return 1;
+    return A[lda ? rocblas_band_index(ku, lda, p, q) : rocblas_packed_index(kl == 0, n, p, q)];
+}
+
+template <rocblas_int NB, rocblas_int DIM_Y, typename T, typename U>
+__device__ void packed_band_mv_kernel_calc(rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int kl,
+                                           rocblas_int ku,
+                                           bool        symmetric,
+                                           bool        trans,
+                                           bool        unit,
+                                           U           alpha,
+                                           const T*    A,
+                                           rocblas_int lda,
+                                           const T*    x,
+                                           rocblas_int incx,
+                                           U           beta,
+                                           T*          y,
+                                           rocblas_int incy)
+{
+    __shared__ T sA[NB][NB + 1];
+    __shared__ T sx[NB];
+    __shared__ T sdata[DIM_Y][NB];
+
+    rocblas_int tx   = hipThreadIdx_x;
+    rocblas_int ty   = hipThreadIdx_y;
+    rocblas_int rows = trans ? n : m;
+    rocblas_int cols = trans ? m : n;
+    rocblas_int row0 = hipBlockIdx_x * NB;
+
+    // Columns of B which hold an element of the band in the rows of this workgroup
+    rocblas_int kb    = kl > ku ? kl : ku;
+    rocblas_int bl    = symmetric ? kb : trans ? ku : kl;
+    rocblas_int bu    = symmetric ? kb : trans ? kl : ku;
+    rocblas_int first = row0 > bl ? row0 - bl : 0;
+    rocblas_int last  = cols - row0 - NB > bu ? row0 + NB + bu : cols;
+
+    T sum = 0;
+    for(rocblas_int col0 = first; col0 < last; col0 += NB)
+    {
+        if(ty == 0)
+            sx[tx] = col0 + tx < last ? x[(col0 + tx) * ptrdiff_t(incx)] : T(0);
+
+        // Element (r, c) of the tile is B(row0 + r, col0 + c). It is loaded by the thread with
+        // tx = r if it is S(row0 + r, col0 + c), and by the thread with tx = c if it is
+        // S(col0 + c, row0 + r).
+        for(rocblas_int c = ty; c < NB; c += DIM_Y)
+        {
+            rocblas_int i = row0 + tx;
+            rocblas_int j = col0 + c;
+            if(symmetric ? (kl == 0 ? i <= j : i >= j) : !trans)
+                sA[c][tx] = packed_band_element(m, n, kl, ku, unit, A, lda, i, j);
+
+            i = row0 + c;
+            j = col0 + tx;
+            if(!(symmetric ? (kl == 0 ? i <= j : i >= j) : !trans))
+                sA[tx][c] = packed_band_element(m, n, kl, ku, unit, A, lda, j, i);
+        }
+        __syncthreads();
+
+        for(rocblas_int c = ty; c < NB; c += DIM_Y)
+            sum += sA[c][tx] * sx[c];
+        __syncthreads();
+    }
+
+    sdata[ty][tx] = sum;
+    __syncthreads();
+
+    rocblas_int ind = row0 + tx;
+    if(ty == 0 && ind < rows)
+    {
+        for(rocblas_int l = 1; l < DIM_Y; l++)
+            sum += sdata[l][tx];
+
+        if(beta != 0)
+            y[ind * incy] = alpha * sum + beta * y[ind * incy];
+        else
+            y[ind * incy] = alpha * sum;
+    }
+}
+
+template <rocblas_int NB,
+          rocblas_int DIM_Y,
+          typename T,
+          typename U,
+          typename V,
+          typename X,
+          typename W>
+__global__ void packed_band_mv_kernel(rocblas_int    m,
+                                      rocblas_int    n,
+                                      rocblas_int    kl,
+                                      rocblas_int    ku,
+                                      bool           symmetric,
+                                      bool           trans,
+                                      bool           unit,
+                                      U              alpha_device_host,
+                                      const V*       Aa,
+                                      ptrdiff_t      shifta,
+                                      rocblas_int    lda,
+                                      rocblas_stride strideA,
+                                      const X*       xa,
+                                      ptrdiff_t      shiftx,
+                                      rocblas_int    incx,
+                                      rocblas_stride stridex,
+                                      U              beta_device_host,
+                                      W*             ya,
+                                      ptrdiff_t      shifty,
+                                      rocblas_int    incy,
+                                      rocblas_stride stridey)
+{
+    const T* A = load_ptr_batch(Aa, hipBlockIdx_y, shifta, strideA);
+    const T* x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
+    T*       y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    packed_band_mv_kernel_calc<NB, DIM_Y>(
+        m, n, kl, ku, symmetric, trans, unit, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+/*
+ * Solves op(A) * x = b for the packed triangular matrix A of each batch, with one workgroup per
+ * batch. The columns of A are contiguous, so that op(A) = A is solved by columns: once x_j is
+ * known, column j of A times x_j is subtracted from the right-hand side. op(A) = A^T is solved
+ * by the rows of A^T, which are the columns of A, so that x_j is found from the dot product of
+ * column j and the known elements of x.
+ */
+template <rocblas_int NB, typename T, typename V, typename W>
+__global__ void tpsv_kernel(rocblas_int    n,
+                            bool           upper,
+                            bool           trans,
+                            bool           unit,
+                            const V*       APa,
+                            ptrdiff_t      shifta,
+                            rocblas_stride strideA,
+                            W*             xa,
+                            ptrdiff_t      shiftx,
+                            rocblas_int    incx,
+                            rocblas_stride stridex)
+{
+    __shared__ T sdata[NB];
+
+    const T* AP = load_ptr_batch(APa, hipBlockIdx_x, shifta, strideA);
+    T*       x  = load_ptr_batch(xa, hipBlockIdx_x, shiftx, stridex);
+
+    rocblas_int tx = hipThreadIdx_x;
+
+    // op(A) is lower triangular, and x is found from its first element, when A is lower and
+    // not transposed or upper and transposed
+    bool forward = upper == trans;
+
+    for(rocblas_int s = 0; s < n; s++)
+    {
+        rocblas_int j  = forward ? s : n - 1 - s;
+        const T*    Aj = AP + rocblas_packed_index(upper, n, 0, j);
+        T*          xj = x + j * ptrdiff_t(incx);
+
+        // Rows of the off-diagonal elements of column j
+        rocblas_int first = upper ? 0 : j + 1;
+        rocblas_int last  = upper ? j : n;
+
+        if(trans)
+        {
+            T sum = 0;
+            for(rocblas_int i = first + tx; i < last; i += NB)
+                sum += Aj[i] * x[i * ptrdiff_t(incx)];
+
+            sdata[tx] = sum;
+            rocblas_sum_reduce<NB>(tx, sdata);
+
+            if(tx == 0)
+                *xj = unit ? *xj - sdata[0] : (*xj - sdata[0]) / Aj[j];
+            __syncthreads();
+        }
+        else
+        {
+            if(tx == 0 && !unit)
+                *xj /= Aj[j];
+            __syncthreads();
+
+            T xj_val = *xj;
+            for(rocblas_int i = first + tx; i < last; i += NB)
+                x[i * ptrdiff_t(incx)] -= Aj[i] * xj_val;
+            __syncthreads();
+        }
+    }
+}
+
+/*! \brief y = alpha * B * x + beta * y for strided or batched A, x and y, where B is formed
+    from the packed or band matrix A as described above. A is packed if lda is 0. */
+template <typename T, typename U, typename V, typename X, typename W>
+rocblas_status rocblas_packed_band_mv_launcher(rocblas_handle handle,
+                                               rocblas_int    m,
+                                               rocblas_int    n,
+                                               rocblas_int    kl,
+                                               rocblas_int    ku,
+                                               bool           symmetric,
+                                               bool           trans,
+                                               bool           unit,
+                                               const U*       alpha,
+                                               const V*       A,
+                                               rocblas_int    offseta,
+                                               rocblas_int    lda,
+                                               rocblas_stride strideA,
+                                               const X*       x,
+                                               ptrdiff_t      shiftx,
+                                               rocblas_int    incx,
+                                               rocblas_stride stridex,
+                                               const U*       beta,
+                                               W*             y,
+                                               ptrdiff_t      shifty,
+                                               rocblas_int    incy,
+                                               rocblas_stride stridey,
+                                               rocblas_int    batch_count)
+{
+    rocblas_int rows = trans ? n : m;
+
+    dim3 grid((rows - 1) / PB_NB + 1, batch_count);
+    dim3 threads(PB_NB, PB_DIM_Y);
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        hipLaunchKernelGGL((packed_band_mv_kernel<PB_NB, PB_DIM_Y, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           m,
+                           n,
+                           kl,
+                           ku,
+                           symmetric,
+                           trans,
+                           unit,
+                           alpha,
+                           A,
+                           offseta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey);
+    else
+        hipLaunchKernelGGL((packed_band_mv_kernel<PB_NB, PB_DIM_Y, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           m,
+                           n,
+                           kl,
+                           ku,
+                           symmetric,
+                           trans,
+                           unit,
+                           *alpha,
+                           A,
+                           offseta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           *beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey);
+
+    return rocblas_status_success;
+}
+
+// Bytes of the copy of x which rocblas_packed_band_trmv_launcher needs
+template <typename T>
+size_t rocblas_packed_band_trmv_workspace_size(rocblas_int n, rocblas_int batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return 0;
+
+    return sizeof(T) * n * size_t(batch_count);
+}
+
+/*! \brief x = op(A) * x for strided or batched triangular A and x, where A is packed if lda is 0.
+    x is copied to workspace first, which must hold
+    rocblas_packed_band_trmv_workspace_size<T>(n, batch_count) bytes of device memory. */
+template <typename T, typename V, typename W>
+rocblas_status rocblas_packed_band_trmv_launcher(rocblas_handle    handle,
+                                                 rocblas_fill      uplo,
+                                                 rocblas_operation transA,
+                                                 rocblas_diagonal  diag,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const V*          A,
+                                                 rocblas_int       offseta,
+                                                 rocblas_int       lda,
+                                                 rocblas_stride    strideA,
+                                                 W*                x,
+                                                 rocblas_int       offsetx,
+                                                 rocblas_int       incx,
+                                                 rocblas_stride    stridex,
+                                                 rocblas_int       batch_count,
+                                                 T*                workspace)
+{
+    //quick return
+    if(!n || !batch_count)
+        return rocblas_status_success;
+
+    rocblas_status status = rocblas_copy_template<PB_COPY_NB, T>(
+        handle, n, x, offsetx, incx, stridex, workspace, 0, 1, n, batch_count);
+    if(status != rocblas_status_success)
+        return status;
+
+    // The copy is multiplied with alpha = 1 and beta = 0, which are host constants
+    static constexpr T one  = 1;
+    static constexpr T zero = 0;
+
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    bool upper = uplo == rocblas_fill_upper;
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+
+    return rocblas_packed_band_mv_launcher<T>(handle,
+                                              n,
+                                              n,
+                                              upper ? 0 : k,
+                                              upper ? k : 0,
+                                              false,
+                                              transA != rocblas_operation_none,
+                                              diag == rocblas_diagonal_unit,
+                                              &one,
+                                              A,
+                                              offseta,
+                                              lda,
+                                              strideA,
+                                              (const T*)workspace,
+                                              0,
+                                              1,
+                                              n,
+                                              &zero,
+                                              x,
+                                              shiftx,
+                                              incx,
+                                              stridex,
+                                              batch_count);
+}
+
+#endif
@@ -0,0 +1,76 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __ROCBLAS_GBMV_HPP__
+#define __ROCBLAS_GBMV_HPP__
+#include "handle.h"
+#include "packed_band_device.hpp"
+#include "rocblas.h"
+#include "utility.h"
+
+/*! \brief GBMV on strided or batched band matrices and vectors. op(A) is A^T for both
+    rocblas_operation_transpose and rocblas_operation_conjugate_transpose. */
+template <typename T, typename U, typename V, typename W>
+rocblas_status rocblas_gbmv_template(rocblas_handle    handle,
+                                     rocblas_operation transA,
+                                     rocblas_int       m,
+                                     rocblas_int       n,
+                                     rocblas_int       kl,
+                                     rocblas_int       ku,
+                                     const U*          alpha,
+                                     const V*          A,
+                                     rocblas_int       offseta,
+                                     rocblas_int       lda,
+                                     rocblas_stride    strideA,
+                                     const V*          x,
+                                     rocblas_int       offsetx,
+                                     rocblas_int       incx,
+                                     rocblas_stride    stridex,
+                                     const U*          beta,
+                                     W*                y,
+                                     rocblas_int       offsety,
+                                     rocblas_int       incy,
+                                     rocblas_stride    stridey,
+                                     rocblas_int       batch_count)
+{
+    //quick return
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha && *beta == 1)
+        return rocblas_status_success;
+
+    bool        trans = transA != rocblas_operation_none;
+    rocblas_int lenx  = trans ? m : n;
+    rocblas_int leny  = trans ? n : m;
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (lenx - 1) : offsetx;
+    ptrdiff_t shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (leny - 1) : offsety;
+
+    return rocblas_packed_band_mv_launcher<T>(handle,
+                                              m,
+                                              n,
+                                              kl,
+                                              ku,
+                                              false,
+                                              trans,
+                                              false,
+                                              alpha,
+                                              A,
+                                              offseta,
+                                              lda,
+                                              strideA,
+                                              x,
+                                              shiftx,
+                                              incx,
+                                              stridex,
+                                              beta,
+                                              y,
+                                              shifty,
+                                              incy,
+                                              stridey,
+                                              batch_count);
+}
+
+#endif
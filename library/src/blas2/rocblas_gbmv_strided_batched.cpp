@@ -0,0 +1,280 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_gbmv.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gbmv_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gbmv_name<float>[] = "rocblas_sgbmv_strided_batched";
+    template <>
+    constexpr char rocblas_gbmv_name<double>[] = "rocblas_dgbmv_strided_batched";
+
+    template <typename T>
+    rocblas_status rocblas_gbmv_strided_batched_impl(rocblas_handle    handle,
+                                                     rocblas_operation transA,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     rocblas_int       kl,
+                                                     rocblas_int       ku,
+                                                     const T*          alpha,
+                                                     const T*          A,
+                                                     rocblas_int       lda,
+                                                     rocblas_stride    strideA,
+                                                     const T*          x,
+                                                     rocblas_int       incx,
+                                                     rocblas_stride    stridex,
+                                                     const T*          beta,
+                                                     T*                y,
+                                                     rocblas_int       incy,
+                                                     rocblas_stride    stridey,
+                                                     rocblas_int       batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto transA_letter = rocblas_transpose_letter(transA);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_gbmv_name<T>,
+                              transA,
+                              m,
+                              n,
+                              kl,
+                              ku,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              lda,
+                              strideA,
+                              x,
+                              incx,
+                              stridex,
+                              log_trace_scalar_value(beta),
+                              y,
+                              incy,
+                              stridey,
+                              batch_count);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              "./rocblas-bench -f gbmv_strided_batched -r",
+                              rocblas_precision_string<T>,
+                              "--transposeA",
+                              transA_letter,
+                              "-m",
+                              m,
+                              "-n",
+                              n,
+                              "--kl",
+                              kl,
+                              "--ku",
+                              ku,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              "--stride_a",
+                              strideA,
+                              "--incx",
+                              incx,
+                              "--stride_x",
+                              stridex,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--incy",
+                              incy,
+                              "--stride_y",
+                              stridey,
+                              "--batch_count",
+                              batch_count);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_gbmv_name<T>,
+                              transA,
+                              m,
+                              n,
+                              kl,
+                              ku,
+                              alpha,
+                              A,
+                              lda,
+                              strideA,
+                              x,
+                              incx,
+                              stridex,
+                              beta,
+                              y,
+                              incy,
+                              stridey,
+                              batch_count);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_gbmv_name<T>,
+                            "transA",
+                            transA_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "KL",
+                            kl,
+                            "KU",
+                            ku,
+                            "lda",
+                            lda,
+                            "stride_a",
+                            strideA,
+                            "incx",
+                            incx,
+                            "stride_x",
+                            stridex,
+                            "incy",
+                            incy,
+                            "stride_y",
+                            stridey,
+                            "batch_count",
+                            batch_count);
+        }
+
+        if(m < 0 || n < 0 || kl < 0 || ku < 0 || lda < kl + ku + 1 || !incx || !incy
+           || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // quick return if possible.
+        if(!m || !n || !batch_count)
+            return rocblas_status_success;
+
+        if(!A || !x || !y || !alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_gbmv_template<T>(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        kl,
+                                        ku,
+                                        alpha,
+                                        A,
+                                        0,
+                                        lda,
+                                        strideA,
+                                        x,
+                                        0,
+                                        incx,
+                                        stridex,
+                                        beta,
+                                        y,
+                                        0,
+                                        incy,
+                                        stridey,
+                                        batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_sgbmv_strided_batched(rocblas_handle    handle,
+                                             rocblas_operation transA,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             rocblas_int       kl,
+                                             rocblas_int       ku,
+                                             const float*      alpha,
+                                             const float*      A,
+                                             rocblas_int       lda,
+                                             rocblas_stride    strideA,
+                                             const float*      x,
+                                             rocblas_int       incx,
+                                             rocblas_stride    stridex,
+                                             const float*      beta,
+                                             float*            y,
+                                             rocblas_int       incy,
+                                             rocblas_stride    stridey,
+                                             rocblas_int       batch_count)
+{
+    return rocblas_gbmv_strided_batched_impl(handle,
+                                             transA,
+                                             m,
+                                             n,
+                                             kl,
+                                             ku,
+                                             alpha,
+                                             A,
+                                             lda,
+                                             strideA,
+                                             x,
+                                             incx,
+                                             stridex,
+                                             beta,
+                                             y,
+                                             incy,
+                                             stridey,
+                                             batch_count);
+}
+
+rocblas_status rocblas_dgbmv_strided_batched(rocblas_handle    handle,
+                                             rocblas_operation transA,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             rocblas_int       kl,
+                                             rocblas_int       ku,
+                                             const double*     alpha,
+                                             const double*     A,
+                                             rocblas_int       lda,
+                                             rocblas_stride    strideA,
+                                             const double*     x,
+                                             rocblas_int       incx,
+                                             rocblas_stride    stridex,
+                                             const double*     beta,
+                                             double*           y,
+                                             rocblas_int       incy,
+                                             rocblas_stride    stridey,
+                                             rocblas_int       batch_count)
+{
+    return rocblas_gbmv_strided_batched_impl(handle,
+                                             transA,
+                                             m,
+                                             n,
+                                             kl,
+                                             ku,
+                                             alpha,
+                                             A,
+                                             lda,
+                                             strideA,
+                                             x,
+                                             incx,
+                                             stridex,
+                                             beta,
+                                             y,
+                                             incy,
+                                             stridey,
+                                             batch_count);
+}
+
+} // extern "C"
@@ -37,12 +37,12 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode = handle->layer_mode;
         if(layer_mode
-           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
         {
             auto transA_letter = rocblas_transpose_letter(transA);
 
@@ -122,14 +122,44 @@ namespace
         if(m < 0 || n < 0 || lda < m || lda < 1 || !incx || !incy)
             return rocblas_status_invalid_size;
 
+        // quick return if possible.
+        // return rocblas_status_size_unchanged if device memory size query
         if(!m || !n)
-            return rocblas_status_success;
+            return handle->is_device_memory_size_query() ? rocblas_status_size_unchanged
+                                                         : rocblas_status_success;
+
+        size_t dev_bytes = rocblas_gemv_kernel_workspace_size<T>(handle, transA, m, n, 1);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
 
         if(!A || !x || !y || !alpha || !beta)
             return rocblas_status_invalid_pointer;
 
-        return rocblas_gemv_template<T>(
-            handle, transA, m, n, alpha, 0, A, 0, lda, 0, x, 0, incx, 0, beta, 0, y, 0, incy, 0, 1);
+        // If the workspace cannot be allocated, A is not split
+        auto mem = handle->device_malloc(dev_bytes);
+
+        return rocblas_gemv_template<T>(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        alpha,
+                                        0,
+                                        A,
+                                        0,
+                                        lda,
+                                        0,
+                                        x,
+                                        0,
+                                        incx,
+                                        0,
+                                        beta,
+                                        0,
+                                        y,
+                                        0,
+                                        incy,
+                                        0,
+                                        1,
+                                        (T*)mem);
     }
 
 } // namespace
@@ -6,7 +6,331 @@
 #include "gemv_device.hpp"
 #include "handle.h"
 #include "rocblas.h"
+#include <algorithm>
+
+// GEMVN_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
+constexpr int GEMVN_DIM_X = 64;
+constexpr int GEMVN_DIM_Y = 16;
+
+// number of threads per column of the transposed kernels
+constexpr int GEMVT_NB = 256;
+
+// Number of workgroups of gemvn_kernel for each batch
+template <typename T>
+inline rocblas_int rocblas_gemvn_blocks(rocblas_int m)
+{
+    return std::is_same<T, rocblas_double_complex>{} ? (m - 1) / GEMVN_DIM_X + 1
+                                                     : (m - 1) / (GEMVN_DIM_X * 4) + 1;
+}
+
+/*
+ * Split-N GEMV
+ *
+ * gemvn_kernel only tiles over the rows of A, and the transposed kernels use one workgroup per
+ * column, so short-wide non-transposed and tall-skinny transposed problems leave most of the
+ * device idle while a few workgroups loop over the long dimension. For those shapes, the long
+ * dimension is split into chunks, which are reduced by separate workgroups into a workspace of
+ * partial sums. A second kernel adds the partial sums and applies alpha and beta.
+ */
+
+// Workgroups per CU which the unsplit kernels must reach for the split not to be used
+constexpr rocblas_int GEMV_SPLIT_WORKGROUPS_PER_CU = 4;
+
+// Minimum length of a chunk of the long dimension. Chunks are a multiple of this length.
+constexpr rocblas_int GEMV_SPLIT_MIN_CHUNK = 1024;
+
+constexpr rocblas_int GEMV_SPLIT_REDUCE_NB = 256;
+
+// Length of the chunks of the long dimension, which is the whole dimension without a split
+template <typename T>
+rocblas_int rocblas_gemv_split_chunk(rocblas_handle    handle,
+                                     rocblas_operation transA,
+                                     rocblas_int       m,
+                                     rocblas_int       n,
+                                     rocblas_int       batch_count)
+{
+    bool        notrans = transA == rocblas_operation_none;
+    rocblas_int len     = notrans ? n : m;
+    if(len < 2 * GEMV_SPLIT_MIN_CHUNK)
+        return len;
+
+    int64_t workgroups = int64_t(batch_count) * (notrans ? rocblas_gemvn_blocks<T>(m) : n);
+    int64_t target
+        = int64_t(GEMV_SPLIT_WORKGROUPS_PER_CU) * handle->device_properties.multiProcessorCount;
+    if(workgroups * 2 > target)
+        return len;
+
+    int64_t splits = std::min<int64_t>((target - 1) / workgroups + 1, len / GEMV_SPLIT_MIN_CHUNK);
+    int64_t chunk  = ((len - 1) / splits / GEMV_SPLIT_MIN_CHUNK + 1) * GEMV_SPLIT_MIN_CHUNK;
+    return rocblas_int(std::min<int64_t>(chunk, len));
+}
+
+// Bytes of the workspace which rocblas_gemv_template needs for the split kernels
+template <typename T>
+size_t rocblas_gemv_kernel_workspace_size(rocblas_handle    handle,
+                                          rocblas_operation transA,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          rocblas_int       batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return 0;
+
+    bool        notrans = transA == rocblas_operation_none;
+    rocblas_int len     = notrans ? n : m;
+    rocblas_int chunk   = rocblas_gemv_split_chunk<T>(handle, transA, m, n, batch_count);
+    if(chunk == len)
+        return 0;
+
+    rocblas_int splits = (len - 1) / chunk + 1;
+    return sizeof(T) * (notrans ? m : n) * size_t(splits) * batch_count;
+}
 
+template <typename T, typename U, typename V, typename W>
+rocblas_status rocblas_gemv_split_template(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       chunk,
+                                           U                 alpha,
+                                           rocblas_stride    stride_alpha,
+                                           const V*          A,
+                                           rocblas_int       offseta,
+                                           rocblas_int       lda,
+                                           rocblas_stride    strideA,
+                                           const V*          x,
+                                           ptrdiff_t         shiftx,
+                                           rocblas_int       incx,
+                                           rocblas_stride    stridex,
+                                           U                 beta,
+                                           rocblas_stride    stride_beta,
+                                           W*                y,
+                                           ptrdiff_t         shifty,
+                                           rocblas_int       incy,
+                                           rocblas_stride    stridey,
+                                           rocblas_int       batch_count,
+                                           T*                workspace)
+{
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    bool        notrans = transA == rocblas_operation_none;
+    rocblas_int len     = notrans ? m : n;
+    rocblas_int splits  = ((notrans ? n : m) - 1) / chunk + 1;
+
+    if(notrans)
+    {
+        dim3 grid(rocblas_gemvn_blocks<T>(m), splits, batch_count);
+        dim3 threads(GEMVN_DIM_X, GEMVN_DIM_Y);
+        hipLaunchKernelGGL((gemvn_split_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, T>),
+                           grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           m,
+                           n,
+                           chunk,
+                           A,
+                           offseta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           workspace);
+    }
+    else
+    {
+        dim3 grid(n, splits, batch_count);
+        dim3 threads(GEMVT_NB);
+        if(transA == rocblas_operation_transpose)
+            hipLaunchKernelGGL((gemvt_split_kernel<GEMVT_NB, false, T>),
+                               grid,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               chunk,
+                               A,
+                               offseta,
+                               lda,
+                               strideA,
+                               x,
+                               shiftx,
+                               incx,
+                               stridex,
+                               workspace);
+        else
+            hipLaunchKernelGGL((gemvt_split_kernel<GEMVT_NB, true, T>),
+                               grid,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               chunk,
+                               A,
+                               offseta,
+                               lda,
+                               strideA,
+                               x,
+                               shiftx,
+                               incx,
+                               stridex,
+                               workspace);
+    }
+
+    dim3 grid((len - 1) / GEMV_SPLIT_REDUCE_NB + 1, batch_count);
+    dim3 threads(GEMV_SPLIT_REDUCE_NB);
+    hipLaunchKernelGGL((gemv_split_reduce_kernel<GEMV_SPLIT_REDUCE_NB, T>),
+                       grid,
+                       threads,
+                       0,
+                       rocblas_stream,
+                       len,
+                       splits,
+                       alpha,
+                       stride_alpha,
+                       beta,
+                       stride_beta,
+                       workspace,
+                       y,
+                       shifty,
+                       incy,
+                       stridey);
+
+    return rocblas_status_success;
+}
+
+/*
+ * GEMV of small matrices
+ *
+ * The tiled kernels give each matrix at least a workgroup of hundreds of threads, most of which
+ * are idle when m and n are small, and large batches of small matrices then launch huge grids.
+ * Matrices with at most GEMV_SMALL_DIM rows and columns are given GEMV_SMALL_DIM lanes each, and
+ * GEMV_SMALL_BATCHES of them share a workgroup of one wavefront.
+ */
+constexpr rocblas_int GEMV_SMALL_DIM     = 32;
+constexpr rocblas_int GEMV_SMALL_BATCHES = 2;
+
+inline bool rocblas_gemv_use_small(rocblas_int m, rocblas_int n)
+{
+    return m <= GEMV_SMALL_DIM && n <= GEMV_SMALL_DIM;
+}
+
+template <typename T, typename U, typename V, typename W>
+rocblas_status rocblas_gemv_small_template(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           U                 alpha,
+                                           rocblas_stride    stride_alpha,
+                                           const V*          A,
+                                           rocblas_int       offseta,
+                                           rocblas_int       lda,
+                                           rocblas_stride    strideA,
+                                           const V*          x,
+                                           ptrdiff_t         shiftx,
+                                           rocblas_int       incx,
+                                           rocblas_stride    stridex,
+                                           U                 beta,
+                                           rocblas_stride    stride_beta,
+                                           W*                y,
+                                           ptrdiff_t         shifty,
+                                           rocblas_int       incy,
+                                           rocblas_stride    stridey,
+                                           rocblas_int       batch_count)
+{
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    dim3 grid((batch_count - 1) / GEMV_SMALL_BATCHES + 1);
+    dim3 threads(GEMV_SMALL_DIM, GEMV_SMALL_BATCHES);
+
+    if(transA == rocblas_operation_none)
+        hipLaunchKernelGGL((gemvn_small_kernel<GEMV_SMALL_DIM, GEMV_SMALL_BATCHES, T>),
+                           grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           m,
+                           n,
+                           alpha,
+                           stride_alpha,
+                           A,
+                           offseta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           beta,
+                           stride_beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           batch_count);
+    else if(transA == rocblas_operation_transpose)
+        hipLaunchKernelGGL((gemvt_small_kernel<GEMV_SMALL_DIM, GEMV_SMALL_BATCHES, false, T>),
+                           grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           m,
+                           n,
+                           alpha,
+                           stride_alpha,
+                           A,
+                           offseta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           beta,
+                           stride_beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           batch_count);
+    else
+        hipLaunchKernelGGL((gemvt_small_kernel<GEMV_SMALL_DIM, GEMV_SMALL_BATCHES, true, T>),
+                           grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           m,
+                           n,
+                           alpha,
+                           stride_alpha,
+                           A,
+                           offseta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           beta,
+                           stride_beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           batch_count);
+
+    return rocblas_status_success;
+}
+
+/*! \brief GEMV on strided or batched matrices and vectors.
+
+    workspace must hold rocblas_gemv_kernel_workspace_size<T>(handle, transA, m, n, batch_count)
+    bytes of device memory for the split kernels to be used. Without it, the long dimension of
+    A is not split. */
 template <typename T, typename U, typename V, typename W>
 rocblas_status rocblas_gemv_template(rocblas_handle    handle,
                                      rocblas_operation transA,
@@ -28,7 +352,8 @@ rocblas_status rocblas_gemv_template(rocblas_handle    handle,
                                      rocblas_int       offsety,
                                      rocblas_int       incy,
                                      rocblas_stride    stridey,
-                                     rocblas_int       batch_count)
+                                     rocblas_int       batch_count,
+                                     T*                workspace = nullptr)
 {
     //quick return
     if(!m || !n || !batch_count)
@@ -44,15 +369,119 @@ rocblas_status rocblas_gemv_template(rocblas_handle    handle,
         = incy < 0 ? offsety - ptrdiff_t(incy) * (transA == rocblas_operation_none ? m - 1 : n - 1)
                    : offsety;
 
+    if(rocblas_gemv_use_small(m, n))
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            return rocblas_gemv_small_template<T>(handle,
+                                                  transA,
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  stride_alpha,
+                                                  A,
+                                                  offseta,
+                                                  lda,
+                                                  strideA,
+                                                  x,
+                                                  shiftx,
+                                                  incx,
+                                                  stridex,
+                                                  beta,
+                                                  stride_beta,
+                                                  y,
+                                                  shifty,
+                                                  incy,
+                                                  stridey,
+                                                  batch_count);
+
+        if(!*alpha && *beta == 1)
+            return rocblas_status_success;
+
+        return rocblas_gemv_small_template<T>(handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              *alpha,
+                                              stride_alpha,
+                                              A,
+                                              offseta,
+                                              lda,
+                                              strideA,
+                                              x,
+                                              shiftx,
+                                              incx,
+                                              stridex,
+                                              *beta,
+                                              stride_beta,
+                                              y,
+                                              shifty,
+                                              incy,
+                                              stridey,
+                                              batch_count);
+    }
+
+    // Split the long dimension of A when the unsplit kernels would leave the device idle
+    rocblas_int len = transA == rocblas_operation_none ? n : m;
+    rocblas_int chunk
+        = workspace ? rocblas_gemv_split_chunk<T>(handle, transA, m, n, batch_count) : len;
+    if(chunk < len)
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            return rocblas_gemv_split_template(handle,
+                                               transA,
+                                               m,
+                                               n,
+                                               chunk,
+                                               alpha,
+                                               stride_alpha,
+                                               A,
+                                               offseta,
+                                               lda,
+                                               strideA,
+                                               x,
+                                               shiftx,
+                                               incx,
+                                               stridex,
+                                               beta,
+                                               stride_beta,
+                                               y,
+                                               shifty,
+                                               incy,
+                                               stridey,
+                                               batch_count,
+                                               workspace);
+
+        if(!*alpha && *beta == 1)
+            return rocblas_status_success;
+
+        return rocblas_gemv_split_template(handle,
+                                           transA,
+                                           m,
+                                           n,
+                                           chunk,
+                                           *alpha,
+                                           stride_alpha,
+                                           A,
+                                           offseta,
+                                           lda,
+                                           strideA,
+                                           x,
+                                           shiftx,
+                                           incx,
+                                           stridex,
+                                           *beta,
+                                           stride_beta,
+                                           y,
+                                           shifty,
+                                           incy,
+                                           stridey,
+                                           batch_count,
+                                           workspace);
+    }
+
     if(transA == rocblas_operation_none)
     {
-        // GEMVN_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
-        static constexpr int GEMVN_DIM_X = 64;
-        static constexpr int GEMVN_DIM_Y = 16;
-        rocblas_int          blocks      = (m - 1) / (GEMVN_DIM_X * 4) + 1;
-        if(std::is_same<T, rocblas_double_complex>{})
-            blocks = (m - 1) / (GEMVN_DIM_X) + 1;
-        dim3 gemvn_grid(blocks, batch_count);
+        dim3 gemvn_grid(rocblas_gemvn_blocks<T>(m), batch_count);
         dim3 gemvn_threads(GEMVN_DIM_X, GEMVN_DIM_Y);
 
         if(handle->pointer_mode == rocblas_pointer_mode_device)
@@ -115,7 +544,7 @@ rocblas_status rocblas_gemv_template(rocblas_handle    handle,
     {
         // transpose
         // number of columns on the y-dim of the grid
-        static constexpr int NB = 256;
+        static constexpr int NB = GEMVT_NB;
         dim3                 gemvt_grid(n, batch_count);
         dim3                 gemvt_threads(NB);
 
@@ -179,7 +608,7 @@ rocblas_status rocblas_gemv_template(rocblas_handle    handle,
     {
         // conjugate transpose
         // number of columns on the y-dim of the grid
-        static constexpr int NB = 256;
+        static constexpr int NB = GEMVT_NB;
         dim3                 gemvc_grid(n, batch_count);
         dim3                 gemvc_threads(NB);
 
@@ -0,0 +1,265 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_gemv_multi.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemv_multi_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemv_multi_name<float>[] = "rocblas_sgemv_multi";
+    template <>
+    constexpr char rocblas_gemv_multi_name<double>[] = "rocblas_dgemv_multi";
+    template <>
+    constexpr char rocblas_gemv_multi_name<rocblas_float_complex>[] = "rocblas_cgemv_multi";
+    template <>
+    constexpr char rocblas_gemv_multi_name<rocblas_double_complex>[] = "rocblas_zgemv_multi";
+
+    template <typename T>
+    rocblas_status rocblas_gemv_multi_impl(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          x,
+                                           rocblas_int       incx,
+                                           rocblas_int       ldx,
+                                           const T*          beta,
+                                           T*                y,
+                                           rocblas_int       incy,
+                                           rocblas_int       ldy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto transA_letter = rocblas_transpose_letter(transA);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_gemv_multi_name<T>,
+                              transA,
+                              m,
+                              n,
+                              k,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              lda,
+                              x,
+                              incx,
+                              ldx,
+                              log_trace_scalar_value(beta),
+                              y,
+                              incy,
+                              ldy);
+
+                // The benchmark stores the vectors contiguously, so ldx and ldy are not passed
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              "./rocblas-bench -f gemv_multi -r",
+                              rocblas_precision_string<T>,
+                              "--transposeA",
+                              transA_letter,
+                              "-m",
+                              m,
+                              "-n",
+                              n,
+                              "-k",
+                              k,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              "--incx",
+                              incx,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--incy",
+                              incy);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_gemv_multi_name<T>,
+                              transA,
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              A,
+                              lda,
+                              x,
+                              incx,
+                              ldx,
+                              beta,
+                              y,
+                              incy,
+                              ldy);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_gemv_multi_name<T>,
+                            "transA",
+                            transA_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "lda",
+                            lda,
+                            "incx",
+                            incx,
+                            "ldx",
+                            ldx,
+                            "incy",
+                            incy,
+                            "ldy",
+                            ldy);
+        }
+
+        if(m < 0 || n < 0 || k < 0 || lda < m || lda < 1 || !incx || !incy)
+            return rocblas_status_invalid_size;
+
+        // The vectors of y must not overlap
+        rocblas_int dim_y = transA == rocblas_operation_none ? m : n;
+        if(k > 1 && dim_y && ldy < 1 + (dim_y - 1) * int64_t(incy < 0 ? -incy : incy))
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !k)
+            return rocblas_status_success;
+
+        if(!A || !x || !y || !alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_gemv_multi_template<T>(handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              0,
+                                              lda,
+                                              0,
+                                              x,
+                                              0,
+                                              incx,
+                                              ldx,
+                                              0,
+                                              beta,
+                                              y,
+                                              0,
+                                              incy,
+                                              ldy,
+                                              0,
+                                              1);
+    }
+
+} // namespace
+
+/*
+* ===========================================================================
+*    C wrapper
+* ===========================================================================
+*/
+
+extern "C" {
+
+rocblas_status rocblas_sgemv_multi(rocblas_handle    handle,
+                                   rocblas_operation transA,
+                                   rocblas_int       m,
+                                   rocblas_int       n,
+                                   rocblas_int       k,
+                                   const float*      alpha,
+                                   const float*      A,
+                                   rocblas_int       lda,
+                                   const float*      x,
+                                   rocblas_int       incx,
+                                   rocblas_int       ldx,
+                                   const float*      beta,
+                                   float*            y,
+                                   rocblas_int       incy,
+                                   rocblas_int       ldy)
+{
+    return rocblas_gemv_multi_impl(
+        handle, transA, m, n, k, alpha, A, lda, x, incx, ldx, beta, y, incy, ldy);
+}
+
+rocblas_status rocblas_dgemv_multi(rocblas_handle    handle,
+                                   rocblas_operation transA,
+                                   rocblas_int       m,
+                                   rocblas_int       n,
+                                   rocblas_int       k,
+                                   const double*     alpha,
+                                   const double*     A,
+                                   rocblas_int       lda,
+                                   const double*     x,
+                                   rocblas_int       incx,
+                                   rocblas_int       ldx,
+                                   const double*     beta,
+                                   double*           y,
+                                   rocblas_int       incy,
+                                   rocblas_int       ldy)
+{
+    return rocblas_gemv_multi_impl(
+        handle, transA, m, n, k, alpha, A, lda, x, incx, ldx, beta, y, incy, ldy);
+}
+
+rocblas_status rocblas_cgemv_multi(rocblas_handle               handle,
+                                   rocblas_operation            transA,
+                                   rocblas_int                  m,
+                                   rocblas_int                  n,
+                                   rocblas_int                  k,
+                                   const rocblas_float_complex* alpha,
+                                   const rocblas_float_complex* A,
+                                   rocblas_int                  lda,
+                                   const rocblas_float_complex* x,
+                                   rocblas_int                  incx,
+                                   rocblas_int                  ldx,
+                                   const rocblas_float_complex* beta,
+                                   rocblas_float_complex*       y,
+                                   rocblas_int                  incy,
+                                   rocblas_int                  ldy)
+{
+    return rocblas_gemv_multi_impl(
+        handle, transA, m, n, k, alpha, A, lda, x, incx, ldx, beta, y, incy, ldy);
+}
+
+rocblas_status rocblas_zgemv_multi(rocblas_handle                handle,
+                                   rocblas_operation             transA,
+                                   rocblas_int                   m,
+                                   rocblas_int                   n,
+                                   rocblas_int                   k,
+                                   const rocblas_double_complex* alpha,
+                                   const rocblas_double_complex* A,
+                                   rocblas_int                   lda,
+                                   const rocblas_double_complex* x,
+                                   rocblas_int                   incx,
+                                   rocblas_int                   ldx,
+                                   const rocblas_double_complex* beta,
+                                   rocblas_double_complex*       y,
+                                   rocblas_int                   incy,
+                                   rocblas_int                   ldy)
+{
+    return rocblas_gemv_multi_impl(
+        handle, transA, m, n, k, alpha, A, lda, x, incx, ldx, beta, y, incy, ldy);
+}
+
+} // extern "C"
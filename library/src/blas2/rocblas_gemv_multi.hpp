@@ -0,0 +1,289 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __ROCBLAS_GEMV_MULTI_HPP__
+#define __ROCBLAS_GEMV_MULTI_HPP__
+#include "gemv_device.hpp"
+#include "handle.h"
+#include "rocblas.h"
+#include <algorithm>
+
+/*
+ * GEMV with several vectors
+ *
+ * y_j = alpha * op(A) * x_j + beta * y_j for j < k. Calling GEMV k times reads A k times, and
+ * GEMM is inefficient with so few columns. The kernels read A once for up to GEMV_MULTI_MAX_K
+ * vectors, keeping a partial sum for each vector in registers. More vectors are processed in
+ * groups of GEMV_MULTI_MAX_K.
+ */
+
+constexpr rocblas_int GEMV_MULTI_MAX_K  = 16;
+constexpr rocblas_int GEMVN_MULTI_DIM_X = 64;
+constexpr rocblas_int GEMVN_MULTI_DIM_Y = 8;
+constexpr rocblas_int GEMVT_MULTI_NB    = 256;
+
+template <rocblas_int K, typename T, typename U, typename V, typename W>
+void rocblas_gemv_multi_launch(rocblas_handle    handle,
+                               rocblas_operation transA,
+                               rocblas_int       m,
+                               rocblas_int       n,
+                               rocblas_int       k,
+                               U                 alpha,
+                               const V*          A,
+                               ptrdiff_t         shifta,
+                               rocblas_int       lda,
+                               rocblas_stride    strideA,
+                               const V*          x,
+                               ptrdiff_t         shiftx,
+                               rocblas_int       incx,
+                               rocblas_int       ldx,
+                               rocblas_stride    stridex,
+                               U                 beta,
+                               W*                y,
+                               ptrdiff_t         shifty,
+                               rocblas_int       incy,
+                               rocblas_int       ldy,
+                               rocblas_stride    stridey,
+                               rocblas_int       batch_count)
+{
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(transA == rocblas_operation_none)
+    {
+        dim3 grid((m - 1) / GEMVN_MULTI_DIM_X + 1, batch_count);
+        dim3 threads(GEMVN_MULTI_DIM_X, GEMVN_MULTI_DIM_Y);
+        hipLaunchKernelGGL((gemvn_multi_kernel<GEMVN_MULTI_DIM_X, GEMVN_MULTI_DIM_Y, K, T>),
+                           grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           shifta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           ldx,
+                           stridex,
+                           beta,
+                           y,
+                           shifty,
+                           incy,
+                           ldy,
+                           stridey);
+    }
+    else
+    {
+        dim3 grid(n, batch_count);
+        dim3 threads(GEMVT_MULTI_NB);
+        if(transA == rocblas_operation_transpose)
+            hipLaunchKernelGGL((gemvt_multi_kernel<GEMVT_MULTI_NB, false, K, T>),
+                               grid,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               shifta,
+                               lda,
+                               strideA,
+                               x,
+                               shiftx,
+                               incx,
+                               ldx,
+                               stridex,
+                               beta,
+                               y,
+                               shifty,
+                               incy,
+                               ldy,
+                               stridey);
+        else
+            hipLaunchKernelGGL((gemvt_multi_kernel<GEMVT_MULTI_NB, true, K, T>),
+                               grid,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               shifta,
+                               lda,
+                               strideA,
+                               x,
+                               shiftx,
+                               incx,
+                               ldx,
+                               stridex,
+                               beta,
+                               y,
+                               shifty,
+                               incy,
+                               ldy,
+                               stridey);
+    }
+}
+
+// Launches the kernels for a group of at most GEMV_MULTI_MAX_K vectors, with the smallest number
+// of partial sums per thread which holds all of them
+template <typename T, typename U, typename V, typename W>
+void rocblas_gemv_multi_group(rocblas_handle    handle,
+                              rocblas_operation transA,
+                              rocblas_int       m,
+                              rocblas_int       n,
+                              rocblas_int       k,
+                              U                 alpha,
+                              const V*          A,
+                              ptrdiff_t         shifta,
+                              rocblas_int       lda,
+                              rocblas_stride    strideA,
+                              const V*          x,
+                              ptrdiff_t         shiftx,
+                              rocblas_int       incx,
+                              rocblas_int       ldx,
+                              rocblas_stride    stridex,
+                              U                 beta,
+                              W*                y,
+                              ptrdiff_t         shifty,
+                              rocblas_int       incy,
+                              rocblas_int       ldy,
+                              rocblas_stride    stridey,
+                              rocblas_int       batch_count)
+{
+    auto launch = rocblas_gemv_multi_launch<GEMV_MULTI_MAX_K, T, U, V, W>;
+    if(k <= 4)
+        launch = rocblas_gemv_multi_launch<4, T, U, V, W>;
+    else if(k <= 8)
+        launch = rocblas_gemv_multi_launch<8, T, U, V, W>;
+
+    launch(handle,
+           transA,
+           m,
+           n,
+           k,
+           alpha,
+           A,
+           shifta,
+           lda,
+           strideA,
+           x,
+           shiftx,
+           incx,
+           ldx,
+           stridex,
+           beta,
+           y,
+           shifty,
+           incy,
+           ldy,
+           stridey,
+           batch_count);
+}
+
+/*! \brief GEMV of the k vectors x_j = x + j * ldx and y_j = y + j * ldy, reading A once for each
+    group of GEMV_MULTI_MAX_K vectors. */
+template <typename T, typename U, typename V, typename W>
+rocblas_status rocblas_gemv_multi_template(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const U*          alpha,
+                                           const V*          A,
+                                           rocblas_int       offseta,
+                                           rocblas_int       lda,
+                                           rocblas_stride    strideA,
+                                           const V*          x,
+                                           rocblas_int       offsetx,
+                                           rocblas_int       incx,
+                                           rocblas_int       ldx,
+                                           rocblas_stride    stridex,
+                                           const U*          beta,
+                                           W*                y,
+                                           rocblas_int       offsety,
+                                           rocblas_int       incy,
+                                           rocblas_int       ldy,
+                                           rocblas_stride    stridey,
+                                           rocblas_int       batch_count)
+{
+    //quick return
+    if(!m || !n || !k || !batch_count)
+        return rocblas_status_success;
+
+    bool host_scalars = handle->pointer_mode == rocblas_pointer_mode_host;
+    if(host_scalars && !*alpha && *beta == 1)
+        return rocblas_status_success;
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    auto shiftx
+        = incx < 0 ? offsetx - ptrdiff_t(incx) * (transA == rocblas_operation_none ? n - 1 : m - 1)
+                   : offsetx;
+    auto shifty
+        = incy < 0 ? offsety - ptrdiff_t(incy) * (transA == rocblas_operation_none ? m - 1 : n - 1)
+                   : offsety;
+
+    for(rocblas_int j = 0; j < k; j += GEMV_MULTI_MAX_K)
+    {
+        rocblas_int group = std::min(k - j, GEMV_MULTI_MAX_K);
+        if(host_scalars)
+            rocblas_gemv_multi_group<T>(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        group,
+                                        *alpha,
+                                        A,
+                                        offseta,
+                                        lda,
+                                        strideA,
+                                        x,
+                                        shiftx + j * ptrdiff_t(ldx),
+                                        incx,
+                                        ldx,
+                                        stridex,
+                                        *beta,
+                                        y,
+                                        shifty + j * ptrdiff_t(ldy),
+                                        incy,
+                                        ldy,
+                                        stridey,
+                                        batch_count);
+        else
+            rocblas_gemv_multi_group<T>(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        group,
+                                        alpha,
+                                        A,
+                                        offseta,
+                                        lda,
+                                        strideA,
+                                        x,
+                                        shiftx + j * ptrdiff_t(ldx),
+                                        incx,
+                                        ldx,
+                                        stridex,
+                                        beta,
+                                        y,
+                                        shifty + j * ptrdiff_t(ldy),
+                                        incy,
+                                        ldy,
+                                        stridey,
+                                        batch_count);
+    }
+
+    return rocblas_status_success;
+}
+
+#endif
@@ -6,7 +6,15 @@
 #include "rocblas.h"
 #include "utility.h"
 
-template <typename T, typename U, typename V, typename W>
+/*
+ * Each workgroup updates a GER_DIM_X x GER_DIM_X tile of A. The slices of x and y which the tile
+ * uses are loaded once into LDS, and each thread updates one row of the tile in GER_DIM_X /
+ * GER_DIM_Y columns, so that x and y are read once per tile instead of once per element of A.
+ */
+constexpr rocblas_int GER_DIM_X = 64;
+constexpr rocblas_int GER_DIM_Y = 16;
+
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T, typename U, typename V, typename W>
 __global__ void ger_kernel(rocblas_int    m,
                            rocblas_int    n,
                            W              alpha_device_host,
@@ -24,18 +32,33 @@ __global__ void ger_kernel(rocblas_int    m,
                            rocblas_int lda,
                            rocblas_int strideA)
 {
+    __shared__ T sx[DIM_X];
+    __shared__ T sy[DIM_X];
 
-    ptrdiff_t tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    ptrdiff_t ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    auto alpha = load_scalar(alpha_device_host, hipBlockIdx_z, stride_alpha);
+    if(!alpha)
+        return;
 
-    if(tx < m && ty < n)
-    {
-        auto alpha              = load_scalar(alpha_device_host, hipBlockIdx_z, stride_alpha);
-        T*   A                  = load_ptr_batch(Aa, hipBlockIdx_z, shifta, strideA);
-        const T* __restrict__ x = load_ptr_batch(xa, hipBlockIdx_z, shiftx, stridex);
-        const T* __restrict__ y = load_ptr_batch(ya, hipBlockIdx_z, shifty, stridey);
+    rocblas_int tx   = hipThreadIdx_x;
+    rocblas_int ty   = hipThreadIdx_y;
+    rocblas_int row  = hipBlockIdx_x * DIM_X + tx;
+    rocblas_int col0 = hipBlockIdx_y * DIM_X;
 
-        A[tx + lda * ty] += alpha * x[tx * incx] * y[ty * incy];
+    T*                    A = load_ptr_batch(Aa, hipBlockIdx_z, shifta, strideA);
+    const T* __restrict__ x = load_ptr_batch(xa, hipBlockIdx_z, shiftx, stridex);
+    const T* __restrict__ y = load_ptr_batch(ya, hipBlockIdx_z, shifty, stridey);
+
+    if(ty == 0)
+        sx[tx] = row < m ? x[row * ptrdiff_t(incx)] : T(0);
+    else if(ty == 1)
+        sy[tx] = col0 + tx < n ? y[(col0 + tx) * ptrdiff_t(incy)] : T(0);
+    __syncthreads();
+
+    if(row < m)
+    {
+        T alpha_x = alpha * sx[tx];
+        for(rocblas_int c = ty; c < DIM_X && col0 + c < n; c += DIM_Y)
+            A[row + ptrdiff_t(col0 + c) * lda] += alpha_x * sy[c];
     }
 }
 
@@ -69,16 +92,14 @@ rocblas_status rocblas_ger_template(rocblas_handle handle,
     auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (m - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
-    static constexpr int GEMV_DIM_X = 128;
-    static constexpr int GEMV_DIM_Y = 8;
-    rocblas_int          blocksX    = (m - 1) / GEMV_DIM_X + 1;
-    rocblas_int          blocksY    = (n - 1) / GEMV_DIM_Y + 1;
+    rocblas_int blocksX = (m - 1) / GER_DIM_X + 1;
+    rocblas_int blocksY = (n - 1) / GER_DIM_X + 1;
 
     dim3 grid(blocksX, blocksY, batch_count);
-    dim3 threads(GEMV_DIM_X, GEMV_DIM_Y);
+    dim3 threads(GER_DIM_X, GER_DIM_Y);
 
     if(handle->pointer_mode == rocblas_pointer_mode_device)
-        hipLaunchKernelGGL(ger_kernel<T>,
+        hipLaunchKernelGGL((ger_kernel<GER_DIM_X, GER_DIM_Y, T>),
                            grid,
                            threads,
                            0,
@@ -100,7 +121,7 @@ rocblas_status rocblas_ger_template(rocblas_handle handle,
                            lda,
                            strideA);
     else
-        hipLaunchKernelGGL(ger_kernel<T>,
+        hipLaunchKernelGGL((ger_kernel<GER_DIM_X, GER_DIM_Y, T>),
                            grid,
                            threads,
                            0,
@@ -0,0 +1,357 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "gemm.hpp"
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "utility.h"
+#include <algorithm>
+#include <new>
+
+/*
+ * Rank-1 updates of A, created by rocblas_ger_accumulator_create_impl. Update j is stored as
+ * column j of the panels X = [alpha_0*x_0, alpha_1*x_1, ...] and Y = [y_0, y_1, ...], so that
+ * the pending updates are A += X(:, 0:k) * Y(:, 0:k)^T, which is applied by one GEMM.
+ */
+struct _rocblas_ger_accumulator
+{
+    rocblas_datatype type;
+    rocblas_int      m;
+    rocblas_int      n;
+    void*            A;
+    rocblas_int      lda;
+    rocblas_int      max_k;
+    rocblas_int      k;
+    void*            X;
+    void*            Y;
+};
+
+namespace
+{
+    constexpr rocblas_int GER_ACCUMULATE_NB = 256;
+
+    template <typename>
+    constexpr char rocblas_ger_accumulator_create_name[] = "unknown";
+    template <>
+    constexpr char rocblas_ger_accumulator_create_name<float>[]
+        = "rocblas_sger_accumulator_create";
+    template <>
+    constexpr char rocblas_ger_accumulator_create_name<double>[]
+        = "rocblas_dger_accumulator_create";
+
+    template <typename>
+    constexpr char rocblas_ger_accumulate_name[] = "unknown";
+    template <>
+    constexpr char rocblas_ger_accumulate_name<float>[] = "rocblas_sger_accumulate";
+    template <>
+    constexpr char rocblas_ger_accumulate_name<double>[] = "rocblas_dger_accumulate";
+
+    // Stores alpha*x and y as the next columns of the panels
+    template <typename T, typename U>
+    __global__ void ger_accumulate_kernel(rocblas_int m,
+                                          rocblas_int n,
+                                          U           alpha_device_host,
+                                          const T* __restrict__ x,
+                                          ptrdiff_t   shiftx,
+                                          rocblas_int incx,
+                                          const T* __restrict__ y,
+                                          ptrdiff_t   shifty,
+                                          rocblas_int incy,
+                                          T*          X,
+                                          T*          Y)
+    {
+        auto      alpha = load_scalar(alpha_device_host);
+        ptrdiff_t tid   = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+        if(tid < m)
+            X[tid] = alpha * x[shiftx + tid * incx];
+        if(tid < n)
+            Y[tid] = y[shifty + tid * incy];
+    }
+
+    // A += X(:, 0:k) * Y(:, 0:k)^T, after which the accumulator is empty
+    template <typename T>
+    rocblas_status rocblas_ger_accumulator_flush_template(rocblas_handle          handle,
+                                                          rocblas_ger_accumulator acc)
+    {
+        if(!acc->k)
+            return rocblas_status_success;
+
+        // The panels are scaled by alpha already, so the GEMM scalars are host constants
+        static constexpr T one = 1;
+
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        rocblas_status status = rocblas_gemm_template<false, true>(handle,
+                                                                   rocblas_operation_none,
+                                                                   rocblas_operation_transpose,
+                                                                   acc->m,
+                                                                   acc->n,
+                                                                   acc->k,
+                                                                   &one,
+                                                                   (const T*)acc->X,
+                                                                   0,
+                                                                   acc->m,
+                                                                   0,
+                                                                   (const T*)acc->Y,
+                                                                   0,
+                                                                   acc->n,
+                                                                   0,
+                                                                   &one,
+                                                                   (T*)acc->A,
+                                                                   0,
+                                                                   acc->lda,
+                                                                   0,
+                                                                   1);
+        if(status == rocblas_status_success)
+            acc->k = 0;
+
+        return status;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_ger_accumulator_create_impl(rocblas_handle           handle,
+                                                       rocblas_int              m,
+                                                       rocblas_int              n,
+                                                       T*                       A,
+                                                       rocblas_int              lda,
+                                                       rocblas_int              max_k,
+                                                       rocblas_ger_accumulator* acc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, rocblas_ger_accumulator_create_name<T>, m, n, A, lda, max_k, acc);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_ger_accumulator_create_name<T>,
+                        "M",
+                        m,
+                        "N",
+                        n,
+                        "lda",
+                        lda,
+                        "max_k",
+                        max_k);
+
+        if(m < 0 || n < 0 || lda < m || lda < 1 || max_k < 1)
+            return rocblas_status_invalid_size;
+        if(!acc || (m && n && !A))
+            return rocblas_status_invalid_pointer;
+
+        // The accumulator owns the panels, which outlive the handle's device memory and are
+        // not needed when A is empty
+        auto a = new(std::nothrow) _rocblas_ger_accumulator{
+            rocblas_datatype_from_type<T>, m, n, A, lda, max_k, 0, nullptr, nullptr};
+        if(!a)
+            return rocblas_status_memory_error;
+
+        if(m && n
+           && ((hipMalloc)(&a->X, sizeof(T) * m * size_t(max_k)) != hipSuccess
+               || (hipMalloc)(&a->Y, sizeof(T) * n * size_t(max_k)) != hipSuccess))
+        {
+            (hipFree)(a->X);
+            delete a;
+            return rocblas_status_memory_error;
+        }
+
+        *acc = a;
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_ger_accumulate_impl(rocblas_handle          handle,
+                                               rocblas_ger_accumulator acc,
+                                               const T*                alpha,
+                                               const T*                x,
+                                               rocblas_int             incx,
+                                               const T*                y,
+                                               rocblas_int             incy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+        {
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+                log_trace(handle, rocblas_ger_accumulate_name<T>, acc, *alpha, x, incx, y, incy);
+            else
+                log_trace(handle, rocblas_ger_accumulate_name<T>, acc, alpha, x, incx, y, incy);
+        }
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, rocblas_ger_accumulate_name<T>, "incx", incx, "incy", incy);
+
+        // The accumulator must have been created for the same precision
+        if(!acc || acc->type != rocblas_datatype_from_type<T>)
+            return rocblas_status_invalid_pointer;
+        if(!incx || !incy)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible. Not Argument error
+        rocblas_int m = acc->m;
+        rocblas_int n = acc->n;
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha)
+            return rocblas_status_success;
+
+        hipStream_t rocblas_stream = handle->rocblas_stream;
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        ptrdiff_t shiftx = incx < 0 ? -ptrdiff_t(incx) * (m - 1) : 0;
+        ptrdiff_t shifty = incy < 0 ? -ptrdiff_t(incy) * (n - 1) : 0;
+
+        T* X = (T*)acc->X + ptrdiff_t(acc->k) * m;
+        T* Y = (T*)acc->Y + ptrdiff_t(acc->k) * n;
+
+        dim3 grid((std::max(m, n) - 1) / GER_ACCUMULATE_NB + 1);
+        dim3 threads(GER_ACCUMULATE_NB);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            hipLaunchKernelGGL((ger_accumulate_kernel<T>),
+                               grid,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               alpha,
+                               x,
+                               shiftx,
+                               incx,
+                               y,
+                               shifty,
+                               incy,
+                               X,
+                               Y);
+        else
+            hipLaunchKernelGGL((ger_accumulate_kernel<T>),
+                               grid,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               *alpha,
+                               x,
+                               shiftx,
+                               incx,
+                               y,
+                               shifty,
+                               incy,
+                               X,
+                               Y);
+
+        // A full accumulator is applied at once, so that the next update has a column to use
+        if(++acc->k == acc->max_k)
+            return rocblas_ger_accumulator_flush_template<T>(handle, acc);
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_sger_accumulator_create(rocblas_handle           handle,
+                                               rocblas_int              m,
+                                               rocblas_int              n,
+                                               float*                   A,
+                                               rocblas_int              lda,
+                                               rocblas_int              max_k,
+                                               rocblas_ger_accumulator* acc)
+{
+    return rocblas_ger_accumulator_create_impl(handle, m, n, A, lda, max_k, acc);
+}
+
+rocblas_status rocblas_dger_accumulator_create(rocblas_handle           handle,
+                                               rocblas_int              m,
+                                               rocblas_int              n,
+                                               double*                  A,
+                                               rocblas_int              lda,
+                                               rocblas_int              max_k,
+                                               rocblas_ger_accumulator* acc)
+{
+    return rocblas_ger_accumulator_create_impl(handle, m, n, A, lda, max_k, acc);
+}
+
+rocblas_status rocblas_sger_accumulate(rocblas_handle          handle,
+                                       rocblas_ger_accumulator acc,
+                                       const float*            alpha,
+                                       const float*            x,
+                                       rocblas_int             incx,
+                                       const float*            y,
+                                       rocblas_int             incy)
+{
+    return rocblas_ger_accumulate_impl(handle, acc, alpha, x, incx, y, incy);
+}
+
+rocblas_status rocblas_dger_accumulate(rocblas_handle          handle,
+                                       rocblas_ger_accumulator acc,
+                                       const double*           alpha,
+                                       const double*           x,
+                                       rocblas_int             incx,
+                                       const double*           y,
+                                       rocblas_int             incy)
+{
+    return rocblas_ger_accumulate_impl(handle, acc, alpha, x, incx, y, incy);
+}
+
+rocblas_status rocblas_ger_accumulator_flush(rocblas_handle handle, rocblas_ger_accumulator acc)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_ger_accumulator_flush", acc);
+
+    if(!acc)
+        return rocblas_status_invalid_pointer;
+
+    switch(acc->type)
+    {
+    case rocblas_datatype_f32_r:
+        return rocblas_ger_accumulator_flush_template<float>(handle, acc);
+    case rocblas_datatype_f64_r:
+        return rocblas_ger_accumulator_flush_template<double>(handle, acc);
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+
+rocblas_status rocblas_destroy_ger_accumulator(rocblas_ger_accumulator acc)
+{
+    if(!acc)
+        return rocblas_status_invalid_pointer;
+
+    // hipFree synchronizes with any updates still using the panels
+    hipError_t err_X = (hipFree)(acc->X);
+    hipError_t err_Y = (hipFree)(acc->Y);
+    delete acc;
+    return err_X == hipSuccess && err_Y == hipSuccess ? rocblas_status_success
+                                                      : rocblas_status_memory_error;
+}
+
+} // extern "C"
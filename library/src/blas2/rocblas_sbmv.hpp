@@ -0,0 +1,72 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __ROCBLAS_SBMV_HPP__
+#define __ROCBLAS_SBMV_HPP__
+#include "handle.h"
+#include "packed_band_device.hpp"
+#include "rocblas.h"
+#include "utility.h"
+
+/*! \brief SBMV on strided or batched band matrices and vectors, where only the k
+    superdiagonals (uplo is rocblas_fill_upper) or subdiagonals of A are stored. */
+template <typename T, typename U, typename V, typename W>
+rocblas_status rocblas_sbmv_template(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     rocblas_int    k,
+                                     const U*       alpha,
+                                     const V*       A,
+                                     rocblas_int    offseta,
+                                     rocblas_int    lda,
+                                     rocblas_stride strideA,
+                                     const V*       x,
+                                     rocblas_int    offsetx,
+                                     rocblas_int    incx,
+                                     rocblas_stride stridex,
+                                     const U*       beta,
+                                     W*             y,
+                                     rocblas_int    offsety,
+                                     rocblas_int    incy,
+                                     rocblas_stride stridey,
+                                     rocblas_int    batch_count)
+{
+    //quick return
+    if(!n || !batch_count)
+        return rocblas_status_success;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha && *beta == 1)
+        return rocblas_status_success;
+
+    bool upper = uplo == rocblas_fill_upper;
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+    ptrdiff_t shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
+
+    return rocblas_packed_band_mv_launcher<T>(handle,
+                                              n,
+                                              n,
+                                              upper ? 0 : k,
+                                              upper ? k : 0,
+                                              true,
+                                              false,
+                                              false,
+                                              alpha,
+                                              A,
+                                              offseta,
+                                              lda,
+                                              strideA,
+                                              x,
+                                              shiftx,
+                                              incx,
+                                              stridex,
+                                              beta,
+                                              y,
+                                              shifty,
+                                              incy,
+                                              stridey,
+                                              batch_count);
+}
+
+#endif
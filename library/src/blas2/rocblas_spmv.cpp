@@ -0,0 +1,147 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_spmv.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_spmv_name[] = "unknown";
+    template <>
+    constexpr char rocblas_spmv_name<float>[] = "rocblas_sspmv";
+    template <>
+    constexpr char rocblas_spmv_name<double>[] = "rocblas_dspmv";
+
+    template <typename T>
+    rocblas_status rocblas_spmv_impl(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     const T*       alpha,
+                                     const T*       AP,
+                                     const T*       x,
+                                     rocblas_int    incx,
+                                     const T*       beta,
+                                     T*             y,
+                                     rocblas_int    incy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto uplo_letter = rocblas_fill_letter(uplo);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_spmv_name<T>,
+                              uplo,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              AP,
+                              x,
+                              incx,
+                              log_trace_scalar_value(beta),
+                              y,
+                              incy);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              "./rocblas-bench -f spmv -r",
+                              rocblas_precision_string<T>,
+                              "--uplo",
+                              uplo_letter,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--incx",
+                              incx,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--incy",
+                              incy);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(
+                        handle, rocblas_spmv_name<T>, uplo, n, alpha, AP, x, incx, beta, y, incy);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_spmv_name<T>,
+                            "uplo",
+                            uplo_letter,
+                            "N",
+                            n,
+                            "incx",
+                            incx,
+                            "incy",
+                            incy);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(n < 0 || !incx || !incy)
+            return rocblas_status_invalid_size;
+
+        // quick return if possible.
+        if(!n)
+            return rocblas_status_success;
+
+        if(!AP || !x || !y || !alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_spmv_template<T>(
+            handle, uplo, n, alpha, AP, 0, 0, x, 0, incx, 0, beta, y, 0, incy, 0, 1);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_sspmv(rocblas_handle handle,
+                             rocblas_fill   uplo,
+                             rocblas_int    n,
+                             const float*   alpha,
+                             const float*   AP,
+                             const float*   x,
+                             rocblas_int    incx,
+                             const float*   beta,
+                             float*         y,
+                             rocblas_int    incy)
+{
+    return rocblas_spmv_impl(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+rocblas_status rocblas_dspmv(rocblas_handle handle,
+                             rocblas_fill   uplo,
+                             rocblas_int    n,
+                             const double*  alpha,
+                             const double*  AP,
+                             const double*  x,
+                             rocblas_int    incx,
+                             const double*  beta,
+                             double*        y,
+                             rocblas_int    incy)
+{
+    return rocblas_spmv_impl(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+} // extern "C"
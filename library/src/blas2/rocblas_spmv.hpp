@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __ROCBLAS_SPMV_HPP__
+#define __ROCBLAS_SPMV_HPP__
+#include "handle.h"
+#include "packed_band_device.hpp"
+#include "rocblas.h"
+#include "utility.h"
+
+/*! \brief SPMV on strided or batched packed matrices and vectors. */
+template <typename T, typename U, typename V, typename W>
+rocblas_status rocblas_spmv_template(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     const U*       alpha,
+                                     const V*       AP,
+                                     rocblas_int    offseta,
+                                     rocblas_stride strideA,
+                                     const V*       x,
+                                     rocblas_int    offsetx,
+                                     rocblas_int    incx,
+                                     rocblas_stride stridex,
+                                     const U*       beta,
+                                     W*             y,
+                                     rocblas_int    offsety,
+                                     rocblas_int    incy,
+                                     rocblas_stride stridey,
+                                     rocblas_int    batch_count)
+{
+    //quick return
+    if(!n || !batch_count)
+        return rocblas_status_success;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha && *beta == 1)
+        return rocblas_status_success;
+
+    bool upper = uplo == rocblas_fill_upper;
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+    ptrdiff_t shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
+
+    // A packed matrix is passed with lda = 0
+    return rocblas_packed_band_mv_launcher<T>(handle,
+                                              n,
+                                              n,
+                                              upper ? 0 : n - 1,
+                                              upper ? n - 1 : 0,
+                                              true,
+                                              false,
+                                              false,
+                                              alpha,
+                                              AP,
+                                              offseta,
+                                              0,
+                                              strideA,
+                                              x,
+                                              shiftx,
+                                              incx,
+                                              stridex,
+                                              beta,
+                                              y,
+                                              shifty,
+                                              incy,
+                                              stridey,
+                                              batch_count);
+}
+
+#endif
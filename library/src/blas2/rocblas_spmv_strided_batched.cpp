@@ -0,0 +1,209 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_spmv.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_spmv_name[] = "unknown";
+    template <>
+    constexpr char rocblas_spmv_name<float>[] = "rocblas_sspmv_strided_batched";
+    template <>
+    constexpr char rocblas_spmv_name<double>[] = "rocblas_dspmv_strided_batched";
+
+    template <typename T>
+    rocblas_status rocblas_spmv_strided_batched_impl(rocblas_handle handle,
+                                                     rocblas_fill   uplo,
+                                                     rocblas_int    n,
+                                                     const T*       alpha,
+                                                     const T*       AP,
+                                                     rocblas_stride strideA,
+                                                     const T*       x,
+                                                     rocblas_int    incx,
+                                                     rocblas_stride stridex,
+                                                     const T*       beta,
+                                                     T*             y,
+                                                     rocblas_int    incy,
+                                                     rocblas_stride stridey,
+                                                     rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto uplo_letter = rocblas_fill_letter(uplo);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_spmv_name<T>,
+                              uplo,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              AP,
+                              strideA,
+                              x,
+                              incx,
+                              stridex,
+                              log_trace_scalar_value(beta),
+                              y,
+                              incy,
+                              stridey,
+                              batch_count);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              "./rocblas-bench -f spmv_strided_batched -r",
+                              rocblas_precision_string<T>,
+                              "--uplo",
+                              uplo_letter,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--stride_a",
+                              strideA,
+                              "--incx",
+                              incx,
+                              "--stride_x",
+                              stridex,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--incy",
+                              incy,
+                              "--stride_y",
+                              stridey,
+                              "--batch_count",
+                              batch_count);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_spmv_name<T>,
+                              uplo,
+                              n,
+                              alpha,
+                              AP,
+                              strideA,
+                              x,
+                              incx,
+                              stridex,
+                              beta,
+                              y,
+                              incy,
+                              stridey,
+                              batch_count);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_spmv_name<T>,
+                            "uplo",
+                            uplo_letter,
+                            "N",
+                            n,
+                            "stride_a",
+                            strideA,
+                            "incx",
+                            incx,
+                            "stride_x",
+                            stridex,
+                            "incy",
+                            incy,
+                            "stride_y",
+                            stridey,
+                            "batch_count",
+                            batch_count);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(n < 0 || !incx || !incy || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // quick return if possible.
+        if(!n || !batch_count)
+            return rocblas_status_success;
+
+        if(!AP || !x || !y || !alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_spmv_template<T>(handle,
+                                        uplo,
+                                        n,
+                                        alpha,
+                                        AP,
+                                        0,
+                                        strideA,
+                                        x,
+                                        0,
+                                        incx,
+                                        stridex,
+                                        beta,
+                                        y,
+                                        0,
+                                        incy,
+                                        stridey,
+                                        batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_sspmv_strided_batched(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const float*   alpha,
+                                             const float*   AP,
+                                             rocblas_stride strideA,
+                                             const float*   x,
+                                             rocblas_int    incx,
+                                             rocblas_stride stridex,
+                                             const float*   beta,
+                                             float*         y,
+                                             rocblas_int    incy,
+                                             rocblas_stride stridey,
+                                             rocblas_int    batch_count)
+{
+    return rocblas_spmv_strided_batched_impl(
+        handle, uplo, n, alpha, AP, strideA, x, incx, stridex, beta, y, incy, stridey, batch_count);
+}
+
+rocblas_status rocblas_dspmv_strided_batched(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const double*  alpha,
+                                             const double*  AP,
+                                             rocblas_stride strideA,
+                                             const double*  x,
+                                             rocblas_int    incx,
+                                             rocblas_stride stridex,
+                                             const double*  beta,
+                                             double*        y,
+                                             rocblas_int    incy,
+                                             rocblas_stride stridey,
+                                             rocblas_int    batch_count)
+{
+    return rocblas_spmv_strided_batched_impl(
+        handle, uplo, n, alpha, AP, strideA, x, incx, stridex, beta, y, incy, stridey, batch_count);
+}
+
+} // extern "C"
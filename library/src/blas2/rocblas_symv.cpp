@@ -0,0 +1,226 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_symv.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <bool HERM, typename>
+    constexpr char rocblas_symv_name[] = "unknown";
+    template <>
+    constexpr char rocblas_symv_name<false, float>[] = "rocblas_ssymv";
+    template <>
+    constexpr char rocblas_symv_name<false, double>[] = "rocblas_dsymv";
+    template <>
+    constexpr char rocblas_symv_name<true, rocblas_float_complex>[] = "rocblas_chemv";
+    template <>
+    constexpr char rocblas_symv_name<true, rocblas_double_complex>[] = "rocblas_zhemv";
+
+    template <bool HERM, typename T>
+    rocblas_status rocblas_symv_impl(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     const T*       alpha,
+                                     const T*       A,
+                                     rocblas_int    lda,
+                                     const T*       x,
+                                     rocblas_int    incx,
+                                     const T*       beta,
+                                     T*             y,
+                                     rocblas_int    incy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto uplo_letter = rocblas_fill_letter(uplo);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_symv_name<HERM, T>,
+                              uplo,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              lda,
+                              x,
+                              incx,
+                              log_trace_scalar_value(beta),
+                              y,
+                              incy);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              HERM ? "./rocblas-bench -f hemv -r" : "./rocblas-bench -f symv -r",
+                              rocblas_precision_string<T>,
+                              "--uplo",
+                              uplo_letter,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              "--incx",
+                              incx,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--incy",
+                              incy);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_symv_name<HERM, T>,
+                              uplo,
+                              n,
+                              alpha,
+                              A,
+                              lda,
+                              x,
+                              incx,
+                              beta,
+                              y,
+                              incy);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_symv_name<HERM, T>,
+                            "uplo",
+                            uplo_letter,
+                            "N",
+                            n,
+                            "lda",
+                            lda,
+                            "incx",
+                            incx,
+                            "incy",
+                            incy);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(n < 0 || lda < n || lda < 1 || !incx || !incy)
+            return rocblas_status_invalid_size;
+
+        // quick return if possible.
+        // return rocblas_status_size_unchanged if device memory size query
+        if(!n)
+            return handle->is_device_memory_size_query() ? rocblas_status_size_unchanged
+                                                         : rocblas_status_success;
+
+        size_t dev_bytes = rocblas_symv_kernel_workspace_size<T>(uplo, n, 1);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+
+        if(!A || !x || !y || !alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        // Without the workspace, the product is computed by a kernel which reads A twice
+        auto mem = handle->device_malloc(dev_bytes);
+
+        rocblas_status status = rocblas_symv_template<HERM>(handle,
+                                                            uplo,
+                                                            n,
+                                                            alpha,
+                                                            A,
+                                                            0,
+                                                            lda,
+                                                            0,
+                                                            x,
+                                                            0,
+                                                            incx,
+                                                            0,
+                                                            beta,
+                                                            y,
+                                                            0,
+                                                            incy,
+                                                            0,
+                                                            1,
+                                                            mem ? (T*)mem : nullptr);
+
+        return status == rocblas_status_success && !mem ? rocblas_status_perf_degraded : status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ssymv(rocblas_handle handle,
+                             rocblas_fill   uplo,
+                             rocblas_int    n,
+                             const float*   alpha,
+                             const float*   A,
+                             rocblas_int    lda,
+                             const float*   x,
+                             rocblas_int    incx,
+                             const float*   beta,
+                             float*         y,
+                             rocblas_int    incy)
+{
+    return rocblas_symv_impl<false>(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+rocblas_status rocblas_dsymv(rocblas_handle handle,
+                             rocblas_fill   uplo,
+                             rocblas_int    n,
+                             const double*  alpha,
+                             const double*  A,
+                             rocblas_int    lda,
+                             const double*  x,
+                             rocblas_int    incx,
+                             const double*  beta,
+                             double*        y,
+                             rocblas_int    incy)
+{
+    return rocblas_symv_impl<false>(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+rocblas_status rocblas_chemv(rocblas_handle               handle,
+                             rocblas_fill                 uplo,
+                             rocblas_int                  n,
+                             const rocblas_float_complex* alpha,
+                             const rocblas_float_complex* A,
+                             rocblas_int                  lda,
+                             const rocblas_float_complex* x,
+                             rocblas_int                  incx,
+                             const rocblas_float_complex* beta,
+                             rocblas_float_complex*       y,
+                             rocblas_int                  incy)
+{
+    return rocblas_symv_impl<true>(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+rocblas_status rocblas_zhemv(rocblas_handle                handle,
+                             rocblas_fill                  uplo,
+                             rocblas_int                   n,
+                             const rocblas_double_complex* alpha,
+                             const rocblas_double_complex* A,
+                             rocblas_int                   lda,
+                             const rocblas_double_complex* x,
+                             rocblas_int                   incx,
+                             const rocblas_double_complex* beta,
+                             rocblas_double_complex*       y,
+                             rocblas_int                   incy)
+{
+    return rocblas_symv_impl<true>(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+} // extern "C"
@@ -0,0 +1,430 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __ROCBLAS_SYMV_HPP__
+#define __ROCBLAS_SYMV_HPP__
+#include "handle.h"
+#include "rocblas.h"
+#include "utility.h"
+
+/*
+ * Symmetric (symv) and Hermitian (hemv) matrix-vector products
+ *
+ *   y = alpha * A * x + beta * y
+ *
+ * where only the triangle of A selected by uplo is read, and each stored element is read once.
+ * A is divided into SYMV_NB x SYMV_NB blocks, and workgroup J of symv_kernel reads the stored
+ * blocks of block column J into LDS. An off-diagonal block S in block row I contributes S * x_J
+ * to y_I and S^T * x_I (S^H for hemv) to y_J, so it is used for both products while it is in
+ * LDS. The contributions to y_J are summed in registers, and those to y_I are written to a
+ * workspace of partial sums. Block column J writes only the rows of its stored blocks, so the
+ * workspace holds those rows of each block column, packed one after another, which is half of
+ * an n x blocks array. symv_reduce_kernel adds the partial sums of each element of y and applies
+ * alpha and beta.
+ *
+ * When the workspace cannot be allocated, symv_direct_kernel computes each element of y from a
+ * row of the symmetric matrix, reading each stored element twice.
+ */
+
+constexpr rocblas_int SYMV_NB        = 32;
+constexpr rocblas_int SYMV_DIM_Y     = 8;
+constexpr rocblas_int SYMV_REDUCE_NB = 256;
+
+// Offset in the workspace of a batch of the partial sums of block column J, such that those of
+// row r are at the offset plus r. Block column J has the rows from J * NB to n (lower), or from 0
+// to the end of its diagonal block (upper).
+template <rocblas_int NB>
+__host__ __device__ inline ptrdiff_t symv_workspace_column(bool lower, rocblas_int n, rocblas_int J)
+{
+    return lower ? ptrdiff_t(J) * n - ptrdiff_t(NB) * J * (J + 1) / 2
+                 : ptrdiff_t(NB) * J * (J + 1) / 2;
+}
+
+// Elements of the workspace of partial sums of each batch
+template <rocblas_int NB>
+__host__ __device__ inline ptrdiff_t symv_workspace_batch_size(bool lower, rocblas_int n)
+{
+    rocblas_int blocks = (n - 1) / NB + 1;
+    return lower ? symv_workspace_column<NB>(lower, n, blocks) + ptrdiff_t(NB) * blocks
+                 : symv_workspace_column<NB>(lower, n, blocks - 1) + n;
+}
+
+// Partial sums of A * x for block column hipBlockIdx_x of A, written to the rows of that block
+// column in the packed workspace of each batch
+template <rocblas_int NB, rocblas_int DIM_Y, bool HERM, typename T, typename V>
+__global__ void symv_kernel(rocblas_fill   uplo,
+                            rocblas_int    n,
+                            const V*       Aa,
+                            ptrdiff_t      shifta,
+                            rocblas_int    lda,
+                            rocblas_stride strideA,
+                            const V*       xa,
+                            ptrdiff_t      shiftx,
+                            rocblas_int    incx,
+                            rocblas_stride stridex,
+                            T*             workspace)
+{
+    // sA[c][r] holds row r and column c of a block. The rows are padded so that the lanes
+    // read different banks both along a row and along a column.
+    __shared__ T sA[NB][NB + 1];
+    __shared__ T sxJ[NB];
+    __shared__ T sxI[NB];
+    __shared__ T sdata[DIM_Y][NB];
+
+    rocblas_int tx     = hipThreadIdx_x;
+    rocblas_int ty     = hipThreadIdx_y;
+    rocblas_int blocks = (n - 1) / NB + 1;
+    rocblas_int col0   = hipBlockIdx_x * NB;
+    rocblas_int ncol   = n - col0 < NB ? n - col0 : NB;
+    bool        lower  = uplo == rocblas_fill_lower;
+
+    const T* A = load_ptr_batch(Aa, hipBlockIdx_y, shifta, strideA);
+    const T* x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
+    workspace += hipBlockIdx_y * symv_workspace_batch_size<NB>(lower, n)
+                 + symv_workspace_column<NB>(lower, n, hipBlockIdx_x);
+
+    if(ty == 0)
+        sxJ[tx] = tx < ncol ? x[(col0 + tx) * ptrdiff_t(incx)] : T(0);
+
+    // The diagonal block is mirrored as it is loaded, so that it can be used as a full block. The
+    // imaginary part of the diagonal of a Hermitian matrix is assumed to be zero.
+    for(rocblas_int c = ty; c < NB; c += DIM_Y)
+    {
+        rocblas_int r = tx;
+        if(r < ncol && c < ncol && (lower ? r >= c : r <= c))
+        {
+            T a = A[col0 + r + ptrdiff_t(col0 + c) * lda];
+            if(r == c)
+                sA[c][r] = HERM ? T(std::real(a)) : a;
+            else
+            {
+                sA[c][r] = a;
+                sA[r][c] = HERM ? conj(a) : a;
+            }
+        }
+        else if(r >= ncol || c >= ncol)
+            sA[c][r] = 0;
+    }
+    __syncthreads();
+
+    // Element col0 + tx of y, summed over the rows ty, ty + DIM_Y, ... of each block
+    T sum = 0;
+    for(rocblas_int c = ty; c < NB; c += DIM_Y)
+        sum += sA[c][tx] * sxJ[c];
+
+    rocblas_int first = lower ? hipBlockIdx_x + 1 : 0;
+    rocblas_int last  = lower ? blocks : hipBlockIdx_x;
+    for(rocblas_int I = first; I < last; I++)
+    {
+        rocblas_int row0 = I * NB;
+        rocblas_int nrow = n - row0 < NB ? n - row0 : NB;
+
+        __syncthreads();
+        if(ty == 0)
+            sxI[tx] = tx < nrow ? x[(row0 + tx) * ptrdiff_t(incx)] : T(0);
+
+        // S * x_J, for row tx of the block
+        T rsum = 0;
+        for(rocblas_int c = ty; c < NB; c += DIM_Y)
+        {
+            T a       = tx < nrow && c < ncol ? A[row0 + tx + ptrdiff_t(col0 + c) * lda] : T(0);
+            sA[c][tx] = a;
+            rsum += a * sxJ[c];
+        }
+        sdata[ty][tx] = rsum;
+        __syncthreads();
+
+        // S^T * x_I or S^H * x_I, for column tx of the block
+        for(rocblas_int r = ty; r < NB; r += DIM_Y)
+            sum += (HERM ? conj(sA[tx][r]) : sA[tx][r]) * sxI[r];
+
+        if(ty == 0 && tx < nrow)
+        {
+            T res = sdata[0][tx];
+            for(rocblas_int l = 1; l < DIM_Y; l++)
+                res += sdata[l][tx];
+            workspace[row0 + tx] = res;
+        }
+    }
+
+    __syncthreads();
+    sdata[ty][tx] = sum;
+    __syncthreads();
+
+    if(ty == 0 && tx < ncol)
+    {
+        T res = sdata[0][tx];
+        for(rocblas_int l = 1; l < DIM_Y; l++)
+            res += sdata[l][tx];
+        workspace[col0 + tx] = res;
+    }
+}
+
+// y = alpha * (sum of the partial sums of element i) + beta * y. Block row I of A has stored
+// blocks in block columns J <= I (lower) or J >= I (upper), which wrote the partial sums.
+template <rocblas_int NB, rocblas_int BLOCK, typename T, typename U, typename W>
+__global__ void symv_reduce_kernel(rocblas_fill   uplo,
+                                   rocblas_int    n,
+                                   U              alpha_device_host,
+                                   U              beta_device_host,
+                                   const T*       workspace,
+                                   W*             ya,
+                                   ptrdiff_t      shifty,
+                                   rocblas_int    incy,
+                                   rocblas_stride stridey)
+{
+    rocblas_int i = hipBlockIdx_x * NB + hipThreadIdx_x;
+    if(i >= n)
+        return;
+
+    T* y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    bool        lower  = uplo == rocblas_fill_lower;
+    rocblas_int blocks = (n - 1) / BLOCK + 1;
+    rocblas_int first  = lower ? 0 : i / BLOCK;
+    rocblas_int last   = lower ? i / BLOCK + 1 : blocks;
+    workspace += hipBlockIdx_y * symv_workspace_batch_size<BLOCK>(lower, n) + i;
+
+    T sum = 0;
+    for(rocblas_int J = first; J < last; J++)
+        sum += workspace[symv_workspace_column<BLOCK>(lower, n, J)];
+
+    if(beta != 0)
+        y[i * incy] = alpha * sum + beta * y[i * incy];
+    else
+        y[i * incy] = alpha * sum;
+}
+
+// y = alpha * A * x + beta * y without workspace. Each workgroup computes DIM_X elements of y,
+// and the DIM_Y rows of threads sum over interleaved columns of A.
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          bool        HERM,
+          typename T,
+          typename U,
+          typename V,
+          typename W>
+__global__ void symv_direct_kernel(rocblas_fill   uplo,
+                                   rocblas_int    n,
+                                   U              alpha_device_host,
+                                   const V*       Aa,
+                                   ptrdiff_t      shifta,
+                                   rocblas_int    lda,
+                                   rocblas_stride strideA,
+                                   const V*       xa,
+                                   ptrdiff_t      shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_stride stridex,
+                                   U              beta_device_host,
+                                   W*             ya,
+                                   ptrdiff_t      shifty,
+                                   rocblas_int    incy,
+                                   rocblas_stride stridey)
+{
+    __shared__ T sdata[DIM_Y][DIM_X];
+
+    rocblas_int tx    = hipThreadIdx_x;
+    rocblas_int ty    = hipThreadIdx_y;
+    rocblas_int i     = hipBlockIdx_x * DIM_X + tx;
+    bool        lower = uplo == rocblas_fill_lower;
+
+    const T* A = load_ptr_batch(Aa, hipBlockIdx_y, shifta, strideA);
+    const T* x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
+
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    // Element (i, j) is read from the stored triangle, as in symv_kernel
+    T sum = 0;
+    if(i < n && alpha != 0)
+    {
+        for(rocblas_int j = ty; j < n; j += DIM_Y)
+        {
+            T a;
+            if(i == j)
+                a = HERM ? T(std::real(A[i + ptrdiff_t(i) * lda])) : A[i + ptrdiff_t(i) * lda];
+            else if(lower == (i > j))
+                a = A[i + ptrdiff_t(j) * lda];
+            else
+                a = HERM ? conj(A[j + ptrdiff_t(i) * lda]) : A[j + ptrdiff_t(i) * lda];
+            sum += a * x[j * ptrdiff_t(incx)];
+        }
+    }
+    sdata[ty][tx] = sum;
+    __syncthreads();
+
+    if(ty == 0 && i < n)
+    {
+        T* y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+
+        for(rocblas_int l = 1; l < DIM_Y; l++)
+            sum += sdata[l][tx];
+
+        if(beta != 0)
+            y[i * incy] = alpha * sum + beta * y[i * incy];
+        else
+            y[i * incy] = alpha * sum;
+    }
+}
+
+// Bytes of the workspace of partial sums which rocblas_symv_template needs
+template <typename T>
+size_t rocblas_symv_kernel_workspace_size(rocblas_fill uplo, rocblas_int n, rocblas_int batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return 0;
+
+    return sizeof(T) * symv_workspace_batch_size<SYMV_NB>(uplo == rocblas_fill_lower, n)
+           * batch_count;
+}
+
+/*! \brief SYMV (HERM false) or HEMV (HERM true) on strided or batched matrices and vectors.
+
+    workspace must hold rocblas_symv_kernel_workspace_size<T>(uplo, n, batch_count) bytes of
+    device memory. When it is nullptr, symv_direct_kernel is used, which reads A twice. */
+template <bool HERM, typename T, typename U, typename V, typename W>
+rocblas_status rocblas_symv_template(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     const U*       alpha,
+                                     const V*       A,
+                                     rocblas_int    offseta,
+                                     rocblas_int    lda,
+                                     rocblas_stride strideA,
+                                     const V*       x,
+                                     rocblas_int    offsetx,
+                                     rocblas_int    incx,
+                                     rocblas_stride stridex,
+                                     const U*       beta,
+                                     W*             y,
+                                     rocblas_int    offsety,
+                                     rocblas_int    incy,
+                                     rocblas_stride stridey,
+                                     rocblas_int    batch_count,
+                                     T*             workspace)
+{
+    //quick return
+    if(!n || !batch_count)
+        return rocblas_status_success;
+
+    bool host_scalars = handle->pointer_mode == rocblas_pointer_mode_host;
+    if(host_scalars && !*alpha && *beta == 1)
+        return rocblas_status_success;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+    ptrdiff_t shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
+
+    if(!workspace)
+    {
+        dim3 direct_grid((n - 1) / SYMV_NB + 1, batch_count);
+        dim3 direct_threads(SYMV_NB, SYMV_DIM_Y);
+        if(host_scalars)
+            hipLaunchKernelGGL((symv_direct_kernel<SYMV_NB, SYMV_DIM_Y, HERM, T>),
+                               direct_grid,
+                               direct_threads,
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               n,
+                               *alpha,
+                               A,
+                               offseta,
+                               lda,
+                               strideA,
+                               x,
+                               shiftx,
+                               incx,
+                               stridex,
+                               *beta,
+                               y,
+                               shifty,
+                               incy,
+                               stridey);
+        else
+            hipLaunchKernelGGL((symv_direct_kernel<SYMV_NB, SYMV_DIM_Y, HERM, T>),
+                               direct_grid,
+                               direct_threads,
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               n,
+                               alpha,
+                               A,
+                               offseta,
+                               lda,
+                               strideA,
+                               x,
+                               shiftx,
+                               incx,
+                               stridex,
+                               beta,
+                               y,
+                               shifty,
+                               incy,
+                               stridey);
+
+        return rocblas_status_success;
+    }
+
+    dim3 grid((n - 1) / SYMV_NB + 1, batch_count);
+    dim3 threads(SYMV_NB, SYMV_DIM_Y);
+    hipLaunchKernelGGL((symv_kernel<SYMV_NB, SYMV_DIM_Y, HERM, T>),
+                       grid,
+                       threads,
+                       0,
+                       rocblas_stream,
+                       uplo,
+                       n,
+                       A,
+                       offseta,
+                       lda,
+                       strideA,
+                       x,
+                       shiftx,
+                       incx,
+                       stridex,
+                       workspace);
+
+    dim3 reduce_grid((n - 1) / SYMV_REDUCE_NB + 1, batch_count);
+    dim3 reduce_threads(SYMV_REDUCE_NB);
+    if(host_scalars)
+        hipLaunchKernelGGL((symv_reduce_kernel<SYMV_REDUCE_NB, SYMV_NB, T>),
+                           reduce_grid,
+                           reduce_threads,
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           *alpha,
+                           *beta,
+                           workspace,
+                           y,
+                           shifty,
+                           incy,
+                           stridey);
+    else
+        hipLaunchKernelGGL((symv_reduce_kernel<SYMV_REDUCE_NB, SYMV_NB, T>),
+                           reduce_grid,
+                           reduce_threads,
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           alpha,
+                           beta,
+                           workspace,
+                           y,
+                           shifty,
+                           incy,
+                           stridey);
+
+    return rocblas_status_success;
+}
+
+#endif
@@ -0,0 +1,242 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_symv.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <bool HERM, typename>
+    constexpr char rocblas_symv_name[] = "unknown";
+    template <>
+    constexpr char rocblas_symv_name<false, float>[] = "rocblas_ssymv_batched";
+    template <>
+    constexpr char rocblas_symv_name<false, double>[] = "rocblas_dsymv_batched";
+    template <>
+    constexpr char rocblas_symv_name<true, rocblas_float_complex>[] = "rocblas_chemv_batched";
+    template <>
+    constexpr char rocblas_symv_name<true, rocblas_double_complex>[] = "rocblas_zhemv_batched";
+
+    template <bool HERM, typename T>
+    rocblas_status rocblas_symv_batched_impl(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const T*       alpha,
+                                             const T* const A[],
+                                             rocblas_int    lda,
+                                             const T* const x[],
+                                             rocblas_int    incx,
+                                             const T*       beta,
+                                             T* const       y[],
+                                             rocblas_int    incy,
+                                             rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto uplo_letter = rocblas_fill_letter(uplo);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_symv_name<HERM, T>,
+                              uplo,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              lda,
+                              x,
+                              incx,
+                              log_trace_scalar_value(beta),
+                              y,
+                              incy,
+                              batch_count);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              HERM ? "./rocblas-bench -f hemv_batched -r"
+                                   : "./rocblas-bench -f symv_batched -r",
+                              rocblas_precision_string<T>,
+                              "--uplo",
+                              uplo_letter,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              "--incx",
+                              incx,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--incy",
+                              incy,
+                              "--batch_count",
+                              batch_count);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_symv_name<HERM, T>,
+                              uplo,
+                              n,
+                              alpha,
+                              A,
+                              lda,
+                              x,
+                              incx,
+                              beta,
+                              y,
+                              incy,
+                              batch_count);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_symv_name<HERM, T>,
+                            "uplo",
+                            uplo_letter,
+                            "N",
+                            n,
+                            "lda",
+                            lda,
+                            "incx",
+                            incx,
+                            "incy",
+                            incy,
+                            "batch_count",
+                            batch_count);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(n < 0 || lda < n || lda < 1 || !incx || !incy || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // quick return if possible.
+        // return rocblas_status_size_unchanged if device memory size query
+        if(!n || !batch_count)
+            return handle->is_device_memory_size_query() ? rocblas_status_size_unchanged
+                                                         : rocblas_status_success;
+
+        size_t dev_bytes = rocblas_symv_kernel_workspace_size<T>(uplo, n, batch_count);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+
+        if(!A || !x || !y || !alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        // Without the workspace, the product is computed by a kernel which reads A twice
+        auto mem = handle->device_malloc(dev_bytes);
+
+        rocblas_status status = rocblas_symv_template<HERM>(handle,
+                                                            uplo,
+                                                            n,
+                                                            alpha,
+                                                            A,
+                                                            0,
+                                                            lda,
+                                                            0,
+                                                            x,
+                                                            0,
+                                                            incx,
+                                                            0,
+                                                            beta,
+                                                            y,
+                                                            0,
+                                                            incy,
+                                                            0,
+                                                            batch_count,
+                                                            mem ? (T*)mem : nullptr);
+
+        return status == rocblas_status_success && !mem ? rocblas_status_perf_degraded : status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ssymv_batched(rocblas_handle     handle,
+                                     rocblas_fill       uplo,
+                                     rocblas_int        n,
+                                     const float*       alpha,
+                                     const float* const A[],
+                                     rocblas_int        lda,
+                                     const float* const x[],
+                                     rocblas_int        incx,
+                                     const float*       beta,
+                                     float* const       y[],
+                                     rocblas_int        incy,
+                                     rocblas_int        batch_count)
+{
+    return rocblas_symv_batched_impl<false>(
+        handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+rocblas_status rocblas_dsymv_batched(rocblas_handle      handle,
+                                     rocblas_fill        uplo,
+                                     rocblas_int         n,
+                                     const double*       alpha,
+                                     const double* const A[],
+                                     rocblas_int         lda,
+                                     const double* const x[],
+                                     rocblas_int         incx,
+                                     const double*       beta,
+                                     double* const       y[],
+                                     rocblas_int         incy,
+                                     rocblas_int         batch_count)
+{
+    return rocblas_symv_batched_impl<false>(
+        handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+rocblas_status rocblas_chemv_batched(rocblas_handle                     handle,
+                                     rocblas_fill                       uplo,
+                                     rocblas_int                        n,
+                                     const rocblas_float_complex*       alpha,
+                                     const rocblas_float_complex* const A[],
+                                     rocblas_int                        lda,
+                                     const rocblas_float_complex* const x[],
+                                     rocblas_int                        incx,
+                                     const rocblas_float_complex*       beta,
+                                     rocblas_float_complex* const       y[],
+                                     rocblas_int                        incy,
+                                     rocblas_int                        batch_count)
+{
+    return rocblas_symv_batched_impl<true>(
+        handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+rocblas_status rocblas_zhemv_batched(rocblas_handle                      handle,
+                                     rocblas_fill                        uplo,
+                                     rocblas_int                         n,
+                                     const rocblas_double_complex*       alpha,
+                                     const rocblas_double_complex* const A[],
+                                     rocblas_int                         lda,
+                                     const rocblas_double_complex* const x[],
+                                     rocblas_int                         incx,
+                                     const rocblas_double_complex*       beta,
+                                     rocblas_double_complex* const       y[],
+                                     rocblas_int                         incy,
+                                     rocblas_int                         batch_count)
+{
+    return rocblas_symv_batched_impl<true>(
+        handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+} // extern "C"
@@ -0,0 +1,329 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_symv.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <bool HERM, typename>
+    constexpr char rocblas_symv_name[] = "unknown";
+    template <>
+    constexpr char rocblas_symv_name<false, float>[] = "rocblas_ssymv_strided_batched";
+    template <>
+    constexpr char rocblas_symv_name<false, double>[] = "rocblas_dsymv_strided_batched";
+    template <>
+    constexpr char rocblas_symv_name<true, rocblas_float_complex>[]
+        = "rocblas_chemv_strided_batched";
+    template <>
+    constexpr char rocblas_symv_name<true, rocblas_double_complex>[]
+        = "rocblas_zhemv_strided_batched";
+
+    template <bool HERM, typename T>
+    rocblas_status rocblas_symv_strided_batched_impl(rocblas_handle handle,
+                                                     rocblas_fill   uplo,
+                                                     rocblas_int    n,
+                                                     const T*       alpha,
+                                                     const T*       A,
+                                                     rocblas_int    lda,
+                                                     rocblas_stride strideA,
+                                                     const T*       x,
+                                                     rocblas_int    incx,
+                                                     rocblas_stride stridex,
+                                                     const T*       beta,
+                                                     T*             y,
+                                                     rocblas_int    incy,
+                                                     rocblas_stride stridey,
+                                                     rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto uplo_letter = rocblas_fill_letter(uplo);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_symv_name<HERM, T>,
+                              uplo,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              lda,
+                              strideA,
+                              x,
+                              incx,
+                              stridex,
+                              log_trace_scalar_value(beta),
+                              y,
+                              incy,
+                              stridey,
+                              batch_count);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              HERM ? "./rocblas-bench -f hemv_strided_batched -r"
+                                   : "./rocblas-bench -f symv_strided_batched -r",
+                              rocblas_precision_string<T>,
+                              "--uplo",
+                              uplo_letter,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              "--stride_a",
+                              strideA,
+                              "--incx",
+                              incx,
+                              "--stride_x",
+                              stridex,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--incy",
+                              incy,
+                              "--stride_y",
+                              stridey,
+                              "--batch_count",
+                              batch_count);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_symv_name<HERM, T>,
+                              uplo,
+                              n,
+                              alpha,
+                              A,
+                              lda,
+                              strideA,
+                              x,
+                              incx,
+                              stridex,
+                              beta,
+                              y,
+                              incy,
+                              stridey,
+                              batch_count);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_symv_name<HERM, T>,
+                            "uplo",
+                            uplo_letter,
+                            "N",
+                            n,
+                            "lda",
+                            lda,
+                            "stride_a",
+                            strideA,
+                            "incx",
+                            incx,
+                            "stride_x",
+                            stridex,
+                            "incy",
+                            incy,
+                            "stride_y",
+                            stridey,
+                            "batch_count",
+                            batch_count);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(n < 0 || lda < n || lda < 1 || !incx || !incy || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // quick return if possible.
+        // return rocblas_status_size_unchanged if device memory size query
+        if(!n || !batch_count)
+            return handle->is_device_memory_size_query() ? rocblas_status_size_unchanged
+                                                         : rocblas_status_success;
+
+        size_t dev_bytes = rocblas_symv_kernel_workspace_size<T>(uplo, n, batch_count);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+
+        if(!A || !x || !y || !alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        // Without the workspace, the product is computed by a kernel which reads A twice
+        auto mem = handle->device_malloc(dev_bytes);
+
+        rocblas_status status = rocblas_symv_template<HERM>(handle,
+                                                            uplo,
+                                                            n,
+                                                            alpha,
+                                                            A,
+                                                            0,
+                                                            lda,
+                                                            strideA,
+                                                            x,
+                                                            0,
+                                                            incx,
+                                                            stridex,
+                                                            beta,
+                                                            y,
+                                                            0,
+                                                            incy,
+                                                            stridey,
+                                                            batch_count,
+                                                            mem ? (T*)mem : nullptr);
+
+        return status == rocblas_status_success && !mem ? rocblas_status_perf_degraded : status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ssymv_strided_batched(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const float*   alpha,
+                                             const float*   A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             const float*   x,
+                                             rocblas_int    incx,
+                                             rocblas_stride stridex,
+                                             const float*   beta,
+                                             float*         y,
+                                             rocblas_int    incy,
+                                             rocblas_stride stridey,
+                                             rocblas_int    batch_count)
+{
+    return rocblas_symv_strided_batched_impl<false>(handle,
+                                                    uplo,
+                                                    n,
+                                                    alpha,
+                                                    A,
+                                                    lda,
+                                                    strideA,
+                                                    x,
+                                                    incx,
+                                                    stridex,
+                                                    beta,
+                                                    y,
+                                                    incy,
+                                                    stridey,
+                                                    batch_count);
+}
+
+rocblas_status rocblas_dsymv_strided_batched(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const double*  alpha,
+                                             const double*  A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             const double*  x,
+                                             rocblas_int    incx,
+                                             rocblas_stride stridex,
+                                             const double*  beta,
+                                             double*        y,
+                                             rocblas_int    incy,
+                                             rocblas_stride stridey,
+                                             rocblas_int    batch_count)
+{
+    return rocblas_symv_strided_batched_impl<false>(handle,
+                                                    uplo,
+                                                    n,
+                                                    alpha,
+                                                    A,
+                                                    lda,
+                                                    strideA,
+                                                    x,
+                                                    incx,
+                                                    stridex,
+                                                    beta,
+                                                    y,
+                                                    incy,
+                                                    stridey,
+                                                    batch_count);
+}
+
+rocblas_status rocblas_chemv_strided_batched(rocblas_handle               handle,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* A,
+                                             rocblas_int                  lda,
+                                             rocblas_stride               strideA,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  incx,
+                                             rocblas_stride               stridex,
+                                             const rocblas_float_complex* beta,
+                                             rocblas_float_complex*       y,
+                                             rocblas_int                  incy,
+                                             rocblas_stride               stridey,
+                                             rocblas_int                  batch_count)
+{
+    return rocblas_symv_strided_batched_impl<true>(handle,
+                                                   uplo,
+                                                   n,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   beta,
+                                                   y,
+                                                   incy,
+                                                   stridey,
+                                                   batch_count);
+}
+
+rocblas_status rocblas_zhemv_strided_batched(rocblas_handle                handle,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* alpha,
+                                             const rocblas_double_complex* A,
+                                             rocblas_int                   lda,
+                                             rocblas_stride                strideA,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   incx,
+                                             rocblas_stride                stridex,
+                                             const rocblas_double_complex* beta,
+                                             rocblas_double_complex*       y,
+                                             rocblas_int                   incy,
+                                             rocblas_stride                stridey,
+                                             rocblas_int                   batch_count)
+{
+    return rocblas_symv_strided_batched_impl<true>(handle,
+                                                   uplo,
+                                                   n,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   beta,
+                                                   y,
+                                                   incy,
+                                                   stridey,
+                                                   batch_count);
+}
+
+} // extern "C"
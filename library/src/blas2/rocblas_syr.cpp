@@ -7,23 +7,30 @@
 
 namespace
 {
-    template <typename>
+    // her is distinguished from syr by a real U for a complex T
+    template <typename T, typename = T>
     constexpr char rocblas_syr_name[] = "unknown";
     template <>
     constexpr char rocblas_syr_name<float>[] = "rocblas_ssyr";
     template <>
     constexpr char rocblas_syr_name<double>[] = "rocblas_dsyr";
+    template <>
+    constexpr char rocblas_syr_name<rocblas_float_complex, float>[] = "rocblas_cher";
+    template <>
+    constexpr char rocblas_syr_name<rocblas_double_complex, double>[] = "rocblas_zher";
 
-    template <typename T>
+    template <typename T, typename U>
     rocblas_status rocblas_syr_impl(rocblas_handle handle,
                                     rocblas_fill   uplo,
                                     rocblas_int    n,
-                                    const T*       alpha,
+                                    const U*       alpha,
                                     const T*       x,
                                     rocblas_int    incx,
                                     T*             A,
                                     rocblas_int    lda)
     {
+        constexpr bool HERM = is_complex<T> && !is_complex<U>;
+
         if(!handle)
             return rocblas_status_invalid_handle;
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
@@ -39,11 +46,11 @@ namespace
             if(handle->pointer_mode == rocblas_pointer_mode_host)
             {
                 if(layer_mode & rocblas_layer_mode_log_trace)
-                    log_trace(handle, rocblas_syr_name<T>, uplo, n, *alpha, x, incx, A, lda);
+                    log_trace(handle, rocblas_syr_name<T, U>, uplo, n, *alpha, x, incx, A, lda);
 
                 if(layer_mode & rocblas_layer_mode_log_bench)
                     log_bench(handle,
-                              "./rocblas-bench -f syr -r",
+                              HERM ? "./rocblas-bench -f her -r" : "./rocblas-bench -f syr -r",
                               rocblas_precision_string<T>,
                               "--uplo",
                               uplo_letter,
@@ -59,12 +66,12 @@ namespace
             else
             {
                 if(layer_mode & rocblas_layer_mode_log_trace)
-                    log_trace(handle, rocblas_syr_name<T>, uplo, n, alpha, x, incx, A, lda);
+                    log_trace(handle, rocblas_syr_name<T, U>, uplo, n, alpha, x, incx, A, lda);
             }
 
             if(layer_mode & rocblas_layer_mode_log_profile)
                 log_profile(handle,
-                            rocblas_syr_name<T>,
+                            rocblas_syr_name<T, U>,
                             "uplo",
                             uplo_letter,
                             "N",
@@ -82,7 +89,7 @@ namespace
         if(n < 0 || !incx || lda < n || lda < 1)
             return rocblas_status_invalid_size;
 
-        return rocblas_syr_template(handle, uplo, n, alpha, x, incx, A, lda);
+        return rocblas_syr_template<HERM>(handle, uplo, n, alpha, x, incx, A, lda);
     }
 
 }
@@ -118,4 +125,28 @@ rocblas_status rocblas_dsyr(rocblas_handle handle,
     return rocblas_syr_impl(handle, uplo, n, alpha, x, incx, A, lda);
 }
 
+rocblas_status rocblas_cher(rocblas_handle               handle,
+                            rocblas_fill                 uplo,
+                            rocblas_int                  n,
+                            const float*                 alpha,
+                            const rocblas_float_complex* x,
+                            rocblas_int                  incx,
+                            rocblas_float_complex*       A,
+                            rocblas_int                  lda)
+{
+    return rocblas_syr_impl(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+rocblas_status rocblas_zher(rocblas_handle                handle,
+                            rocblas_fill                  uplo,
+                            rocblas_int                   n,
+                            const double*                 alpha,
+                            const rocblas_double_complex* x,
+                            rocblas_int                   incx,
+                            rocblas_double_complex*       A,
+                            rocblas_int                   lda)
+{
+    return rocblas_syr_impl(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
 } // extern "C"
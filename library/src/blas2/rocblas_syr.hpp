@@ -4,53 +4,130 @@
 #pragma once
 #include "handle.h"
 #include "rocblas.h"
+#include "utility.h"
 
-template <typename T, typename U>
-__global__ void rocblas_syr_kernel(rocblas_fill uplo,
-                                   rocblas_int  n,
-                                   U            alpha_device_host,
-                                   const T* __restrict__ x,
-                                   rocblas_int incx,
-                                   T*          A,
-                                   rocblas_int lda)
+/*
+ * A is updated in SYR_DIM_X x SYR_DIM_X tiles, and only the tiles which intersect the triangle
+ * selected by uplo are launched. The tiles are numbered along the block rows of the lower
+ * triangle, so that tile k is block row I and block column J <= I with k = I * (I + 1) / 2 + J.
+ * For the upper triangle the tile is transposed. As in ger_kernel, the two slices of x which a
+ * tile uses are loaded once into LDS, and each thread updates SYR_DIM_X / SYR_DIM_Y elements.
+ * HER uses this kernel with HERM set, and rocblas_syr2.hpp reuses the tiling for SYR2 and HER2.
+ */
+constexpr rocblas_int SYR_DIM_X = 64;
+constexpr rocblas_int SYR_DIM_Y = 16;
+
+// Block row I and block column J <= I of tile k of a lower triangle of tiles
+__device__ inline void rocblas_tri_tile_index(rocblas_int k, rocblas_int& I, rocblas_int& J)
 {
-    auto        alpha = load_scalar(alpha_device_host);
-    rocblas_int tx    = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    rocblas_int ty    = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    // The square root may be rounded either way, so I is corrected
+    int64_t i = (sqrt(8.0 * k + 1) - 1) / 2;
+    while(i * (i + 1) / 2 > k)
+        i--;
+    while((i + 1) * (i + 2) / 2 <= k)
+        i++;
 
-    if(uplo == rocblas_fill_lower ? tx < n && ty <= tx : ty < n && tx <= ty)
-        A[tx + lda * ty] += alpha * x[tx * incx] * x[ty * incx];
+    I = i;
+    J = k - i * (i + 1) / 2;
 }
 
-template <typename T>
-rocblas_status rocblas_syr_template(rocblas_handle handle,
+// A += alpha * x * x**T, or A += alpha * x * x**H with a real alpha when HERM
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          bool        HERM,
+          typename T,
+          typename U,
+          typename V,
+          typename W>
+__global__ void rocblas_syr_kernel(rocblas_fill   uplo,
+                                   rocblas_int    n,
+                                   W              alpha_device_host,
+                                   rocblas_stride stride_alpha,
+                                   const U __restrict__ xa,
+                                   ptrdiff_t      shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_stride stridex,
+                                   V              Aa,
+                                   ptrdiff_t      shiftA,
+                                   rocblas_int    lda,
+                                   rocblas_stride strideA)
+{
+    __shared__ T sx_row[DIM_X];
+    __shared__ T sx_col[DIM_X];
+
+    auto alpha = load_scalar(alpha_device_host, hipBlockIdx_z, stride_alpha);
+    if(!alpha)
+        return;
+
+    bool        lower = uplo == rocblas_fill_lower;
+    rocblas_int I, J;
+    rocblas_tri_tile_index(hipBlockIdx_x, I, J);
+
+    rocblas_int tx   = hipThreadIdx_x;
+    rocblas_int ty   = hipThreadIdx_y;
+    rocblas_int row  = (lower ? I : J) * DIM_X + tx;
+    rocblas_int col0 = (lower ? J : I) * DIM_X;
+
+    const T* __restrict__ x = load_ptr_batch(xa, hipBlockIdx_z, shiftx, stridex);
+    T*                    A = load_ptr_batch(Aa, hipBlockIdx_z, shiftA, strideA);
+
+    if(ty == 0)
+        sx_row[tx] = row < n ? x[row * ptrdiff_t(incx)] : T(0);
+    else if(ty == 1)
+        sx_col[tx] = col0 + tx < n ? x[(col0 + tx) * ptrdiff_t(incx)] : T(0);
+    __syncthreads();
+
+    if(row < n)
+    {
+        T alpha_x = alpha * sx_row[tx];
+        for(rocblas_int c = ty; c < DIM_X && col0 + c < n; c += DIM_Y)
+        {
+            rocblas_int col = col0 + c;
+            if(lower ? row >= col : row <= col)
+            {
+                T& a = A[row + ptrdiff_t(col) * lda];
+                a += alpha_x * (HERM ? conj(sx_col[c]) : sx_col[c]);
+
+                // The diagonal of a Hermitian matrix is kept real
+                if(HERM && row == col)
+                    a = std::real(a);
+            }
+        }
+    }
+}
+
+// Launches rocblas_syr_kernel on strided or batched x and A
+template <bool HERM, typename T, typename U, typename V, typename W>
+rocblas_status rocblas_syr_launcher(rocblas_handle handle,
                                     rocblas_fill   uplo,
                                     rocblas_int    n,
-                                    const T*       alpha,
-                                    const T*       x,
+                                    const W*       alpha,
+                                    rocblas_stride stride_alpha,
+                                    U              x,
+                                    rocblas_int    offsetx,
                                     rocblas_int    incx,
-                                    T*             A,
-                                    rocblas_int    lda)
+                                    rocblas_stride stridex,
+                                    V              A,
+                                    rocblas_int    offsetA,
+                                    rocblas_int    lda,
+                                    rocblas_stride strideA,
+                                    rocblas_int    batch_count)
 {
     // Quick return if possible. Not Argument error
-    if(!n)
+    if(!n || !batch_count)
         return rocblas_status_success;
 
     hipStream_t rocblas_stream = handle->rocblas_stream;
 
-    static constexpr int GEMV_DIM_X = 128;
-    static constexpr int GEMV_DIM_Y = 8;
-    rocblas_int          blocksX    = (n - 1) / GEMV_DIM_X + 1;
-    rocblas_int          blocksY    = (n - 1) / GEMV_DIM_Y + 1;
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
 
-    dim3 syr_grid(blocksX, blocksY);
-    dim3 syr_threads(GEMV_DIM_X, GEMV_DIM_Y);
-
-    if(incx < 0)
-        x -= ptrdiff_t(incx) * (n - 1);
+    rocblas_int blocks = (n - 1) / SYR_DIM_X + 1;
+    dim3        syr_grid(blocks * (blocks + 1) / 2, 1, batch_count);
+    dim3        syr_threads(SYR_DIM_X, SYR_DIM_Y);
 
     if(rocblas_pointer_mode_device == handle->pointer_mode)
-        hipLaunchKernelGGL(rocblas_syr_kernel,
+        hipLaunchKernelGGL((rocblas_syr_kernel<SYR_DIM_X, SYR_DIM_Y, HERM, T>),
                            syr_grid,
                            syr_threads,
                            0,
@@ -58,12 +135,17 @@ rocblas_status rocblas_syr_template(rocblas_handle handle,
                            uplo,
                            n,
                            alpha,
+                           stride_alpha,
                            x,
+                           shiftx,
                            incx,
+                           stridex,
                            A,
-                           lda);
+                           offsetA,
+                           lda,
+                           strideA);
     else
-        hipLaunchKernelGGL(rocblas_syr_kernel,
+        hipLaunchKernelGGL((rocblas_syr_kernel<SYR_DIM_X, SYR_DIM_Y, HERM, T>),
                            syr_grid,
                            syr_threads,
                            0,
@@ -71,10 +153,29 @@ rocblas_status rocblas_syr_template(rocblas_handle handle,
                            uplo,
                            n,
                            *alpha,
+                           stride_alpha,
                            x,
+                           shiftx,
                            incx,
+                           stridex,
                            A,
-                           lda);
+                           offsetA,
+                           lda,
+                           strideA);
 
     return rocblas_status_success;
 }
+
+// HER when HERM, with a real alpha of type U
+template <bool HERM, typename T, typename U>
+rocblas_status rocblas_syr_template(rocblas_handle handle,
+                                    rocblas_fill   uplo,
+                                    rocblas_int    n,
+                                    const U*       alpha,
+                                    const T*       x,
+                                    rocblas_int    incx,
+                                    T*             A,
+                                    rocblas_int    lda)
+{
+    return rocblas_syr_launcher<HERM, T>(handle, uplo, n, alpha, 0, x, 0, incx, 0, A, 0, lda, 0, 1);
+}
@@ -0,0 +1,186 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_syr2.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <bool HERM, typename>
+    constexpr char rocblas_syr2_name[] = "unknown";
+    template <>
+    constexpr char rocblas_syr2_name<false, float>[] = "rocblas_ssyr2";
+    template <>
+    constexpr char rocblas_syr2_name<false, double>[] = "rocblas_dsyr2";
+    template <>
+    constexpr char rocblas_syr2_name<true, rocblas_float_complex>[] = "rocblas_cher2";
+    template <>
+    constexpr char rocblas_syr2_name<true, rocblas_double_complex>[] = "rocblas_zher2";
+
+    template <bool HERM, typename T>
+    rocblas_status rocblas_syr2_impl(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     const T*       alpha,
+                                     const T*       x,
+                                     rocblas_int    incx,
+                                     const T*       y,
+                                     rocblas_int    incy,
+                                     T*             A,
+                                     rocblas_int    lda)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto uplo_letter = rocblas_fill_letter(uplo);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syr2_name<HERM, T>,
+                              uplo,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              x,
+                              incx,
+                              y,
+                              incy,
+                              A,
+                              lda);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              HERM ? "./rocblas-bench -f her2 -r" : "./rocblas-bench -f syr2 -r",
+                              rocblas_precision_string<T>,
+                              "--uplo",
+                              uplo_letter,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--incx",
+                              incx,
+                              "--incy",
+                              incy,
+                              "--lda",
+                              lda);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syr2_name<HERM, T>,
+                              uplo,
+                              n,
+                              alpha,
+                              x,
+                              incx,
+                              y,
+                              incy,
+                              A,
+                              lda);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_syr2_name<HERM, T>,
+                            "uplo",
+                            uplo_letter,
+                            "N",
+                            n,
+                            "incx",
+                            incx,
+                            "incy",
+                            incy,
+                            "lda",
+                            lda);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(!x || !y || !A)
+            return rocblas_status_invalid_pointer;
+        if(n < 0 || !incx || !incy || lda < n || lda < 1)
+            return rocblas_status_invalid_size;
+
+        return rocblas_syr2_launcher<HERM, T>(
+            handle, uplo, n, alpha, 0, x, 0, incx, 0, y, 0, incy, 0, A, 0, lda, 0, 1);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ssyr2(rocblas_handle handle,
+                             rocblas_fill   uplo,
+                             rocblas_int    n,
+                             const float*   alpha,
+                             const float*   x,
+                             rocblas_int    incx,
+                             const float*   y,
+                             rocblas_int    incy,
+                             float*         A,
+                             rocblas_int    lda)
+{
+    return rocblas_syr2_impl<false>(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+rocblas_status rocblas_dsyr2(rocblas_handle handle,
+                             rocblas_fill   uplo,
+                             rocblas_int    n,
+                             const double*  alpha,
+                             const double*  x,
+                             rocblas_int    incx,
+                             const double*  y,
+                             rocblas_int    incy,
+                             double*        A,
+                             rocblas_int    lda)
+{
+    return rocblas_syr2_impl<false>(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+rocblas_status rocblas_cher2(rocblas_handle               handle,
+                             rocblas_fill                 uplo,
+                             rocblas_int                  n,
+                             const rocblas_float_complex* alpha,
+                             const rocblas_float_complex* x,
+                             rocblas_int                  incx,
+                             const rocblas_float_complex* y,
+                             rocblas_int                  incy,
+                             rocblas_float_complex*       A,
+                             rocblas_int                  lda)
+{
+    return rocblas_syr2_impl<true>(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+rocblas_status rocblas_zher2(rocblas_handle                handle,
+                             rocblas_fill                  uplo,
+                             rocblas_int                   n,
+                             const rocblas_double_complex* alpha,
+                             const rocblas_double_complex* x,
+                             rocblas_int                   incx,
+                             const rocblas_double_complex* y,
+                             rocblas_int                   incy,
+                             rocblas_double_complex*       A,
+                             rocblas_int                   lda)
+{
+    return rocblas_syr2_impl<true>(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+} // extern "C"
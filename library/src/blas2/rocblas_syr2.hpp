@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#pragma once
+#include "handle.h"
+#include "rocblas.h"
+#include "rocblas_syr.hpp"
+#include "utility.h"
+
+/*
+ * A is updated in the same triangle of tiles as rocblas_syr_kernel. Each tile loads the slices
+ * of x and y for its rows and for its columns into LDS, so both rank-1 terms are applied in one
+ * read and write of each stored element of A.
+ */
+
+// A += alpha * x * y**T + alpha * y * x**T, or when HERM
+// A += alpha * x * y**H + conj(alpha) * y * x**H
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          bool        HERM,
+          typename T,
+          typename U,
+          typename V,
+          typename W>
+__global__ void rocblas_syr2_kernel(rocblas_fill   uplo,
+                                    rocblas_int    n,
+                                    W              alpha_device_host,
+                                    rocblas_stride stride_alpha,
+                                    const U __restrict__ xa,
+                                    ptrdiff_t      shiftx,
+                                    rocblas_int    incx,
+                                    rocblas_stride stridex,
+                                    const U __restrict__ ya,
+                                    ptrdiff_t      shifty,
+                                    rocblas_int    incy,
+                                    rocblas_stride stridey,
+                                    V              Aa,
+                                    ptrdiff_t      shiftA,
+                                    rocblas_int    lda,
+                                    rocblas_stride strideA)
+{
+    __shared__ T sx_row[DIM_X];
+    __shared__ T sy_row[DIM_X];
+    __shared__ T sx_col[DIM_X];
+    __shared__ T sy_col[DIM_X];
+
+    auto alpha = load_scalar(alpha_device_host, hipBlockIdx_z, stride_alpha);
+    if(!alpha)
+        return;
+
+    bool        lower = uplo == rocblas_fill_lower;
+    rocblas_int I, J;
+    rocblas_tri_tile_index(hipBlockIdx_x, I, J);
+
+    rocblas_int tx   = hipThreadIdx_x;
+    rocblas_int ty   = hipThreadIdx_y;
+    rocblas_int row  = (lower ? I : J) * DIM_X + tx;
+    rocblas_int col0 = (lower ? J : I) * DIM_X;
+
+    const T* __restrict__ x = load_ptr_batch(xa, hipBlockIdx_z, shiftx, stridex);
+    const T* __restrict__ y = load_ptr_batch(ya, hipBlockIdx_z, shifty, stridey);
+    T*                    A = load_ptr_batch(Aa, hipBlockIdx_z, shiftA, strideA);
+
+    if(ty == 0)
+        sx_row[tx] = row < n ? x[row * ptrdiff_t(incx)] : T(0);
+    else if(ty == 1)
+        sy_row[tx] = row < n ? y[row * ptrdiff_t(incy)] : T(0);
+    else if(ty == 2)
+        sx_col[tx] = col0 + tx < n ? x[(col0 + tx) * ptrdiff_t(incx)] : T(0);
+    else if(ty == 3)
+        sy_col[tx] = col0 + tx < n ? y[(col0 + tx) * ptrdiff_t(incy)] : T(0);
+    __syncthreads();
+
+    if(row < n)
+    {
+        T alpha_x = alpha * sx_row[tx];
+        T alpha_y = (HERM ? conj(alpha) : alpha) * sy_row[tx];
+        for(rocblas_int c = ty; c < DIM_X && col0 + c < n; c += DIM_Y)
+        {
+            rocblas_int col = col0 + c;
+            if(lower ? row >= col : row <= col)
+            {
+                T& a = A[row + ptrdiff_t(col) * lda];
+                a += alpha_x * (HERM ? conj(sy_col[c]) : sy_col[c])
+                     + alpha_y * (HERM ? conj(sx_col[c]) : sx_col[c]);
+
+                // The diagonal of a Hermitian matrix is kept real
+                if(HERM && row == col)
+                    a = std::real(a);
+            }
+        }
+    }
+}
+
+// Launches rocblas_syr2_kernel on strided or batched x, y and A
+template <bool HERM, typename T, typename U, typename V, typename W>
+rocblas_status rocblas_syr2_launcher(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     const W*       alpha,
+                                     rocblas_stride stride_alpha,
+                                     U              x,
+                                     rocblas_int    offsetx,
+                                     rocblas_int    incx,
+                                     rocblas_stride stridex,
+                                     U              y,
+                                     rocblas_int    offsety,
+                                     rocblas_int    incy,
+                                     rocblas_stride stridey,
+                                     V              A,
+                                     rocblas_int    offsetA,
+                                     rocblas_int    lda,
+                                     rocblas_stride strideA,
+                                     rocblas_int    batch_count)
+{
+    // Quick return if possible. Not Argument error
+    if(!n || !batch_count)
+        return rocblas_status_success;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+    ptrdiff_t shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
+
+    rocblas_int blocks = (n - 1) / SYR_DIM_X + 1;
+    dim3        syr2_grid(blocks * (blocks + 1) / 2, 1, batch_count);
+    dim3        syr2_threads(SYR_DIM_X, SYR_DIM_Y);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+        hipLaunchKernelGGL((rocblas_syr2_kernel<SYR_DIM_X, SYR_DIM_Y, HERM, T>),
+                           syr2_grid,
+                           syr2_threads,
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           alpha,
+                           stride_alpha,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           A,
+                           offsetA,
+                           lda,
+                           strideA);
+    else
+        hipLaunchKernelGGL((rocblas_syr2_kernel<SYR_DIM_X, SYR_DIM_Y, HERM, T>),
+                           syr2_grid,
+                           syr2_threads,
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           *alpha,
+                           stride_alpha,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           A,
+                           offsetA,
+                           lda,
+                           strideA);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_syr2.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <bool HERM, typename>
+    constexpr char rocblas_syr2_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_syr2_batched_name<false, float>[] = "rocblas_ssyr2_batched";
+    template <>
+    constexpr char rocblas_syr2_batched_name<false, double>[] = "rocblas_dsyr2_batched";
+    template <>
+    constexpr char rocblas_syr2_batched_name<true, rocblas_float_complex>[]
+        = "rocblas_cher2_batched";
+    template <>
+    constexpr char rocblas_syr2_batched_name<true, rocblas_double_complex>[]
+        = "rocblas_zher2_batched";
+
+    template <bool HERM, typename T>
+    rocblas_status rocblas_syr2_batched_impl(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const T*       alpha,
+                                             const T* const x[],
+                                             rocblas_int    shiftx,
+                                             rocblas_int    incx,
+                                             const T* const y[],
+                                             rocblas_int    shifty,
+                                             rocblas_int    incy,
+                                             T* const       A[],
+                                             rocblas_int    shiftA,
+                                             rocblas_int    lda,
+                                             rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto uplo_letter = rocblas_fill_letter(uplo);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syr2_batched_name<HERM, T>,
+                              uplo,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              x,
+                              incx,
+                              y,
+                              incy,
+                              A,
+                              lda,
+                              batch_count);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              HERM ? "./rocblas-bench -f her2_batched -r"
+                                   : "./rocblas-bench -f syr2_batched -r",
+                              rocblas_precision_string<T>,
+                              "--uplo",
+                              uplo_letter,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--incx",
+                              incx,
+                              "--incy",
+                              incy,
+                              "--lda",
+                              lda,
+                              "--batch_count",
+                              batch_count);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syr2_batched_name<HERM, T>,
+                              uplo,
+                              n,
+                              alpha,
+                              x,
+                              incx,
+                              y,
+                              incy,
+                              A,
+                              lda,
+                              batch_count);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_syr2_batched_name<HERM, T>,
+                            "uplo",
+                            uplo_letter,
+                            "N",
+                            n,
+                            "incx",
+                            incx,
+                            "incy",
+                            incy,
+                            "lda",
+                            lda,
+                            "batch_count",
+                            batch_count);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(!x || !y || !A)
+            return rocblas_status_invalid_pointer;
+        if(n < 0 || !incx || !incy || lda < n || lda < 1 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        return rocblas_syr2_launcher<HERM, T>(handle,
+                                              uplo,
+                                              n,
+                                              alpha,
+                                              0,
+                                              x,
+                                              shiftx,
+                                              incx,
+                                              0,
+                                              y,
+                                              shifty,
+                                              incy,
+                                              0,
+                                              A,
+                                              shiftA,
+                                              lda,
+                                              0,
+                                              batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ssyr2_batched(rocblas_handle     handle,
+                                     rocblas_fill       uplo,
+                                     rocblas_int        n,
+                                     const float*       alpha,
+                                     const float* const x[],
+                                     rocblas_int        incx,
+                                     const float* const y[],
+                                     rocblas_int        incy,
+                                     float* const       A[],
+                                     rocblas_int        lda,
+                                     rocblas_int        batch_count)
+{
+    return rocblas_syr2_batched_impl<false>(
+        handle, uplo, n, alpha, x, 0, incx, y, 0, incy, A, 0, lda, batch_count);
+}
+
+rocblas_status rocblas_dsyr2_batched(rocblas_handle      handle,
+                                     rocblas_fill        uplo,
+                                     rocblas_int         n,
+                                     const double*       alpha,
+                                     const double* const x[],
+                                     rocblas_int         incx,
+                                     const double* const y[],
+                                     rocblas_int         incy,
+                                     double* const       A[],
+                                     rocblas_int         lda,
+                                     rocblas_int         batch_count)
+{
+    return rocblas_syr2_batched_impl<false>(
+        handle, uplo, n, alpha, x, 0, incx, y, 0, incy, A, 0, lda, batch_count);
+}
+
+rocblas_status rocblas_cher2_batched(rocblas_handle                     handle,
+                                     rocblas_fill                       uplo,
+                                     rocblas_int                        n,
+                                     const rocblas_float_complex*       alpha,
+                                     const rocblas_float_complex* const x[],
+                                     rocblas_int                        incx,
+                                     const rocblas_float_complex* const y[],
+                                     rocblas_int                        incy,
+                                     rocblas_float_complex* const       A[],
+                                     rocblas_int                        lda,
+                                     rocblas_int                        batch_count)
+{
+    return rocblas_syr2_batched_impl<true>(
+        handle, uplo, n, alpha, x, 0, incx, y, 0, incy, A, 0, lda, batch_count);
+}
+
+rocblas_status rocblas_zher2_batched(rocblas_handle                      handle,
+                                     rocblas_fill                        uplo,
+                                     rocblas_int                         n,
+                                     const rocblas_double_complex*       alpha,
+                                     const rocblas_double_complex* const x[],
+                                     rocblas_int                         incx,
+                                     const rocblas_double_complex* const y[],
+                                     rocblas_int                         incy,
+                                     rocblas_double_complex* const       A[],
+                                     rocblas_int                         lda,
+                                     rocblas_int                         batch_count)
+{
+    return rocblas_syr2_batched_impl<true>(
+        handle, uplo, n, alpha, x, 0, incx, y, 0, incy, A, 0, lda, batch_count);
+}
+
+} // extern "C"
@@ -0,0 +1,318 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_syr2.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <bool HERM, typename>
+    constexpr char rocblas_syr2_strided_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_syr2_strided_batched_name<false, float>[]
+        = "rocblas_ssyr2_strided_batched";
+    template <>
+    constexpr char rocblas_syr2_strided_batched_name<false, double>[]
+        = "rocblas_dsyr2_strided_batched";
+    template <>
+    constexpr char rocblas_syr2_strided_batched_name<true, rocblas_float_complex>[]
+        = "rocblas_cher2_strided_batched";
+    template <>
+    constexpr char rocblas_syr2_strided_batched_name<true, rocblas_double_complex>[]
+        = "rocblas_zher2_strided_batched";
+
+    template <bool HERM, typename T>
+    rocblas_status rocblas_syr2_strided_batched_impl(rocblas_handle handle,
+                                                     rocblas_fill   uplo,
+                                                     rocblas_int    n,
+                                                     const T*       alpha,
+                                                     const T*       x,
+                                                     rocblas_int    shiftx,
+                                                     rocblas_int    incx,
+                                                     rocblas_stride stridex,
+                                                     const T*       y,
+                                                     rocblas_int    shifty,
+                                                     rocblas_int    incy,
+                                                     rocblas_stride stridey,
+                                                     T*             A,
+                                                     rocblas_int    shiftA,
+                                                     rocblas_int    lda,
+                                                     rocblas_stride strideA,
+                                                     rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto uplo_letter = rocblas_fill_letter(uplo);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syr2_strided_batched_name<HERM, T>,
+                              uplo,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              x,
+                              incx,
+                              stridex,
+                              y,
+                              incy,
+                              stridey,
+                              A,
+                              lda,
+                              strideA,
+                              batch_count);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              HERM ? "./rocblas-bench -f her2_strided_batched -r"
+                                   : "./rocblas-bench -f syr2_strided_batched -r",
+                              rocblas_precision_string<T>,
+                              "--uplo",
+                              uplo_letter,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--incx",
+                              incx,
+                              "--stride_x",
+                              stridex,
+                              "--incy",
+                              incy,
+                              "--stride_y",
+                              stridey,
+                              "--lda",
+                              lda,
+                              "--stride_a",
+                              strideA,
+                              "--batch_count",
+                              batch_count);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syr2_strided_batched_name<HERM, T>,
+                              uplo,
+                              n,
+                              alpha,
+                              x,
+                              incx,
+                              stridex,
+                              y,
+                              incy,
+                              stridey,
+                              A,
+                              lda,
+                              strideA,
+                              batch_count);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_syr2_strided_batched_name<HERM, T>,
+                            "uplo",
+                            uplo_letter,
+                            "N",
+                            n,
+                            "incx",
+                            incx,
+                            "stride_x",
+                            stridex,
+                            "incy",
+                            incy,
+                            "stride_y",
+                            stridey,
+                            "lda",
+                            lda,
+                            "stride_a",
+                            strideA,
+                            "batch_count",
+                            batch_count);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(!x || !y || !A)
+            return rocblas_status_invalid_pointer;
+        if(n < 0 || !incx || !incy || lda < n || lda < 1 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        return rocblas_syr2_launcher<HERM, T>(handle,
+                                              uplo,
+                                              n,
+                                              alpha,
+                                              0,
+                                              x,
+                                              shiftx,
+                                              incx,
+                                              stridex,
+                                              y,
+                                              shifty,
+                                              incy,
+                                              stridey,
+                                              A,
+                                              shiftA,
+                                              lda,
+                                              strideA,
+                                              batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ssyr2_strided_batched(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const float*   alpha,
+                                             const float*   x,
+                                             rocblas_int    incx,
+                                             rocblas_stride stridex,
+                                             const float*   y,
+                                             rocblas_int    incy,
+                                             rocblas_stride stridey,
+                                             float*         A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             rocblas_int    batch_count)
+{
+    return rocblas_syr2_strided_batched_impl<false>(handle,
+                                                    uplo,
+                                                    n,
+                                                    alpha,
+                                                    x,
+                                                    0,
+                                                    incx,
+                                                    stridex,
+                                                    y,
+                                                    0,
+                                                    incy,
+                                                    stridey,
+                                                    A,
+                                                    0,
+                                                    lda,
+                                                    strideA,
+                                                    batch_count);
+}
+
+rocblas_status rocblas_dsyr2_strided_batched(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const double*  alpha,
+                                             const double*  x,
+                                             rocblas_int    incx,
+                                             rocblas_stride stridex,
+                                             const double*  y,
+                                             rocblas_int    incy,
+                                             rocblas_stride stridey,
+                                             double*        A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             rocblas_int    batch_count)
+{
+    return rocblas_syr2_strided_batched_impl<false>(handle,
+                                                    uplo,
+                                                    n,
+                                                    alpha,
+                                                    x,
+                                                    0,
+                                                    incx,
+                                                    stridex,
+                                                    y,
+                                                    0,
+                                                    incy,
+                                                    stridey,
+                                                    A,
+                                                    0,
+                                                    lda,
+                                                    strideA,
+                                                    batch_count);
+}
+
+rocblas_status rocblas_cher2_strided_batched(rocblas_handle               handle,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  incx,
+                                             rocblas_stride               stridex,
+                                             const rocblas_float_complex* y,
+                                             rocblas_int                  incy,
+                                             rocblas_stride               stridey,
+                                             rocblas_float_complex*       A,
+                                             rocblas_int                  lda,
+                                             rocblas_stride               strideA,
+                                             rocblas_int                  batch_count)
+{
+    return rocblas_syr2_strided_batched_impl<true>(handle,
+                                                   uplo,
+                                                   n,
+                                                   alpha,
+                                                   x,
+                                                   0,
+                                                   incx,
+                                                   stridex,
+                                                   y,
+                                                   0,
+                                                   incy,
+                                                   stridey,
+                                                   A,
+                                                   0,
+                                                   lda,
+                                                   strideA,
+                                                   batch_count);
+}
+
+rocblas_status rocblas_zher2_strided_batched(rocblas_handle                handle,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* alpha,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   incx,
+                                             rocblas_stride                stridex,
+                                             const rocblas_double_complex* y,
+                                             rocblas_int                   incy,
+                                             rocblas_stride                stridey,
+                                             rocblas_double_complex*       A,
+                                             rocblas_int                   lda,
+                                             rocblas_stride                strideA,
+                                             rocblas_int                   batch_count)
+{
+    return rocblas_syr2_strided_batched_impl<true>(handle,
+                                                   uplo,
+                                                   n,
+                                                   alpha,
+                                                   x,
+                                                   0,
+                                                   incx,
+                                                   stridex,
+                                                   y,
+                                                   0,
+                                                   incy,
+                                                   stridey,
+                                                   A,
+                                                   0,
+                                                   lda,
+                                                   strideA,
+                                                   batch_count);
+}
+
+} // extern "C"
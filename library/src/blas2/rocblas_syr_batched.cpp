@@ -7,18 +7,25 @@
 
 namespace
 {
-    template <typename>
+    // her is distinguished from syr by a real U for a complex T
+    template <typename T, typename = T>
     constexpr char rocblas_syr_batched_name[] = "unknown";
     template <>
     constexpr char rocblas_syr_batched_name<float>[] = "rocblas_ssyr_batched";
     template <>
     constexpr char rocblas_syr_batched_name<double>[] = "rocblas_dsyr_batched";
+    template <>
+    constexpr char rocblas_syr_batched_name<rocblas_float_complex, float>[]
+        = "rocblas_cher_batched";
+    template <>
+    constexpr char rocblas_syr_batched_name<rocblas_double_complex, double>[]
+        = "rocblas_zher_batched";
 
-    template <typename T>
+    template <typename T, typename U>
     rocblas_status rocblas_syr_batched_impl(rocblas_handle handle,
                                             rocblas_fill   uplo,
                                             rocblas_int    n,
-                                            const T*       alpha,
+                                            const U*       alpha,
                                             const T* const x[],
                                             rocblas_int    shiftx,
                                             rocblas_int    incx,
@@ -27,6 +34,8 @@ namespace
                                             rocblas_int    lda,
                                             rocblas_int    batch_count)
     {
+        constexpr bool HERM = is_complex<T> && !is_complex<U>;
+
         if(!handle)
             return rocblas_status_invalid_handle;
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
@@ -42,12 +51,21 @@ namespace
             if(handle->pointer_mode == rocblas_pointer_mode_host)
             {
                 if(layer_mode & rocblas_layer_mode_log_trace)
-                    log_trace(
-                        handle, rocblas_syr_batched_name<T>, uplo, n, *alpha, 0, x, incx, A, lda);
+                    log_trace(handle,
+                              rocblas_syr_batched_name<T, U>,
+                              uplo,
+                              n,
+                              *alpha,
+                              0,
+                              x,
+                              incx,
+                              A,
+                              lda);
 
                 if(layer_mode & rocblas_layer_mode_log_bench)
                     log_bench(handle,
-                              "./rocblas-bench -f syr_batched -r",
+                              HERM ? "./rocblas-bench -f her_batched -r"
+                                   : "./rocblas-bench -f syr_batched -r",
                               rocblas_precision_string<T>,
                               "--uplo",
                               uplo_letter,
@@ -66,7 +84,7 @@ namespace
             {
                 if(layer_mode & rocblas_layer_mode_log_trace)
                     log_trace(handle,
-                              rocblas_syr_batched_name<T>,
+                              rocblas_syr_batched_name<T, U>,
                               uplo,
                               n,
                               alpha,
@@ -79,7 +97,7 @@ namespace
 
             if(layer_mode & rocblas_layer_mode_log_profile)
                 log_profile(handle,
-                            rocblas_syr_batched_name<T>,
+                            rocblas_syr_batched_name<T, U>,
                             "uplo",
                             uplo_letter,
                             "N",
@@ -99,7 +117,7 @@ namespace
         if(n < 0 || !incx || lda < n || lda < 1 || batch_count < 0)
             return rocblas_status_invalid_size;
 
-        return rocblas_syr_batched_template(
+        return rocblas_syr_batched_template<HERM>(
             handle, uplo, n, alpha, 0, x, 0, incx, A, 0, lda, batch_count);
     }
 
@@ -139,4 +157,30 @@ rocblas_status rocblas_dsyr_batched(rocblas_handle      handle,
     return rocblas_syr_batched_impl(handle, uplo, n, alpha, x, 0, incx, A, 0, lda, batch_count);
 }
 
+rocblas_status rocblas_cher_batched(rocblas_handle                     handle,
+                                    rocblas_fill                       uplo,
+                                    rocblas_int                        n,
+                                    const float*                       alpha,
+                                    const rocblas_float_complex* const x[],
+                                    rocblas_int                        incx,
+                                    rocblas_float_complex* const       A[],
+                                    rocblas_int                        lda,
+                                    rocblas_int                        batch_count)
+{
+    return rocblas_syr_batched_impl(handle, uplo, n, alpha, x, 0, incx, A, 0, lda, batch_count);
+}
+
+rocblas_status rocblas_zher_batched(rocblas_handle                      handle,
+                                    rocblas_fill                        uplo,
+                                    rocblas_int                         n,
+                                    const double*                       alpha,
+                                    const rocblas_double_complex* const x[],
+                                    rocblas_int                         incx,
+                                    rocblas_double_complex* const       A[],
+                                    rocblas_int                         lda,
+                                    rocblas_int                         batch_count)
+{
+    return rocblas_syr_batched_impl(handle, uplo, n, alpha, x, 0, incx, A, 0, lda, batch_count);
+}
+
 } // extern "C"
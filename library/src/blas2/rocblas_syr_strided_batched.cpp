@@ -7,18 +7,25 @@
 
 namespace
 {
-    template <typename>
+    // her is distinguished from syr by a real U for a complex T
+    template <typename T, typename = T>
     constexpr char rocblas_syr_strided_batched_name[] = "unknown";
     template <>
     constexpr char rocblas_syr_strided_batched_name<float>[] = "rocblas_ssyr_strided_batched";
     template <>
     constexpr char rocblas_syr_strided_batched_name<double>[] = "rocblas_dsyr_strided_batched";
+    template <>
+    constexpr char rocblas_syr_strided_batched_name<rocblas_float_complex, float>[]
+        = "rocblas_cher_strided_batched";
+    template <>
+    constexpr char rocblas_syr_strided_batched_name<rocblas_double_complex, double>[]
+        = "rocblas_zher_strided_batched";
 
-    template <typename T>
+    template <typename T, typename U>
     rocblas_status rocblas_syr_strided_batched_impl(rocblas_handle handle,
                                                     rocblas_fill   uplo,
                                                     rocblas_int    n,
-                                                    const T*       alpha,
+                                                    const U*       alpha,
                                                     const T*       x,
                                                     rocblas_int    shiftx,
                                                     rocblas_int    incx,
@@ -29,6 +36,8 @@ namespace
                                                     rocblas_stride strideA,
                                                     rocblas_int    batch_count)
     {
+        constexpr bool HERM = is_complex<T> && !is_complex<U>;
+
         if(!handle)
             return rocblas_status_invalid_handle;
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
@@ -45,7 +54,7 @@ namespace
             {
                 if(layer_mode & rocblas_layer_mode_log_trace)
                     log_trace(handle,
-                              rocblas_syr_strided_batched_name<T>,
+                              rocblas_syr_strided_batched_name<T, U>,
                               uplo,
                               n,
                               *alpha,
@@ -57,7 +66,8 @@ namespace
 
                 if(layer_mode & rocblas_layer_mode_log_bench)
                     log_bench(handle,
-                              "./rocblas-bench -f syr_strided_batched -r",
+                              HERM ? "./rocblas-bench -f her_strided_batched -r"
+                                   : "./rocblas-bench -f syr_strided_batched -r",
                               rocblas_precision_string<T>,
                               "--uplo",
                               uplo_letter,
@@ -80,7 +90,7 @@ namespace
             {
                 if(layer_mode & rocblas_layer_mode_log_trace)
                     log_trace(handle,
-                              rocblas_syr_strided_batched_name<T>,
+                              rocblas_syr_strided_batched_name<T, U>,
                               uplo,
                               n,
                               alpha,
@@ -95,7 +105,7 @@ namespace
 
             if(layer_mode & rocblas_layer_mode_log_profile)
                 log_profile(handle,
-                            rocblas_syr_strided_batched_name<T>,
+                            rocblas_syr_strided_batched_name<T, U>,
                             "uplo",
                             uplo_letter,
                             "N",
@@ -119,7 +129,7 @@ namespace
         if(n < 0 || !incx || lda < n || lda < 1 || batch_count < 0)
             return rocblas_status_invalid_size;
 
-        return rocblas_syr_strided_batched_template(
+        return rocblas_syr_strided_batched_template<HERM>(
             handle, uplo, n, alpha, 0, x, 0, incx, stridex, A, 0, lda, strideA, batch_count);
     }
 
@@ -165,4 +175,36 @@ rocblas_status rocblas_dsyr_strided_batched(rocblas_handle handle,
         handle, uplo, n, alpha, x, 0, incx, stridex, A, 0, lda, strideA, batch_count);
 }
 
+rocblas_status rocblas_cher_strided_batched(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_int                  n,
+                                            const float*                 alpha,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int                  incx,
+                                            rocblas_stride               stridex,
+                                            rocblas_float_complex*       A,
+                                            rocblas_int                  lda,
+                                            rocblas_stride               strideA,
+                                            rocblas_int                  batch_count)
+{
+    return rocblas_syr_strided_batched_impl(
+        handle, uplo, n, alpha, x, 0, incx, stridex, A, 0, lda, strideA, batch_count);
+}
+
+rocblas_status rocblas_zher_strided_batched(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_int                   n,
+                                            const double*                 alpha,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int                   incx,
+                                            rocblas_stride                stridex,
+                                            rocblas_double_complex*       A,
+                                            rocblas_int                   lda,
+                                            rocblas_stride                strideA,
+                                            rocblas_int                   batch_count)
+{
+    return rocblas_syr_strided_batched_impl(
+        handle, uplo, n, alpha, x, 0, incx, stridex, A, 0, lda, strideA, batch_count);
+}
+
 } // extern "C"
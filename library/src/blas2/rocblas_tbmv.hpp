@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __ROCBLAS_TBMV_HPP__
+#define __ROCBLAS_TBMV_HPP__
+#include "handle.h"
+#include "packed_band_device.hpp"
+#include "rocblas.h"
+#include "utility.h"
+
+/*! \brief TBMV on strided or batched triangular band matrices and vectors.
+
+    workspace must hold rocblas_packed_band_trmv_workspace_size<T>(n, batch_count) bytes of
+    device memory. */
+template <typename T, typename V, typename W>
+rocblas_status rocblas_tbmv_template(rocblas_handle    handle,
+                                     rocblas_fill      uplo,
+                                     rocblas_operation transA,
+                                     rocblas_diagonal  diag,
+                                     rocblas_int       n,
+                                     rocblas_int       k,
+                                     const V*          A,
+                                     rocblas_int       offseta,
+                                     rocblas_int       lda,
+                                     rocblas_stride    strideA,
+                                     W*                x,
+                                     rocblas_int       offsetx,
+                                     rocblas_int       incx,
+                                     rocblas_stride    stridex,
+                                     rocblas_int       batch_count,
+                                     T*                workspace)
+{
+    return rocblas_packed_band_trmv_launcher(handle,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             n,
+                                             k,
+                                             A,
+                                             offseta,
+                                             lda,
+                                             strideA,
+                                             x,
+                                             offsetx,
+                                             incx,
+                                             stridex,
+                                             batch_count,
+                                             workspace);
+}
+
+#endif
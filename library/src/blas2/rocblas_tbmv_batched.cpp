@@ -0,0 +1,169 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_tbmv.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_tbmv_name[] = "unknown";
+    template <>
+    constexpr char rocblas_tbmv_name<float>[] = "rocblas_stbmv_batched";
+    template <>
+    constexpr char rocblas_tbmv_name<double>[] = "rocblas_dtbmv_batched";
+
+    template <typename T>
+    rocblas_status rocblas_tbmv_batched_impl(rocblas_handle    handle,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation transA,
+                                             rocblas_diagonal  diag,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const T* const    A[],
+                                             rocblas_int       lda,
+                                             T* const          x[],
+                                             rocblas_int       incx,
+                                             rocblas_int       batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto uplo_letter   = rocblas_fill_letter(uplo);
+            auto transA_letter = rocblas_transpose_letter(transA);
+            auto diag_letter   = rocblas_diag_letter(diag);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          rocblas_tbmv_name<T>,
+                          uplo,
+                          transA,
+                          diag,
+                          n,
+                          k,
+                          A,
+                          lda,
+                          x,
+                          incx,
+                          batch_count);
+
+            if(layer_mode & rocblas_layer_mode_log_bench)
+                log_bench(handle,
+                          "./rocblas-bench -f tbmv_batched -r",
+                          rocblas_precision_string<T>,
+                          "--uplo",
+                          uplo_letter,
+                          "--transposeA",
+                          transA_letter,
+                          "--diag",
+                          diag_letter,
+                          "-n",
+                          n,
+                          "-k",
+                          k,
+                          "--lda",
+                          lda,
+                          "--incx",
+                          incx,
+                          "--batch_count",
+                          batch_count);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_tbmv_name<T>,
+                            "uplo",
+                            uplo_letter,
+                            "transA",
+                            transA_letter,
+                            "diag",
+                            diag_letter,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "lda",
+                            lda,
+                            "incx",
+                            incx,
+                            "batch_count",
+                            batch_count);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(n < 0 || k < 0 || lda < k + 1 || !incx || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // quick return if possible.
+        // return rocblas_status_size_unchanged if device memory size query
+        if(!n || !batch_count)
+            return handle->is_device_memory_size_query() ? rocblas_status_size_unchanged
+                                                         : rocblas_status_success;
+
+        size_t dev_bytes = rocblas_packed_band_trmv_workspace_size<T>(n, batch_count);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+
+        if(!A || !x)
+            return rocblas_status_invalid_pointer;
+
+        auto mem = handle->device_malloc(dev_bytes);
+        if(!mem)
+            return rocblas_status_memory_error;
+
+        return rocblas_tbmv_template<T>(
+            handle, uplo, transA, diag, n, k, A, 0, lda, 0, x, 0, incx, 0, batch_count, (T*)mem);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_stbmv_batched(rocblas_handle     handle,
+                                     rocblas_fill       uplo,
+                                     rocblas_operation  transA,
+                                     rocblas_diagonal   diag,
+                                     rocblas_int        n,
+                                     rocblas_int        k,
+                                     const float* const A[],
+                                     rocblas_int        lda,
+                                     float* const       x[],
+                                     rocblas_int        incx,
+                                     rocblas_int        batch_count)
+{
+    return rocblas_tbmv_batched_impl(
+        handle, uplo, transA, diag, n, k, A, lda, x, incx, batch_count);
+}
+
+rocblas_status rocblas_dtbmv_batched(rocblas_handle      handle,
+                                     rocblas_fill        uplo,
+                                     rocblas_operation   transA,
+                                     rocblas_diagonal    diag,
+                                     rocblas_int         n,
+                                     rocblas_int         k,
+                                     const double* const A[],
+                                     rocblas_int         lda,
+                                     double* const       x[],
+                                     rocblas_int         incx,
+                                     rocblas_int         batch_count)
+{
+    return rocblas_tbmv_batched_impl(
+        handle, uplo, transA, diag, n, k, A, lda, x, incx, batch_count);
+}
+
+} // extern "C"
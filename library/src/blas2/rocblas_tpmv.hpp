@@ -0,0 +1,50 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __ROCBLAS_TPMV_HPP__
+#define __ROCBLAS_TPMV_HPP__
+#include "handle.h"
+#include "packed_band_device.hpp"
+#include "rocblas.h"
+#include "utility.h"
+
+/*! \brief TPMV on strided or batched packed triangular matrices and vectors.
+
+    workspace must hold rocblas_packed_band_trmv_workspace_size<T>(n, batch_count) bytes of
+    device memory. */
+template <typename T, typename V, typename W>
+rocblas_status rocblas_tpmv_template(rocblas_handle    handle,
+                                     rocblas_fill      uplo,
+                                     rocblas_operation transA,
+                                     rocblas_diagonal  diag,
+                                     rocblas_int       n,
+                                     const V*          AP,
+                                     rocblas_int       offseta,
+                                     rocblas_stride    strideA,
+                                     W*                x,
+                                     rocblas_int       offsetx,
+                                     rocblas_int       incx,
+                                     rocblas_stride    stridex,
+                                     rocblas_int       batch_count,
+                                     T*                workspace)
+{
+    // A packed matrix is passed with lda = 0, and its triangle is a band of n - 1 diagonals
+    return rocblas_packed_band_trmv_launcher(handle,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             n,
+                                             n - 1,
+                                             AP,
+                                             offseta,
+                                             0,
+                                             strideA,
+                                             x,
+                                             offsetx,
+                                             incx,
+                                             stridex,
+                                             batch_count,
+                                             workspace);
+}
+
+#endif
@@ -0,0 +1,57 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __ROCBLAS_TPSV_HPP__
+#define __ROCBLAS_TPSV_HPP__
+#include "handle.h"
+#include "packed_band_device.hpp"
+#include "rocblas.h"
+#include "utility.h"
+
+/*! \brief TPSV on strided or batched packed triangular matrices and vectors. op(A) is A^T for
+    both rocblas_operation_transpose and rocblas_operation_conjugate_transpose. */
+template <typename T, typename V, typename W>
+rocblas_status rocblas_tpsv_template(rocblas_handle    handle,
+                                     rocblas_fill      uplo,
+                                     rocblas_operation transA,
+                                     rocblas_diagonal  diag,
+                                     rocblas_int       n,
+                                     const V*          AP,
+                                     rocblas_int       offseta,
+                                     rocblas_stride    strideA,
+                                     W*                x,
+                                     rocblas_int       offsetx,
+                                     rocblas_int       incx,
+                                     rocblas_stride    stridex,
+                                     rocblas_int       batch_count)
+{
+    //quick return
+    if(!n || !batch_count)
+        return rocblas_status_success;
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+
+    dim3 grid(batch_count);
+    dim3 threads(TPSV_NB);
+    hipLaunchKernelGGL((tpsv_kernel<TPSV_NB, T>),
+                       grid,
+                       threads,
+                       0,
+                       handle->rocblas_stream,
+                       n,
+                       uplo == rocblas_fill_upper,
+                       transA != rocblas_operation_none,
+                       diag == rocblas_diagonal_unit,
+                       AP,
+                       offseta,
+                       strideA,
+                       x,
+                       shiftx,
+                       incx,
+                       stridex);
+
+    return rocblas_status_success;
+}
+
+#endif
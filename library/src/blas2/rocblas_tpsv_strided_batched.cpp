@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_tpsv.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_tpsv_name[] = "unknown";
+    template <>
+    constexpr char rocblas_tpsv_name<float>[] = "rocblas_stpsv_strided_batched";
+    template <>
+    constexpr char rocblas_tpsv_name<double>[] = "rocblas_dtpsv_strided_batched";
+
+    template <typename T>
+    rocblas_status rocblas_tpsv_strided_batched_impl(rocblas_handle    handle,
+                                                     rocblas_fill      uplo,
+                                                     rocblas_operation transA,
+                                                     rocblas_diagonal  diag,
+                                                     rocblas_int       n,
+                                                     const T*          AP,
+                                                     rocblas_stride    strideA,
+                                                     T*                x,
+                                                     rocblas_int       incx,
+                                                     rocblas_stride    stridex,
+                                                     rocblas_int       batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto uplo_letter   = rocblas_fill_letter(uplo);
+            auto transA_letter = rocblas_transpose_letter(transA);
+            auto diag_letter   = rocblas_diag_letter(diag);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          rocblas_tpsv_name<T>,
+                          uplo,
+                          transA,
+                          diag,
+                          n,
+                          AP,
+                          strideA,
+                          x,
+                          incx,
+                          stridex,
+                          batch_count);
+
+            if(layer_mode & rocblas_layer_mode_log_bench)
+                log_bench(handle,
+                          "./rocblas-bench -f tpsv_strided_batched -r",
+                          rocblas_precision_string<T>,
+                          "--uplo",
+                          uplo_letter,
+                          "--transposeA",
+                          transA_letter,
+                          "--diag",
+                          diag_letter,
+                          "-n",
+                          n,
+                          "--stride_a",
+                          strideA,
+                          "--incx",
+                          incx,
+                          "--stride_x",
+                          stridex,
+                          "--batch_count",
+                          batch_count);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_tpsv_name<T>,
+                            "uplo",
+                            uplo_letter,
+                            "transA",
+                            transA_letter,
+                            "diag",
+                            diag_letter,
+                            "N",
+                            n,
+                            "stride_a",
+                            strideA,
+                            "incx",
+                            incx,
+                            "stride_x",
+                            stridex,
+                            "batch_count",
+                            batch_count);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(n < 0 || !incx || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // quick return if possible.
+        if(!n || !batch_count)
+            return rocblas_status_success;
+
+        if(!AP || !x)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_tpsv_template<T>(
+            handle, uplo, transA, diag, n, AP, 0, strideA, x, 0, incx, stridex, batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_stpsv_strided_batched(rocblas_handle    handle,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation transA,
+                                             rocblas_diagonal  diag,
+                                             rocblas_int       n,
+                                             const float*      AP,
+                                             rocblas_stride    strideA,
+                                             float*            x,
+                                             rocblas_int       incx,
+                                             rocblas_stride    stridex,
+                                             rocblas_int       batch_count)
+{
+    return rocblas_tpsv_strided_batched_impl(
+        handle, uplo, transA, diag, n, AP, strideA, x, incx, stridex, batch_count);
+}
+
+rocblas_status rocblas_dtpsv_strided_batched(rocblas_handle    handle,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation transA,
+                                             rocblas_diagonal  diag,
+                                             rocblas_int       n,
+                                             const double*     AP,
+                                             rocblas_stride    strideA,
+                                             double*           x,
+                                             rocblas_int       incx,
+                                             rocblas_stride    stridex,
+                                             rocblas_int       batch_count)
+{
+    return rocblas_tpsv_strided_batched_impl(
+        handle, uplo, transA, diag, n, AP, strideA, x, incx, stridex, batch_count);
+}
+
+} // extern "C"
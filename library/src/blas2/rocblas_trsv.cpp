@@ -114,6 +114,10 @@ namespace
                                                                            supplied_invA,
                                                                            supplied_invA_size);
 
+        // If this was a device memory query or an error occurred, return status
+        if(status != rocblas_status_success && status != rocblas_status_perf_degraded)
+            return status;
+
         rocblas_status status2 = rocblas_trsv_template<BLOCK, false, T>(handle,
                                                                         uplo,
                                                                         transA,
@@ -221,4 +225,29 @@ rocblas_status rocblas_trsv_ex(rocblas_handle    handle,
     }
 }
 
+rocblas_status rocblas_trsv_workspace_size(rocblas_handle   handle,
+                                           rocblas_int      m,
+                                           rocblas_int      batch_count,
+                                           rocblas_datatype compute_type,
+                                           size_t*          minimum_size,
+                                           size_t*          optimal_size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(!minimum_size || !optimal_size)
+        return rocblas_status_invalid_pointer;
+    if(compute_type != rocblas_datatype_f64_r && compute_type != rocblas_datatype_f32_r)
+        return rocblas_status_not_implemented;
+
+    // Without a supplied invA, the only workspace is the completion flags of the solver, so
+    // the minimum and optimal sizes are the same. Small systems need no workspace.
+    *minimum_size = *optimal_size = 0;
+    if(m && batch_count && !rocblas_trsv_use_wavefront(m))
+        *minimum_size = *optimal_size = _rocblas_handle::device_memory_size(
+            rocblas_trsv_persistent_flags_bytes(m, batch_count));
+    return rocblas_status_success;
+}
+
 } // extern "C"
@@ -674,6 +674,457 @@ namespace
         return rocblas_status_success;
     }
 
+    /*
+     * Single launch TRSV
+     *
+     * The solution is split into blocks of TRSV_DIM rows, one workgroup per block. Workgroups
+     * take block indices in the order in which they start, from a ticket counter, so that every
+     * block they depend on belongs to a workgroup which is already running. A workgroup
+     * subtracts the product with each earlier block of x as soon as that block's completion flag
+     * is set, then solves its diagonal block in LDS, writes its block of x in place and sets its
+     * own flag.
+     *
+     * Upper triangular systems of op(A) are solved as lower triangular ones by reversing the
+     * order of the rows and columns, so the blocks are always solved forward.
+     */
+
+    constexpr rocblas_int TRSV_DIM   = 64;
+    constexpr rocblas_int TRSV_DIM_Y = 4;
+
+    // Row or column i of the reversed system, which is lower triangular
+    __device__ inline rocblas_int trsv_row(bool lower, rocblas_int m, rocblas_int i)
+    {
+        return lower ? i : m - 1 - i;
+    }
+
+    // Loads the DIM x DIM tile of op(A) at rows r0 and columns c0 of the reversed system into
+    // registers, reading A along its columns. Elements outside of A are 0.
+    template <rocblas_int DIM, rocblas_int DIM_Y, typename T>
+    __device__ inline void trsv_load_tile(T*          a,
+                                          const T*    A,
+                                          rocblas_int lda,
+                                          bool        notrans,
+                                          bool        lower,
+                                          rocblas_int m,
+                                          rocblas_int r0,
+                                          rocblas_int c0)
+    {
+        for(rocblas_int l = 0; l < DIM / DIM_Y; l++)
+        {
+            rocblas_int r = notrans ? hipThreadIdx_x : hipThreadIdx_y + l * DIM_Y;
+            rocblas_int c = notrans ? hipThreadIdx_y + l * DIM_Y : hipThreadIdx_x;
+            a[l]          = 0;
+            if(r0 + r < m && c0 + c < m)
+            {
+                rocblas_int row = trsv_row(lower, m, r0 + r);
+                rocblas_int col = trsv_row(lower, m, c0 + c);
+                a[l] = notrans ? A[row + ptrdiff_t(col) * lda] : A[col + ptrdiff_t(row) * lda];
+            }
+        }
+    }
+
+    // Stores a tile loaded by trsv_load_tile into sA, with sA[c][r] = op(A)[r0 + r, c0 + c]
+    template <rocblas_int DIM, rocblas_int DIM_Y, typename T>
+    __device__ inline void trsv_store_tile(T (*sA)[DIM + 1], const T* a, bool notrans)
+    {
+        for(rocblas_int l = 0; l < DIM / DIM_Y; l++)
+        {
+            rocblas_int r = notrans ? hipThreadIdx_x : hipThreadIdx_y + l * DIM_Y;
+            rocblas_int c = notrans ? hipThreadIdx_y + l * DIM_Y : hipThreadIdx_x;
+            sA[c][r]      = a[l];
+        }
+    }
+
+    // flags holds, for each batch, the ticket counter followed by one flag per block
+    template <rocblas_int DIM, rocblas_int DIM_Y, typename T, typename U, typename V>
+    __global__ void trsv_persistent_kernel(rocblas_fill      uplo,
+                                           rocblas_operation transA,
+                                           rocblas_diagonal  diag,
+                                           rocblas_int       m,
+                                           U                 Aa,
+                                           rocblas_int       offset_A,
+                                           rocblas_int       lda,
+                                           rocblas_stride    stride_A,
+                                           V                 Ba,
+                                           rocblas_int       offset_B,
+                                           rocblas_int       incx,
+                                           rocblas_stride    stride_B,
+                                           rocblas_int*      flags)
+    {
+        __shared__ T           sA[DIM][DIM + 1];
+        __shared__ T           sx[DIM];
+        __shared__ T           ssum[DIM_Y][DIM];
+        __shared__ rocblas_int sblock;
+
+        rocblas_int tx  = hipThreadIdx_x;
+        rocblas_int ty  = hipThreadIdx_y;
+        rocblas_int tid = tx + ty * DIM;
+
+        flags += hipBlockIdx_y * (hipGridDim_x + 1);
+        if(tid == 0)
+            sblock = atomicAdd(flags, 1);
+        __syncthreads();
+
+        rocblas_int j  = sblock;
+        rocblas_int r0 = j * DIM;
+
+        const T* A = load_ptr_batch(Aa, hipBlockIdx_y, offset_A, stride_A);
+        T*       x = load_ptr_batch(Ba, hipBlockIdx_y, offset_B, stride_B);
+        if(incx < 0)
+            x -= ptrdiff_t(incx) * (m - 1);
+
+        bool notrans = transA == rocblas_operation_none;
+        bool lower   = (uplo == rocblas_fill_lower) == notrans;
+
+        T a[DIM / DIM_Y];
+        T sum = 0;
+        for(rocblas_int i = 0; i < j; i++)
+        {
+            rocblas_int c0 = i * DIM;
+
+            // A does not depend on the earlier blocks, so it is read before waiting for them
+            trsv_load_tile<DIM, DIM_Y>(a, A, lda, notrans, lower, m, r0, c0);
+
+            if(tid == 0)
+            {
+                while(!*(volatile rocblas_int*)&flags[1 + i])
+                    ;
+                __threadfence();
+            }
+            __syncthreads();
+
+            // Block i of x was written by another workgroup, so it is not read through the cache
+            trsv_store_tile<DIM, DIM_Y>(sA, a, notrans);
+            if(ty == 0)
+                sx[tx] = ((volatile T*)x)[trsv_row(lower, m, c0 + tx) * ptrdiff_t(incx)];
+            __syncthreads();
+
+            for(rocblas_int c = ty; c < DIM; c += DIM_Y)
+                sum += sA[c][tx] * sx[c];
+            __syncthreads();
+        }
+
+        trsv_load_tile<DIM, DIM_Y>(a, A, lda, notrans, lower, m, r0, r0);
+        trsv_store_tile<DIM, DIM_Y>(sA, a, notrans);
+        ssum[ty][tx] = sum;
+        __syncthreads();
+
+        rocblas_int row = r0 + tx;
+        T           b   = 0;
+        if(ty == 0 && row < m)
+        {
+            b = x[trsv_row(lower, m, row) * ptrdiff_t(incx)];
+            for(rocblas_int l = 0; l < DIM_Y; l++)
+                b -= ssum[l][tx];
+        }
+
+        // Forward substitution on the diagonal block
+        for(rocblas_int k = 0; k < DIM; k++)
+        {
+            if(ty == 0 && tx == k)
+            {
+                if(diag == rocblas_diagonal_non_unit && row < m)
+                    b /= sA[k][k];
+                sx[k] = b;
+            }
+            __syncthreads();
+            if(ty == 0 && tx > k)
+                b -= sA[k][tx] * sx[k];
+        }
+
+        if(ty == 0 && row < m)
+            x[trsv_row(lower, m, row) * ptrdiff_t(incx)] = b;
+
+        // Make this block of x visible to the other workgroups before setting the flag
+        __threadfence();
+        __syncthreads();
+        if(tid == 0)
+            atomicExch(&flags[1 + j], 1);
+    }
+
+    // Bytes of the completion flags used by rocblas_trsv_persistent_template
+    inline size_t rocblas_trsv_persistent_flags_bytes(rocblas_int m, rocblas_int batch_count)
+    {
+        return sizeof(rocblas_int) * ((m - 1) / TRSV_DIM + 2) * batch_count;
+    }
+
+    /*! \brief Solves op(A) * x = b in place, with a single launch for all of the batches.
+
+        flags must hold rocblas_trsv_persistent_flags_bytes(m, batch_count) bytes of device
+        memory. They are cleared on the stream before the launch. */
+    template <typename T, typename U, typename V>
+    rocblas_status rocblas_trsv_persistent_template(rocblas_handle    handle,
+                                                    rocblas_fill      uplo,
+                                                    rocblas_operation transA,
+                                                    rocblas_diagonal  diag,
+                                                    rocblas_int       m,
+                                                    U                 A,
+                                                    rocblas_int       offset_A,
+                                                    rocblas_int       lda,
+                                                    rocblas_stride    stride_A,
+                                                    V                 B,
+                                                    rocblas_int       offset_B,
+                                                    rocblas_int       incx,
+                                                    rocblas_stride    stride_B,
+                                                    rocblas_int       batch_count,
+                                                    rocblas_int*      flags)
+    {
+        if(!m || !batch_count)
+            return rocblas_status_success;
+
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(flags,
+                                           0,
+                                           rocblas_trsv_persistent_flags_bytes(m, batch_count),
+                                           handle->rocblas_stream));
+
+        dim3 grid((m - 1) / TRSV_DIM + 1, batch_count);
+        dim3 threads(TRSV_DIM, TRSV_DIM_Y);
+
+        hipLaunchKernelGGL((trsv_persistent_kernel<TRSV_DIM, TRSV_DIM_Y, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           A,
+                           offset_A,
+                           lda,
+                           stride_A,
+                           B,
+                           offset_B,
+                           incx,
+                           stride_B,
+                           flags);
+
+        return rocblas_status_success;
+    }
+
+    /*
+     * Wavefront per system TRSV
+     *
+     * For small m, the blocked solvers are limited by launches and synchronization, not by
+     * arithmetic. Each system of at most TRSV_WAVEFRONT_MAX_M rows is solved by a single
+     * wavefront, with all of the batches in one launch. Each lane keeps its rows of x in
+     * registers. Panels of TRSV_WAVEFRONT_PANEL columns of op(A) are staged in LDS, reading A
+     * along its columns, and the panel is solved by column oriented forward substitution. The
+     * kernel is instantiated for 32, 64 and 128 rows, and the smallest which holds m is used, so
+     * that small systems do not reserve LDS and registers for 128 rows.
+     */
+
+    constexpr rocblas_int TRSV_WAVEFRONT_SIZE  = 64;
+    constexpr rocblas_int TRSV_WAVEFRONT_MAX_M = 128;
+    constexpr rocblas_int TRSV_WAVEFRONT_PANEL = 32;
+
+    // Whether rocblas_trsv_wavefront_template is used for systems of m rows
+    inline bool rocblas_trsv_use_wavefront(rocblas_int m)
+    {
+        return m <= TRSV_WAVEFRONT_MAX_M;
+    }
+
+    template <rocblas_int MAX_M, rocblas_int PANEL, typename T, typename U, typename V>
+    __global__ void trsv_wavefront_kernel(rocblas_fill      uplo,
+                                          rocblas_operation transA,
+                                          rocblas_diagonal  diag,
+                                          rocblas_int       m,
+                                          U                 Aa,
+                                          rocblas_int       offset_A,
+                                          rocblas_int       lda,
+                                          rocblas_stride    stride_A,
+                                          V                 Ba,
+                                          rocblas_int       offset_B,
+                                          rocblas_int       incx,
+                                          rocblas_stride    stride_B)
+    {
+        constexpr rocblas_int ROWS = (MAX_M - 1) / TRSV_WAVEFRONT_SIZE + 1;
+
+        // sA[c][r] = op(A)[r, c0 + c] of the reversed system, which is lower triangular
+        __shared__ T sA[PANEL][MAX_M + 1];
+        __shared__ T sx[PANEL];
+
+        rocblas_int tx = hipThreadIdx_x;
+
+        const T* A = load_ptr_batch(Aa, hipBlockIdx_x, offset_A, stride_A);
+        T*       x = load_ptr_batch(Ba, hipBlockIdx_x, offset_B, stride_B);
+        if(incx < 0)
+            x -= ptrdiff_t(incx) * (m - 1);
+
+        bool notrans = transA == rocblas_operation_none;
+        bool lower   = (uplo == rocblas_fill_lower) == notrans;
+
+        // Row tx + l * TRSV_WAVEFRONT_SIZE of x is held by lane tx
+        T b[ROWS];
+        for(rocblas_int l = 0; l < ROWS; l++)
+        {
+            rocblas_int r = tx + l * TRSV_WAVEFRONT_SIZE;
+            b[l]          = r < m ? x[trsv_row(lower, m, r) * ptrdiff_t(incx)] : 0;
+        }
+
+        for(rocblas_int c0 = 0; c0 < m; c0 += PANEL)
+        {
+            // Only the rows at and below the diagonal of the panel are needed, so the loads cover
+            // the cols x rows block of the panel from row c0. Consecutive lanes read consecutive
+            // elements of a column of A, whether or not A is transposed.
+            rocblas_int cols = min(PANEL, m - c0);
+            rocblas_int rows = m - c0;
+            for(rocblas_int i = tx; i < cols * rows; i += TRSV_WAVEFRONT_SIZE)
+            {
+                rocblas_int c = notrans ? i / rows : i % cols;
+                rocblas_int r = c0 + (notrans ? i % rows : i / cols);
+                if(r >= c0 + c)
+                {
+                    rocblas_int row = trsv_row(lower, m, r);
+                    rocblas_int col = trsv_row(lower, m, c0 + c);
+                    sA[c][r]        = notrans ? A[row + ptrdiff_t(col) * lda]
+                                              : A[col + ptrdiff_t(row) * lda];
+                }
+            }
+            __syncthreads();
+
+            for(rocblas_int k = 0; k < PANEL && c0 + k < m; k++)
+            {
+                rocblas_int kk = c0 + k;
+                for(rocblas_int l = 0; l < ROWS; l++)
+                    if(tx + l * TRSV_WAVEFRONT_SIZE == kk)
+                    {
+                        if(diag == rocblas_diagonal_non_unit)
+                            b[l] /= sA[k][kk];
+                        sx[k] = b[l];
+                    }
+                __syncthreads();
+
+                T xk = sx[k];
+                for(rocblas_int l = 0; l < ROWS; l++)
+                {
+                    rocblas_int r = tx + l * TRSV_WAVEFRONT_SIZE;
+                    if(r > kk && r < m)
+                        b[l] -= sA[k][r] * xk;
+                }
+            }
+
+            // The next panel overwrites sA
+            __syncthreads();
+        }
+
+        for(rocblas_int l = 0; l < ROWS; l++)
+        {
+            rocblas_int r = tx + l * TRSV_WAVEFRONT_SIZE;
+            if(r < m)
+                x[trsv_row(lower, m, r) * ptrdiff_t(incx)] = b[l];
+        }
+    }
+
+    template <rocblas_int MAX_M, typename T, typename U, typename V>
+    void rocblas_trsv_wavefront_launch(rocblas_handle    handle,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       rocblas_diagonal  diag,
+                                       rocblas_int       m,
+                                       U                 A,
+                                       rocblas_int       offset_A,
+                                       rocblas_int       lda,
+                                       rocblas_stride    stride_A,
+                                       V                 B,
+                                       rocblas_int       offset_B,
+                                       rocblas_int       incx,
+                                       rocblas_stride    stride_B,
+                                       rocblas_int       batch_count)
+    {
+        dim3 grid(batch_count);
+        dim3 threads(TRSV_WAVEFRONT_SIZE);
+
+        hipLaunchKernelGGL((trsv_wavefront_kernel<MAX_M, TRSV_WAVEFRONT_PANEL, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           A,
+                           offset_A,
+                           lda,
+                           stride_A,
+                           B,
+                           offset_B,
+                           incx,
+                           stride_B);
+    }
+
+    /*! \brief Solves op(A) * x = b in place for m <= TRSV_WAVEFRONT_MAX_M, with one wavefront
+        per batch and no workspace. */
+    template <typename T, typename U, typename V>
+    rocblas_status rocblas_trsv_wavefront_template(rocblas_handle    handle,
+                                                   rocblas_fill      uplo,
+                                                   rocblas_operation transA,
+                                                   rocblas_diagonal  diag,
+                                                   rocblas_int       m,
+                                                   U                 A,
+                                                   rocblas_int       offset_A,
+                                                   rocblas_int       lda,
+                                                   rocblas_stride    stride_A,
+                                                   V                 B,
+                                                   rocblas_int       offset_B,
+                                                   rocblas_int       incx,
+                                                   rocblas_stride    stride_B,
+                                                   rocblas_int       batch_count)
+    {
+        if(!m || !batch_count)
+            return rocblas_status_success;
+
+        // The smallest instantiation which holds the m rows
+        if(m <= 32)
+            rocblas_trsv_wavefront_launch<32, T>(handle,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 m,
+                                                 A,
+                                                 offset_A,
+                                                 lda,
+                                                 stride_A,
+                                                 B,
+                                                 offset_B,
+                                                 incx,
+                                                 stride_B,
+                                                 batch_count);
+        else if(m <= 64)
+            rocblas_trsv_wavefront_launch<64, T>(handle,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 m,
+                                                 A,
+                                                 offset_A,
+                                                 lda,
+                                                 stride_A,
+                                                 B,
+                                                 offset_B,
+                                                 incx,
+                                                 stride_B,
+                                                 batch_count);
+        else
+            rocblas_trsv_wavefront_launch<TRSV_WAVEFRONT_MAX_M, T>(handle,
+                                                                   uplo,
+                                                                   transA,
+                                                                   diag,
+                                                                   m,
+                                                                   A,
+                                                                   offset_A,
+                                                                   lda,
+                                                                   stride_A,
+                                                                   B,
+                                                                   offset_B,
+                                                                   incx,
+                                                                   stride_B,
+                                                                   batch_count);
+
+        return rocblas_status_success;
+    }
+
     template <rocblas_int BLOCK, bool BATCHED, typename T, typename U>
     rocblas_status rocblas_trsv_template_mem(rocblas_handle handle,
                                              rocblas_int    m,
@@ -692,9 +1143,6 @@ namespace
         // perf_status indicates whether optimal performance is obtainable with available memory
         rocblas_status perf_status = rocblas_status_success;
 
-        size_t invA_bytes   = 0;
-        size_t c_temp_bytes = 0;
-
         // For user-supplied invA, check to make sure size is large enough
         // If not large enough, indicate degraded performance and ignore supplied invA
         if(supplied_invA && supplied_invA_size / BLOCK < m)
@@ -706,48 +1154,40 @@ namespace
             supplied_invA  = nullptr;
         }
 
-        if(!supplied_invA)
-        {
-            // Only allocate bytes for invA if supplied_invA == nullptr or supplied_invA_size is too small
-            invA_bytes = sizeof(T) * BLOCK * m * batch_count;
-
-            // When m < BLOCK, C is unnecessary for trtri
-            c_temp_bytes = (m / BLOCK) * (sizeof(T) * (BLOCK / 2) * (BLOCK / 2)) * batch_count;
-
-            // For the TRTRI last diagonal block we need remainder space if m % BLOCK != 0
-            if(!exact_blocks)
-            {
-                // TODO: Make this more accurate -- right now it's much larger than necessary
-                size_t remainder_bytes = sizeof(T) * ROCBLAS_TRTRI_NB * BLOCK * 2 * batch_count;
+        // Without a supplied invA, the single launch solver is used, which only needs its
+        // completion flags. They are stored in the x_temp memory. Small systems are solved one
+        // per wavefront, without any workspace.
+        size_t x_temp_bytes = rocblas_trsv_use_wavefront(m)
+                                  ? 0
+                                  : rocblas_trsv_persistent_flags_bytes(m, batch_count);
+        size_t xarrBytes    = 0;
 
-                // C is the maximum of the temporary space needed for TRTRI
-                c_temp_bytes = max(c_temp_bytes, remainder_bytes);
-            }
+        if(supplied_invA)
+        {
+            // Temporary solution vector
+            // If the special solver can be used, only BLOCK words are needed instead of m words
+            x_temp_bytes
+                = exact_blocks ? sizeof(T) * BLOCK * batch_count : sizeof(T) * m * batch_count;
+            xarrBytes = BATCHED ? sizeof(T*) * batch_count : 0;
         }
 
-        // Temporary solution vector
-        // If the special solver can be used, then only BLOCK words are needed instead of m words
-        size_t x_temp_bytes
-            = exact_blocks ? sizeof(T) * BLOCK * batch_count : sizeof(T) * m * batch_count;
-
-        // X and C temporaries can share space, so the maximum size is allocated
-        size_t x_c_temp_bytes = max(x_temp_bytes, c_temp_bytes);
-        size_t arrBytes       = BATCHED ? sizeof(T*) * batch_count : 0;
-        size_t xarrBytes      = BATCHED ? sizeof(T*) * batch_count : 0;
-
         // If this is a device memory size query, set optimal size and return changed status
         if(handle->is_device_memory_size_query())
-            return handle->set_optimal_device_memory_size(x_c_temp_bytes, invA_bytes);
+            return handle->set_optimal_device_memory_size(x_temp_bytes, xarrBytes);
 
         // Attempt to allocate optimal memory size, returning error if failure
-        auto mem = handle->device_malloc(x_c_temp_bytes, xarrBytes, invA_bytes, arrBytes);
+        auto mem = handle->device_malloc(x_temp_bytes, xarrBytes);
         if(!mem)
             return rocblas_status_memory_error;
 
         // Get pointers to allocated device memory
         // Note: Order of pointers in std::tie(...) must match order of sizes in handle->device_malloc(...)
 
-        std::tie(*mem_x_temp, *mem_x_temp_arr, *mem_invA, *mem_invA_arr) = mem;
+        std::tie(*mem_x_temp, *mem_x_temp_arr) = mem;
+
+        // invA is no longer computed by TRSV
+        *mem_invA     = nullptr;
+        *mem_invA_arr = nullptr;
 
         return perf_status;
     }
@@ -779,6 +1219,42 @@ namespace
         if(batch_count == 0)
             return rocblas_status_success;
 
+        // Without a usable supplied invA, solve with a single launch
+        if(!supplied_invA || supplied_invA_size / BLOCK < m)
+        {
+            if(rocblas_trsv_use_wavefront(m))
+                return rocblas_trsv_wavefront_template<T>(handle,
+                                                          uplo,
+                                                          transA,
+                                                          diag,
+                                                          m,
+                                                          A,
+                                                          offset_A,
+                                                          lda,
+                                                          stride_A,
+                                                          B,
+                                                          offset_B,
+                                                          incx,
+                                                          stride_B,
+                                                          batch_count);
+
+            return rocblas_trsv_persistent_template<T>(handle,
+                                                       uplo,
+                                                       transA,
+                                                       diag,
+                                                       m,
+                                                       A,
+                                                       offset_A,
+                                                       lda,
+                                                       stride_A,
+                                                       B,
+                                                       offset_B,
+                                                       incx,
+                                                       stride_B,
+                                                       batch_count,
+                                                       (rocblas_int*)x_temp);
+        }
+
         rocblas_status status       = rocblas_status_success;
         const bool     exact_blocks = (m % BLOCK) == 0;
         size_t         x_temp_els   = exact_blocks ? BLOCK : m;
@@ -786,40 +1262,6 @@ namespace
         // Temporarily switch to host pointer mode, restoring on return
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
-        if(supplied_invA)
-            invA = (U*)(supplied_invA);
-        else
-        {
-            // batched trtri invert diagonal part (BLOCK*BLOCK) of A into invA
-            auto c_temp = x_temp; // Uses same memory as x_temp
-            stride_invA = BLOCK * m;
-
-            if(BATCHED)
-            {
-                setup_batched_array<BLOCK>(
-                    handle->rocblas_stream, (T*)c_temp, 0, (T**)x_temparr, batch_count);
-                setup_batched_array<BLOCK>(
-                    handle->rocblas_stream, (T*)invA, stride_invA, (T**)invAarr, batch_count);
-            }
-
-            status
-                = rocblas_trtri_trsm_template<BLOCK, BATCHED, T>(handle,
-                                                                 (V)(BATCHED ? x_temparr : c_temp),
-                                                                 uplo,
-                                                                 diag,
-                                                                 m,
-                                                                 A,
-                                                                 0,
-                                                                 lda,
-                                                                 stride_A,
-                                                                 (V)(BATCHED ? invAarr : invA),
-                                                                 0,
-                                                                 stride_invA,
-                                                                 batch_count);
-            if(status != rocblas_status_success)
-                return status;
-        }
-
         if(transA == rocblas_operation_conjugate_transpose)
             transA = rocblas_operation_transpose;
 
@@ -849,7 +1291,7 @@ namespace
                                                      offset_B,
                                                      abs_incx,
                                                      stride_B,
-                                                     (U)(BATCHED ? invAarr : invA),
+                                                     supplied_invA,
                                                      offset_invA,
                                                      stride_invA,
                                                      (V)(BATCHED ? x_temparr : x_temp),
@@ -876,7 +1318,7 @@ namespace
                                                  offset_B,
                                                  abs_incx,
                                                  stride_B,
-                                                 (U)(BATCHED ? invAarr : invA),
+                                                 supplied_invA,
                                                  offset_invA,
                                                  stride_invA,
                                                  (V)(BATCHED ? x_temparr : x_temp),
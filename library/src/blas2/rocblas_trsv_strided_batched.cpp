@@ -144,6 +144,10 @@ namespace
                                                                            supplied_invA,
                                                                            supplied_invA_size);
 
+        // If this was a device memory query or an error occurred, return status
+        if(status != rocblas_status_success && status != rocblas_status_perf_degraded)
+            return status;
+
         rocblas_status status2 = rocblas_trsv_template<BLOCK, false, T>(handle,
                                                                         uplo,
                                                                         transA,
@@ -2,6 +2,7 @@
  * Copyright 2018-2019 Advanced Micro Devices, Inc.
  ************************************************************************** */
 #include "gemm.hpp"
+#include "gemm_bf16x3.hpp"
 #include "logging.h"
 
 namespace
@@ -41,7 +42,13 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        // Temporary device memory is only used by rocblas_xf32_bf16x3_math
+        if(handle->is_device_memory_size_query())
+        {
+            if(!std::is_same<T, float>{} || handle->math_mode != rocblas_xf32_bf16x3_math)
+                return rocblas_status_size_unchanged;
+            return rocblas_gemm_bf16x3_device_memory_size(handle, m, n, k, 1);
+        }
 
         // Perform logging
         auto layer_mode = handle->layer_mode;
@@ -143,6 +150,30 @@ namespace
         if(validArgs != rocblas_status_success)
             return validArgs;
 
+        // Only the user-facing single precision GEMMs follow the handle's math mode
+        if(std::is_same<T, float>{} && handle->math_mode == rocblas_xf32_bf16x3_math)
+            return rocblas_gemm_bf16x3_template<false, false>(handle,
+                                                              trans_a,
+                                                              trans_b,
+                                                              m,
+                                                              n,
+                                                              k,
+                                                              alpha,
+                                                              A,
+                                                              0,
+                                                              ld_a,
+                                                              0,
+                                                              B,
+                                                              0,
+                                                              ld_b,
+                                                              0,
+                                                              beta,
+                                                              C,
+                                                              0,
+                                                              ld_c,
+                                                              0,
+                                                              1);
+
         return rocblas_gemm_template<false, false>(handle,
                                                    trans_a,
                                                    trans_b,
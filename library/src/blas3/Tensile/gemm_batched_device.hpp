@@ -0,0 +1,434 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#pragma once
+#ifndef _GEMM_BATCHED_DEVICE_HPP_
+#define _GEMM_BATCHED_DEVICE_HPP_
+
+#include "handle.h"
+#include "rocblas.h"
+#include "utility.h"
+
+/*
+ * Batched GEMM which reads arrays of device pointers on the device
+ *
+ * The Tensile path of rocblas_gemm_template<BATCHED = true> copies the arrays of pointers to
+ * the host and launches one GEMM per batch, which synchronizes with the host. Routines which
+ * must run asynchronously on the stream, such as TRSM and TRTRI, use these kernels instead.
+ * They handle all of the batches in a single launch, and never copy the arrays of pointers to
+ * the host.
+ *
+ * Products with m and n of at least GEMM_BATCHED_DEVICE_BLK use a register-blocked kernel,
+ * where each workgroup computes a BLK x BLK tile of C and each thread a 4 x 4 block of it.
+ * Smaller products use a kernel with one element of C per thread, which wastes less of its
+ * tiles on the edges.
+ *
+ * Each batch may also contain sub_count matrices, sub_stride elements apart, which are
+ * multiplied in the same launch. This is the layout of the diagonal blocks used by TRTRI.
+ */
+
+constexpr rocblas_int GEMM_BATCHED_DEVICE_DIM   = 16;
+constexpr rocblas_int GEMM_BATCHED_DEVICE_BLK   = 64;
+constexpr rocblas_int GEMM_BATCHED_DEVICE_BLK_K = 16;
+
+// Element (i, j) of op(A)
+template <typename T>
+__device__ inline T gemm_batched_device_load(
+    const T* A, rocblas_int ld, rocblas_operation trans, rocblas_int i, rocblas_int j)
+{
+    if(trans == rocblas_operation_none)
+        return A[i + ptrdiff_t(j) * ld];
+    T a = A[j + ptrdiff_t(i) * ld];
+    return trans == rocblas_operation_conjugate_transpose ? conj(a) : a;
+}
+
+// C = alpha * op(A) * op(B) + beta * C, with DIM x DIM tiles of C per workgroup
+template <rocblas_int DIM, typename T, typename TScal, typename UA, typename UB, typename V>
+__global__ void gemm_batched_device_kernel(rocblas_operation trans_a,
+                                           rocblas_operation trans_b,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           TScal             alpha_device_host,
+                                           UA                Aa,
+                                           rocblas_int       offset_a,
+                                           rocblas_int       ld_a,
+                                           rocblas_stride    stride_a,
+                                           rocblas_stride    sub_stride_a,
+                                           UB                Ba,
+                                           rocblas_int       offset_b,
+                                           rocblas_int       ld_b,
+                                           rocblas_stride    stride_b,
+                                           rocblas_stride    sub_stride_b,
+                                           TScal             beta_device_host,
+                                           V                 Ca,
+                                           rocblas_int       offset_c,
+                                           rocblas_int       ld_c,
+                                           rocblas_stride    stride_c,
+                                           rocblas_stride    sub_stride_c,
+                                           rocblas_int       sub_count)
+{
+    __shared__ T sA[DIM][DIM];
+    __shared__ T sB[DIM][DIM];
+
+    rocblas_int tx    = hipThreadIdx_x;
+    rocblas_int ty    = hipThreadIdx_y;
+    rocblas_int row   = hipBlockIdx_x * DIM + tx;
+    rocblas_int col   = hipBlockIdx_y * DIM + ty;
+    rocblas_int batch = hipBlockIdx_z / sub_count;
+    rocblas_int sub   = hipBlockIdx_z % sub_count;
+
+    const T* A     = load_ptr_batch(Aa, batch, offset_a + sub * sub_stride_a, stride_a);
+    const T* B     = load_ptr_batch(Ba, batch, offset_b + sub * sub_stride_b, stride_b);
+    T*       C     = load_ptr_batch(Ca, batch, offset_c + sub * sub_stride_c, stride_c);
+    auto     alpha = load_scalar(alpha_device_host);
+    auto     beta  = load_scalar(beta_device_host);
+
+    T sum = 0;
+    if(alpha != 0)
+    {
+        for(rocblas_int kk = 0; kk < k; kk += DIM)
+        {
+            // op(A)[row, kk + ty] and op(B)[kk + tx, col]
+            T a = 0, b = 0;
+            if(row < m && kk + ty < k)
+                a = gemm_batched_device_load(A, ld_a, trans_a, row, kk + ty);
+            if(col < n && kk + tx < k)
+                b = gemm_batched_device_load(B, ld_b, trans_b, kk + tx, col);
+            sA[ty][tx] = a;
+            sB[ty][tx] = b;
+
+            __syncthreads();
+
+            for(rocblas_int l = 0; l < DIM; l++)
+                sum += sA[l][tx] * sB[ty][l];
+
+            __syncthreads();
+        }
+    }
+
+    if(row < m && col < n)
+    {
+        T& c = C[row + ptrdiff_t(col) * ld_c];
+
+        // beta == 0 overwrites C, so that NaNs in C are not propagated
+        c = beta != 0 ? alpha * sum + beta * c : alpha * sum;
+    }
+}
+
+// C = alpha * op(A) * op(B) + beta * C, with BLK x BLK tiles of C per workgroup of DIM x DIM
+// threads. Thread (tx, ty) computes the rows tx + r * DIM and columns ty + s * DIM of the tile.
+template <rocblas_int DIM,
+          rocblas_int BLK,
+          rocblas_int BLK_K,
+          typename T,
+          typename TScal,
+          typename UA,
+          typename UB,
+          typename V>
+__global__ void gemm_batched_device_blocked_kernel(rocblas_operation trans_a,
+                                                   rocblas_operation trans_b,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   rocblas_int       k,
+                                                   TScal             alpha_device_host,
+                                                   UA                Aa,
+                                                   rocblas_int       offset_a,
+                                                   rocblas_int       ld_a,
+                                                   rocblas_stride    stride_a,
+                                                   rocblas_stride    sub_stride_a,
+                                                   UB                Ba,
+                                                   rocblas_int       offset_b,
+                                                   rocblas_int       ld_b,
+                                                   rocblas_stride    stride_b,
+                                                   rocblas_stride    sub_stride_b,
+                                                   TScal             beta_device_host,
+                                                   V                 Ca,
+                                                   rocblas_int       offset_c,
+                                                   rocblas_int       ld_c,
+                                                   rocblas_stride    stride_c,
+                                                   rocblas_stride    sub_stride_c,
+                                                   rocblas_int       sub_count)
+{
+    static_assert(BLK % DIM == 0 && BLK * BLK_K % (DIM * DIM) == 0,
+                  "The tiles must be divisible among the threads");
+    constexpr rocblas_int R = BLK / DIM;
+
+    // sA[l][i] is op(A)[i0 + i, kk + l] and sB[l][j] is op(B)[kk + l, j0 + j]
+    __shared__ T sA[BLK_K][BLK];
+    __shared__ T sB[BLK_K][BLK];
+
+    rocblas_int tx    = hipThreadIdx_x;
+    rocblas_int ty    = hipThreadIdx_y;
+    rocblas_int tid   = tx + ty * DIM;
+    rocblas_int i0    = hipBlockIdx_x * BLK;
+    rocblas_int j0    = hipBlockIdx_y * BLK;
+    rocblas_int batch = hipBlockIdx_z / sub_count;
+    rocblas_int sub   = hipBlockIdx_z % sub_count;
+
+    const T* A     = load_ptr_batch(Aa, batch, offset_a + sub * sub_stride_a, stride_a);
+    const T* B     = load_ptr_batch(Ba, batch, offset_b + sub * sub_stride_b, stride_b);
+    T*       C     = load_ptr_batch(Ca, batch, offset_c + sub * sub_stride_c, stride_c);
+    auto     alpha = load_scalar(alpha_device_host);
+    auto     beta  = load_scalar(beta_device_host);
+
+    // Consecutive threads load consecutive elements in memory
+    bool a_cols = trans_a == rocblas_operation_none;
+    bool b_cols = trans_b != rocblas_operation_none;
+
+    T sum[R][R] = {};
+    if(alpha != 0)
+    {
+        for(rocblas_int kk = 0; kk < k; kk += BLK_K)
+        {
+            for(rocblas_int e = tid; e < BLK * BLK_K; e += DIM * DIM)
+            {
+                rocblas_int i  = a_cols ? e % BLK : e / BLK_K;
+                rocblas_int la = a_cols ? e / BLK : e % BLK_K;
+                rocblas_int j  = b_cols ? e % BLK : e / BLK_K;
+                rocblas_int lb = b_cols ? e / BLK : e % BLK_K;
+
+                T a = 0, b = 0;
+                if(i0 + i < m && kk + la < k)
+                    a = gemm_batched_device_load(A, ld_a, trans_a, i0 + i, kk + la);
+                if(j0 + j < n && kk + lb < k)
+                    b = gemm_batched_device_load(B, ld_b, trans_b, kk + lb, j0 + j);
+                sA[la][i] = a;
+                sB[lb][j] = b;
+            }
+
+            __syncthreads();
+
+            for(rocblas_int l = 0; l < BLK_K; l++)
+            {
+                T a[R], b[R];
+                for(rocblas_int r = 0; r < R; r++)
+                {
+                    a[r] = sA[l][tx + r * DIM];
+                    b[r] = sB[l][ty + r * DIM];
+                }
+                for(rocblas_int r = 0; r < R; r++)
+                    for(rocblas_int s = 0; s < R; s++)
+                        sum[r][s] += a[r] * b[s];
+            }
+
+            __syncthreads();
+        }
+    }
+
+    for(rocblas_int s = 0; s < R; s++)
+    {
+        rocblas_int col = j0 + ty + s * DIM;
+        for(rocblas_int r = 0; r < R; r++)
+        {
+            rocblas_int row = i0 + tx + r * DIM;
+            if(row < m && col < n)
+            {
+                T& c = C[row + ptrdiff_t(col) * ld_c];
+
+                // beta == 0 overwrites C, so that NaNs in C are not propagated
+                c = beta != 0 ? alpha * sum[r][s] + beta * c : alpha * sum[r][s];
+            }
+        }
+    }
+}
+
+// Launches the kernel for the sizes of the product, with alpha and beta on the host or device
+template <typename T, typename TScal, typename UA, typename UB, typename V>
+void rocblas_gemm_batched_device_launch(rocblas_handle    handle,
+                                        rocblas_operation trans_a,
+                                        rocblas_operation trans_b,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        rocblas_int       k,
+                                        TScal             alpha,
+                                        UA                A,
+                                        rocblas_int       offset_a,
+                                        rocblas_int       ld_a,
+                                        rocblas_stride    stride_a,
+                                        rocblas_stride    sub_stride_a,
+                                        UB                B,
+                                        rocblas_int       offset_b,
+                                        rocblas_int       ld_b,
+                                        rocblas_stride    stride_b,
+                                        rocblas_stride    sub_stride_b,
+                                        TScal             beta,
+                                        V                 C,
+                                        rocblas_int       offset_c,
+                                        rocblas_int       ld_c,
+                                        rocblas_stride    stride_c,
+                                        rocblas_stride    sub_stride_c,
+                                        rocblas_int       batch_count,
+                                        rocblas_int       sub_count)
+{
+    dim3 threads(GEMM_BATCHED_DEVICE_DIM, GEMM_BATCHED_DEVICE_DIM);
+
+    if(m >= GEMM_BATCHED_DEVICE_BLK && n >= GEMM_BATCHED_DEVICE_BLK)
+    {
+        dim3 grid((m - 1) / GEMM_BATCHED_DEVICE_BLK + 1,
+                  (n - 1) / GEMM_BATCHED_DEVICE_BLK + 1,
+                  batch_count * sub_count);
+
+        hipLaunchKernelGGL((gemm_batched_device_blocked_kernel<GEMM_BATCHED_DEVICE_DIM,
+                                                               GEMM_BATCHED_DEVICE_BLK,
+                                                               GEMM_BATCHED_DEVICE_BLK_K,
+                                                               T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           trans_a,
+                           trans_b,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           offset_a,
+                           ld_a,
+                           stride_a,
+                           sub_stride_a,
+                           B,
+                           offset_b,
+                           ld_b,
+                           stride_b,
+                           sub_stride_b,
+                           beta,
+                           C,
+                           offset_c,
+                           ld_c,
+                           stride_c,
+                           sub_stride_c,
+                           sub_count);
+    }
+    else
+    {
+        dim3 grid((m - 1) / GEMM_BATCHED_DEVICE_DIM + 1,
+                  (n - 1) / GEMM_BATCHED_DEVICE_DIM + 1,
+                  batch_count * sub_count);
+
+        hipLaunchKernelGGL((gemm_batched_device_kernel<GEMM_BATCHED_DEVICE_DIM, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           trans_a,
+                           trans_b,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           offset_a,
+                           ld_a,
+                           stride_a,
+                           sub_stride_a,
+                           B,
+                           offset_b,
+                           ld_b,
+                           stride_b,
+                           sub_stride_b,
+                           beta,
+                           C,
+                           offset_c,
+                           ld_c,
+                           stride_c,
+                           sub_stride_c,
+                           sub_count);
+    }
+}
+
+/*! \brief Batched GEMM on arrays of device pointers or strided matrices, without host
+    synchronization.
+
+    alpha and beta follow the pointer mode of the handle. For each of the batch_count batches,
+    sub_count products are computed, with matrices sub_stride_a, sub_stride_b and sub_stride_c
+    apart. */
+template <typename T, typename UA, typename UB, typename V>
+rocblas_status rocblas_gemm_batched_device_template(rocblas_handle    handle,
+                                                    rocblas_operation trans_a,
+                                                    rocblas_operation trans_b,
+                                                    rocblas_int       m,
+                                                    rocblas_int       n,
+                                                    rocblas_int       k,
+                                                    const T*          alpha,
+                                                    UA                A,
+                                                    rocblas_int       offset_a,
+                                                    rocblas_int       ld_a,
+                                                    rocblas_stride    stride_a,
+                                                    UB                B,
+                                                    rocblas_int       offset_b,
+                                                    rocblas_int       ld_b,
+                                                    rocblas_stride    stride_b,
+                                                    const T*          beta,
+                                                    V                 C,
+                                                    rocblas_int       offset_c,
+                                                    rocblas_int       ld_c,
+                                                    rocblas_stride    stride_c,
+                                                    rocblas_int       batch_count,
+                                                    rocblas_int       sub_count    = 1,
+                                                    rocblas_stride    sub_stride_a = 0,
+                                                    rocblas_stride    sub_stride_b = 0,
+                                                    rocblas_stride    sub_stride_c = 0)
+{
+    // Quick return. k == 0 still scales C by beta, which is known here only for host scalars.
+    if(!m || !n || !batch_count || !sub_count)
+        return rocblas_status_success;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        rocblas_gemm_batched_device_launch<T>(handle,
+                                              trans_a,
+                                              trans_b,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              offset_a,
+                                              ld_a,
+                                              stride_a,
+                                              sub_stride_a,
+                                              B,
+                                              offset_b,
+                                              ld_b,
+                                              stride_b,
+                                              sub_stride_b,
+                                              beta,
+                                              C,
+                                              offset_c,
+                                              ld_c,
+                                              stride_c,
+                                              sub_stride_c,
+                                              batch_count,
+                                              sub_count);
+    else if(*beta != 1 || (k && *alpha != 0))
+        rocblas_gemm_batched_device_launch<T>(handle,
+                                              trans_a,
+                                              trans_b,
+                                              m,
+                                              n,
+                                              k,
+                                              *alpha,
+                                              A,
+                                              offset_a,
+                                              ld_a,
+                                              stride_a,
+                                              sub_stride_a,
+                                              B,
+                                              offset_b,
+                                              ld_b,
+                                              stride_b,
+                                              sub_stride_b,
+                                              *beta,
+                                              C,
+                                              offset_c,
+                                              ld_c,
+                                              stride_c,
+                                              sub_stride_c,
+                                              batch_count,
+                                              sub_count);
+
+    return rocblas_status_success;
+}
+
+#endif // _GEMM_BATCHED_DEVICE_HPP_
@@ -0,0 +1,390 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#pragma once
+#ifndef _GEMM_BF16X3_HPP_
+#define _GEMM_BF16X3_HPP_
+
+#include "../../blas_ex/rocblas_gemm_ex.hpp"
+#include "handle.h"
+#include "rocblas.h"
+#include "utility.h"
+
+/*
+ * Single precision GEMM emulated with bfloat16 products (rocblas_xf32_bf16x3_math)
+ *
+ * Each element x of A and B is split into x = hi + lo + O(2^-16 * x), where hi is x rounded
+ * to bfloat16 and lo is the remainder x - hi rounded to bfloat16. Then
+ *
+ *   A * B ~= A_hi * B_hi + A_hi * B_lo + A_lo * B_hi
+ *
+ * dropping A_lo * B_lo, which is about 2^-16 relative to A * B. The three products are
+ * computed by the bfloat16 gemm_ex kernels (BBH), which accumulate in FP32, as one GEMM over
+ * the operands stacked along k:
+ *
+ *   [A_hi A_hi A_lo] * [B_hi; B_lo; B_hi]
+ *
+ * The BBH kernels round D to bfloat16, so the result is kept as the sum of two bfloat16
+ * matrices: D1 = bf16(A_hi * B_hi), and D2 = bf16(stacked product - D1) with C = D1 and
+ * beta = -1. D2 only holds the remainder, so D1 + D2 has about 16 significant bits, and
+ * C = alpha * (D1 + D2) + beta * C is formed in FP32.
+ *
+ * The mode applies to rocblas_sgemm, rocblas_sgemm_batched and rocblas_sgemm_strided_batched.
+ * The float GEMMs used inside other functions, such as trsm, syrk and symm, do not use it.
+ */
+
+constexpr rocblas_int GEMM_BF16X3_DIM_X = 64;
+constexpr rocblas_int GEMM_BF16X3_DIM_Y = 4;
+
+// Split x into bfloat16 high and low parts
+__device__ inline void gemm_bf16x3_split(float x, rocblas_bfloat16& hi, rocblas_bfloat16& lo)
+{
+    hi = rocblas_bfloat16(x);
+
+    // If rounding a large finite x overflows to Inf, truncate instead
+    if(!isinf(x) && isinf(float(hi)))
+        hi.data = uint16_t(__float_as_uint(x) >> 16);
+
+    // Inf has no low part; NaN propagates through x - hi
+    lo = float(hi) == x ? rocblas_bfloat16(0.0f) : rocblas_bfloat16(x - float(hi));
+}
+
+// Split the rows x cols matrix X into W, as three copies stacked along the k dimension, which
+// is the columns of X if k_in_cols and its rows otherwise. Copy lo_block holds the low parts
+// and the other two copies hold the high parts.
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename U>
+__global__ void gemm_bf16x3_split_kernel(rocblas_int       rows,
+                                         rocblas_int       cols,
+                                         U                 Xa,
+                                         rocblas_int       offset_x,
+                                         rocblas_int       ld_x,
+                                         rocblas_stride    stride_x,
+                                         bool              k_in_cols,
+                                         rocblas_int       lo_block,
+                                         rocblas_bfloat16* W,
+                                         rocblas_stride    stride_w,
+                                         rocblas_int       batch_offset)
+{
+    rocblas_int row = hipBlockIdx_x * DIM_X + hipThreadIdx_x;
+    rocblas_int col = hipBlockIdx_y * DIM_Y + hipThreadIdx_y;
+
+    if(row < rows && col < cols)
+    {
+        const float* X = load_ptr_batch(Xa, batch_offset + hipBlockIdx_z, offset_x, stride_x);
+
+        rocblas_bfloat16 hi, lo;
+        gemm_bf16x3_split(X[row + ptrdiff_t(col) * ld_x], hi, lo);
+
+        W += hipBlockIdx_z * stride_w;
+        for(rocblas_int j = 0; j < 3; j++)
+        {
+            ptrdiff_t i = k_in_cols ? row + ptrdiff_t(col + j * cols) * rows
+                                    : row + j * rows + ptrdiff_t(col) * 3 * rows;
+            W[i]        = j == lo_block ? lo : hi;
+        }
+    }
+}
+
+// C = alpha * (D1 + D2) + beta * C
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename V>
+__global__ void gemm_bf16x3_combine_kernel(rocblas_int             m,
+                                           rocblas_int             n,
+                                           float                   alpha,
+                                           const rocblas_bfloat16* D1,
+                                           const rocblas_bfloat16* D2,
+                                           rocblas_stride          stride_d,
+                                           float                   beta,
+                                           V                       Ca,
+                                           rocblas_int             offset_c,
+                                           rocblas_int             ld_c,
+                                           rocblas_stride          stride_c,
+                                           rocblas_int             batch_offset)
+{
+    rocblas_int row = hipBlockIdx_x * DIM_X + hipThreadIdx_x;
+    rocblas_int col = hipBlockIdx_y * DIM_Y + hipThreadIdx_y;
+
+    if(row < m && col < n)
+    {
+        float* C = load_ptr_batch(Ca, batch_offset + hipBlockIdx_z, offset_c, stride_c);
+        float& c = C[row + ptrdiff_t(col) * ld_c];
+
+        // D1 and D2 are not computed when alpha == 0 or k == 0
+        float ab = 0;
+        if(alpha != 0)
+        {
+            ptrdiff_t i = hipBlockIdx_z * stride_d + row + ptrdiff_t(col) * m;
+            ab          = alpha * (float(D1[i]) + float(D2[i]));
+        }
+
+        // beta == 0 overwrites C, so that NaNs in C are not propagated
+        c = beta != 0 ? ab + beta * c : ab;
+    }
+}
+
+// Elements of temporary device memory per batch: the stacked A and B, and D1 and D2
+inline std::array<size_t, 4> gemm_bf16x3_sizes(rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    if(m <= 0 || n <= 0 || k <= 0)
+        return {{0, 0, 0, 0}};
+    return {{size_t(3) * m * k, size_t(3) * k * n, size_t(m) * n, size_t(m) * n}};
+}
+
+/*! \brief Sets the optimal device memory size of a single precision GEMM with
+    rocblas_xf32_bf16x3_math. */
+inline rocblas_status rocblas_gemm_bf16x3_device_memory_size(rocblas_handle handle,
+                                                             rocblas_int    m,
+                                                             rocblas_int    n,
+                                                             rocblas_int    k,
+                                                             rocblas_int    batch_count)
+{
+    auto   sizes = gemm_bf16x3_sizes(m, n, k);
+    size_t b     = batch_count > 0 ? batch_count : 0;
+    return handle->set_optimal_device_memory_size(sizeof(rocblas_bfloat16) * sizes[0] * b,
+                                                  sizeof(rocblas_bfloat16) * sizes[1] * b,
+                                                  sizeof(rocblas_bfloat16) * sizes[2] * b,
+                                                  sizeof(rocblas_bfloat16) * sizes[3] * b);
+}
+
+// The emulation only applies to single precision
+template <bool BATCHED, bool STRIDED, typename T, typename U, typename V>
+inline rocblas_status rocblas_gemm_bf16x3_template(rocblas_handle    handle,
+                                                   rocblas_operation trans_a,
+                                                   rocblas_operation trans_b,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   rocblas_int       k,
+                                                   const T*          alpha,
+                                                   const U*          A,
+                                                   rocblas_int       offset_a,
+                                                   rocblas_int       ld_a,
+                                                   rocblas_stride    stride_a,
+                                                   const U*          B,
+                                                   rocblas_int       offset_b,
+                                                   rocblas_int       ld_b,
+                                                   rocblas_stride    stride_b,
+                                                   const T*          beta,
+                                                   V*                C,
+                                                   rocblas_int       offset_c,
+                                                   rocblas_int       ld_c,
+                                                   rocblas_stride    stride_c,
+                                                   rocblas_int       batch_count)
+{
+    return rocblas_status_not_implemented;
+}
+
+/*! \brief Single precision GEMM with rocblas_xf32_bf16x3_math.
+
+    The batch is processed in chunks which fit in the device memory available. */
+template <bool BATCHED, bool STRIDED, typename U, typename V>
+inline rocblas_status rocblas_gemm_bf16x3_template(rocblas_handle    handle,
+                                                   rocblas_operation trans_a,
+                                                   rocblas_operation trans_b,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   rocblas_int       k,
+                                                   const float*      alpha,
+                                                   const U*          A,
+                                                   rocblas_int       offset_a,
+                                                   rocblas_int       ld_a,
+                                                   rocblas_stride    stride_a,
+                                                   const U*          B,
+                                                   rocblas_int       offset_b,
+                                                   rocblas_int       ld_b,
+                                                   rocblas_stride    stride_b,
+                                                   const float*      beta,
+                                                   V*                C,
+                                                   rocblas_int       offset_c,
+                                                   rocblas_int       ld_c,
+                                                   rocblas_stride    stride_c,
+                                                   rocblas_int       batch_count)
+{
+    // Early exit. Note: k==0 is not an early exit, since C still needs to be multiplied by beta.
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    float alpha_h, beta_h;
+
+    // If in device pointer mode, copy alpha and beta to host
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(&alpha_h, alpha, sizeof(float), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(&beta_h, beta, sizeof(float), hipMemcpyDeviceToHost));
+        alpha = &alpha_h;
+        beta  = &beta_h;
+    }
+
+    // When beta == 1 and either k == 0 or alpha == 0, the operation is a no-op
+    if(*beta == 1 && (k == 0 || *alpha == 0))
+        return rocblas_status_success;
+
+    // The products are only needed when alpha != 0 and k != 0
+    bool products = *alpha != 0 && k != 0;
+    auto sizes    = gemm_bf16x3_sizes(m, n, products ? k : 0);
+
+    // Try the whole batch first, and halve the chunk of the batch while it does not fit
+    for(rocblas_int chunk = batch_count;; chunk = (chunk + 1) / 2)
+    {
+        auto mem = handle->device_malloc(sizeof(rocblas_bfloat16) * sizes[0] * chunk,
+                                         sizeof(rocblas_bfloat16) * sizes[1] * chunk,
+                                         sizeof(rocblas_bfloat16) * sizes[2] * chunk,
+                                         sizeof(rocblas_bfloat16) * sizes[3] * chunk);
+        if(!mem)
+        {
+            if(chunk == 1)
+                return rocblas_status_memory_error;
+            continue;
+        }
+
+        void *W_a, *W_b, *D1, *D2;
+        std::tie(W_a, W_b, D1, D2) = mem;
+
+        // op(A) is m x 3k and op(B) is 3k x n after stacking; transposed operands stay
+        // transposed, so that the split kernels read and write along the same dimension
+        bool              a_n    = trans_a == rocblas_operation_none;
+        bool              b_n    = trans_b == rocblas_operation_none;
+        rocblas_operation op_a   = a_n ? rocblas_operation_none : rocblas_operation_transpose;
+        rocblas_operation op_b   = b_n ? rocblas_operation_none : rocblas_operation_transpose;
+        rocblas_int       ld_w_a = a_n ? m : 3 * k;
+        rocblas_int       ld_w_b = b_n ? 3 * k : n;
+
+        for(rocblas_int b = 0; b < batch_count; b += chunk)
+        {
+            rocblas_int nb = std::min(chunk, batch_count - b);
+            dim3        threads(GEMM_BF16X3_DIM_X, GEMM_BF16X3_DIM_Y);
+
+            if(products)
+            {
+                rocblas_int a_rows = a_n ? m : k, a_cols = a_n ? k : m;
+                rocblas_int b_rows = b_n ? k : n, b_cols = b_n ? n : k;
+
+                dim3 grid_a((a_rows - 1) / GEMM_BF16X3_DIM_X + 1,
+                            (a_cols - 1) / GEMM_BF16X3_DIM_Y + 1,
+                            nb);
+                dim3 grid_b((b_rows - 1) / GEMM_BF16X3_DIM_X + 1,
+                            (b_cols - 1) / GEMM_BF16X3_DIM_Y + 1,
+                            nb);
+
+                // [A_hi A_hi A_lo] and [B_hi; B_lo; B_hi]
+                hipLaunchKernelGGL(
+                    (gemm_bf16x3_split_kernel<GEMM_BF16X3_DIM_X, GEMM_BF16X3_DIM_Y, const U*>),
+                    grid_a,
+                    threads,
+                    0,
+                    handle->rocblas_stream,
+                    a_rows,
+                    a_cols,
+                    A,
+                    offset_a,
+                    ld_a,
+                    stride_a,
+                    a_n,
+                    2,
+                    (rocblas_bfloat16*)W_a,
+                    sizes[0],
+                    b);
+                hipLaunchKernelGGL(
+                    (gemm_bf16x3_split_kernel<GEMM_BF16X3_DIM_X, GEMM_BF16X3_DIM_Y, const U*>),
+                    grid_b,
+                    threads,
+                    0,
+                    handle->rocblas_stream,
+                    b_rows,
+                    b_cols,
+                    B,
+                    offset_b,
+                    ld_b,
+                    stride_b,
+                    !b_n,
+                    1,
+                    (rocblas_bfloat16*)W_b,
+                    sizes[1],
+                    b);
+
+                // D1 = A_hi * B_hi, which is the first of the stacked blocks
+                float one = 1, zero = 0, minus_one = -1;
+
+                rocblas_status status = gemm_ex_handle_transpose(handle,
+                                                                 op_a,
+                                                                 op_b,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 &one,
+                                                                 (const tensile_bfloat16*)W_a,
+                                                                 0,
+                                                                 ld_w_a,
+                                                                 sizes[0],
+                                                                 (const tensile_bfloat16*)W_b,
+                                                                 0,
+                                                                 ld_w_b,
+                                                                 sizes[1],
+                                                                 &zero,
+                                                                 (const tensile_bfloat16*)D1,
+                                                                 0,
+                                                                 m,
+                                                                 sizes[2],
+                                                                 (tensile_bfloat16*)D1,
+                                                                 0,
+                                                                 m,
+                                                                 sizes[2],
+                                                                 nb);
+                if(status != rocblas_status_success)
+                    return status;
+
+                // D2 = [A_hi A_hi A_lo] * [B_hi; B_lo; B_hi] - D1
+                status = gemm_ex_handle_transpose(handle,
+                                                  op_a,
+                                                  op_b,
+                                                  m,
+                                                  n,
+                                                  3 * k,
+                                                  &one,
+                                                  (const tensile_bfloat16*)W_a,
+                                                  0,
+                                                  ld_w_a,
+                                                  sizes[0],
+                                                  (const tensile_bfloat16*)W_b,
+                                                  0,
+                                                  ld_w_b,
+                                                  sizes[1],
+                                                  &minus_one,
+                                                  (const tensile_bfloat16*)D1,
+                                                  0,
+                                                  m,
+                                                  sizes[2],
+                                                  (tensile_bfloat16*)D2,
+                                                  0,
+                                                  m,
+                                                  sizes[3],
+                                                  nb);
+                if(status != rocblas_status_success)
+                    return status;
+            }
+
+            dim3 grid_c((m - 1) / GEMM_BF16X3_DIM_X + 1, (n - 1) / GEMM_BF16X3_DIM_Y + 1, nb);
+
+            hipLaunchKernelGGL(
+                (gemm_bf16x3_combine_kernel<GEMM_BF16X3_DIM_X, GEMM_BF16X3_DIM_Y, V*>),
+                grid_c,
+                threads,
+                0,
+                handle->rocblas_stream,
+                m,
+                n,
+                products ? *alpha : 0.0f,
+                (const rocblas_bfloat16*)D1,
+                (const rocblas_bfloat16*)D2,
+                sizes[2],
+                *beta,
+                C,
+                offset_c,
+                ld_c,
+                stride_c,
+                b);
+        }
+
+        return rocblas_status_success;
+    }
+}
+
+#endif // _GEMM_BF16X3_HPP_
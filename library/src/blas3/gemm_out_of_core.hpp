@@ -0,0 +1,233 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __GEMM_OUT_OF_CORE_HPP__
+#define __GEMM_OUT_OF_CORE_HPP__
+
+/*
+ * Host-side tile scheduler and transfer pipeline for out-of-core GEMM.
+ *
+ * Nothing in this file touches HIP directly. The pipeline is written against a
+ * DEVICE policy which performs the tile transfers, the tile GEMM, and the
+ * record/wait operations on events between its queues. The library provides a
+ * HIP policy in rocblas_gemm_out_of_core.cpp; the client tests provide a mock
+ * policy which checks the ordering of every buffer access.
+ */
+
+#include "definitions.h"
+#include "rocblas.h"
+#include <algorithm>
+#include <cstddef>
+
+// Tile sizes used for one out-of-core GEMM. mb and nb partition C, kb partitions the
+// reduction dimension. A zero tiling means that no tiling fits in the workspace.
+struct rocblas_gemm_ooc_tiling
+{
+    rocblas_int mb;
+    rocblas_int nb;
+    rocblas_int kb;
+
+    // Elements of each double-buffered tile
+    size_t A_tile_els() const
+    {
+        return size_t(mb) * kb;
+    }
+    size_t B_tile_els() const
+    {
+        return size_t(kb) * nb;
+    }
+    size_t C_tile_els() const
+    {
+        return size_t(mb) * nb;
+    }
+
+    // Total device workspace: two slots each of the A, B and C tiles
+    size_t workspace_bytes(size_t elem_size) const
+    {
+        return 2 * (A_tile_els() + B_tile_els() + C_tile_els()) * elem_size;
+    }
+};
+
+/*! \brief Choose the largest tiling not exceeding max_tile whose workspace is accepted by fits.
+
+    fits(size_t bytes) returns whether a workspace of that size can be obtained. The
+    largest tile dimension is halved until fits() accepts the workspace or all tile
+    dimensions are 1, in which case a zero tiling is returned.
+*/
+template <typename FITS>
+rocblas_gemm_ooc_tiling rocblas_gemm_ooc_choose_tiling(rocblas_int m,
+                                                       rocblas_int n,
+                                                       rocblas_int k,
+                                                       size_t      elem_size,
+                                                       rocblas_int max_tile,
+                                                       FITS&&      fits)
+{
+    rocblas_gemm_ooc_tiling t{
+        std::min(m, max_tile), std::min(n, max_tile), std::min(k, max_tile)};
+
+    // k == 0 still scales C by beta, so keep a nonzero kb to size the A and B slots
+    t.kb = std::max(t.kb, 1);
+
+    while(!fits(t.workspace_bytes(elem_size)))
+    {
+        rocblas_int* largest = &t.mb;
+        if(t.nb > *largest)
+            largest = &t.nb;
+        if(t.kb > *largest)
+            largest = &t.kb;
+
+        if(*largest == 1)
+            return {0, 0, 0};
+
+        *largest = (*largest + 1) / 2;
+    }
+    return t;
+}
+
+// One step of the schedule: a (m x k) * (k x n) tile product accumulated into the
+// C tile at (i, j). first_k is set on the first k-panel of a C tile and last_k on the last.
+struct rocblas_gemm_ooc_step
+{
+    rocblas_int i, j, l;
+    rocblas_int m, n, k;
+    bool        first_k, last_k;
+};
+
+/*! \brief Enumerate the steps of an out-of-core GEMM in pipeline order.
+
+    C tiles are visited column of tiles by column of tiles; the k-panels of each C tile
+    are consecutive so that the C tile stays resident while it accumulates.
+    func(const rocblas_gemm_ooc_step&) is called for each step and may return a
+    non-success status to stop the enumeration.
+*/
+template <typename FUNC>
+rocblas_status rocblas_gemm_ooc_schedule(
+    rocblas_int m, rocblas_int n, rocblas_int k, const rocblas_gemm_ooc_tiling& t, FUNC&& func)
+{
+    for(rocblas_int j = 0; j < n; j += t.nb)
+        for(rocblas_int i = 0; i < m; i += t.mb)
+        {
+            rocblas_int l = 0;
+            do
+            {
+                rocblas_gemm_ooc_step step;
+                step.i       = i;
+                step.j       = j;
+                step.l       = l;
+                step.m       = std::min(t.mb, m - i);
+                step.n       = std::min(t.nb, n - j);
+                step.k       = std::min(t.kb, k - l);
+                step.first_k = l == 0;
+                step.last_k  = l + t.kb >= k;
+
+                rocblas_status status = func(step);
+                if(status != rocblas_status_success)
+                    return status;
+
+                l += t.kb;
+            } while(l < k);
+        }
+    return rocblas_status_success;
+}
+
+// Queues used by the pipeline. Transfers in each direction get their own queue so
+// that uploads of the next tiles and downloads of finished C tiles overlap compute.
+enum rocblas_gemm_ooc_queue
+{
+    rocblas_gemm_ooc_compute,
+    rocblas_gemm_ooc_upload,
+    rocblas_gemm_ooc_download,
+};
+
+// Events used by the pipeline, each of which exists once per buffer slot
+enum rocblas_gemm_ooc_event
+{
+    rocblas_gemm_ooc_uploaded, // A, B (and C) tiles of a step are on the device
+    rocblas_gemm_ooc_computed, // tile GEMM of a step has finished with its A and B slot
+    rocblas_gemm_ooc_downloaded, // C tile has been copied back to the host
+};
+
+constexpr int rocblas_gemm_ooc_slots = 2;
+
+/*! \brief Run the out-of-core GEMM pipeline.
+
+    The DEVICE policy provides:
+
+      upload_A(slot, step), upload_B(slot, step), upload_C(slot, step),
+      download_C(slot, step)                  enqueue a tile transfer on the matching queue
+      gemm(ab_slot, c_slot, step, beta_first) enqueue the tile GEMM on the compute queue,
+                                              scaling C by beta on the first k-panel
+      record(queue, event, slot)              record an event after the queue's prior work
+      wait(queue, event, slot)                make the queue wait for the latest record
+      synchronize()                           wait for all queues
+
+    each returning rocblas_status. A and B tiles are double-buffered per step and C tiles
+    are double-buffered per C tile, so the upload of step s+1 and the download of the
+    previous C tile run while the GEMM of step s executes.
+*/
+template <typename DEVICE>
+rocblas_status rocblas_gemm_ooc_pipeline(DEVICE&                        device,
+                                         rocblas_int                    m,
+                                         rocblas_int                    n,
+                                         rocblas_int                    k,
+                                         const rocblas_gemm_ooc_tiling& t,
+                                         bool                           beta_is_zero)
+{
+    size_t step_count = 0;
+    size_t tile_count = 0;
+
+    rocblas_status status = rocblas_gemm_ooc_schedule(
+        m, n, k, t, [&](const rocblas_gemm_ooc_step& step) -> rocblas_status {
+            int ab = step_count % rocblas_gemm_ooc_slots;
+            int c  = tile_count % rocblas_gemm_ooc_slots;
+
+            // The A and B slot was last read by the GEMM two steps ago
+            if(step_count >= rocblas_gemm_ooc_slots)
+                RETURN_IF_ROCBLAS_ERROR(
+                    device.wait(rocblas_gemm_ooc_upload, rocblas_gemm_ooc_computed, ab));
+
+            RETURN_IF_ROCBLAS_ERROR(device.upload_A(ab, step));
+            RETURN_IF_ROCBLAS_ERROR(device.upload_B(ab, step));
+
+            if(step.first_k)
+            {
+                // The C slot was last used by the tile two C tiles ago, whose download
+                // already waited on its final GEMM. Waiting here also orders the GEMM
+                // below after that download, even when C is not uploaded.
+                if(tile_count >= rocblas_gemm_ooc_slots)
+                    RETURN_IF_ROCBLAS_ERROR(
+                        device.wait(rocblas_gemm_ooc_upload, rocblas_gemm_ooc_downloaded, c));
+
+                if(!beta_is_zero)
+                    RETURN_IF_ROCBLAS_ERROR(device.upload_C(c, step));
+            }
+
+            RETURN_IF_ROCBLAS_ERROR(
+                device.record(rocblas_gemm_ooc_upload, rocblas_gemm_ooc_uploaded, ab));
+            RETURN_IF_ROCBLAS_ERROR(
+                device.wait(rocblas_gemm_ooc_compute, rocblas_gemm_ooc_uploaded, ab));
+
+            RETURN_IF_ROCBLAS_ERROR(device.gemm(ab, c, step, step.first_k));
+            RETURN_IF_ROCBLAS_ERROR(
+                device.record(rocblas_gemm_ooc_compute, rocblas_gemm_ooc_computed, ab));
+
+            if(step.last_k)
+            {
+                RETURN_IF_ROCBLAS_ERROR(
+                    device.wait(rocblas_gemm_ooc_download, rocblas_gemm_ooc_computed, ab));
+                RETURN_IF_ROCBLAS_ERROR(device.download_C(c, step));
+                RETURN_IF_ROCBLAS_ERROR(
+                    device.record(rocblas_gemm_ooc_download, rocblas_gemm_ooc_downloaded, c));
+                ++tile_count;
+            }
+
+            ++step_count;
+            return rocblas_status_success;
+        });
+
+    // Always drain the queues, so that no transfer touches host memory after returning
+    rocblas_status sync_status = device.synchronize();
+    return status != rocblas_status_success ? status : sync_status;
+}
+
+#endif // __GEMM_OUT_OF_CORE_HPP__
@@ -0,0 +1,516 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "gemm.hpp"
+#include "gemm_out_of_core.hpp"
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "utility.h"
+
+namespace
+{
+    // Largest tile dimension used for out-of-core GEMM. With two slots each of the A, B
+    // and C tiles, the workspace is 6 * 4096^2 elements (384 MiB in double precision).
+    constexpr rocblas_int ROCBLAS_GEMM_OOC_MAX_TILE = 4096;
+
+    template <typename>
+    constexpr char rocblas_gemm_out_of_core_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_out_of_core_name<float>[] = "rocblas_sgemm_out_of_core";
+    template <>
+    constexpr char rocblas_gemm_out_of_core_name<double>[] = "rocblas_dgemm_out_of_core";
+    template <>
+    constexpr char rocblas_gemm_out_of_core_name<rocblas_float_complex>[]
+        = "rocblas_cgemm_out_of_core";
+    template <>
+    constexpr char rocblas_gemm_out_of_core_name<rocblas_double_complex>[]
+        = "rocblas_zgemm_out_of_core";
+
+    /*******************************************************************************
+    * HIP policy for rocblas_gemm_ooc_pipeline
+    *
+    * The compute queue is the handle's stream. Uploads and downloads are issued
+    * on two auxiliary non-blocking streams, ordered against compute with events.
+    ******************************************************************************/
+    template <typename T>
+    class rocblas_gemm_ooc_hip_device
+    {
+        static constexpr int num_queues = 3;
+        static constexpr int num_events = 3;
+
+        rocblas_handle                 handle;
+        rocblas_operation              trans_a, trans_b;
+        T                              alpha, beta;
+        const T*                       A;
+        rocblas_int                    ld_a;
+        const T*                       B;
+        rocblas_int                    ld_b;
+        T*                             C;
+        rocblas_int                    ld_c;
+        const rocblas_gemm_ooc_tiling& t;
+
+        T*          dA[rocblas_gemm_ooc_slots];
+        T*          dB[rocblas_gemm_ooc_slots];
+        T*          dC[rocblas_gemm_ooc_slots];
+        hipStream_t stream[num_queues]                        = {};
+        hipEvent_t  event[num_events][rocblas_gemm_ooc_slots] = {};
+
+        // Leading dimensions of the device tiles
+        rocblas_int tile_ld_a() const
+        {
+            return trans_a == rocblas_operation_none ? t.mb : t.kb;
+        }
+        rocblas_int tile_ld_b() const
+        {
+            return trans_b == rocblas_operation_none ? t.kb : t.nb;
+        }
+
+        // Copy a rows x cols column-major block between host and device
+        rocblas_status copy_tile(void*                  dst,
+                                 rocblas_int            ld_dst,
+                                 const void*            src,
+                                 rocblas_int            ld_src,
+                                 rocblas_int            rows,
+                                 rocblas_int            cols,
+                                 hipMemcpyKind          kind,
+                                 rocblas_gemm_ooc_queue queue)
+        {
+            if(rows && cols)
+                RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(dst,
+                                                     ld_dst * sizeof(T),
+                                                     src,
+                                                     ld_src * sizeof(T),
+                                                     rows * sizeof(T),
+                                                     cols,
+                                                     kind,
+                                                     stream[queue]));
+            return rocblas_status_success;
+        }
+
+    public:
+        rocblas_gemm_ooc_hip_device(rocblas_handle                 handle,
+                                    rocblas_operation              trans_a,
+                                    rocblas_operation              trans_b,
+                                    T                              alpha,
+                                    const T*                       A,
+                                    rocblas_int                    ld_a,
+                                    const T*                       B,
+                                    rocblas_int                    ld_b,
+                                    T                              beta,
+                                    T*                             C,
+                                    rocblas_int                    ld_c,
+                                    const rocblas_gemm_ooc_tiling& t,
+                                    void*                          workspace)
+            : handle(handle)
+            , trans_a(trans_a)
+            , trans_b(trans_b)
+            , alpha(alpha)
+            , beta(beta)
+            , A(A)
+            , ld_a(ld_a)
+            , B(B)
+            , ld_b(ld_b)
+            , C(C)
+            , ld_c(ld_c)
+            , t(t)
+        {
+            T* ptr = (T*)workspace;
+            for(int s = 0; s < rocblas_gemm_ooc_slots; ++s)
+            {
+                dA[s] = ptr;
+                ptr += t.A_tile_els();
+                dB[s] = ptr;
+                ptr += t.B_tile_els();
+                dC[s] = ptr;
+                ptr += t.C_tile_els();
+            }
+        }
+
+        ~rocblas_gemm_ooc_hip_device()
+        {
+            for(auto& e : event)
+                for(auto ev : e)
+                    if(ev)
+                        hipEventDestroy(ev);
+            for(int q = rocblas_gemm_ooc_upload; q < num_queues; ++q)
+                if(stream[q])
+                    hipStreamDestroy(stream[q]);
+        }
+
+        rocblas_gemm_ooc_hip_device(const rocblas_gemm_ooc_hip_device&) = delete;
+        rocblas_gemm_ooc_hip_device& operator=(const rocblas_gemm_ooc_hip_device&) = delete;
+
+        // Create the transfer streams and events, and order the first uploads after any
+        // work already queued on the handle's stream which may still use the workspace
+        rocblas_status init()
+        {
+            stream[rocblas_gemm_ooc_compute] = handle->rocblas_stream;
+            for(int q = rocblas_gemm_ooc_upload; q < num_queues; ++q)
+                RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&stream[q], hipStreamNonBlocking));
+            for(auto& e : event)
+                for(auto& ev : e)
+                    RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&ev, hipEventDisableTiming));
+
+            RETURN_IF_ROCBLAS_ERROR(record(rocblas_gemm_ooc_compute, rocblas_gemm_ooc_computed, 0));
+            RETURN_IF_ROCBLAS_ERROR(wait(rocblas_gemm_ooc_upload, rocblas_gemm_ooc_computed, 0));
+            return wait(rocblas_gemm_ooc_download, rocblas_gemm_ooc_computed, 0);
+        }
+
+        rocblas_status upload_A(int slot, const rocblas_gemm_ooc_step& s)
+        {
+            bool        none = trans_a == rocblas_operation_none;
+            rocblas_int row  = none ? s.i : s.l;
+            rocblas_int col  = none ? s.l : s.i;
+            return copy_tile(dA[slot],
+                             tile_ld_a(),
+                             A + row + size_t(col) * ld_a,
+                             ld_a,
+                             none ? s.m : s.k,
+                             none ? s.k : s.m,
+                             hipMemcpyHostToDevice,
+                             rocblas_gemm_ooc_upload);
+        }
+
+        rocblas_status upload_B(int slot, const rocblas_gemm_ooc_step& s)
+        {
+            bool        none = trans_b == rocblas_operation_none;
+            rocblas_int row  = none ? s.l : s.j;
+            rocblas_int col  = none ? s.j : s.l;
+            return copy_tile(dB[slot],
+                             tile_ld_b(),
+                             B + row + size_t(col) * ld_b,
+                             ld_b,
+                             none ? s.k : s.n,
+                             none ? s.n : s.k,
+                             hipMemcpyHostToDevice,
+                             rocblas_gemm_ooc_upload);
+        }
+
+        rocblas_status upload_C(int slot, const rocblas_gemm_ooc_step& s)
+        {
+            return copy_tile(dC[slot],
+                             t.mb,
+                             C + s.i + size_t(s.j) * ld_c,
+                             ld_c,
+                             s.m,
+                             s.n,
+                             hipMemcpyHostToDevice,
+                             rocblas_gemm_ooc_upload);
+        }
+
+        rocblas_status download_C(int slot, const rocblas_gemm_ooc_step& s)
+        {
+            return copy_tile(C + s.i + size_t(s.j) * ld_c,
+                             ld_c,
+                             dC[slot],
+                             t.mb,
+                             s.m,
+                             s.n,
+                             hipMemcpyDeviceToHost,
+                             rocblas_gemm_ooc_download);
+        }
+
+        // The handle is in host pointer mode for the duration of the pipeline
+        rocblas_status gemm(int ab_slot, int c_slot, const rocblas_gemm_ooc_step& s, bool first_k)
+        {
+            T beta_step = first_k ? beta : T(1);
+            return rocblas_gemm_template<false, false>(handle,
+                                                       trans_a,
+                                                       trans_b,
+                                                       s.m,
+                                                       s.n,
+                                                       s.k,
+                                                       &alpha,
+                                                       (const T*)dA[ab_slot],
+                                                       0,
+                                                       tile_ld_a(),
+                                                       0,
+                                                       (const T*)dB[ab_slot],
+                                                       0,
+                                                       tile_ld_b(),
+                                                       0,
+                                                       &beta_step,
+                                                       dC[c_slot],
+                                                       0,
+                                                       t.mb,
+                                                       0,
+                                                       1);
+        }
+
+        rocblas_status record(rocblas_gemm_ooc_queue queue, rocblas_gemm_ooc_event e, int slot)
+        {
+            RETURN_IF_HIP_ERROR(hipEventRecord(event[e][slot], stream[queue]));
+            return rocblas_status_success;
+        }
+
+        rocblas_status wait(rocblas_gemm_ooc_queue queue, rocblas_gemm_ooc_event e, int slot)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream[queue], event[e][slot], 0));
+            return rocblas_status_success;
+        }
+
+        rocblas_status synchronize()
+        {
+            for(auto s : stream)
+                RETURN_IF_HIP_ERROR(hipStreamSynchronize(s));
+            return rocblas_status_success;
+        }
+    };
+
+    /*******************************************************************************
+    * Out-of-core GEMM implementation
+    ******************************************************************************/
+    template <typename T>
+    rocblas_status rocblas_gemm_out_of_core_impl(rocblas_handle    handle,
+                                                 rocblas_operation trans_a,
+                                                 rocblas_operation trans_b,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const T*          alpha,
+                                                 const T*          A,
+                                                 rocblas_int       ld_a,
+                                                 const T*          B,
+                                                 rocblas_int       ld_b,
+                                                 const T*          beta,
+                                                 T*                C,
+                                                 rocblas_int       ld_c)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto trans_a_letter = rocblas_transpose_letter(trans_a);
+            auto trans_b_letter = rocblas_transpose_letter(trans_b);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_gemm_out_of_core_name<T>,
+                              trans_a,
+                              trans_b,
+                              m,
+                              n,
+                              k,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              ld_a,
+                              B,
+                              ld_b,
+                              log_trace_scalar_value(beta),
+                              C,
+                              ld_c);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              "./rocblas-bench -f gemm_out_of_core -r",
+                              rocblas_precision_string<T>,
+                              "--transposeA",
+                              trans_a_letter,
+                              "--transposeB",
+                              trans_b_letter,
+                              "-m",
+                              m,
+                              "-n",
+                              n,
+                              "-k",
+                              k,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              ld_a,
+                              "--ldb",
+                              ld_b,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--ldc",
+                              ld_c);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_gemm_out_of_core_name<T>,
+                              trans_a,
+                              trans_b,
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              A,
+                              ld_a,
+                              B,
+                              ld_b,
+                              beta,
+                              C,
+                              ld_c);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_gemm_out_of_core_name<T>,
+                            "transA",
+                            trans_a_letter,
+                            "transB",
+                            trans_b_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "lda",
+                            ld_a,
+                            "ldb",
+                            ld_b,
+                            "ldc",
+                            ld_c);
+        }
+
+        auto validArgs = validateArgs(
+            handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c);
+
+        if(validArgs != rocblas_status_success)
+            return validArgs;
+
+        // quick return
+        if(!m || !n)
+        {
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return rocblas_status_success;
+        }
+
+        // The optimal workspace holds the largest tiles
+        if(handle->is_device_memory_size_query())
+        {
+            auto t = rocblas_gemm_ooc_choose_tiling(
+                m, n, k, sizeof(T), ROCBLAS_GEMM_OOC_MAX_TILE, [](size_t) { return true; });
+            return handle->set_optimal_device_memory_size(t.workspace_bytes(sizeof(T)));
+        }
+
+        // alpha and beta are needed on the host for every tile
+        T alpha_h, beta_h;
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpy(&alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost));
+            RETURN_IF_HIP_ERROR(hipMemcpy(&beta_h, beta, sizeof(T), hipMemcpyDeviceToHost));
+        }
+        else
+        {
+            alpha_h = *alpha;
+            beta_h  = *beta;
+        }
+
+        if(beta_h == T(1) && (k == 0 || alpha_h == T(0)))
+            return rocblas_status_success;
+
+        // Shrink the tiles until their workspace can be allocated from the handle
+        auto t = rocblas_gemm_ooc_choose_tiling(
+            m, n, k, sizeof(T), ROCBLAS_GEMM_OOC_MAX_TILE, [=](size_t bytes) {
+                return bool(handle->device_malloc(bytes));
+            });
+        if(!t.mb)
+            return rocblas_status_memory_error;
+
+        auto mem = handle->device_malloc(t.workspace_bytes(sizeof(T)));
+        if(!mem)
+            return rocblas_status_memory_error;
+
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        rocblas_gemm_ooc_hip_device<T> device(
+            handle, trans_a, trans_b, alpha_h, A, ld_a, B, ld_b, beta_h, C, ld_c, t, (void*)mem);
+        RETURN_IF_ROCBLAS_ERROR(device.init());
+
+        return rocblas_gemm_ooc_pipeline(device, m, n, k, t, beta_h == T(0));
+    }
+
+} // namespace
+
+/*******************************************************************************
+ * Out-of-core GEMM APIs
+ ******************************************************************************/
+extern "C" {
+
+rocblas_status rocblas_sgemm_out_of_core(rocblas_handle    handle,
+                                         rocblas_operation trans_a,
+                                         rocblas_operation trans_b,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const float*      alpha,
+                                         const float*      A,
+                                         rocblas_int       ld_a,
+                                         const float*      B,
+                                         rocblas_int       ld_b,
+                                         const float*      beta,
+                                         float*            C,
+                                         rocblas_int       ld_c)
+{
+    return rocblas_gemm_out_of_core_impl(
+        handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c);
+}
+
+rocblas_status rocblas_dgemm_out_of_core(rocblas_handle    handle,
+                                         rocblas_operation trans_a,
+                                         rocblas_operation trans_b,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const double*     alpha,
+                                         const double*     A,
+                                         rocblas_int       ld_a,
+                                         const double*     B,
+                                         rocblas_int       ld_b,
+                                         const double*     beta,
+                                         double*           C,
+                                         rocblas_int       ld_c)
+{
+    return rocblas_gemm_out_of_core_impl(
+        handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c);
+}
+
+rocblas_status rocblas_cgemm_out_of_core(rocblas_handle               handle,
+                                         rocblas_operation            trans_a,
+                                         rocblas_operation            trans_b,
+                                         rocblas_int                  m,
+                                         rocblas_int                  n,
+                                         rocblas_int                  k,
+                                         const rocblas_float_complex* alpha,
+                                         const rocblas_float_complex* A,
+                                         rocblas_int                  ld_a,
+                                         const rocblas_float_complex* B,
+                                         rocblas_int                  ld_b,
+                                         const rocblas_float_complex* beta,
+                                         rocblas_float_complex*       C,
+                                         rocblas_int                  ld_c)
+{
+    return rocblas_gemm_out_of_core_impl(
+        handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c);
+}
+
+rocblas_status rocblas_zgemm_out_of_core(rocblas_handle                handle,
+                                         rocblas_operation             trans_a,
+                                         rocblas_operation             trans_b,
+                                         rocblas_int                   m,
+                                         rocblas_int                   n,
+                                         rocblas_int                   k,
+                                         const rocblas_double_complex* alpha,
+                                         const rocblas_double_complex* A,
+                                         rocblas_int                   ld_a,
+                                         const rocblas_double_complex* B,
+                                         rocblas_int                   ld_b,
+                                         const rocblas_double_complex* beta,
+                                         rocblas_double_complex*       C,
+                                         rocblas_int                   ld_c)
+{
+    return rocblas_gemm_out_of_core_impl(
+        handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c);
+}
+
+} // extern "C"
@@ -0,0 +1,262 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_symm.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <bool HERM, typename>
+    constexpr char rocblas_symm_name[] = "unknown";
+    template <>
+    constexpr char rocblas_symm_name<false, float>[] = "rocblas_ssymm";
+    template <>
+    constexpr char rocblas_symm_name<false, double>[] = "rocblas_dsymm";
+    template <>
+    constexpr char rocblas_symm_name<false, rocblas_float_complex>[] = "rocblas_csymm";
+    template <>
+    constexpr char rocblas_symm_name<false, rocblas_double_complex>[] = "rocblas_zsymm";
+    template <>
+    constexpr char rocblas_symm_name<true, rocblas_float_complex>[] = "rocblas_chemm";
+    template <>
+    constexpr char rocblas_symm_name<true, rocblas_double_complex>[] = "rocblas_zhemm";
+
+    template <bool HERM, typename T>
+    rocblas_status rocblas_symm_impl(rocblas_handle handle,
+                                     rocblas_side   side,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    m,
+                                     rocblas_int    n,
+                                     const T*       alpha,
+                                     const T*       A,
+                                     rocblas_int    lda,
+                                     const T*       B,
+                                     rocblas_int    ldb,
+                                     const T*       beta,
+                                     T*             C,
+                                     rocblas_int    ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto side_letter = rocblas_side_letter(side);
+            auto uplo_letter = rocblas_fill_letter(uplo);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_symm_name<HERM, T>,
+                              side,
+                              uplo,
+                              m,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              lda,
+                              B,
+                              ldb,
+                              log_trace_scalar_value(beta),
+                              C,
+                              ldc);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              HERM ? "./rocblas-bench -f hemm -r" : "./rocblas-bench -f symm -r",
+                              rocblas_precision_string<T>,
+                              "--side",
+                              side_letter,
+                              "--uplo",
+                              uplo_letter,
+                              "-m",
+                              m,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              "--ldb",
+                              ldb,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--ldc",
+                              ldc);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_symm_name<HERM, T>,
+                              side,
+                              uplo,
+                              m,
+                              n,
+                              alpha,
+                              A,
+                              lda,
+                              B,
+                              ldb,
+                              beta,
+                              C,
+                              ldc);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_symm_name<HERM, T>,
+                            "side",
+                            side_letter,
+                            "uplo",
+                            uplo_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "lda",
+                            lda,
+                            "ldb",
+                            ldb,
+                            "ldc",
+                            ldc);
+        }
+
+        if(side != rocblas_side_left && side != rocblas_side_right)
+            return rocblas_status_not_implemented;
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+
+        rocblas_int ka = side == rocblas_side_left ? m : n;
+        if(m < 0 || n < 0 || lda < ka || lda < 1 || ldb < m || ldb < 1 || ldc < m || ldc < 1)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!alpha || !beta || !A || !B || !C)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_symm_template<false, HERM>(
+            handle, side, uplo, m, n, alpha, A, 0, lda, 0, B, 0, ldb, 0, beta, C, 0, ldc, 0, 1);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ssymm(rocblas_handle handle,
+                             rocblas_side   side,
+                             rocblas_fill   uplo,
+                             rocblas_int    m,
+                             rocblas_int    n,
+                             const float*   alpha,
+                             const float*   A,
+                             rocblas_int    lda,
+                             const float*   B,
+                             rocblas_int    ldb,
+                             const float*   beta,
+                             float*         C,
+                             rocblas_int    ldc)
+{
+    return rocblas_symm_impl<false>(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+rocblas_status rocblas_dsymm(rocblas_handle handle,
+                             rocblas_side   side,
+                             rocblas_fill   uplo,
+                             rocblas_int    m,
+                             rocblas_int    n,
+                             const double*  alpha,
+                             const double*  A,
+                             rocblas_int    lda,
+                             const double*  B,
+                             rocblas_int    ldb,
+                             const double*  beta,
+                             double*        C,
+                             rocblas_int    ldc)
+{
+    return rocblas_symm_impl<false>(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+rocblas_status rocblas_csymm(rocblas_handle               handle,
+                             rocblas_side                 side,
+                             rocblas_fill                 uplo,
+                             rocblas_int                  m,
+                             rocblas_int                  n,
+                             const rocblas_float_complex* alpha,
+                             const rocblas_float_complex* A,
+                             rocblas_int                  lda,
+                             const rocblas_float_complex* B,
+                             rocblas_int                  ldb,
+                             const rocblas_float_complex* beta,
+                             rocblas_float_complex*       C,
+                             rocblas_int                  ldc)
+{
+    return rocblas_symm_impl<false>(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+rocblas_status rocblas_zsymm(rocblas_handle                handle,
+                             rocblas_side                  side,
+                             rocblas_fill                  uplo,
+                             rocblas_int                   m,
+                             rocblas_int                   n,
+                             const rocblas_double_complex* alpha,
+                             const rocblas_double_complex* A,
+                             rocblas_int                   lda,
+                             const rocblas_double_complex* B,
+                             rocblas_int                   ldb,
+                             const rocblas_double_complex* beta,
+                             rocblas_double_complex*       C,
+                             rocblas_int                   ldc)
+{
+    return rocblas_symm_impl<false>(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+rocblas_status rocblas_chemm(rocblas_handle               handle,
+                             rocblas_side                 side,
+                             rocblas_fill                 uplo,
+                             rocblas_int                  m,
+                             rocblas_int                  n,
+                             const rocblas_float_complex* alpha,
+                             const rocblas_float_complex* A,
+                             rocblas_int                  lda,
+                             const rocblas_float_complex* B,
+                             rocblas_int                  ldb,
+                             const rocblas_float_complex* beta,
+                             rocblas_float_complex*       C,
+                             rocblas_int                  ldc)
+{
+    return rocblas_symm_impl<true>(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+rocblas_status rocblas_zhemm(rocblas_handle                handle,
+                             rocblas_side                  side,
+                             rocblas_fill                  uplo,
+                             rocblas_int                   m,
+                             rocblas_int                   n,
+                             const rocblas_double_complex* alpha,
+                             const rocblas_double_complex* A,
+                             rocblas_int                   lda,
+                             const rocblas_double_complex* B,
+                             rocblas_int                   ldb,
+                             const rocblas_double_complex* beta,
+                             rocblas_double_complex*       C,
+                             rocblas_int                   ldc)
+{
+    return rocblas_symm_impl<true>(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+} // extern "C"
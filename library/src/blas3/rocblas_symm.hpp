@@ -0,0 +1,326 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __ROCBLAS_SYMM_HPP__
+#define __ROCBLAS_SYMM_HPP__
+
+#include "gemm.hpp"
+#include "handle.h"
+#include "rocblas.h"
+#include "utility.h"
+
+/*
+ * Symmetric (symm) and Hermitian (hemm) matrix-matrix products
+ *
+ *   side == rocblas_side_left   C = alpha * A * B + beta * C,  A is m x m
+ *   side == rocblas_side_right  C = alpha * B * A + beta * C,  A is n x n
+ *
+ * where only the triangle of A selected by uplo is read. A is split into diagonal blocks of
+ * size SYMM_DIAG_NB, whose products are computed by a small kernel which mirrors the stored
+ * triangle as it loads A, and which also scales C by beta. The rest of the stored triangle
+ * is covered by square off-diagonal blocks of size SYMM_DIAG_NB, 2 * SYMM_DIAG_NB, ...,
+ * in the same way as in rocblas_syrk.hpp. Each off-diagonal block S of A appears twice in
+ * the full matrix, as S and as S^T (S^H for hemm), so it contributes two GEMMs.
+ */
+
+constexpr rocblas_int SYMM_DIAG_NB    = 32;
+constexpr rocblas_int SYMM_DIAG_DIM_Y = 8;
+
+// Element (i, j) of the full symmetric or Hermitian matrix A, read from the stored triangle
+template <bool HERM, typename T>
+__device__ inline T symm_load_A(
+    const T* A, rocblas_fill uplo, rocblas_int lda, rocblas_int i, rocblas_int j)
+{
+    // The imaginary part of the diagonal of a Hermitian matrix is assumed to be zero
+    if(i == j)
+    {
+        T d = A[i + ptrdiff_t(i) * lda];
+        return HERM ? T(std::real(d)) : d;
+    }
+    if(uplo == rocblas_fill_lower ? i > j : i < j)
+        return A[i + ptrdiff_t(j) * lda];
+    return HERM ? conj(A[j + ptrdiff_t(i) * lda]) : A[j + ptrdiff_t(i) * lda];
+}
+
+// C = alpha * A_d * B + beta * C (left) or C = alpha * B * A_d + beta * C (right), where
+// A_d is the block diagonal part of A with blocks of size NB. hipBlockIdx_x selects the
+// diagonal block and hipBlockIdx_y a group of NB columns (left) or rows (right) of C.
+template <rocblas_int NB,
+          rocblas_int DIM_Y,
+          bool        HERM,
+          typename T,
+          typename U,
+          typename V>
+__global__ void symm_diag_kernel(rocblas_side   side,
+                                 rocblas_fill   uplo,
+                                 rocblas_int    m,
+                                 rocblas_int    n,
+                                 T              alpha,
+                                 U              Aa,
+                                 rocblas_int    offset_A,
+                                 rocblas_int    lda,
+                                 rocblas_stride stride_A,
+                                 U              Ba,
+                                 rocblas_int    offset_B,
+                                 rocblas_int    ldb,
+                                 rocblas_stride stride_B,
+                                 T              beta,
+                                 V              Ca,
+                                 rocblas_int    offset_C,
+                                 rocblas_int    ldc,
+                                 rocblas_stride stride_C)
+{
+    bool        left = side == rocblas_side_left;
+    rocblas_int ka   = left ? m : n;
+    rocblas_int blk  = hipBlockIdx_x * NB;
+
+    // Index into the diagonal block along A, and into the other dimension of C
+    rocblas_int a = blk + hipThreadIdx_x;
+    if(a >= ka)
+        return;
+
+    const T* A = load_ptr_batch(Aa, hipBlockIdx_z, offset_A, stride_A);
+    const T* B = load_ptr_batch(Ba, hipBlockIdx_z, offset_B, stride_B);
+    T*       C = load_ptr_batch(Ca, hipBlockIdx_z, offset_C, stride_C);
+
+    rocblas_int nc   = left ? n : m;
+    rocblas_int lend = min(blk + NB, ka);
+
+    for(rocblas_int c = hipBlockIdx_y * NB + hipThreadIdx_y;
+        c < nc && c < (hipBlockIdx_y + 1) * NB;
+        c += DIM_Y)
+    {
+        T sum = 0;
+        if(alpha != 0)
+        {
+            for(rocblas_int l = blk; l < lend; l++)
+            {
+                if(left)
+                    sum += symm_load_A<HERM>(A, uplo, lda, a, l) * B[l + ptrdiff_t(c) * ldb];
+                else
+                    sum += B[c + ptrdiff_t(l) * ldb] * symm_load_A<HERM>(A, uplo, lda, l, a);
+            }
+        }
+
+        T& cc = left ? C[a + ptrdiff_t(c) * ldc] : C[c + ptrdiff_t(a) * ldc];
+
+        // beta == 0 overwrites C, so that NaNs in C are not propagated
+        cc = beta != 0 ? alpha * sum + beta * cc : alpha * sum;
+    }
+}
+
+/*! \brief Symmetric (HERM == false) or Hermitian (HERM == true) matrix-matrix product.
+
+    U and V are const T* / T* for the non-batched and strided batched functions, or arrays
+    of device pointers when BATCHED. */
+template <bool BATCHED, bool HERM, typename T, typename U, typename V>
+rocblas_status rocblas_symm_template(rocblas_handle handle,
+                                     rocblas_side   side,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    m,
+                                     rocblas_int    n,
+                                     const T*       alpha,
+                                     U              A,
+                                     rocblas_int    offset_A,
+                                     rocblas_int    lda,
+                                     rocblas_stride stride_A,
+                                     U              B,
+                                     rocblas_int    offset_B,
+                                     rocblas_int    ldb,
+                                     rocblas_stride stride_B,
+                                     const T*       beta,
+                                     V              C,
+                                     rocblas_int    offset_C,
+                                     rocblas_int    ldc,
+                                     rocblas_stride stride_C,
+                                     rocblas_int    batch_count)
+{
+    // Quick return
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    // Temporarily switch to host pointer mode, saving current pointer mode, restored on return
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    // Get alpha and beta
+    T alpha_h, beta_h;
+    if(saved_pointer_mode == rocblas_pointer_mode_host)
+    {
+        alpha_h = *alpha;
+        beta_h  = *beta;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(&alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(&beta_h, beta, sizeof(T), hipMemcpyDeviceToHost));
+    }
+
+    // When alpha == 0 and beta == 1, the operation is a no-op
+    if(alpha_h == 0 && beta_h == 1)
+        return rocblas_status_success;
+
+    bool        left = side == rocblas_side_left;
+    rocblas_int ka   = left ? m : n;
+    rocblas_int nc   = left ? n : m;
+    T           one  = 1;
+
+    // Diagonal blocks, which also scale all of C by beta
+    dim3 diag_grid((ka - 1) / SYMM_DIAG_NB + 1, (nc - 1) / SYMM_DIAG_NB + 1, batch_count);
+    dim3 diag_threads(SYMM_DIAG_NB, SYMM_DIAG_DIM_Y);
+
+    hipLaunchKernelGGL((symm_diag_kernel<SYMM_DIAG_NB, SYMM_DIAG_DIM_Y, HERM, T>),
+                       diag_grid,
+                       diag_threads,
+                       0,
+                       handle->rocblas_stream,
+                       side,
+                       uplo,
+                       m,
+                       n,
+                       alpha_h,
+                       A,
+                       offset_A,
+                       lda,
+                       stride_A,
+                       B,
+                       offset_B,
+                       ldb,
+                       stride_B,
+                       beta_h,
+                       C,
+                       offset_C,
+                       ldc,
+                       stride_C);
+
+    if(alpha_h == 0)
+        return rocblas_status_success;
+
+    rocblas_operation trans_S
+        = HERM ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+
+    // Off-diagonal blocks, doubling in size with each level. The stored block S of A covers
+    // rows [r, r + rows) and columns [c, c + cols) of A, and its mirror image covers rows
+    // [c, c + cols) and columns [r, r + rows).
+    for(rocblas_int nb = SYMM_DIAG_NB; nb < ka; nb *= 2)
+    {
+        for(rocblas_int i0 = 0; i0 + nb < ka; i0 += 2 * nb)
+        {
+            rocblas_int mb    = std::min(nb, ka - i0 - nb);
+            bool        lower = uplo == rocblas_fill_lower;
+            rocblas_int r     = lower ? i0 + nb : i0;
+            rocblas_int c     = lower ? i0 : i0 + nb;
+            rocblas_int rows  = lower ? mb : nb;
+            rocblas_int cols  = lower ? nb : mb;
+
+            rocblas_int offset_S = offset_A + r + c * lda;
+
+            rocblas_status status;
+            if(left)
+            {
+                // C[r:r+rows, :] += alpha * S * B[c:c+cols, :]
+                status = rocblas_gemm_template<BATCHED, !BATCHED>(handle,
+                                                                  rocblas_operation_none,
+                                                                  rocblas_operation_none,
+                                                                  rows,
+                                                                  n,
+                                                                  cols,
+                                                                  &alpha_h,
+                                                                  A,
+                                                                  offset_S,
+                                                                  lda,
+                                                                  stride_A,
+                                                                  B,
+                                                                  offset_B + c,
+                                                                  ldb,
+                                                                  stride_B,
+                                                                  &one,
+                                                                  C,
+                                                                  offset_C + r,
+                                                                  ldc,
+                                                                  stride_C,
+                                                                  batch_count);
+                if(status != rocblas_status_success)
+                    return status;
+
+                // C[c:c+cols, :] += alpha * S^T * B[r:r+rows, :]
+                status = rocblas_gemm_template<BATCHED, !BATCHED>(handle,
+                                                                  trans_S,
+                                                                  rocblas_operation_none,
+                                                                  cols,
+                                                                  n,
+                                                                  rows,
+                                                                  &alpha_h,
+                                                                  A,
+                                                                  offset_S,
+                                                                  lda,
+                                                                  stride_A,
+                                                                  B,
+                                                                  offset_B + r,
+                                                                  ldb,
+                                                                  stride_B,
+                                                                  &one,
+                                                                  C,
+                                                                  offset_C + c,
+                                                                  ldc,
+                                                                  stride_C,
+                                                                  batch_count);
+            }
+            else
+            {
+                // C[:, c:c+cols] += alpha * B[:, r:r+rows] * S
+                status = rocblas_gemm_template<BATCHED, !BATCHED>(handle,
+                                                                  rocblas_operation_none,
+                                                                  rocblas_operation_none,
+                                                                  m,
+                                                                  cols,
+                                                                  rows,
+                                                                  &alpha_h,
+                                                                  B,
+                                                                  offset_B + r * ldb,
+                                                                  ldb,
+                                                                  stride_B,
+                                                                  A,
+                                                                  offset_S,
+                                                                  lda,
+                                                                  stride_A,
+                                                                  &one,
+                                                                  C,
+                                                                  offset_C + c * ldc,
+                                                                  ldc,
+                                                                  stride_C,
+                                                                  batch_count);
+                if(status != rocblas_status_success)
+                    return status;
+
+                // C[:, r:r+rows] += alpha * B[:, c:c+cols] * S^T
+                status = rocblas_gemm_template<BATCHED, !BATCHED>(handle,
+                                                                  rocblas_operation_none,
+                                                                  trans_S,
+                                                                  m,
+                                                                  rows,
+                                                                  cols,
+                                                                  &alpha_h,
+                                                                  B,
+                                                                  offset_B + c * ldb,
+                                                                  ldb,
+                                                                  stride_B,
+                                                                  A,
+                                                                  offset_S,
+                                                                  lda,
+                                                                  stride_A,
+                                                                  &one,
+                                                                  C,
+                                                                  offset_C + r * ldc,
+                                                                  ldc,
+                                                                  stride_C,
+                                                                  batch_count);
+            }
+            if(status != rocblas_status_success)
+                return status;
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+#endif // __ROCBLAS_SYMM_HPP__
@@ -0,0 +1,305 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_symm.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <bool HERM, typename>
+    constexpr char rocblas_symm_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_symm_batched_name<false, float>[] = "rocblas_ssymm_batched";
+    template <>
+    constexpr char rocblas_symm_batched_name<false, double>[] = "rocblas_dsymm_batched";
+    template <>
+    constexpr char rocblas_symm_batched_name<false, rocblas_float_complex>[]
+        = "rocblas_csymm_batched";
+    template <>
+    constexpr char rocblas_symm_batched_name<false, rocblas_double_complex>[]
+        = "rocblas_zsymm_batched";
+    template <>
+    constexpr char rocblas_symm_batched_name<true, rocblas_float_complex>[]
+        = "rocblas_chemm_batched";
+    template <>
+    constexpr char rocblas_symm_batched_name<true, rocblas_double_complex>[]
+        = "rocblas_zhemm_batched";
+
+    template <bool HERM, typename T>
+    rocblas_status rocblas_symm_batched_impl(rocblas_handle handle,
+                                             rocblas_side   side,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             const T*       alpha,
+                                             const T* const A[],
+                                             rocblas_int    lda,
+                                             const T* const B[],
+                                             rocblas_int    ldb,
+                                             const T*       beta,
+                                             T* const       C[],
+                                             rocblas_int    ldc,
+                                             rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto side_letter = rocblas_side_letter(side);
+            auto uplo_letter = rocblas_fill_letter(uplo);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_symm_batched_name<HERM, T>,
+                              side,
+                              uplo,
+                              m,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              lda,
+                              B,
+                              ldb,
+                              log_trace_scalar_value(beta),
+                              C,
+                              ldc,
+                              batch_count);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              HERM ? "./rocblas-bench -f hemm_batched -r"
+                                   : "./rocblas-bench -f symm_batched -r",
+                              rocblas_precision_string<T>,
+                              "--side",
+                              side_letter,
+                              "--uplo",
+                              uplo_letter,
+                              "-m",
+                              m,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              "--ldb",
+                              ldb,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--ldc",
+                              ldc,
+                              "--batch_count",
+                              batch_count);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_symm_batched_name<HERM, T>,
+                              side,
+                              uplo,
+                              m,
+                              n,
+                              alpha,
+                              A,
+                              lda,
+                              B,
+                              ldb,
+                              beta,
+                              C,
+                              ldc,
+                              batch_count);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_symm_batched_name<HERM, T>,
+                            "side",
+                            side_letter,
+                            "uplo",
+                            uplo_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "lda",
+                            lda,
+                            "ldb",
+                            ldb,
+                            "ldc",
+                            ldc,
+                            "batch_count",
+                            batch_count);
+        }
+
+        if(side != rocblas_side_left && side != rocblas_side_right)
+            return rocblas_status_not_implemented;
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+
+        rocblas_int ka = side == rocblas_side_left ? m : n;
+        if(m < 0 || n < 0 || lda < ka || lda < 1 || ldb < m || ldb < 1 || ldc < m || ldc < 1
+           || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !batch_count)
+            return rocblas_status_success;
+
+        if(!alpha || !beta || !A || !B || !C)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_symm_template<true, HERM>(handle,
+                                                 side,
+                                                 uplo,
+                                                 m,
+                                                 n,
+                                                 alpha,
+                                                 A,
+                                                 0,
+                                                 lda,
+                                                 0,
+                                                 B,
+                                                 0,
+                                                 ldb,
+                                                 0,
+                                                 beta,
+                                                 C,
+                                                 0,
+                                                 ldc,
+                                                 0,
+                                                 batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ssymm_batched(rocblas_handle     handle,
+                                     rocblas_side       side,
+                                     rocblas_fill       uplo,
+                                     rocblas_int        m,
+                                     rocblas_int        n,
+                                     const float*       alpha,
+                                     const float* const A[],
+                                     rocblas_int        lda,
+                                     const float* const B[],
+                                     rocblas_int        ldb,
+                                     const float*       beta,
+                                     float* const       C[],
+                                     rocblas_int        ldc,
+                                     rocblas_int        batch_count)
+{
+    return rocblas_symm_batched_impl<false>(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+rocblas_status rocblas_dsymm_batched(rocblas_handle      handle,
+                                     rocblas_side        side,
+                                     rocblas_fill        uplo,
+                                     rocblas_int         m,
+                                     rocblas_int         n,
+                                     const double*       alpha,
+                                     const double* const A[],
+                                     rocblas_int         lda,
+                                     const double* const B[],
+                                     rocblas_int         ldb,
+                                     const double*       beta,
+                                     double* const       C[],
+                                     rocblas_int         ldc,
+                                     rocblas_int         batch_count)
+{
+    return rocblas_symm_batched_impl<false>(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+rocblas_status rocblas_csymm_batched(rocblas_handle                     handle,
+                                     rocblas_side                       side,
+                                     rocblas_fill                       uplo,
+                                     rocblas_int                        m,
+                                     rocblas_int                        n,
+                                     const rocblas_float_complex*       alpha,
+                                     const rocblas_float_complex* const A[],
+                                     rocblas_int                        lda,
+                                     const rocblas_float_complex* const B[],
+                                     rocblas_int                        ldb,
+                                     const rocblas_float_complex*       beta,
+                                     rocblas_float_complex* const       C[],
+                                     rocblas_int                        ldc,
+                                     rocblas_int                        batch_count)
+{
+    return rocblas_symm_batched_impl<false>(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+rocblas_status rocblas_zsymm_batched(rocblas_handle                      handle,
+                                     rocblas_side                        side,
+                                     rocblas_fill                        uplo,
+                                     rocblas_int                         m,
+                                     rocblas_int                         n,
+                                     const rocblas_double_complex*       alpha,
+                                     const rocblas_double_complex* const A[],
+                                     rocblas_int                         lda,
+                                     const rocblas_double_complex* const B[],
+                                     rocblas_int                         ldb,
+                                     const rocblas_double_complex*       beta,
+                                     rocblas_double_complex* const       C[],
+                                     rocblas_int                         ldc,
+                                     rocblas_int                         batch_count)
+{
+    return rocblas_symm_batched_impl<false>(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+rocblas_status rocblas_chemm_batched(rocblas_handle                     handle,
+                                     rocblas_side                       side,
+                                     rocblas_fill                       uplo,
+                                     rocblas_int                        m,
+                                     rocblas_int                        n,
+                                     const rocblas_float_complex*       alpha,
+                                     const rocblas_float_complex* const A[],
+                                     rocblas_int                        lda,
+                                     const rocblas_float_complex* const B[],
+                                     rocblas_int                        ldb,
+                                     const rocblas_float_complex*       beta,
+                                     rocblas_float_complex* const       C[],
+                                     rocblas_int                        ldc,
+                                     rocblas_int                        batch_count)
+{
+    return rocblas_symm_batched_impl<true>(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+rocblas_status rocblas_zhemm_batched(rocblas_handle                      handle,
+                                     rocblas_side                        side,
+                                     rocblas_fill                        uplo,
+                                     rocblas_int                         m,
+                                     rocblas_int                         n,
+                                     const rocblas_double_complex*       alpha,
+                                     const rocblas_double_complex* const A[],
+                                     rocblas_int                         lda,
+                                     const rocblas_double_complex* const B[],
+                                     rocblas_int                         ldb,
+                                     const rocblas_double_complex*       beta,
+                                     rocblas_double_complex* const       C[],
+                                     rocblas_int                         ldc,
+                                     rocblas_int                         batch_count)
+{
+    return rocblas_symm_batched_impl<true>(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+} // extern "C"
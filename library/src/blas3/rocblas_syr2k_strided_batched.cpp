@@ -0,0 +1,440 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_syrk.hpp"
+#include "utility.h"
+
+namespace
+{
+    // her2k is distinguished from syr2k by a real beta type U for a complex T
+    template <typename T, typename = T>
+    constexpr char rocblas_syr2k_strided_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_syr2k_strided_batched_name<float>[] = "rocblas_ssyr2k_strided_batched";
+    template <>
+    constexpr char rocblas_syr2k_strided_batched_name<double>[] = "rocblas_dsyr2k_strided_batched";
+    template <>
+    constexpr char rocblas_syr2k_strided_batched_name<rocblas_float_complex>[]
+        = "rocblas_csyr2k_strided_batched";
+    template <>
+    constexpr char rocblas_syr2k_strided_batched_name<rocblas_double_complex>[]
+        = "rocblas_zsyr2k_strided_batched";
+    template <>
+    constexpr char rocblas_syr2k_strided_batched_name<rocblas_float_complex, float>[]
+        = "rocblas_cher2k_strided_batched";
+    template <>
+    constexpr char rocblas_syr2k_strided_batched_name<rocblas_double_complex, double>[]
+        = "rocblas_zher2k_strided_batched";
+
+    template <typename T, typename U, typename V>
+    rocblas_status rocblas_syr2k_strided_batched_impl(rocblas_handle    handle,
+                                                      rocblas_fill      uplo,
+                                                      rocblas_operation transA,
+                                                      rocblas_int       n,
+                                                      rocblas_int       k,
+                                                      const V*          alpha,
+                                                      const T*          A,
+                                                      rocblas_int       lda,
+                                                      rocblas_stride    stride_A,
+                                                      const T*          B,
+                                                      rocblas_int       ldb,
+                                                      rocblas_stride    stride_B,
+                                                      const U*          beta,
+                                                      T*                C,
+                                                      rocblas_int       ldc,
+                                                      rocblas_stride    stride_C,
+                                                      rocblas_int       batch_count)
+    {
+        constexpr bool HERM = is_complex<T> && !is_complex<U>;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto uplo_letter   = rocblas_fill_letter(uplo);
+            auto transA_letter = rocblas_transpose_letter(transA);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syr2k_strided_batched_name<T, U>,
+                              uplo,
+                              transA,
+                              n,
+                              k,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              lda,
+                              stride_A,
+                              B,
+                              ldb,
+                              stride_B,
+                              log_trace_scalar_value(beta),
+                              C,
+                              ldc,
+                              stride_C,
+                              batch_count);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              HERM ? "./rocblas-bench -f her2k_strided_batched -r"
+                                   : "./rocblas-bench -f syr2k_strided_batched -r",
+                              rocblas_precision_string<T>,
+                              "--uplo",
+                              uplo_letter,
+                              "--transposeA",
+                              transA_letter,
+                              "-n",
+                              n,
+                              "-k",
+                              k,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              "--stride_a",
+                              stride_A,
+                              "--ldb",
+                              ldb,
+                              "--stride_b",
+                              stride_B,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--ldc",
+                              ldc,
+                              "--stride_c",
+                              stride_C,
+                              "--batch_count",
+                              batch_count);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syr2k_strided_batched_name<T, U>,
+                              uplo,
+                              transA,
+                              n,
+                              k,
+                              alpha,
+                              A,
+                              lda,
+                              stride_A,
+                              B,
+                              ldb,
+                              stride_B,
+                              beta,
+                              C,
+                              ldc,
+                              stride_C,
+                              batch_count);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_syr2k_strided_batched_name<T, U>,
+                            "uplo",
+                            uplo_letter,
+                            "transA",
+                            transA_letter,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "lda",
+                            lda,
+                            "stride_a",
+                            stride_A,
+                            "ldb",
+                            ldb,
+                            "stride_b",
+                            stride_B,
+                            "ldc",
+                            ldc,
+                            "stride_c",
+                            stride_C,
+                            "batch_count",
+                            batch_count);
+        }
+
+        // syr2k takes the transpose and her2k the conjugate transpose, except for real types
+        rocblas_operation trans_invalid = HERM ? rocblas_operation_transpose
+                                               : rocblas_operation_conjugate_transpose;
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(is_complex<T> && transA == trans_invalid)
+            return rocblas_status_not_implemented;
+
+        rocblas_int A_row = transA == rocblas_operation_none ? n : k;
+        if(n < 0 || k < 0 || lda < A_row || lda < 1 || ldb < A_row || ldb < 1 || ldc < n || ldc < 1
+           || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!n || !batch_count)
+            return rocblas_status_success;
+
+        if(!alpha || !beta || !A || !B || !C)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_syrk_template<false, HERM, true, T>(handle,
+                                                           uplo,
+                                                           transA,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           A,
+                                                           0,
+                                                           lda,
+                                                           stride_A,
+                                                           B,
+                                                           0,
+                                                           ldb,
+                                                           stride_B,
+                                                           beta,
+                                                           C,
+                                                           0,
+                                                           ldc,
+                                                           stride_C,
+                                                           batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ssyr2k_strided_batched(rocblas_handle    handle,
+                                              rocblas_fill      uplo,
+                                              rocblas_operation transA,
+                                              rocblas_int       n,
+                                              rocblas_int       k,
+                                              const float*      alpha,
+                                              const float*      A,
+                                              rocblas_int       lda,
+                                              rocblas_stride    stride_A,
+                                              const float*      B,
+                                              rocblas_int       ldb,
+                                              rocblas_stride    stride_B,
+                                              const float*      beta,
+                                              float*            C,
+                                              rocblas_int       ldc,
+                                              rocblas_stride    stride_C,
+                                              rocblas_int       batch_count)
+{
+    return rocblas_syr2k_strided_batched_impl(handle,
+                                              uplo,
+                                              transA,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              stride_C,
+                                              batch_count);
+}
+
+rocblas_status rocblas_dsyr2k_strided_batched(rocblas_handle    handle,
+                                              rocblas_fill      uplo,
+                                              rocblas_operation transA,
+                                              rocblas_int       n,
+                                              rocblas_int       k,
+                                              const double*     alpha,
+                                              const double*     A,
+                                              rocblas_int       lda,
+                                              rocblas_stride    stride_A,
+                                              const double*     B,
+                                              rocblas_int       ldb,
+                                              rocblas_stride    stride_B,
+                                              const double*     beta,
+                                              double*           C,
+                                              rocblas_int       ldc,
+                                              rocblas_stride    stride_C,
+                                              rocblas_int       batch_count)
+{
+    return rocblas_syr2k_strided_batched_impl(handle,
+                                              uplo,
+                                              transA,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              stride_C,
+                                              batch_count);
+}
+
+rocblas_status rocblas_csyr2k_strided_batched(rocblas_handle               handle,
+                                              rocblas_fill                 uplo,
+                                              rocblas_operation            transA,
+                                              rocblas_int                  n,
+                                              rocblas_int                  k,
+                                              const rocblas_float_complex* alpha,
+                                              const rocblas_float_complex* A,
+                                              rocblas_int                  lda,
+                                              rocblas_stride               stride_A,
+                                              const rocblas_float_complex* B,
+                                              rocblas_int                  ldb,
+                                              rocblas_stride               stride_B,
+                                              const rocblas_float_complex* beta,
+                                              rocblas_float_complex*       C,
+                                              rocblas_int                  ldc,
+                                              rocblas_stride               stride_C,
+                                              rocblas_int                  batch_count)
+{
+    return rocblas_syr2k_strided_batched_impl(handle,
+                                              uplo,
+                                              transA,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              stride_C,
+                                              batch_count);
+}
+
+rocblas_status rocblas_zsyr2k_strided_batched(rocblas_handle                handle,
+                                              rocblas_fill                  uplo,
+                                              rocblas_operation             transA,
+                                              rocblas_int                   n,
+                                              rocblas_int                   k,
+                                              const rocblas_double_complex* alpha,
+                                              const rocblas_double_complex* A,
+                                              rocblas_int                   lda,
+                                              rocblas_stride                stride_A,
+                                              const rocblas_double_complex* B,
+                                              rocblas_int                   ldb,
+                                              rocblas_stride                stride_B,
+                                              const rocblas_double_complex* beta,
+                                              rocblas_double_complex*       C,
+                                              rocblas_int                   ldc,
+                                              rocblas_stride                stride_C,
+                                              rocblas_int                   batch_count)
+{
+    return rocblas_syr2k_strided_batched_impl(handle,
+                                              uplo,
+                                              transA,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              stride_C,
+                                              batch_count);
+}
+
+rocblas_status rocblas_cher2k_strided_batched(rocblas_handle               handle,
+                                              rocblas_fill                 uplo,
+                                              rocblas_operation            transA,
+                                              rocblas_int                  n,
+                                              rocblas_int                  k,
+                                              const rocblas_float_complex* alpha,
+                                              const rocblas_float_complex* A,
+                                              rocblas_int                  lda,
+                                              rocblas_stride               stride_A,
+                                              const rocblas_float_complex* B,
+                                              rocblas_int                  ldb,
+                                              rocblas_stride               stride_B,
+                                              const float*                 beta,
+                                              rocblas_float_complex*       C,
+                                              rocblas_int                  ldc,
+                                              rocblas_stride               stride_C,
+                                              rocblas_int                  batch_count)
+{
+    return rocblas_syr2k_strided_batched_impl(handle,
+                                              uplo,
+                                              transA,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              stride_C,
+                                              batch_count);
+}
+
+rocblas_status rocblas_zher2k_strided_batched(rocblas_handle                handle,
+                                              rocblas_fill                  uplo,
+                                              rocblas_operation             transA,
+                                              rocblas_int                   n,
+                                              rocblas_int                   k,
+                                              const rocblas_double_complex* alpha,
+                                              const rocblas_double_complex* A,
+                                              rocblas_int                   lda,
+                                              rocblas_stride                stride_A,
+                                              const rocblas_double_complex* B,
+                                              rocblas_int                   ldb,
+                                              rocblas_stride                stride_B,
+                                              const double*                 beta,
+                                              rocblas_double_complex*       C,
+                                              rocblas_int                   ldc,
+                                              rocblas_stride                stride_C,
+                                              rocblas_int                   batch_count)
+{
+    return rocblas_syr2k_strided_batched_impl(handle,
+                                              uplo,
+                                              transA,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              stride_C,
+                                              batch_count);
+}
+
+} // extern "C"
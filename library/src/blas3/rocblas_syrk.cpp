@@ -0,0 +1,246 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_syrk.hpp"
+#include "utility.h"
+
+namespace
+{
+    // herk is distinguished from syrk by a real U for a complex T
+    template <typename T, typename = T>
+    constexpr char rocblas_syrk_name[] = "unknown";
+    template <>
+    constexpr char rocblas_syrk_name<float>[] = "rocblas_ssyrk";
+    template <>
+    constexpr char rocblas_syrk_name<double>[] = "rocblas_dsyrk";
+    template <>
+    constexpr char rocblas_syrk_name<rocblas_float_complex>[] = "rocblas_csyrk";
+    template <>
+    constexpr char rocblas_syrk_name<rocblas_double_complex>[] = "rocblas_zsyrk";
+    template <>
+    constexpr char rocblas_syrk_name<rocblas_float_complex, float>[] = "rocblas_cherk";
+    template <>
+    constexpr char rocblas_syrk_name<rocblas_double_complex, double>[] = "rocblas_zherk";
+
+    template <typename T, typename U>
+    rocblas_status rocblas_syrk_impl(rocblas_handle    handle,
+                                     rocblas_fill      uplo,
+                                     rocblas_operation transA,
+                                     rocblas_int       n,
+                                     rocblas_int       k,
+                                     const U*          alpha,
+                                     const T*          A,
+                                     rocblas_int       lda,
+                                     const U*          beta,
+                                     T*                C,
+                                     rocblas_int       ldc)
+    {
+        constexpr bool HERM = is_complex<T> && !is_complex<U>;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto uplo_letter   = rocblas_fill_letter(uplo);
+            auto transA_letter = rocblas_transpose_letter(transA);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syrk_name<T, U>,
+                              uplo,
+                              transA,
+                              n,
+                              k,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              lda,
+                              log_trace_scalar_value(beta),
+                              C,
+                              ldc);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              HERM ? "./rocblas-bench -f herk -r" : "./rocblas-bench -f syrk -r",
+                              rocblas_precision_string<T>,
+                              "--uplo",
+                              uplo_letter,
+                              "--transposeA",
+                              transA_letter,
+                              "-n",
+                              n,
+                              "-k",
+                              k,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--ldc",
+                              ldc);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syrk_name<T, U>,
+                              uplo,
+                              transA,
+                              n,
+                              k,
+                              alpha,
+                              A,
+                              lda,
+                              beta,
+                              C,
+                              ldc);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_syrk_name<T, U>,
+                            "uplo",
+                            uplo_letter,
+                            "transA",
+                            transA_letter,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "lda",
+                            lda,
+                            "ldc",
+                            ldc);
+        }
+
+        // syrk takes the transpose and herk the conjugate transpose, except for real types
+        rocblas_operation trans_invalid = HERM ? rocblas_operation_transpose
+                                               : rocblas_operation_conjugate_transpose;
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(is_complex<T> && transA == trans_invalid)
+            return rocblas_status_not_implemented;
+
+        rocblas_int A_row = transA == rocblas_operation_none ? n : k;
+        if(n < 0 || k < 0 || lda < A_row || lda < 1 || ldc < n || ldc < 1)
+            return rocblas_status_invalid_size;
+
+        if(!n)
+            return rocblas_status_success;
+
+        if(!alpha || !beta || !A || !C)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_syrk_template<false, HERM, false, T>(
+            handle, uplo, transA, n, k, alpha, A, 0, lda, 0, A, 0, lda, 0, beta, C, 0, ldc, 0, 1);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ssyrk(rocblas_handle    handle,
+                             rocblas_fill      uplo,
+                             rocblas_operation transA,
+                             rocblas_int       n,
+                             rocblas_int       k,
+                             const float*      alpha,
+                             const float*      A,
+                             rocblas_int       lda,
+                             const float*      beta,
+                             float*            C,
+                             rocblas_int       ldc)
+{
+    return rocblas_syrk_impl(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+rocblas_status rocblas_dsyrk(rocblas_handle    handle,
+                             rocblas_fill      uplo,
+                             rocblas_operation transA,
+                             rocblas_int       n,
+                             rocblas_int       k,
+                             const double*     alpha,
+                             const double*     A,
+                             rocblas_int       lda,
+                             const double*     beta,
+                             double*           C,
+                             rocblas_int       ldc)
+{
+    return rocblas_syrk_impl(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+rocblas_status rocblas_csyrk(rocblas_handle               handle,
+                             rocblas_fill                 uplo,
+                             rocblas_operation            transA,
+                             rocblas_int                  n,
+                             rocblas_int                  k,
+                             const rocblas_float_complex* alpha,
+                             const rocblas_float_complex* A,
+                             rocblas_int                  lda,
+                             const rocblas_float_complex* beta,
+                             rocblas_float_complex*       C,
+                             rocblas_int                  ldc)
+{
+    return rocblas_syrk_impl(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+rocblas_status rocblas_zsyrk(rocblas_handle                handle,
+                             rocblas_fill                  uplo,
+                             rocblas_operation             transA,
+                             rocblas_int                   n,
+                             rocblas_int                   k,
+                             const rocblas_double_complex* alpha,
+                             const rocblas_double_complex* A,
+                             rocblas_int                   lda,
+                             const rocblas_double_complex* beta,
+                             rocblas_double_complex*       C,
+                             rocblas_int                   ldc)
+{
+    return rocblas_syrk_impl(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+rocblas_status rocblas_cherk(rocblas_handle               handle,
+                             rocblas_fill                 uplo,
+                             rocblas_operation            transA,
+                             rocblas_int                  n,
+                             rocblas_int                  k,
+                             const float*                 alpha,
+                             const rocblas_float_complex* A,
+                             rocblas_int                  lda,
+                             const float*                 beta,
+                             rocblas_float_complex*       C,
+                             rocblas_int                  ldc)
+{
+    return rocblas_syrk_impl(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+rocblas_status rocblas_zherk(rocblas_handle                handle,
+                             rocblas_fill                  uplo,
+                             rocblas_operation             transA,
+                             rocblas_int                   n,
+                             rocblas_int                   k,
+                             const double*                 alpha,
+                             const rocblas_double_complex* A,
+                             rocblas_int                   lda,
+                             const double*                 beta,
+                             rocblas_double_complex*       C,
+                             rocblas_int                   ldc)
+{
+    return rocblas_syrk_impl(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+} // extern "C"
@@ -0,0 +1,309 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __ROCBLAS_SYRK_HPP__
+#define __ROCBLAS_SYRK_HPP__
+
+#include "gemm.hpp"
+#include "handle.h"
+#include "rocblas.h"
+#include "utility.h"
+
+/*
+ * Rank-k and rank-2k updates of one triangle of C:
+ *
+ *   syrk   C = alpha * op(A) * op(A)^T + beta * C
+ *   herk   C = alpha * op(A) * op(A)^H + beta * C
+ *   syr2k  C = alpha * op(A) * op(B)^T + alpha * op(B) * op(A)^T + beta * C
+ *   her2k  C = alpha * op(A) * op(B)^H + conj(alpha) * op(B) * op(A)^H + beta * C
+ *
+ * where op(A) is n x k. C is split into diagonal blocks of size SYRK_DIAG_NB, which are
+ * computed by a small kernel touching only the stored triangle. The rest of the triangle
+ * is covered by square off-diagonal blocks of size SYRK_DIAG_NB, 2 * SYRK_DIAG_NB,
+ * 4 * SYRK_DIAG_NB, ..., each of which is a GEMM, so that most of the flops of a large
+ * update are spent in a few large GEMMs.
+ */
+
+constexpr rocblas_int SYRK_DIAG_NB    = 32;
+constexpr rocblas_int SYRK_DIAG_DIM_Y = 8;
+
+// Element (i, l) of op(A), conjugated for the conjugate transpose
+template <bool HERM, typename T>
+__device__ inline T syrk_load_op(
+    const T* A, rocblas_operation trans, rocblas_int lda, rocblas_int i, rocblas_int l)
+{
+    if(trans == rocblas_operation_none)
+        return A[i + ptrdiff_t(l) * lda];
+    return HERM ? conj(A[l + ptrdiff_t(i) * lda]) : A[l + ptrdiff_t(i) * lda];
+}
+
+// One thread block per diagonal block of C and per batch; each thread computes the elements
+// of one row of the diagonal block which lie in the stored triangle.
+template <rocblas_int NB,
+          rocblas_int DIM_Y,
+          bool        HERM,
+          bool        TWOK,
+          typename T,
+          typename U,
+          typename V>
+__global__ void syrk_diag_kernel(rocblas_fill      uplo,
+                                 rocblas_operation trans,
+                                 rocblas_int       n,
+                                 rocblas_int       k,
+                                 T                 alpha,
+                                 U                 Aa,
+                                 rocblas_int       offset_A,
+                                 rocblas_int       lda,
+                                 rocblas_stride    stride_A,
+                                 U                 Ba,
+                                 rocblas_int       offset_B,
+                                 rocblas_int       ldb,
+                                 rocblas_stride    stride_B,
+                                 T                 beta,
+                                 V                 Ca,
+                                 rocblas_int       offset_C,
+                                 rocblas_int       ldc,
+                                 rocblas_stride    stride_C)
+{
+    rocblas_int row = hipBlockIdx_x * NB + hipThreadIdx_x;
+    if(row >= n)
+        return;
+
+    const T* A = load_ptr_batch(Aa, hipBlockIdx_y, offset_A, stride_A);
+    const T* B = load_ptr_batch(Ba, hipBlockIdx_y, offset_B, stride_B);
+    T*       C = load_ptr_batch(Ca, hipBlockIdx_y, offset_C, stride_C);
+
+    T alpha2 = HERM ? conj(alpha) : alpha;
+
+    for(rocblas_int col = hipBlockIdx_x * NB + hipThreadIdx_y;
+        col < n && col < (hipBlockIdx_x + 1) * NB;
+        col += DIM_Y)
+    {
+        if(uplo == rocblas_fill_lower ? row < col : row > col)
+            continue;
+
+        T sum1 = 0, sum2 = 0;
+        if(alpha != 0)
+        {
+            for(rocblas_int l = 0; l < k; l++)
+            {
+                T a_row = syrk_load_op<HERM>(A, trans, lda, row, l);
+                T a_col = syrk_load_op<HERM>(A, trans, lda, col, l);
+                if(TWOK)
+                {
+                    T b_row = syrk_load_op<HERM>(B, trans, ldb, row, l);
+                    T b_col = syrk_load_op<HERM>(B, trans, ldb, col, l);
+                    sum1 += a_row * (HERM ? conj(b_col) : b_col);
+                    sum2 += b_row * (HERM ? conj(a_col) : a_col);
+                }
+                else
+                {
+                    sum1 += a_row * (HERM ? conj(a_col) : a_col);
+                }
+            }
+        }
+
+        T& c   = C[row + ptrdiff_t(col) * ldc];
+        T  res = TWOK ? alpha * sum1 + alpha2 * sum2 : alpha * sum1;
+
+        // beta == 0 overwrites C, so that NaNs in C are not propagated
+        if(beta != 0)
+            res += beta * c;
+
+        // The diagonal of a Hermitian matrix is real
+        if(HERM && row == col)
+            res = (res + conj(res)) / 2;
+
+        c = res;
+    }
+}
+
+/*! \brief Rank-k (TWOK == false) or rank-2k (TWOK == true) update of one triangle of C,
+    symmetric when HERM == false and Hermitian when HERM == true.
+
+    U and V are const T* / T* for the non-batched and strided batched functions, or arrays
+    of device pointers when BATCHED. B is ignored unless TWOK. alpha and beta may be real or
+    of type T. */
+template <bool BATCHED,
+          bool HERM,
+          bool TWOK,
+          typename T,
+          typename TAlpha,
+          typename TBeta,
+          typename U,
+          typename V>
+rocblas_status rocblas_syrk_template(rocblas_handle    handle,
+                                     rocblas_fill      uplo,
+                                     rocblas_operation trans,
+                                     rocblas_int       n,
+                                     rocblas_int       k,
+                                     const TAlpha*     alpha,
+                                     U                 A,
+                                     rocblas_int       offset_A,
+                                     rocblas_int       lda,
+                                     rocblas_stride    stride_A,
+                                     U                 B,
+                                     rocblas_int       offset_B,
+                                     rocblas_int       ldb,
+                                     rocblas_stride    stride_B,
+                                     const TBeta*      beta,
+                                     V                 C,
+                                     rocblas_int       offset_C,
+                                     rocblas_int       ldc,
+                                     rocblas_stride    stride_C,
+                                     rocblas_int       batch_count)
+{
+    // Quick return. k == 0 is not a quick return, because C must still be multiplied by beta
+    if(!n || !batch_count)
+        return rocblas_status_success;
+
+    // For real types, the conjugate transpose is the transpose
+    if(!is_complex<T> && trans == rocblas_operation_conjugate_transpose)
+        trans = rocblas_operation_transpose;
+
+    // Temporarily switch to host pointer mode, saving current pointer mode, restored on return
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    // Get alpha and beta
+    TAlpha alpha_h;
+    TBeta  beta_h;
+    if(saved_pointer_mode == rocblas_pointer_mode_host)
+    {
+        alpha_h = *alpha;
+        beta_h  = *beta;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(&alpha_h, alpha, sizeof(TAlpha), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(&beta_h, beta, sizeof(TBeta), hipMemcpyDeviceToHost));
+    }
+
+    // When beta == 1 and either k == 0 or alpha == 0, the operation is a no-op
+    if(beta_h == 1 && (!k || alpha_h == 0))
+        return rocblas_status_success;
+
+    T alpha_t = alpha_h;
+    T beta_t  = beta_h;
+    T alpha2  = HERM ? conj(alpha_t) : alpha_t;
+    T one     = 1;
+
+    if(!TWOK)
+    {
+        B        = A;
+        offset_B = offset_A;
+        ldb      = lda;
+        stride_B = stride_A;
+    }
+
+    // Diagonal blocks
+    dim3 diag_grid((n - 1) / SYRK_DIAG_NB + 1, batch_count);
+    dim3 diag_threads(SYRK_DIAG_NB, SYRK_DIAG_DIM_Y);
+
+    hipLaunchKernelGGL((syrk_diag_kernel<SYRK_DIAG_NB, SYRK_DIAG_DIM_Y, HERM, TWOK, T>),
+                       diag_grid,
+                       diag_threads,
+                       0,
+                       handle->rocblas_stream,
+                       uplo,
+                       trans,
+                       n,
+                       k,
+                       alpha_t,
+                       A,
+                       offset_A,
+                       lda,
+                       stride_A,
+                       B,
+                       offset_B,
+                       ldb,
+                       stride_B,
+                       beta_t,
+                       C,
+                       offset_C,
+                       ldc,
+                       stride_C);
+
+    // The block of C at rows [i, i + m) and columns [j, j + n) is
+    // op(A)[i:i+m, :] * op(B)[j:j+n, :]^T (or ^H), which is a GEMM with these operations
+    rocblas_operation trans_a = trans;
+    rocblas_operation trans_b = rocblas_operation_none;
+    if(trans == rocblas_operation_none)
+        trans_b = HERM ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+
+    // Distance between consecutive rows of op(A) and op(B)
+    rocblas_int row_A = trans == rocblas_operation_none ? 1 : lda;
+    rocblas_int row_B = trans == rocblas_operation_none ? 1 : ldb;
+
+    // Off-diagonal blocks, doubling in size with each level
+    for(rocblas_int nb = SYRK_DIAG_NB; nb < n; nb *= 2)
+    {
+        for(rocblas_int i0 = 0; i0 + nb < n; i0 += 2 * nb)
+        {
+            // Lower: rows [i0 + nb, i0 + nb + mb), columns [i0, i0 + nb).
+            // Upper: the transposed position.
+            rocblas_int mb    = std::min(nb, n - i0 - nb);
+            bool        lower = uplo == rocblas_fill_lower;
+            rocblas_int i     = lower ? i0 + nb : i0;
+            rocblas_int j     = lower ? i0 : i0 + nb;
+            rocblas_int m_blk = lower ? mb : nb;
+            rocblas_int n_blk = lower ? nb : mb;
+
+            rocblas_status status
+                = rocblas_gemm_template<BATCHED, !BATCHED>(handle,
+                                                           trans_a,
+                                                           trans_b,
+                                                           m_blk,
+                                                           n_blk,
+                                                           k,
+                                                           &alpha_t,
+                                                           A,
+                                                           offset_A + i * row_A,
+                                                           lda,
+                                                           stride_A,
+                                                           B,
+                                                           offset_B + j * row_B,
+                                                           ldb,
+                                                           stride_B,
+                                                           &beta_t,
+                                                           C,
+                                                           offset_C + i + j * ldc,
+                                                           ldc,
+                                                           stride_C,
+                                                           batch_count);
+            if(status != rocblas_status_success)
+                return status;
+
+            // The second product of a rank-2k update accumulates into the same block
+            if(TWOK)
+            {
+                status = rocblas_gemm_template<BATCHED, !BATCHED>(handle,
+                                                                  trans_a,
+                                                                  trans_b,
+                                                                  m_blk,
+                                                                  n_blk,
+                                                                  k,
+                                                                  &alpha2,
+                                                                  B,
+                                                                  offset_B + i * row_B,
+                                                                  ldb,
+                                                                  stride_B,
+                                                                  A,
+                                                                  offset_A + j * row_A,
+                                                                  lda,
+                                                                  stride_A,
+                                                                  &one,
+                                                                  C,
+                                                                  offset_C + i + j * ldc,
+                                                                  ldc,
+                                                                  stride_C,
+                                                                  batch_count);
+                if(status != rocblas_status_success)
+                    return status;
+            }
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+#endif // __ROCBLAS_SYRK_HPP__
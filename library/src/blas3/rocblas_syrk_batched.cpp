@@ -0,0 +1,286 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_syrk.hpp"
+#include "utility.h"
+
+namespace
+{
+    // herk is distinguished from syrk by a real U for a complex T
+    template <typename T, typename = T>
+    constexpr char rocblas_syrk_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_syrk_batched_name<float>[] = "rocblas_ssyrk_batched";
+    template <>
+    constexpr char rocblas_syrk_batched_name<double>[] = "rocblas_dsyrk_batched";
+    template <>
+    constexpr char rocblas_syrk_batched_name<rocblas_float_complex>[] = "rocblas_csyrk_batched";
+    template <>
+    constexpr char rocblas_syrk_batched_name<rocblas_double_complex>[] = "rocblas_zsyrk_batched";
+    template <>
+    constexpr char rocblas_syrk_batched_name<rocblas_float_complex, float>[]
+        = "rocblas_cherk_batched";
+    template <>
+    constexpr char rocblas_syrk_batched_name<rocblas_double_complex, double>[]
+        = "rocblas_zherk_batched";
+
+    template <typename T, typename U>
+    rocblas_status rocblas_syrk_batched_impl(rocblas_handle    handle,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation transA,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const U*          alpha,
+                                             const T* const    A[],
+                                             rocblas_int       lda,
+                                             const U*          beta,
+                                             T* const          C[],
+                                             rocblas_int       ldc,
+                                             rocblas_int       batch_count)
+    {
+        constexpr bool HERM = is_complex<T> && !is_complex<U>;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto uplo_letter   = rocblas_fill_letter(uplo);
+            auto transA_letter = rocblas_transpose_letter(transA);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syrk_batched_name<T, U>,
+                              uplo,
+                              transA,
+                              n,
+                              k,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              lda,
+                              log_trace_scalar_value(beta),
+                              C,
+                              ldc,
+                              batch_count);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              HERM ? "./rocblas-bench -f herk_batched -r"
+                                   : "./rocblas-bench -f syrk_batched -r",
+                              rocblas_precision_string<T>,
+                              "--uplo",
+                              uplo_letter,
+                              "--transposeA",
+                              transA_letter,
+                              "-n",
+                              n,
+                              "-k",
+                              k,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              LOG_BENCH_SCALAR_VALUE(beta),
+                              "--ldc",
+                              ldc,
+                              "--batch_count",
+                              batch_count);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_syrk_batched_name<T, U>,
+                              uplo,
+                              transA,
+                              n,
+                              k,
+                              alpha,
+                              A,
+                              lda,
+                              beta,
+                              C,
+                              ldc,
+                              batch_count);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_syrk_batched_name<T, U>,
+                            "uplo",
+                            uplo_letter,
+                            "transA",
+                            transA_letter,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "lda",
+                            lda,
+                            "ldc",
+                            ldc,
+                            "batch_count",
+                            batch_count);
+        }
+
+        // syrk takes the transpose and herk the conjugate transpose, except for real types
+        rocblas_operation trans_invalid = HERM ? rocblas_operation_transpose
+                                               : rocblas_operation_conjugate_transpose;
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(is_complex<T> && transA == trans_invalid)
+            return rocblas_status_not_implemented;
+
+        rocblas_int A_row = transA == rocblas_operation_none ? n : k;
+        if(n < 0 || k < 0 || lda < A_row || lda < 1 || ldc < n || ldc < 1 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!n || !batch_count)
+            return rocblas_status_success;
+
+        if(!alpha || !beta || !A || !C)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_syrk_template<true, HERM, false, T>(handle,
+                                                           uplo,
+                                                           transA,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           A,
+                                                           0,
+                                                           lda,
+                                                           0,
+                                                           A,
+                                                           0,
+                                                           lda,
+                                                           0,
+                                                           beta,
+                                                           C,
+                                                           0,
+                                                           ldc,
+                                                           0,
+                                                           batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_ssyrk_batched(rocblas_handle     handle,
+                                     rocblas_fill       uplo,
+                                     rocblas_operation  transA,
+                                     rocblas_int        n,
+                                     rocblas_int        k,
+                                     const float*       alpha,
+                                     const float* const A[],
+                                     rocblas_int        lda,
+                                     const float*       beta,
+                                     float* const       C[],
+                                     rocblas_int        ldc,
+                                     rocblas_int        batch_count)
+{
+    return rocblas_syrk_batched_impl(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batch_count);
+}
+
+rocblas_status rocblas_dsyrk_batched(rocblas_handle      handle,
+                                     rocblas_fill        uplo,
+                                     rocblas_operation   transA,
+                                     rocblas_int         n,
+                                     rocblas_int         k,
+                                     const double*       alpha,
+                                     const double* const A[],
+                                     rocblas_int         lda,
+                                     const double*       beta,
+                                     double* const       C[],
+                                     rocblas_int         ldc,
+                                     rocblas_int         batch_count)
+{
+    return rocblas_syrk_batched_impl(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batch_count);
+}
+
+rocblas_status rocblas_csyrk_batched(rocblas_handle                     handle,
+                                     rocblas_fill                       uplo,
+                                     rocblas_operation                  transA,
+                                     rocblas_int                        n,
+                                     rocblas_int                        k,
+                                     const rocblas_float_complex*       alpha,
+                                     const rocblas_float_complex* const A[],
+                                     rocblas_int                        lda,
+                                     const rocblas_float_complex*       beta,
+                                     rocblas_float_complex* const       C[],
+                                     rocblas_int                        ldc,
+                                     rocblas_int                        batch_count)
+{
+    return rocblas_syrk_batched_impl(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batch_count);
+}
+
+rocblas_status rocblas_zsyrk_batched(rocblas_handle                      handle,
+                                     rocblas_fill                        uplo,
+                                     rocblas_operation                   transA,
+                                     rocblas_int                         n,
+                                     rocblas_int                         k,
+                                     const rocblas_double_complex*       alpha,
+                                     const rocblas_double_complex* const A[],
+                                     rocblas_int                         lda,
+                                     const rocblas_double_complex*       beta,
+                                     rocblas_double_complex* const       C[],
+                                     rocblas_int                         ldc,
+                                     rocblas_int                         batch_count)
+{
+    return rocblas_syrk_batched_impl(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batch_count);
+}
+
+rocblas_status rocblas_cherk_batched(rocblas_handle                     handle,
+                                     rocblas_fill                       uplo,
+                                     rocblas_operation                  transA,
+                                     rocblas_int                        n,
+                                     rocblas_int                        k,
+                                     const float*                       alpha,
+                                     const rocblas_float_complex* const A[],
+                                     rocblas_int                        lda,
+                                     const float*                       beta,
+                                     rocblas_float_complex* const       C[],
+                                     rocblas_int                        ldc,
+                                     rocblas_int                        batch_count)
+{
+    return rocblas_syrk_batched_impl(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batch_count);
+}
+
+rocblas_status rocblas_zherk_batched(rocblas_handle                      handle,
+                                     rocblas_fill                        uplo,
+                                     rocblas_operation                   transA,
+                                     rocblas_int                         n,
+                                     rocblas_int                         k,
+                                     const double*                       alpha,
+                                     const rocblas_double_complex* const A[],
+                                     rocblas_int                         lda,
+                                     const double*                       beta,
+                                     rocblas_double_complex* const       C[],
+                                     rocblas_int                         ldc,
+                                     rocblas_int                         batch_count)
+{
+    return rocblas_syrk_batched_impl(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batch_count);
+}
+
+} // extern "C"
@@ -163,6 +163,182 @@ namespace
             handle, side, uplo, transa, diag, m, n, alpha, a, lda, c, ldc, (T*)mem);
     }
 
+    template <typename>
+    constexpr char rocblas_trmm_outofplace_name[] = "unknown";
+    template <>
+    constexpr char rocblas_trmm_outofplace_name<float>[] = "rocblas_strmm_outofplace";
+    template <>
+    constexpr char rocblas_trmm_outofplace_name<double>[] = "rocblas_dtrmm_outofplace";
+
+    template <typename T>
+    rocblas_status rocblas_trmm_outofplace_impl(rocblas_handle    handle,
+                                                rocblas_side      side,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation transa,
+                                                rocblas_diagonal  diag,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                const T*          alpha,
+                                                const T*          a,
+                                                rocblas_int       lda,
+                                                const T*          b,
+                                                rocblas_int       ldb,
+                                                T*                c,
+                                                rocblas_int       ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto side_letter   = rocblas_side_letter(side);
+            auto uplo_letter   = rocblas_fill_letter(uplo);
+            auto transa_letter = rocblas_transpose_letter(transa);
+            auto diag_letter   = rocblas_diag_letter(diag);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_trmm_outofplace_name<T>,
+                              side,
+                              uplo,
+                              transa,
+                              diag,
+                              m,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              a,
+                              lda,
+                              b,
+                              ldb,
+                              c,
+                              ldc);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              "./rocblas-bench -f trmm_outofplace -r",
+                              rocblas_precision_string<T>,
+                              "--side",
+                              side_letter,
+                              "--uplo",
+                              uplo_letter,
+                              "--transposeA",
+                              transa_letter,
+                              "--diag",
+                              diag_letter,
+                              "-m",
+                              m,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              "--ldb",
+                              ldb,
+                              "--ldc",
+                              ldc);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_trmm_outofplace_name<T>,
+                              side,
+                              uplo,
+                              transa,
+                              diag,
+                              m,
+                              n,
+                              alpha,
+                              a,
+                              lda,
+                              b,
+                              ldb,
+                              c,
+                              ldc);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_trmm_outofplace_name<T>,
+                            "side",
+                            side_letter,
+                            "uplo",
+                            uplo_letter,
+                            "transa",
+                            transa_letter,
+                            "diag",
+                            diag_letter,
+                            "m",
+                            m,
+                            "n",
+                            n,
+                            "lda",
+                            lda,
+                            "ldb",
+                            ldb,
+                            "ldc",
+                            ldc);
+        }
+
+        rocblas_int nrowa = rocblas_side_left == side ? m : n;
+
+        if(m < 0 || n < 0 || lda < nrowa || lda < 1 || ldb < m || ldb < 1 || ldc < m || ldc < 1)
+            return rocblas_status_invalid_size;
+
+        if(m == 0 || n == 0)
+        {
+            if(handle->is_device_memory_size_query())
+                return rocblas_status_size_unchanged;
+            else
+                return rocblas_status_success;
+        }
+
+        if(!a || !b || !c || !alpha)
+            return rocblas_status_invalid_pointer;
+
+        // C must not overlap B
+        if(b == c)
+            return rocblas_status_invalid_pointer;
+
+        // beta = 1 for the off-diagonal GEMMs, on the device in device pointer mode
+        size_t dev_bytes = sizeof(T);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+
+        auto mem = handle->device_malloc(dev_bytes);
+        if(!mem)
+            return rocblas_status_memory_error;
+
+        return rocblas_trmm_outofplace_template<false>(handle,
+                                                       side,
+                                                       uplo,
+                                                       transa,
+                                                       diag,
+                                                       m,
+                                                       n,
+                                                       alpha,
+                                                       a,
+                                                       0,
+                                                       lda,
+                                                       0,
+                                                       b,
+                                                       0,
+                                                       ldb,
+                                                       0,
+                                                       c,
+                                                       0,
+                                                       ldc,
+                                                       0,
+                                                       1,
+                                                       (T*)mem);
+    }
+
 } // namespace
 
 /*
@@ -205,6 +381,44 @@ rocblas_status rocblas_dtrmm(rocblas_handle    handle,
     return rocblas_trmm_impl(handle, side, uplo, transa, diag, m, n, alpha, a, lda, c, ldc);
 }
 
+rocblas_status rocblas_strmm_outofplace(rocblas_handle    handle,
+                                        rocblas_side      side,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation transa,
+                                        rocblas_diagonal  diag,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        const float*      alpha,
+                                        const float*      a,
+                                        rocblas_int       lda,
+                                        const float*      b,
+                                        rocblas_int       ldb,
+                                        float*            c,
+                                        rocblas_int       ldc)
+{
+    return rocblas_trmm_outofplace_impl(
+        handle, side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb, c, ldc);
+}
+
+rocblas_status rocblas_dtrmm_outofplace(rocblas_handle    handle,
+                                        rocblas_side      side,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation transa,
+                                        rocblas_diagonal  diag,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        const double*     alpha,
+                                        const double*     a,
+                                        rocblas_int       lda,
+                                        const double*     b,
+                                        rocblas_int       ldb,
+                                        double*           c,
+                                        rocblas_int       ldc)
+{
+    return rocblas_trmm_outofplace_impl(
+        handle, side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb, c, ldc);
+}
+
 } // extern "C"
 
 /* ============================================================================================ */
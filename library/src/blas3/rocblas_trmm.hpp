@@ -5,6 +5,7 @@
 #include "../blas1/rocblas_scal.hpp"
 #include "../blas2/rocblas_gemv.hpp"
 #include "../blas3/Tensile/gemm.hpp"
+#include "../blas3/Tensile/gemm_batched_device.hpp"
 #include "dcld.hpp"
 #include "handle.h"
 #include "rocblas.h"
@@ -1451,3 +1452,466 @@ rocblas_status rocblas_trmm_template(rocblas_handle    handle,
 
     return rocblas_status_success;
 }
+
+/*
+ * Batched and out-of-place TRMM
+ *
+ *   side == rocblas_side_left   C = alpha * op(A) * B,  A is m x m
+ *   side == rocblas_side_right  C = alpha * B * op(A),  A is n x n
+ *
+ * op(A) is split into diagonal blocks of size TRMM_DIAG_NB and off-diagonal blocks which
+ * double in size, as in SYRK. One kernel launch computes the products with the diagonal blocks
+ * for all of the batches, and each off-diagonal block is a GEMM accumulated into C. Elements of
+ * A outside of the triangle are not read, and the diagonal is not read when it is unit. The
+ * in-place batched routines write C to temporary device memory and copy it back to B.
+ */
+
+constexpr rocblas_int TRMM_DIM     = 16;
+constexpr rocblas_int TRMM_DIAG_NB = 32;
+
+// Element (i, j) of the triangular matrix op(A), where lower refers to op(A)
+template <typename T>
+__device__ inline T trmm_load_A(const T*    A,
+                                rocblas_int lda,
+                                bool        lower,
+                                bool        trans,
+                                bool        conjA,
+                                bool        unit,
+                                rocblas_int i,
+                                rocblas_int j)
+{
+    if(lower ? i < j : i > j)
+        return 0;
+    if(unit && i == j)
+        return 1;
+    T a = trans ? A[j + ptrdiff_t(i) * lda] : A[i + ptrdiff_t(j) * lda];
+    return conjA ? conj(a) : a;
+}
+
+// C = alpha * D * B or C = alpha * B * D, where D holds the NB x NB diagonal blocks of op(A).
+// Each workgroup computes a DIM x DIM tile of C.
+template <rocblas_int DIM, rocblas_int NB, typename T, typename TScal, typename U, typename W>
+__global__ void trmm_diag_kernel(rocblas_side      side,
+                                 rocblas_fill      uplo,
+                                 rocblas_operation transA,
+                                 rocblas_diagonal  diag,
+                                 rocblas_int       m,
+                                 rocblas_int       n,
+                                 TScal             alpha_device_host,
+                                 U                 Aa,
+                                 rocblas_int       offset_A,
+                                 rocblas_int       lda,
+                                 rocblas_stride    stride_A,
+                                 U                 Ba,
+                                 rocblas_int       offset_B,
+                                 rocblas_int       ldb,
+                                 rocblas_stride    stride_B,
+                                 W                 Ca,
+                                 rocblas_int       offset_C,
+                                 rocblas_int       ldc,
+                                 rocblas_stride    stride_C)
+{
+    static_assert(NB % DIM == 0, "NB must be a multiple of DIM");
+
+    __shared__ T sX[DIM][DIM];
+    __shared__ T sY[DIM][DIM];
+
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int ty  = hipThreadIdx_y;
+    rocblas_int row = hipBlockIdx_x * DIM + tx;
+    rocblas_int col = hipBlockIdx_y * DIM + ty;
+
+    const T* A     = load_ptr_batch(Aa, hipBlockIdx_z, offset_A, stride_A);
+    const T* B     = load_ptr_batch(Ba, hipBlockIdx_z, offset_B, stride_B);
+    T*       C     = load_ptr_batch(Ca, hipBlockIdx_z, offset_C, stride_C);
+    auto     alpha = load_scalar(alpha_device_host);
+
+    bool        left  = side == rocblas_side_left;
+    bool        trans = transA != rocblas_operation_none;
+    bool        conjA = transA == rocblas_operation_conjugate_transpose;
+    bool        unit  = diag == rocblas_diagonal_unit;
+    bool        lower = (uplo == rocblas_fill_lower) != trans;
+    rocblas_int ka    = left ? m : n;
+
+    // Rows (left) or columns (right) of op(A) used by this tile lie in the diagonal block
+    // starting at d0, and are non-zero in [l_begin, l_end)
+    rocblas_int r0      = left ? hipBlockIdx_x * DIM : hipBlockIdx_y * DIM;
+    rocblas_int d0      = r0 / NB * NB;
+    bool        from_r0 = left != lower;
+    rocblas_int l_begin = from_r0 ? r0 : d0;
+    rocblas_int l_end   = min(ka, from_r0 ? d0 + NB : r0 + DIM);
+
+    T sum = 0;
+    if(alpha != 0)
+    {
+        for(rocblas_int kk = l_begin; kk < l_end; kk += DIM)
+        {
+            // X[row, kk + ty] and Y[kk + tx, col], where X * Y is D * B or B * D
+            T x = 0, y = 0;
+            if(row < m && kk + ty < l_end)
+                x = left ? trmm_load_A(A, lda, lower, trans, conjA, unit, row, kk + ty)
+                         : B[row + ptrdiff_t(kk + ty) * ldb];
+            if(col < n && kk + tx < l_end)
+                y = left ? B[kk + tx + ptrdiff_t(col) * ldb]
+                         : trmm_load_A(A, lda, lower, trans, conjA, unit, kk + tx, col);
+            sX[ty][tx] = x;
+            sY[ty][tx] = y;
+
+            __syncthreads();
+
+            for(rocblas_int l = 0; l < DIM; l++)
+                sum += sX[l][tx] * sY[ty][l];
+
+            __syncthreads();
+        }
+    }
+
+    // alpha == 0 sets C to 0, without reading B
+    if(row < m && col < n)
+        C[row + ptrdiff_t(col) * ldc] = alpha * sum;
+}
+
+// Sets the device scalar beta = 1 used by the off-diagonal GEMMs in device pointer mode
+template <typename T>
+__global__ void trmm_one_kernel(T* one)
+{
+    *one = 1;
+}
+
+/*! \brief C = alpha * op(A) * B or C = alpha * B * op(A).
+
+    U is const T* for the non-batched and strided batched functions, or an array of device
+    pointers when BATCHED, and W is the corresponding type of C. C must not overlap B.
+
+    alpha follows the pointer mode of the handle, and is never copied to the host. In device
+    pointer mode, workspace must be device memory for one element of T, which holds beta = 1 for
+    the GEMMs; it is not used in host pointer mode. */
+template <bool BATCHED, typename T, typename U, typename W>
+rocblas_status rocblas_trmm_outofplace_template(rocblas_handle    handle,
+                                                rocblas_side      side,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation transA,
+                                                rocblas_diagonal  diag,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                const T*          alpha,
+                                                U                 A,
+                                                rocblas_int       offset_A,
+                                                rocblas_int       lda,
+                                                rocblas_stride    stride_A,
+                                                U                 B,
+                                                rocblas_int       offset_B,
+                                                rocblas_int       ldb,
+                                                rocblas_stride    stride_B,
+                                                W                 C,
+                                                rocblas_int       offset_C,
+                                                rocblas_int       ldc,
+                                                rocblas_stride    stride_C,
+                                                rocblas_int       batch_count,
+                                                T*                workspace)
+{
+    // Quick return
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    // For real types, the conjugate transpose is the transpose
+    if(!is_complex<T> && transA == rocblas_operation_conjugate_transpose)
+        transA = rocblas_operation_transpose;
+
+    bool device_mode = handle->pointer_mode == rocblas_pointer_mode_device;
+
+    // Diagonal blocks, which also set all of C
+    dim3 grid((m - 1) / TRMM_DIM + 1, (n - 1) / TRMM_DIM + 1, batch_count);
+    dim3 threads(TRMM_DIM, TRMM_DIM);
+
+    if(device_mode)
+        hipLaunchKernelGGL((trmm_diag_kernel<TRMM_DIM, TRMM_DIAG_NB, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           alpha,
+                           A,
+                           offset_A,
+                           lda,
+                           stride_A,
+                           B,
+                           offset_B,
+                           ldb,
+                           stride_B,
+                           C,
+                           offset_C,
+                           ldc,
+                           stride_C);
+    else
+        hipLaunchKernelGGL((trmm_diag_kernel<TRMM_DIM, TRMM_DIAG_NB, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           *alpha,
+                           A,
+                           offset_A,
+                           lda,
+                           stride_A,
+                           B,
+                           offset_B,
+                           ldb,
+                           stride_B,
+                           C,
+                           offset_C,
+                           ldc,
+                           stride_C);
+
+    // alpha == 0 has already set C to 0
+    if(!device_mode && *alpha == 0)
+        return rocblas_status_success;
+
+    // beta = 1 for the GEMMs, in the pointer mode of alpha
+    T        one_h = 1;
+    const T* one   = &one_h;
+    if(device_mode)
+    {
+        hipLaunchKernelGGL(trmm_one_kernel, dim3(1), dim3(1), 0, handle->rocblas_stream, workspace);
+        one = workspace;
+    }
+
+    bool        left  = side == rocblas_side_left;
+    bool        trans = transA != rocblas_operation_none;
+    bool        lower = (uplo == rocblas_fill_lower) != trans;
+    rocblas_int ka    = left ? m : n;
+
+    // Off-diagonal blocks, doubling in size with each level
+    for(rocblas_int nb = TRMM_DIAG_NB; nb < ka; nb *= 2)
+    {
+        for(rocblas_int i0 = 0; i0 + nb < ka; i0 += 2 * nb)
+        {
+            // The block of op(A) at rows [i, i + m_blk) and columns [j, j + n_blk).
+            // Lower: rows [i0 + nb, i0 + nb + mb), columns [i0, i0 + nb).
+            // Upper: the transposed position.
+            rocblas_int mb       = std::min(nb, ka - i0 - nb);
+            rocblas_int i        = lower ? i0 + nb : i0;
+            rocblas_int j        = lower ? i0 : i0 + nb;
+            rocblas_int m_blk    = lower ? mb : nb;
+            rocblas_int n_blk    = lower ? nb : mb;
+            rocblas_int offset_a = offset_A + (trans ? j + i * lda : i + j * lda);
+
+            // Left:  C[i:i+m_blk, :] += alpha * op(A)[i:i+m_blk, j:j+n_blk] * B[j:j+n_blk, :]
+            // Right: C[:, j:j+n_blk] += alpha * B[:, i:i+m_blk] * op(A)[i:i+m_blk, j:j+n_blk]
+            rocblas_operation trans_x  = left ? transA : rocblas_operation_none;
+            rocblas_operation trans_y  = left ? rocblas_operation_none : transA;
+            rocblas_int       gemm_m   = left ? m_blk : m;
+            rocblas_int       gemm_n   = left ? n : n_blk;
+            rocblas_int       gemm_k   = left ? n_blk : m_blk;
+            U                 X        = left ? A : B;
+            rocblas_int       offset_x = left ? offset_a : offset_B + i * ldb;
+            rocblas_int       ldx      = left ? lda : ldb;
+            rocblas_stride    stride_x = left ? stride_A : stride_B;
+            U                 Y        = left ? B : A;
+            rocblas_int       offset_y = left ? offset_B + j : offset_a;
+            rocblas_int       ldy      = left ? ldb : lda;
+            rocblas_stride    stride_y = left ? stride_B : stride_A;
+            rocblas_int       offset_c = offset_C + (left ? i : j * ldc);
+
+            // Tensile is used for host scalars and strided matrices. Arrays of device pointers
+            // and device scalars use the batched device kernels, which copy neither to the host.
+            rocblas_status status;
+            if(!BATCHED && !device_mode)
+                status = rocblas_gemm_template<BATCHED, !BATCHED>(handle,
+                                                                  trans_x,
+                                                                  trans_y,
+                                                                  gemm_m,
+                                                                  gemm_n,
+                                                                  gemm_k,
+                                                                  alpha,
+                                                                  X,
+                                                                  offset_x,
+                                                                  ldx,
+                                                                  stride_x,
+                                                                  Y,
+                                                                  offset_y,
+                                                                  ldy,
+                                                                  stride_y,
+                                                                  one,
+                                                                  C,
+                                                                  offset_c,
+                                                                  ldc,
+                                                                  stride_C,
+                                                                  batch_count);
+            else
+                status = rocblas_gemm_batched_device_template(handle,
+                                                              trans_x,
+                                                              trans_y,
+                                                              gemm_m,
+                                                              gemm_n,
+                                                              gemm_k,
+                                                              alpha,
+                                                              X,
+                                                              offset_x,
+                                                              ldx,
+                                                              stride_x,
+                                                              Y,
+                                                              offset_y,
+                                                              ldy,
+                                                              stride_y,
+                                                              one,
+                                                              C,
+                                                              offset_c,
+                                                              ldc,
+                                                              stride_C,
+                                                              batch_count);
+            if(status != rocblas_status_success)
+                return status;
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+// B = W, where W is m x n with leading dimension m and stride m * n
+template <typename T, typename V>
+__global__ void trmm_copy_back_kernel(rocblas_int    m,
+                                      rocblas_int    n,
+                                      const T*       W,
+                                      V              Ba,
+                                      rocblas_int    offset_B,
+                                      rocblas_int    ldb,
+                                      rocblas_stride stride_B)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < m && j < n)
+    {
+        T* B = load_ptr_batch(Ba, hipBlockIdx_z, offset_B, stride_B);
+
+        B[i + ptrdiff_t(j) * ldb] = W[i + m * (j + ptrdiff_t(hipBlockIdx_z) * n)];
+    }
+}
+
+// The matrices from batch b onwards, of a strided batch or of an array of device pointers
+template <typename T>
+inline T* trmm_batch_from(T* p, rocblas_int b, rocblas_stride stride)
+{
+    return p + b * stride;
+}
+
+template <typename T>
+inline T* const* trmm_batch_from(T* const* p, rocblas_int b, rocblas_stride stride)
+{
+    return p + b;
+}
+
+/*! \brief In-place batched TRMM, B = alpha * op(A) * B or B = alpha * B * op(A).
+
+    The products are written to temporary device memory, and copied back to B. When the whole
+    batch does not fit in the device memory, it is processed in chunks of the batch which do. */
+template <bool BATCHED, typename T, typename U, typename V>
+rocblas_status rocblas_trmm_batched_template(rocblas_handle    handle,
+                                             rocblas_side      side,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation transA,
+                                             rocblas_diagonal  diag,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             const T*          alpha,
+                                             U                 A,
+                                             rocblas_int       offset_A,
+                                             rocblas_int       lda,
+                                             rocblas_stride    stride_A,
+                                             V                 B,
+                                             rocblas_int       offset_B,
+                                             rocblas_int       ldb,
+                                             rocblas_stride    stride_B,
+                                             rocblas_int       batch_count)
+{
+    // Quick return
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    rocblas_stride stride_W = rocblas_stride(m) * n;
+
+    // Halve the chunk of the batch until its temporary memory can be allocated
+    for(rocblas_int chunk = batch_count;; chunk = (chunk + 1) / 2)
+    {
+        auto mem = handle->device_malloc(sizeof(T) * stride_W * chunk,
+                                         BATCHED ? sizeof(T*) * chunk : 0,
+                                         sizeof(T));
+        if(!mem)
+        {
+            if(chunk == 1)
+                return rocblas_status_memory_error;
+            continue;
+        }
+
+        void *W, *W_array, *workspace;
+        std::tie(W, W_array, workspace) = mem;
+
+        // The batched products take C as an array of device pointers into W
+        if(BATCHED)
+            setup_batched_array<256>(handle->rocblas_stream, (T*)W, stride_W, (T**)W_array, chunk);
+        auto C = (std::conditional_t<BATCHED, T**, T*>)(BATCHED ? W_array : W);
+
+        for(rocblas_int b = 0; b < batch_count; b += chunk)
+        {
+            rocblas_int batches = std::min(chunk, batch_count - b);
+            auto        A_b     = trmm_batch_from(A, b, stride_A);
+            auto        B_b     = trmm_batch_from(B, b, stride_B);
+
+            rocblas_status status = rocblas_trmm_outofplace_template<BATCHED, T, U>(handle,
+                                                                                     side,
+                                                                                     uplo,
+                                                                                     transA,
+                                                                                     diag,
+                                                                                     m,
+                                                                                     n,
+                                                                                     alpha,
+                                                                                     A_b,
+                                                                                     offset_A,
+                                                                                     lda,
+                                                                                     stride_A,
+                                                                                     B_b,
+                                                                                     offset_B,
+                                                                                     ldb,
+                                                                                     stride_B,
+                                                                                     C,
+                                                                                     0,
+                                                                                     m,
+                                                                                     stride_W,
+                                                                                     batches,
+                                                                                     (T*)workspace);
+            if(status != rocblas_status_success)
+                return status;
+
+            dim3 grid((m - 1) / TRMM_DIM + 1, (n - 1) / TRMM_DIM + 1, batches);
+            dim3 threads(TRMM_DIM, TRMM_DIM);
+
+            hipLaunchKernelGGL((trmm_copy_back_kernel<T>),
+                               grid,
+                               threads,
+                               0,
+                               handle->rocblas_stream,
+                               m,
+                               n,
+                               (const T*)W,
+                               B_b,
+                               offset_B,
+                               ldb,
+                               stride_B);
+        }
+
+        return rocblas_status_success;
+    }
+}
@@ -0,0 +1,221 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_trmm.hpp"
+#include "utility.h"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_trmm_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_trmm_batched_name<float>[] = "rocblas_strmm_batched";
+    template <>
+    constexpr char rocblas_trmm_batched_name<double>[] = "rocblas_dtrmm_batched";
+
+    template <typename T>
+    rocblas_status rocblas_trmm_batched_impl(rocblas_handle    handle,
+                                             rocblas_side      side,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation transa,
+                                             rocblas_diagonal  diag,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             const T*          alpha,
+                                             const T* const    a[],
+                                             rocblas_int       lda,
+                                             T* const          b[],
+                                             rocblas_int       ldb,
+                                             rocblas_int       batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto side_letter   = rocblas_side_letter(side);
+            auto uplo_letter   = rocblas_fill_letter(uplo);
+            auto transa_letter = rocblas_transpose_letter(transa);
+            auto diag_letter   = rocblas_diag_letter(diag);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_trmm_batched_name<T>,
+                              side,
+                              uplo,
+                              transa,
+                              diag,
+                              m,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              a,
+                              lda,
+                              b,
+                              ldb,
+                              batch_count);
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                    log_bench(handle,
+                              "./rocblas-bench -f trmm_batched -r",
+                              rocblas_precision_string<T>,
+                              "--side",
+                              side_letter,
+                              "--uplo",
+                              uplo_letter,
+                              "--transposeA",
+                              transa_letter,
+                              "--diag",
+                              diag_letter,
+                              "-m",
+                              m,
+                              "-n",
+                              n,
+                              LOG_BENCH_SCALAR_VALUE(alpha),
+                              "--lda",
+                              lda,
+                              "--ldb",
+                              ldb,
+                              "--batch_count",
+                              batch_count);
+            }
+            else
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                    log_trace(handle,
+                              rocblas_trmm_batched_name<T>,
+                              side,
+                              uplo,
+                              transa,
+                              diag,
+                              m,
+                              n,
+                              alpha,
+                              a,
+                              lda,
+                              b,
+                              ldb,
+                              batch_count);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_trmm_batched_name<T>,
+                            "side",
+                            side_letter,
+                            "uplo",
+                            uplo_letter,
+                            "transa",
+                            transa_letter,
+                            "diag",
+                            diag_letter,
+                            "m",
+                            m,
+                            "n",
+                            n,
+                            "lda",
+                            lda,
+                            "ldb",
+                            ldb,
+                            "batch_count",
+                            batch_count);
+        }
+
+        rocblas_int nrowa = rocblas_side_left == side ? m : n;
+
+        if(m < 0 || n < 0 || lda < nrowa || lda < 1 || ldb < m || ldb < 1 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !batch_count)
+        {
+            if(handle->is_device_memory_size_query())
+                return rocblas_status_size_unchanged;
+            else
+                return rocblas_status_success;
+        }
+
+        if(!a || !b || !alpha)
+            return rocblas_status_invalid_pointer;
+
+        // The products are written to temporary memory and copied back to B, through an array
+        // of pointers to it. With less device memory, the batch is processed in chunks. One more
+        // element holds beta = 1 for the GEMMs in device pointer mode.
+        size_t dev_bytes     = size_t(m) * n * batch_count * sizeof(T);
+        size_t dev_ptr_bytes = sizeof(T*) * batch_count;
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes, dev_ptr_bytes, sizeof(T));
+
+        return rocblas_trmm_batched_template<true>(handle,
+                                                   side,
+                                                   uplo,
+                                                   transa,
+                                                   diag,
+                                                   m,
+                                                   n,
+                                                   alpha,
+                                                   a,
+                                                   0,
+                                                   lda,
+                                                   0,
+                                                   b,
+                                                   0,
+                                                   ldb,
+                                                   0,
+                                                   batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_strmm_batched(rocblas_handle     handle,
+                                     rocblas_side       side,
+                                     rocblas_fill       uplo,
+                                     rocblas_operation  transa,
+                                     rocblas_diagonal   diag,
+                                     rocblas_int        m,
+                                     rocblas_int        n,
+                                     const float*       alpha,
+                                     const float* const a[],
+                                     rocblas_int        lda,
+                                     float* const       b[],
+                                     rocblas_int        ldb,
+                                     rocblas_int        batch_count)
+{
+    return rocblas_trmm_batched_impl(
+        handle, side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb, batch_count);
+}
+
+rocblas_status rocblas_dtrmm_batched(rocblas_handle      handle,
+                                     rocblas_side        side,
+                                     rocblas_fill        uplo,
+                                     rocblas_operation   transa,
+                                     rocblas_diagonal    diag,
+                                     rocblas_int         m,
+                                     rocblas_int         n,
+                                     const double*       alpha,
+                                     const double* const a[],
+                                     rocblas_int         lda,
+                                     double* const       b[],
+                                     rocblas_int         ldb,
+                                     rocblas_int         batch_count)
+{
+    return rocblas_trmm_batched_impl(
+        handle, side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb, batch_count);
+}
+
+} // extern "C"
@@ -11,8 +11,26 @@
 #include "utility.h"
 #include <algorithm>
 #include <cstdio>
+#include <new>
 #include <tuple>
 
+/*
+ * Inverted diagonal blocks of a triangular matrix A, created by rocblas_trsm_prepare_impl.
+ * A itself is not copied, since the solves still read its off-diagonal blocks.
+ */
+struct _rocblas_trsm_factor
+{
+    rocblas_datatype type;
+    rocblas_side     side;
+    rocblas_fill     uplo;
+    rocblas_diagonal diag;
+    rocblas_int      k;
+    const void*      A;
+    rocblas_int      lda;
+    void*            invA;
+    rocblas_int      invA_size;
+};
+
 namespace
 {
     // Shared memory usuage is (128/2)^2 * sizeof(float) = 32K. LDS is 64K per CU. Theoretically
@@ -27,6 +45,20 @@ namespace
     template <>
     constexpr char rocblas_trsm_name<double>[] = "rocblas_dtrsm";
 
+    template <typename>
+    constexpr char rocblas_trsm_prepare_name[] = "unknown";
+    template <>
+    constexpr char rocblas_trsm_prepare_name<float>[] = "rocblas_strsm_prepare";
+    template <>
+    constexpr char rocblas_trsm_prepare_name<double>[] = "rocblas_dtrsm_prepare";
+
+    template <typename>
+    constexpr char rocblas_trsm_solve_name[] = "unknown";
+    template <>
+    constexpr char rocblas_trsm_solve_name<float>[] = "rocblas_strsm_solve";
+    template <>
+    constexpr char rocblas_trsm_solve_name<double>[] = "rocblas_dtrsm_solve";
+
     /* ============================================================================================ */
 
     template <rocblas_int BLOCK, typename T>
@@ -171,58 +203,180 @@ namespace
         if(ldb < m)
             return rocblas_status_invalid_size;
 
-        //////////////////////
-        // MEMORY MANAGEMENT//
-        //////////////////////
-        void*          mem_x_temp;
-        void*          mem_x_temp_arr;
-        void*          mem_invA;
-        void*          mem_invA_arr;
-        bool           optimal_mem;
-        rocblas_status perf_status = rocblas_trsm_template_mem<BLOCK, false, T>(handle,
-                                                                                side,
-                                                                                m,
-                                                                                n,
-                                                                                1,
-                                                                                mem_x_temp,
-                                                                                mem_x_temp_arr,
-                                                                                mem_invA,
-                                                                                mem_invA_arr,
-                                                                                supplied_invA,
-                                                                                supplied_invA_size);
-
-        // If this was a device memory query or an error occurred, return status
-        if(perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
-            return perf_status;
-
-        optimal_mem = perf_status == rocblas_status_success;
-
-        rocblas_status status = rocblas_trsm_template<BLOCK, false, T>(handle,
-                                                                       side,
-                                                                       uplo,
-                                                                       transA,
-                                                                       diag,
-                                                                       m,
-                                                                       n,
-                                                                       alpha,
-                                                                       A,
-                                                                       0,
-                                                                       lda,
-                                                                       0,
-                                                                       B,
-                                                                       0,
-                                                                       ldb,
-                                                                       0,
-                                                                       1,
-                                                                       optimal_mem,
-                                                                       mem_x_temp,
-                                                                       mem_x_temp_arr,
-                                                                       mem_invA,
-                                                                       mem_invA_arr,
-                                                                       supplied_invA,
-                                                                       supplied_invA_size);
-
-        return status != rocblas_status_success ? status : perf_status;
+        return rocblas_trsm_solve_template<BLOCK>(handle,
+                                                  side,
+                                                  uplo,
+                                                  transA,
+                                                  diag,
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  B,
+                                                  ldb,
+                                                  supplied_invA,
+                                                  supplied_invA_size);
+    }
+
+    /* ============================================================================================ */
+
+    template <rocblas_int BLOCK, typename T>
+    rocblas_status rocblas_trsm_prepare_impl(rocblas_handle       handle,
+                                             rocblas_side         side,
+                                             rocblas_fill         uplo,
+                                             rocblas_diagonal     diag,
+                                             rocblas_int          k,
+                                             const T*             A,
+                                             rocblas_int          lda,
+                                             rocblas_trsm_factor* factor)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(!handle->is_device_memory_size_query())
+        {
+            auto layer_mode = handle->layer_mode;
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(
+                    handle, rocblas_trsm_prepare_name<T>, side, uplo, diag, k, A, lda, factor);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_trsm_prepare_name<T>,
+                            "side",
+                            rocblas_side_letter(side),
+                            "uplo",
+                            rocblas_fill_letter(uplo),
+                            "diag",
+                            rocblas_diag_letter(diag),
+                            "k",
+                            k,
+                            "lda",
+                            lda);
+        }
+
+        if(side != rocblas_side_left && side != rocblas_side_right)
+            return rocblas_status_not_implemented;
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(k < 0 || lda < k || lda < 1)
+            return rocblas_status_invalid_size;
+        if(!factor || (k && !A))
+            return rocblas_status_invalid_pointer;
+
+        // Temporary memory for inverting the diagonal blocks
+        size_t c_temp_bytes = k ? rocblas_trtri_trsm_temp_els<BLOCK>(k) * sizeof(T) : 0;
+
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(c_temp_bytes);
+
+        auto mem = handle->device_malloc(c_temp_bytes);
+        if(!mem)
+            return rocblas_status_memory_error;
+
+        // The factor owns invA, which outlives the handle's device memory
+        auto f = new(std::nothrow) _rocblas_trsm_factor{
+            rocblas_datatype_from_type<T>, side, uplo, diag, k, A, lda, nullptr, BLOCK * k};
+        if(!f)
+            return rocblas_status_memory_error;
+
+        if(k && (hipMalloc)(&f->invA, sizeof(T) * f->invA_size) != hipSuccess)
+        {
+            delete f;
+            return rocblas_status_memory_error;
+        }
+
+        rocblas_status status = rocblas_trtri_trsm_template<BLOCK, false, T>(
+            handle, (T*)mem, uplo, diag, k, A, 0, lda, 0, (T*)f->invA, 0, 0, 1);
+        if(status != rocblas_status_success)
+        {
+            (hipFree)(f->invA);
+            delete f;
+            return status;
+        }
+
+        *factor = f;
+        return rocblas_status_success;
+    }
+
+    /* ============================================================================================ */
+
+    template <rocblas_int BLOCK, typename T>
+    rocblas_status rocblas_trsm_solve_impl(rocblas_handle      handle,
+                                           rocblas_trsm_factor factor,
+                                           rocblas_operation   transA,
+                                           rocblas_int         m,
+                                           rocblas_int         n,
+                                           const T*            alpha,
+                                           T*                  B,
+                                           rocblas_int         ldb)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(!handle->is_device_memory_size_query())
+        {
+            auto layer_mode = handle->layer_mode;
+            if(layer_mode & rocblas_layer_mode_log_trace)
+            {
+                if(handle->pointer_mode == rocblas_pointer_mode_host)
+                    log_trace(handle,
+                              rocblas_trsm_solve_name<T>,
+                              factor,
+                              transA,
+                              m,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              B,
+                              ldb);
+                else
+                    log_trace(
+                        handle, rocblas_trsm_solve_name<T>, factor, transA, m, n, alpha, B, ldb);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_trsm_solve_name<T>,
+                            "transA",
+                            rocblas_transpose_letter(transA),
+                            "m",
+                            m,
+                            "n",
+                            n,
+                            "ldb",
+                            ldb);
+        }
+
+        // The factor must have been prepared for the same precision
+        if(!factor || factor->type != rocblas_datatype_from_type<T>)
+            return rocblas_status_invalid_pointer;
+        if(m < 0 || n < 0 || ldb < m || ldb < 1
+           || factor->k != (factor->side == rocblas_side_left ? m : n))
+            return rocblas_status_invalid_size;
+
+        // quick return if possible.
+        // return status_size_unchanged if device memory size query
+        if(!m || !n)
+            return handle->is_device_memory_size_query() ? rocblas_status_size_unchanged
+                                                         : rocblas_status_success;
+        if(!alpha || !B)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_trsm_solve_template<BLOCK>(handle,
+                                                  factor->side,
+                                                  factor->uplo,
+                                                  transA,
+                                                  factor->diag,
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  static_cast<const T*>(factor->A),
+                                                  factor->lda,
+                                                  B,
+                                                  ldb,
+                                                  static_cast<const T*>(factor->invA),
+                                                  factor->invA_size);
     }
 
 }
@@ -324,4 +478,100 @@ rocblas_status rocblas_trsm_ex(rocblas_handle    handle,
     }
 }
 
+rocblas_status rocblas_strsm_prepare(rocblas_handle       handle,
+                                     rocblas_side         side,
+                                     rocblas_fill         uplo,
+                                     rocblas_diagonal     diag,
+                                     rocblas_int          k,
+                                     const float*         A,
+                                     rocblas_int          lda,
+                                     rocblas_trsm_factor* factor)
+{
+    return rocblas_trsm_prepare_impl<STRSM_BLOCK>(handle, side, uplo, diag, k, A, lda, factor);
+}
+
+rocblas_status rocblas_dtrsm_prepare(rocblas_handle       handle,
+                                     rocblas_side         side,
+                                     rocblas_fill         uplo,
+                                     rocblas_diagonal     diag,
+                                     rocblas_int          k,
+                                     const double*        A,
+                                     rocblas_int          lda,
+                                     rocblas_trsm_factor* factor)
+{
+    return rocblas_trsm_prepare_impl<DTRSM_BLOCK>(handle, side, uplo, diag, k, A, lda, factor);
+}
+
+rocblas_status rocblas_strsm_solve(rocblas_handle      handle,
+                                   rocblas_trsm_factor factor,
+                                   rocblas_operation   transA,
+                                   rocblas_int         m,
+                                   rocblas_int         n,
+                                   const float*        alpha,
+                                   float*              B,
+                                   rocblas_int         ldb)
+{
+    return rocblas_trsm_solve_impl<STRSM_BLOCK>(handle, factor, transA, m, n, alpha, B, ldb);
+}
+
+rocblas_status rocblas_dtrsm_solve(rocblas_handle      handle,
+                                   rocblas_trsm_factor factor,
+                                   rocblas_operation   transA,
+                                   rocblas_int         m,
+                                   rocblas_int         n,
+                                   const double*       alpha,
+                                   double*             B,
+                                   rocblas_int         ldb)
+{
+    return rocblas_trsm_solve_impl<DTRSM_BLOCK>(handle, factor, transA, m, n, alpha, B, ldb);
+}
+
+rocblas_status rocblas_destroy_trsm_factor(rocblas_trsm_factor factor)
+{
+    if(!factor)
+        return rocblas_status_invalid_pointer;
+
+    // hipFree synchronizes with any solves still using invA
+    hipError_t err = (hipFree)(factor->invA);
+    delete factor;
+    return err == hipSuccess ? rocblas_status_success : rocblas_status_memory_error;
+}
+
+rocblas_status rocblas_trsm_workspace_size(rocblas_handle   handle,
+                                           rocblas_side     side,
+                                           rocblas_int      m,
+                                           rocblas_int      n,
+                                           rocblas_int      batch_count,
+                                           rocblas_datatype compute_type,
+                                           size_t*          minimum_size,
+                                           size_t*          optimal_size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(side != rocblas_side_left && side != rocblas_side_right)
+        return rocblas_status_not_implemented;
+    if(m < 0 || n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(!minimum_size || !optimal_size)
+        return rocblas_status_invalid_pointer;
+
+    // The sizes of the batched functions, which include the arrays of pointers, are enough
+    // for all of the TRSM functions
+    switch(compute_type)
+    {
+    case rocblas_datatype_f64_r:
+        rocblas_trsm_workspace_size_template<DTRSM_BLOCK, true, double>(
+            side, m, n, batch_count, false, minimum_size, optimal_size);
+        return rocblas_status_success;
+
+    case rocblas_datatype_f32_r:
+        rocblas_trsm_workspace_size_template<STRSM_BLOCK, true, float>(
+            side, m, n, batch_count, false, minimum_size, optimal_size);
+        return rocblas_status_success;
+
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+
 } // extern "C"
@@ -6,6 +6,7 @@
 
 #include "../blas_ex/rocblas_gemm_ex.hpp"
 #include "handle.h"
+#include "logging.h"
 #include "rocblas.h"
 #include "trtri_trsm.hpp"
 #include "utility.h"
@@ -86,6 +87,290 @@ namespace
                            offset_dst);
     }
 
+    // B = alpha * B, with alpha read on the device. alpha == 0 sets B to 0.
+    template <typename T, typename V>
+    __global__ void scale_matrix_trsm(rocblas_int    rows,
+                                      rocblas_int    cols,
+                                      const T*       alpha,
+                                      V              b,
+                                      rocblas_int    ldb,
+                                      rocblas_stride stride_b,
+                                      rocblas_int    offset_b)
+    {
+        T* xb = load_ptr_batch(b, hipBlockIdx_z, offset_b, stride_b);
+
+        size_t tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        size_t ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+        if(tx < rows && ty < cols)
+        {
+            T& x = xb[tx + ldb * ty];
+            x    = *alpha == 0 ? T(0) : *alpha * x;
+        }
+    }
+
+    /* ===============scale helper============================================ */
+    template <typename T, typename V>
+    void scale_block_unit(rocblas_handle handle,
+                          rocblas_int    m,
+                          rocblas_int    n,
+                          const T*       alpha,
+                          V              dst,
+                          rocblas_int    dst_ld,
+                          rocblas_stride dst_stride,
+                          rocblas_int    batch_count,
+                          rocblas_int    offset_dst = 0)
+    {
+        rocblas_int blocksX = (m - 1) / 128 + 1; // parameters for device kernel
+        rocblas_int blocksY = (n - 1) / 8 + 1;
+        dim3        grid(blocksX, blocksY, batch_count);
+        dim3        threads(128, 8);
+
+        hipLaunchKernelGGL(scale_matrix_trsm<T>,
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           m,
+                           n,
+                           alpha,
+                           dst,
+                           dst_ld,
+                           dst_stride,
+                           offset_dst);
+    }
+
+    /* ===============small trsm=============================================== */
+
+    // Largest m and n solved by the fused kernel, which needs no temporary device memory
+    constexpr rocblas_int TRSM_SMALL_DIM   = 64;
+    constexpr rocblas_int TRSM_SMALL_DIM_Y = 8;
+
+    inline bool rocblas_trsm_small(rocblas_int m, rocblas_int n)
+    {
+        return m <= TRSM_SMALL_DIM && n <= TRSM_SMALL_DIM;
+    }
+
+    // Solves one small system per workgroup by substitution. The system is written as
+    // M X = alpha B with M = op(A) on the left side, and M = op(A)^T with X and B transposed on
+    // the right side. M is held in LDS and thread (tx, ty) holds row tx of X, for the right hand
+    // sides ty, ty + DIM_Y, ..., in registers. Each step of the substitution solves for one row
+    // of X, which is broadcast through LDS.
+    template <rocblas_int DIM, rocblas_int DIM_Y, typename T, typename U, typename V>
+    __global__ void trsm_small_kernel(rocblas_side      side,
+                                      rocblas_fill      uplo,
+                                      rocblas_operation transA,
+                                      rocblas_diagonal  diag,
+                                      rocblas_int       m,
+                                      rocblas_int       n,
+                                      T                 alpha,
+                                      U                 Aa,
+                                      rocblas_int       offset_A,
+                                      rocblas_int       lda,
+                                      rocblas_stride    stride_A,
+                                      V                 Ba,
+                                      rocblas_int       offset_B,
+                                      rocblas_int       ldb,
+                                      rocblas_stride    stride_B)
+    {
+        constexpr rocblas_int NC = DIM / DIM_Y;
+
+        __shared__ T sA[DIM][DIM]; // sA[j][i] = M[i][j]
+        __shared__ T sX[2][DIM]; // solved row of X, double buffered
+
+        const T* A = load_ptr_batch(Aa, hipBlockIdx_z, offset_A, stride_A);
+        T*       B = load_ptr_batch(Ba, hipBlockIdx_z, offset_B, stride_B);
+
+        rocblas_int tx      = hipThreadIdx_x;
+        rocblas_int ty      = hipThreadIdx_y;
+        bool        left    = side == rocblas_side_left;
+        bool        notrans = transA == rocblas_operation_none;
+        rocblas_int k       = left ? m : n;
+        rocblas_int nrhs    = left ? n : m;
+        bool        lower   = (uplo == rocblas_fill_lower) == (left == notrans);
+        bool        trans   = left != notrans; // M[i][j] = A[j + i * lda]
+        bool        conjA   = transA == rocblas_operation_conjugate_transpose;
+
+        if(tx < k)
+            for(rocblas_int j = ty; j < k; j += DIM_Y)
+            {
+                T a       = trans ? A[j + ptrdiff_t(tx) * lda] : A[tx + ptrdiff_t(j) * lda];
+                sA[j][tx] = conjA ? conj(a) : a;
+            }
+
+        T x[NC];
+        for(rocblas_int c = 0; c < NC; c++)
+        {
+            rocblas_int r = ty + c * DIM_Y;
+            x[c]          = 0;
+            if(tx < k && r < nrhs && alpha != 0)
+                x[c] = alpha * (left ? B[tx + ptrdiff_t(r) * ldb] : B[r + ptrdiff_t(tx) * ldb]);
+        }
+
+        __syncthreads();
+
+        for(rocblas_int s = 0; s < k; s++)
+        {
+            rocblas_int j  = lower ? s : k - 1 - s;
+            T*          xj = sX[s & 1];
+
+            if(tx == j)
+                for(rocblas_int c = 0; c < NC; c++)
+                {
+                    rocblas_int r = ty + c * DIM_Y;
+                    if(r < nrhs)
+                    {
+                        if(diag == rocblas_diagonal_non_unit)
+                            x[c] /= sA[j][j];
+                        xj[r] = x[c];
+                    }
+                }
+
+            // One barrier per step suffices, since the buffer written in the next step was last
+            // read before this barrier
+            __syncthreads();
+
+            if(tx < k && (lower ? tx > j : tx < j))
+                for(rocblas_int c = 0; c < NC; c++)
+                {
+                    rocblas_int r = ty + c * DIM_Y;
+                    if(r < nrhs)
+                        x[c] -= sA[j][tx] * xj[r];
+                }
+        }
+
+        if(tx < k)
+            for(rocblas_int c = 0; c < NC; c++)
+            {
+                rocblas_int r = ty + c * DIM_Y;
+                if(r < nrhs)
+                    (left ? B[tx + ptrdiff_t(r) * ldb] : B[r + ptrdiff_t(tx) * ldb]) = x[c];
+            }
+    }
+
+    // alpha must be a host value
+    template <typename T, typename U, typename V>
+    rocblas_status rocblas_trsm_small_template(rocblas_handle    handle,
+                                               rocblas_side      side,
+                                               rocblas_fill      uplo,
+                                               rocblas_operation transA,
+                                               rocblas_diagonal  diag,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               T                 alpha,
+                                               U                 A,
+                                               rocblas_int       offset_A,
+                                               rocblas_int       lda,
+                                               rocblas_stride    stride_A,
+                                               V                 B,
+                                               rocblas_int       offset_B,
+                                               rocblas_int       ldb,
+                                               rocblas_stride    stride_B,
+                                               rocblas_int       batch_count)
+    {
+        if(!m || !n)
+            return rocblas_status_success;
+
+        dim3 grid(1, 1, batch_count);
+        dim3 threads(TRSM_SMALL_DIM, TRSM_SMALL_DIM_Y);
+
+        hipLaunchKernelGGL((trsm_small_kernel<TRSM_SMALL_DIM, TRSM_SMALL_DIM_Y, T, U, V>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           alpha,
+                           A,
+                           offset_A,
+                           lda,
+                           stride_A,
+                           B,
+                           offset_B,
+                           ldb,
+                           stride_B);
+
+        return rocblas_status_success;
+    }
+
+    /* ===============gemm helper============================================= */
+
+    // GEMM used by TRSM. The batched gemm reads the arrays of pointers on the device, so that
+    // TRSM does not synchronize with the host. alpha and beta must be host pointers.
+    template <bool BATCHED, typename T, typename U, typename V>
+    rocblas_status rocblas_trsm_gemm_template(rocblas_handle    handle,
+                                              rocblas_operation trans_a,
+                                              rocblas_operation trans_b,
+                                              rocblas_int       m,
+                                              rocblas_int       n,
+                                              rocblas_int       k,
+                                              const T*          alpha,
+                                              const U*          A,
+                                              rocblas_int       offset_a,
+                                              rocblas_int       ld_a,
+                                              rocblas_stride    stride_a,
+                                              const U*          B,
+                                              rocblas_int       offset_b,
+                                              rocblas_int       ld_b,
+                                              rocblas_stride    stride_b,
+                                              const T*          beta,
+                                              V*                C,
+                                              rocblas_int       offset_c,
+                                              rocblas_int       ld_c,
+                                              rocblas_stride    stride_c,
+                                              rocblas_int       batch_count)
+    {
+        if(BATCHED)
+            return rocblas_gemm_batched_device_template(handle,
+                                                        trans_a,
+                                                        trans_b,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        alpha,
+                                                        A,
+                                                        offset_a,
+                                                        ld_a,
+                                                        stride_a,
+                                                        B,
+                                                        offset_b,
+                                                        ld_b,
+                                                        stride_b,
+                                                        beta,
+                                                        C,
+                                                        offset_c,
+                                                        ld_c,
+                                                        stride_c,
+                                                        batch_count);
+        else
+            return rocblas_gemm_template<BATCHED, !BATCHED>(handle,
+                                                            trans_a,
+                                                            trans_b,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            offset_a,
+                                                            ld_a,
+                                                            stride_a,
+                                                            B,
+                                                            offset_b,
+                                                            ld_b,
+                                                            stride_b,
+                                                            beta,
+                                                            C,
+                                                            offset_c,
+                                                            ld_c,
+                                                            stride_c,
+                                                            batch_count);
+    }
+
     /* ===============left==================================================== */
 
     template <rocblas_int BLOCK, bool BATCHED, typename T, typename U, typename V>
@@ -121,103 +406,103 @@ namespace
             {
                 // left, lower no-transpose
                 jb = min(BLOCK, m);
-                rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                         transA,
-                                                         transB,
-                                                         jb,
-                                                         n,
-                                                         jb,
-                                                         alpha,
-                                                         invA,
-                                                         offset_invAin,
-                                                         BLOCK,
-                                                         stride_invA,
-                                                         (U)B,
-                                                         offset_Bin,
-                                                         ldb,
-                                                         stride_B,
-                                                         &zero<T>,
-                                                         X,
-                                                         0,
-                                                         m,
-                                                         stride_X,
-                                                         batch_count);
+                rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                    transA,
+                                                    transB,
+                                                    jb,
+                                                    n,
+                                                    jb,
+                                                    alpha,
+                                                    invA,
+                                                    offset_invAin,
+                                                    BLOCK,
+                                                    stride_invA,
+                                                    (U)B,
+                                                    offset_Bin,
+                                                    ldb,
+                                                    stride_B,
+                                                    &zero<T>,
+                                                    X,
+                                                    0,
+                                                    m,
+                                                    stride_X,
+                                                    batch_count);
 
                 if(BLOCK < m)
                 {
-                    rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                             transA,
-                                                             transB,
-                                                             m - BLOCK,
-                                                             n,
-                                                             BLOCK,
-                                                             &negative_one<T>,
-                                                             A,
-                                                             BLOCK + offset_Ain,
-                                                             lda,
-                                                             stride_A,
-                                                             (U)X,
-                                                             0,
-                                                             m,
-                                                             stride_X,
-                                                             alpha,
-                                                             B,
-                                                             BLOCK + offset_Bin,
-                                                             ldb,
-                                                             stride_B,
-                                                             batch_count);
+                    rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                        transA,
+                                                        transB,
+                                                        m - BLOCK,
+                                                        n,
+                                                        BLOCK,
+                                                        &negative_one<T>,
+                                                        A,
+                                                        BLOCK + offset_Ain,
+                                                        lda,
+                                                        stride_A,
+                                                        (U)X,
+                                                        0,
+                                                        m,
+                                                        stride_X,
+                                                        alpha,
+                                                        B,
+                                                        BLOCK + offset_Bin,
+                                                        ldb,
+                                                        stride_B,
+                                                        batch_count);
                     // remaining blocks
                     for(i = BLOCK; i < m; i += BLOCK)
                     {
                         jb = min(m - i, BLOCK);
 
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transA,
-                                                                 transB,
-                                                                 jb,
-                                                                 n,
-                                                                 jb,
-                                                                 &one<T>,
-                                                                 invA,
-                                                                 i * BLOCK + offset_invAin,
-                                                                 BLOCK,
-                                                                 stride_invA,
-                                                                 (U)B,
-                                                                 i + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 &zero<T>,
-                                                                 X,
-                                                                 i,
-                                                                 m,
-                                                                 stride_X,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transA,
+                                                            transB,
+                                                            jb,
+                                                            n,
+                                                            jb,
+                                                            &one<T>,
+                                                            invA,
+                                                            i * BLOCK + offset_invAin,
+                                                            BLOCK,
+                                                            stride_invA,
+                                                            (U)B,
+                                                            i + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            &zero<T>,
+                                                            X,
+                                                            i,
+                                                            m,
+                                                            stride_X,
+                                                            batch_count);
                         if(i + BLOCK
                            >= m) // this condition is not necessary at all and can be changed
                             // as if (i+BLOCK<m)
                             break;
 
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transA,
-                                                                 transB,
-                                                                 m - i - BLOCK,
-                                                                 n,
-                                                                 BLOCK,
-                                                                 &negative_one<T>,
-                                                                 A,
-                                                                 i + BLOCK + i * lda + offset_Ain,
-                                                                 lda,
-                                                                 stride_A,
-                                                                 (U)X,
-                                                                 i,
-                                                                 m,
-                                                                 stride_X,
-                                                                 &one<T>,
-                                                                 B,
-                                                                 i + BLOCK + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transA,
+                                                            transB,
+                                                            m - i - BLOCK,
+                                                            n,
+                                                            BLOCK,
+                                                            &negative_one<T>,
+                                                            A,
+                                                            i + BLOCK + i * lda + offset_Ain,
+                                                            lda,
+                                                            stride_A,
+                                                            (U)X,
+                                                            i,
+                                                            m,
+                                                            stride_X,
+                                                            &one<T>,
+                                                            B,
+                                                            i + BLOCK + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            batch_count);
                     }
                 }
 
@@ -240,100 +525,100 @@ namespace
                 i  = m - jb;
 
                 // if m=n=35=lda=ldb, BLOCK =32, then jb = 3, i = 32; {3, 35, 3, 32, 35, 35}
-                rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                         transA,
-                                                         transB,
-                                                         jb,
-                                                         n,
-                                                         jb,
-                                                         alpha,
-                                                         invA,
-                                                         i * BLOCK + offset_invAin,
-                                                         BLOCK,
-                                                         stride_invA,
-                                                         (U)B,
-                                                         i + offset_Bin,
-                                                         ldb,
-                                                         stride_B,
-                                                         &zero<T>,
-                                                         X,
-                                                         i,
-                                                         m,
-                                                         stride_X,
-                                                         batch_count);
+                rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                    transA,
+                                                    transB,
+                                                    jb,
+                                                    n,
+                                                    jb,
+                                                    alpha,
+                                                    invA,
+                                                    i * BLOCK + offset_invAin,
+                                                    BLOCK,
+                                                    stride_invA,
+                                                    (U)B,
+                                                    i + offset_Bin,
+                                                    ldb,
+                                                    stride_B,
+                                                    &zero<T>,
+                                                    X,
+                                                    i,
+                                                    m,
+                                                    stride_X,
+                                                    batch_count);
 
                 if(i - BLOCK >= 0)
                 {
-                    rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                             transA,
-                                                             transB,
-                                                             i,
-                                                             n,
-                                                             jb,
-                                                             &negative_one<T>,
-                                                             A,
-                                                             i * lda + offset_Ain,
-                                                             lda,
-                                                             stride_A,
-                                                             (U)X,
-                                                             i,
-                                                             m,
-                                                             stride_X,
-                                                             alpha,
-                                                             B,
-                                                             offset_Bin,
-                                                             ldb,
-                                                             stride_B,
-                                                             batch_count);
+                    rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                        transA,
+                                                        transB,
+                                                        i,
+                                                        n,
+                                                        jb,
+                                                        &negative_one<T>,
+                                                        A,
+                                                        i * lda + offset_Ain,
+                                                        lda,
+                                                        stride_A,
+                                                        (U)X,
+                                                        i,
+                                                        m,
+                                                        stride_X,
+                                                        alpha,
+                                                        B,
+                                                        offset_Bin,
+                                                        ldb,
+                                                        stride_B,
+                                                        batch_count);
 
                     // remaining blocks
                     for(i = m - jb - BLOCK; i >= 0; i -= BLOCK)
                     {
                         //{32, 35, 32, 32, 35, 35}
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transA,
-                                                                 transB,
-                                                                 BLOCK,
-                                                                 n,
-                                                                 BLOCK,
-                                                                 &one<T>,
-                                                                 invA,
-                                                                 i * BLOCK + offset_invAin,
-                                                                 BLOCK,
-                                                                 stride_invA,
-                                                                 (U)B,
-                                                                 i + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 &zero<T>,
-                                                                 X,
-                                                                 i,
-                                                                 m,
-                                                                 stride_X,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transA,
+                                                            transB,
+                                                            BLOCK,
+                                                            n,
+                                                            BLOCK,
+                                                            &one<T>,
+                                                            invA,
+                                                            i * BLOCK + offset_invAin,
+                                                            BLOCK,
+                                                            stride_invA,
+                                                            (U)B,
+                                                            i + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            &zero<T>,
+                                                            X,
+                                                            i,
+                                                            m,
+                                                            stride_X,
+                                                            batch_count);
                         if(i - BLOCK < 0)
                             break;
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transA,
-                                                                 transB,
-                                                                 i,
-                                                                 n,
-                                                                 BLOCK,
-                                                                 &negative_one<T>,
-                                                                 A,
-                                                                 i * lda + offset_Ain,
-                                                                 lda,
-                                                                 stride_A,
-                                                                 (U)X,
-                                                                 i,
-                                                                 m,
-                                                                 stride_X,
-                                                                 &one<T>,
-                                                                 B,
-                                                                 offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transA,
+                                                            transB,
+                                                            i,
+                                                            n,
+                                                            BLOCK,
+                                                            &negative_one<T>,
+                                                            A,
+                                                            i * lda + offset_Ain,
+                                                            lda,
+                                                            stride_A,
+                                                            (U)X,
+                                                            i,
+                                                            m,
+                                                            stride_X,
+                                                            &one<T>,
+                                                            B,
+                                                            offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            batch_count);
                     }
                 }
             }
@@ -345,98 +630,98 @@ namespace
                 // left, lower transpose
                 jb = (m % BLOCK == 0) ? BLOCK : (m % BLOCK);
                 i  = m - jb;
-                rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                         transA,
-                                                         transB,
-                                                         jb,
-                                                         n,
-                                                         jb,
-                                                         alpha,
-                                                         invA,
-                                                         i * BLOCK + offset_invAin,
-                                                         BLOCK,
-                                                         stride_invA,
-                                                         (U)B,
-                                                         i + offset_Bin,
-                                                         ldb,
-                                                         stride_B,
-                                                         &zero<T>,
-                                                         X,
-                                                         i,
-                                                         m,
-                                                         stride_X,
-                                                         batch_count);
+                rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                    transA,
+                                                    transB,
+                                                    jb,
+                                                    n,
+                                                    jb,
+                                                    alpha,
+                                                    invA,
+                                                    i * BLOCK + offset_invAin,
+                                                    BLOCK,
+                                                    stride_invA,
+                                                    (U)B,
+                                                    i + offset_Bin,
+                                                    ldb,
+                                                    stride_B,
+                                                    &zero<T>,
+                                                    X,
+                                                    i,
+                                                    m,
+                                                    stride_X,
+                                                    batch_count);
                 if(i - BLOCK >= 0)
                 {
-                    rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                             transA,
-                                                             transB,
-                                                             i,
-                                                             n,
-                                                             jb,
-                                                             &negative_one<T>,
-                                                             A,
-                                                             i + offset_Ain,
-                                                             lda,
-                                                             stride_A,
-                                                             (U)X,
-                                                             i,
-                                                             m,
-                                                             stride_X,
-                                                             alpha,
-                                                             B,
-                                                             offset_Bin,
-                                                             ldb,
-                                                             stride_B,
-                                                             batch_count);
+                    rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                        transA,
+                                                        transB,
+                                                        i,
+                                                        n,
+                                                        jb,
+                                                        &negative_one<T>,
+                                                        A,
+                                                        i + offset_Ain,
+                                                        lda,
+                                                        stride_A,
+                                                        (U)X,
+                                                        i,
+                                                        m,
+                                                        stride_X,
+                                                        alpha,
+                                                        B,
+                                                        offset_Bin,
+                                                        ldb,
+                                                        stride_B,
+                                                        batch_count);
 
                     // remaining blocks
                     for(i = m - jb - BLOCK; i >= 0; i -= BLOCK)
                     {
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transA,
-                                                                 transB,
-                                                                 BLOCK,
-                                                                 n,
-                                                                 BLOCK,
-                                                                 &one<T>,
-                                                                 invA,
-                                                                 i * BLOCK + offset_invAin,
-                                                                 BLOCK,
-                                                                 stride_invA,
-                                                                 (U)B,
-                                                                 i + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 &zero<T>,
-                                                                 X,
-                                                                 i,
-                                                                 m,
-                                                                 stride_X,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transA,
+                                                            transB,
+                                                            BLOCK,
+                                                            n,
+                                                            BLOCK,
+                                                            &one<T>,
+                                                            invA,
+                                                            i * BLOCK + offset_invAin,
+                                                            BLOCK,
+                                                            stride_invA,
+                                                            (U)B,
+                                                            i + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            &zero<T>,
+                                                            X,
+                                                            i,
+                                                            m,
+                                                            stride_X,
+                                                            batch_count);
                         if(i - BLOCK < 0)
                             break;
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transA,
-                                                                 transB,
-                                                                 i,
-                                                                 n,
-                                                                 BLOCK,
-                                                                 &negative_one<T>,
-                                                                 A,
-                                                                 i + offset_Ain,
-                                                                 lda,
-                                                                 stride_A,
-                                                                 (U)X,
-                                                                 i,
-                                                                 m,
-                                                                 stride_X,
-                                                                 &one<T>,
-                                                                 B,
-                                                                 offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transA,
+                                                            transB,
+                                                            i,
+                                                            n,
+                                                            BLOCK,
+                                                            &negative_one<T>,
+                                                            A,
+                                                            i + offset_Ain,
+                                                            lda,
+                                                            stride_A,
+                                                            (U)X,
+                                                            i,
+                                                            m,
+                                                            stride_X,
+                                                            &one<T>,
+                                                            B,
+                                                            offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            batch_count);
                     }
                 }
             }
@@ -444,99 +729,99 @@ namespace
             {
                 // left, upper transpose
                 jb = min(BLOCK, m);
-                rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                         transA,
-                                                         transB,
-                                                         jb,
-                                                         n,
-                                                         jb,
-                                                         alpha,
-                                                         invA,
-                                                         offset_invAin,
-                                                         BLOCK,
-                                                         stride_invA,
-                                                         (U)B,
-                                                         offset_Bin,
-                                                         ldb,
-                                                         stride_B,
-                                                         &zero<T>,
-                                                         X,
-                                                         0,
-                                                         m,
-                                                         stride_X,
-                                                         batch_count);
+                rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                    transA,
+                                                    transB,
+                                                    jb,
+                                                    n,
+                                                    jb,
+                                                    alpha,
+                                                    invA,
+                                                    offset_invAin,
+                                                    BLOCK,
+                                                    stride_invA,
+                                                    (U)B,
+                                                    offset_Bin,
+                                                    ldb,
+                                                    stride_B,
+                                                    &zero<T>,
+                                                    X,
+                                                    0,
+                                                    m,
+                                                    stride_X,
+                                                    batch_count);
                 if(BLOCK < m)
                 {
-                    rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                             transA,
-                                                             transB,
-                                                             m - BLOCK,
-                                                             n,
-                                                             BLOCK,
-                                                             &negative_one<T>,
-                                                             A,
-                                                             BLOCK * lda + offset_Ain,
-                                                             lda,
-                                                             stride_A,
-                                                             (U)X,
-                                                             0,
-                                                             m,
-                                                             stride_X,
-                                                             alpha,
-                                                             B,
-                                                             BLOCK + offset_Bin,
-                                                             ldb,
-                                                             stride_B,
-                                                             batch_count);
+                    rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                        transA,
+                                                        transB,
+                                                        m - BLOCK,
+                                                        n,
+                                                        BLOCK,
+                                                        &negative_one<T>,
+                                                        A,
+                                                        BLOCK * lda + offset_Ain,
+                                                        lda,
+                                                        stride_A,
+                                                        (U)X,
+                                                        0,
+                                                        m,
+                                                        stride_X,
+                                                        alpha,
+                                                        B,
+                                                        BLOCK + offset_Bin,
+                                                        ldb,
+                                                        stride_B,
+                                                        batch_count);
 
                     // remaining blocks
                     for(i = BLOCK; i < m; i += BLOCK)
                     {
                         jb = min(m - i, BLOCK);
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transA,
-                                                                 transB,
-                                                                 jb,
-                                                                 n,
-                                                                 jb,
-                                                                 &one<T>,
-                                                                 invA,
-                                                                 i * BLOCK + offset_invAin,
-                                                                 BLOCK,
-                                                                 stride_invA,
-                                                                 (U)B,
-                                                                 i + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 &zero<T>,
-                                                                 X,
-                                                                 i,
-                                                                 m,
-                                                                 stride_X,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transA,
+                                                            transB,
+                                                            jb,
+                                                            n,
+                                                            jb,
+                                                            &one<T>,
+                                                            invA,
+                                                            i * BLOCK + offset_invAin,
+                                                            BLOCK,
+                                                            stride_invA,
+                                                            (U)B,
+                                                            i + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            &zero<T>,
+                                                            X,
+                                                            i,
+                                                            m,
+                                                            stride_X,
+                                                            batch_count);
                         if(i + BLOCK >= m)
                             break;
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transA,
-                                                                 transB,
-                                                                 m - i - BLOCK,
-                                                                 n,
-                                                                 BLOCK,
-                                                                 &negative_one<T>,
-                                                                 A,
-                                                                 i + (i + BLOCK) * lda + offset_Ain,
-                                                                 lda,
-                                                                 stride_A,
-                                                                 (U)X,
-                                                                 i,
-                                                                 m,
-                                                                 stride_X,
-                                                                 &one<T>,
-                                                                 B,
-                                                                 i + BLOCK + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transA,
+                                                            transB,
+                                                            m - i - BLOCK,
+                                                            n,
+                                                            BLOCK,
+                                                            &negative_one<T>,
+                                                            A,
+                                                            i + (i + BLOCK) * lda + offset_Ain,
+                                                            lda,
+                                                            stride_A,
+                                                            (U)X,
+                                                            i,
+                                                            m,
+                                                            stride_X,
+                                                            &one<T>,
+                                                            B,
+                                                            i + BLOCK + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            batch_count);
                     }
                 }
             }
@@ -581,98 +866,98 @@ namespace
                 // right, lower no-transpose
                 jb = (n % BLOCK == 0) ? BLOCK : (n % BLOCK);
                 i  = n - jb;
-                rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                         transB,
-                                                         transA,
-                                                         m,
-                                                         jb,
-                                                         jb,
-                                                         alpha,
-                                                         U(B),
-                                                         i * ldb + offset_Bin,
-                                                         ldb,
-                                                         stride_B,
-                                                         invA,
-                                                         i * BLOCK + offset_invAin,
-                                                         BLOCK,
-                                                         stride_invA,
-                                                         &zero<T>,
-                                                         X,
-                                                         i * m,
-                                                         m,
-                                                         stride_X,
-                                                         batch_count);
+                rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                    transB,
+                                                    transA,
+                                                    m,
+                                                    jb,
+                                                    jb,
+                                                    alpha,
+                                                    U(B),
+                                                    i * ldb + offset_Bin,
+                                                    ldb,
+                                                    stride_B,
+                                                    invA,
+                                                    i * BLOCK + offset_invAin,
+                                                    BLOCK,
+                                                    stride_invA,
+                                                    &zero<T>,
+                                                    X,
+                                                    i * m,
+                                                    m,
+                                                    stride_X,
+                                                    batch_count);
                 if(i - BLOCK >= 0)
                 {
-                    rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                             transB,
-                                                             transA,
-                                                             m,
-                                                             i,
-                                                             jb,
-                                                             &negative_one<T>,
-                                                             (U)X,
-                                                             i * m,
-                                                             m,
-                                                             stride_X,
-                                                             A,
-                                                             i + offset_Ain,
-                                                             lda,
-                                                             stride_A,
-                                                             alpha,
-                                                             B,
-                                                             offset_Bin,
-                                                             ldb,
-                                                             stride_B,
-                                                             batch_count);
+                    rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                        transB,
+                                                        transA,
+                                                        m,
+                                                        i,
+                                                        jb,
+                                                        &negative_one<T>,
+                                                        (U)X,
+                                                        i * m,
+                                                        m,
+                                                        stride_X,
+                                                        A,
+                                                        i + offset_Ain,
+                                                        lda,
+                                                        stride_A,
+                                                        alpha,
+                                                        B,
+                                                        offset_Bin,
+                                                        ldb,
+                                                        stride_B,
+                                                        batch_count);
 
                     // remaining blocks
                     for(i = n - jb - BLOCK; i >= 0; i -= BLOCK)
                     {
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transB,
-                                                                 transA,
-                                                                 m,
-                                                                 BLOCK,
-                                                                 BLOCK,
-                                                                 &one<T>,
-                                                                 (U)B,
-                                                                 i * ldb + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 invA,
-                                                                 i * BLOCK + offset_invAin,
-                                                                 BLOCK,
-                                                                 stride_invA,
-                                                                 &zero<T>,
-                                                                 X,
-                                                                 i * m,
-                                                                 m,
-                                                                 stride_X,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transB,
+                                                            transA,
+                                                            m,
+                                                            BLOCK,
+                                                            BLOCK,
+                                                            &one<T>,
+                                                            (U)B,
+                                                            i * ldb + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            invA,
+                                                            i * BLOCK + offset_invAin,
+                                                            BLOCK,
+                                                            stride_invA,
+                                                            &zero<T>,
+                                                            X,
+                                                            i * m,
+                                                            m,
+                                                            stride_X,
+                                                            batch_count);
                         if(i - BLOCK < 0)
                             break;
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transB,
-                                                                 transA,
-                                                                 m,
-                                                                 i,
-                                                                 BLOCK,
-                                                                 &negative_one<T>,
-                                                                 (U)X,
-                                                                 i * m,
-                                                                 m,
-                                                                 stride_X,
-                                                                 A,
-                                                                 i + offset_Ain,
-                                                                 lda,
-                                                                 stride_A,
-                                                                 &one<T>,
-                                                                 B,
-                                                                 offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transB,
+                                                            transA,
+                                                            m,
+                                                            i,
+                                                            BLOCK,
+                                                            &negative_one<T>,
+                                                            (U)X,
+                                                            i * m,
+                                                            m,
+                                                            stride_X,
+                                                            A,
+                                                            i + offset_Ain,
+                                                            lda,
+                                                            stride_A,
+                                                            &one<T>,
+                                                            B,
+                                                            offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            batch_count);
                     }
                 }
             }
@@ -680,99 +965,99 @@ namespace
             {
                 // right, upper no-transpose
                 jb = min(BLOCK, n);
-                rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                         transB,
-                                                         transA,
-                                                         m,
-                                                         jb,
-                                                         jb,
-                                                         alpha,
-                                                         (U)B,
-                                                         offset_Bin,
-                                                         ldb,
-                                                         stride_B,
-                                                         invA,
-                                                         offset_invAin,
-                                                         BLOCK,
-                                                         stride_invA,
-                                                         &zero<T>,
-                                                         X,
-                                                         0,
-                                                         m,
-                                                         stride_X,
-                                                         batch_count);
+                rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                    transB,
+                                                    transA,
+                                                    m,
+                                                    jb,
+                                                    jb,
+                                                    alpha,
+                                                    (U)B,
+                                                    offset_Bin,
+                                                    ldb,
+                                                    stride_B,
+                                                    invA,
+                                                    offset_invAin,
+                                                    BLOCK,
+                                                    stride_invA,
+                                                    &zero<T>,
+                                                    X,
+                                                    0,
+                                                    m,
+                                                    stride_X,
+                                                    batch_count);
                 if(BLOCK < n)
                 {
-                    rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                             transB,
-                                                             transA,
-                                                             m,
-                                                             n - BLOCK,
-                                                             BLOCK,
-                                                             &negative_one<T>,
-                                                             (U)X,
-                                                             0,
-                                                             m,
-                                                             stride_X,
-                                                             A,
-                                                             BLOCK * lda + offset_Ain,
-                                                             lda,
-                                                             stride_A,
-                                                             alpha,
-                                                             B,
-                                                             BLOCK * ldb + offset_Bin,
-                                                             ldb,
-                                                             stride_B,
-                                                             batch_count);
+                    rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                        transB,
+                                                        transA,
+                                                        m,
+                                                        n - BLOCK,
+                                                        BLOCK,
+                                                        &negative_one<T>,
+                                                        (U)X,
+                                                        0,
+                                                        m,
+                                                        stride_X,
+                                                        A,
+                                                        BLOCK * lda + offset_Ain,
+                                                        lda,
+                                                        stride_A,
+                                                        alpha,
+                                                        B,
+                                                        BLOCK * ldb + offset_Bin,
+                                                        ldb,
+                                                        stride_B,
+                                                        batch_count);
 
                     // remaining blocks
                     for(i = BLOCK; i < n; i += BLOCK)
                     {
                         jb = min(BLOCK, n - i);
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transB,
-                                                                 transA,
-                                                                 m,
-                                                                 jb,
-                                                                 jb,
-                                                                 &one<T>,
-                                                                 (U)B,
-                                                                 i * ldb + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 invA,
-                                                                 i * BLOCK + offset_invAin,
-                                                                 BLOCK,
-                                                                 stride_invA,
-                                                                 &zero<T>,
-                                                                 X,
-                                                                 i * m,
-                                                                 m,
-                                                                 stride_X,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transB,
+                                                            transA,
+                                                            m,
+                                                            jb,
+                                                            jb,
+                                                            &one<T>,
+                                                            (U)B,
+                                                            i * ldb + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            invA,
+                                                            i * BLOCK + offset_invAin,
+                                                            BLOCK,
+                                                            stride_invA,
+                                                            &zero<T>,
+                                                            X,
+                                                            i * m,
+                                                            m,
+                                                            stride_X,
+                                                            batch_count);
                         if(i + BLOCK >= n)
                             break;
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transB,
-                                                                 transA,
-                                                                 m,
-                                                                 n - i - BLOCK,
-                                                                 BLOCK,
-                                                                 &negative_one<T>,
-                                                                 (U)X,
-                                                                 i * m,
-                                                                 m,
-                                                                 stride_X,
-                                                                 A,
-                                                                 i + (i + BLOCK) * lda + offset_Ain,
-                                                                 lda,
-                                                                 stride_A,
-                                                                 &one<T>,
-                                                                 B,
-                                                                 (i + BLOCK) * ldb + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transB,
+                                                            transA,
+                                                            m,
+                                                            n - i - BLOCK,
+                                                            BLOCK,
+                                                            &negative_one<T>,
+                                                            (U)X,
+                                                            i * m,
+                                                            m,
+                                                            stride_X,
+                                                            A,
+                                                            i + (i + BLOCK) * lda + offset_Ain,
+                                                            lda,
+                                                            stride_A,
+                                                            &one<T>,
+                                                            B,
+                                                            (i + BLOCK) * ldb + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            batch_count);
                     }
                 }
             }
@@ -783,99 +1068,99 @@ namespace
             {
                 // right, lower transpose
                 jb = min(BLOCK, n);
-                rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                         transB,
-                                                         transA,
-                                                         m,
-                                                         jb,
-                                                         jb,
-                                                         alpha,
-                                                         U(B),
-                                                         offset_Bin,
-                                                         ldb,
-                                                         stride_B,
-                                                         invA,
-                                                         offset_invAin,
-                                                         BLOCK,
-                                                         stride_invA,
-                                                         &zero<T>,
-                                                         X,
-                                                         0,
-                                                         m,
-                                                         stride_X,
-                                                         batch_count);
+                rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                    transB,
+                                                    transA,
+                                                    m,
+                                                    jb,
+                                                    jb,
+                                                    alpha,
+                                                    U(B),
+                                                    offset_Bin,
+                                                    ldb,
+                                                    stride_B,
+                                                    invA,
+                                                    offset_invAin,
+                                                    BLOCK,
+                                                    stride_invA,
+                                                    &zero<T>,
+                                                    X,
+                                                    0,
+                                                    m,
+                                                    stride_X,
+                                                    batch_count);
                 if(BLOCK < n)
                 {
-                    rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                             transB,
-                                                             transA,
-                                                             m,
-                                                             n - BLOCK,
-                                                             BLOCK,
-                                                             &negative_one<T>,
-                                                             U(X),
-                                                             0,
-                                                             m,
-                                                             stride_X,
-                                                             A,
-                                                             BLOCK + offset_Ain,
-                                                             lda,
-                                                             stride_A,
-                                                             alpha,
-                                                             B,
-                                                             BLOCK * ldb + offset_Bin,
-                                                             ldb,
-                                                             stride_B,
-                                                             batch_count);
+                    rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                        transB,
+                                                        transA,
+                                                        m,
+                                                        n - BLOCK,
+                                                        BLOCK,
+                                                        &negative_one<T>,
+                                                        U(X),
+                                                        0,
+                                                        m,
+                                                        stride_X,
+                                                        A,
+                                                        BLOCK + offset_Ain,
+                                                        lda,
+                                                        stride_A,
+                                                        alpha,
+                                                        B,
+                                                        BLOCK * ldb + offset_Bin,
+                                                        ldb,
+                                                        stride_B,
+                                                        batch_count);
 
                     // remaining blocks
                     for(i = BLOCK; i < n; i += BLOCK)
                     {
                         jb = min(BLOCK, n - i);
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transB,
-                                                                 transA,
-                                                                 m,
-                                                                 jb,
-                                                                 jb,
-                                                                 &one<T>,
-                                                                 (U)B,
-                                                                 i * ldb + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 invA,
-                                                                 i * BLOCK + offset_invAin,
-                                                                 BLOCK,
-                                                                 stride_invA,
-                                                                 &zero<T>,
-                                                                 X,
-                                                                 i * m,
-                                                                 m,
-                                                                 stride_X,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transB,
+                                                            transA,
+                                                            m,
+                                                            jb,
+                                                            jb,
+                                                            &one<T>,
+                                                            (U)B,
+                                                            i * ldb + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            invA,
+                                                            i * BLOCK + offset_invAin,
+                                                            BLOCK,
+                                                            stride_invA,
+                                                            &zero<T>,
+                                                            X,
+                                                            i * m,
+                                                            m,
+                                                            stride_X,
+                                                            batch_count);
                         if(i + BLOCK >= n)
                             break;
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transB,
-                                                                 transA,
-                                                                 m,
-                                                                 n - i - BLOCK,
-                                                                 BLOCK,
-                                                                 &negative_one<T>,
-                                                                 (U)X,
-                                                                 i * m,
-                                                                 m,
-                                                                 stride_X,
-                                                                 A,
-                                                                 BLOCK + i + i * lda + offset_Ain,
-                                                                 lda,
-                                                                 stride_A,
-                                                                 &one<T>,
-                                                                 B,
-                                                                 (i + BLOCK) * ldb + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transB,
+                                                            transA,
+                                                            m,
+                                                            n - i - BLOCK,
+                                                            BLOCK,
+                                                            &negative_one<T>,
+                                                            (U)X,
+                                                            i * m,
+                                                            m,
+                                                            stride_X,
+                                                            A,
+                                                            BLOCK + i + i * lda + offset_Ain,
+                                                            lda,
+                                                            stride_A,
+                                                            &one<T>,
+                                                            B,
+                                                            (i + BLOCK) * ldb + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            batch_count);
                     }
                 }
             }
@@ -884,98 +1169,98 @@ namespace
                 // right, upper transpose
                 jb = (n % BLOCK == 0) ? BLOCK : (n % BLOCK);
                 i  = n - jb;
-                rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                         transB,
-                                                         transA,
-                                                         m,
-                                                         jb,
-                                                         jb,
-                                                         alpha,
-                                                         (U)B,
-                                                         i * ldb + offset_Bin,
-                                                         ldb,
-                                                         stride_B,
-                                                         invA,
-                                                         i * BLOCK + offset_invAin,
-                                                         BLOCK,
-                                                         stride_invA,
-                                                         &zero<T>,
-                                                         X,
-                                                         i * m,
-                                                         m,
-                                                         stride_X,
-                                                         batch_count);
+                rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                    transB,
+                                                    transA,
+                                                    m,
+                                                    jb,
+                                                    jb,
+                                                    alpha,
+                                                    (U)B,
+                                                    i * ldb + offset_Bin,
+                                                    ldb,
+                                                    stride_B,
+                                                    invA,
+                                                    i * BLOCK + offset_invAin,
+                                                    BLOCK,
+                                                    stride_invA,
+                                                    &zero<T>,
+                                                    X,
+                                                    i * m,
+                                                    m,
+                                                    stride_X,
+                                                    batch_count);
                 if(i - BLOCK >= 0)
                 {
-                    rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                             transB,
-                                                             transA,
-                                                             m,
-                                                             i,
-                                                             jb,
-                                                             &negative_one<T>,
-                                                             (U)X,
-                                                             i * m,
-                                                             m,
-                                                             stride_X,
-                                                             A,
-                                                             i * lda + offset_Ain,
-                                                             lda,
-                                                             stride_A,
-                                                             alpha,
-                                                             B,
-                                                             offset_Bin,
-                                                             ldb,
-                                                             stride_B,
-                                                             batch_count);
+                    rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                        transB,
+                                                        transA,
+                                                        m,
+                                                        i,
+                                                        jb,
+                                                        &negative_one<T>,
+                                                        (U)X,
+                                                        i * m,
+                                                        m,
+                                                        stride_X,
+                                                        A,
+                                                        i * lda + offset_Ain,
+                                                        lda,
+                                                        stride_A,
+                                                        alpha,
+                                                        B,
+                                                        offset_Bin,
+                                                        ldb,
+                                                        stride_B,
+                                                        batch_count);
 
                     // remaining blocks
                     for(i = n - jb - BLOCK; i >= 0; i -= BLOCK)
                     {
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transB,
-                                                                 transA,
-                                                                 m,
-                                                                 BLOCK,
-                                                                 BLOCK,
-                                                                 &one<T>,
-                                                                 (U)B,
-                                                                 i * ldb + offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 invA,
-                                                                 i * BLOCK + offset_invAin,
-                                                                 BLOCK,
-                                                                 stride_invA,
-                                                                 &zero<T>,
-                                                                 X,
-                                                                 i * m,
-                                                                 m,
-                                                                 stride_X,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transB,
+                                                            transA,
+                                                            m,
+                                                            BLOCK,
+                                                            BLOCK,
+                                                            &one<T>,
+                                                            (U)B,
+                                                            i * ldb + offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            invA,
+                                                            i * BLOCK + offset_invAin,
+                                                            BLOCK,
+                                                            stride_invA,
+                                                            &zero<T>,
+                                                            X,
+                                                            i * m,
+                                                            m,
+                                                            stride_X,
+                                                            batch_count);
                         if(i - BLOCK < 0)
                             break;
-                        rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                 transB,
-                                                                 transA,
-                                                                 m,
-                                                                 i,
-                                                                 BLOCK,
-                                                                 &negative_one<T>,
-                                                                 (U)X,
-                                                                 i * m,
-                                                                 m,
-                                                                 stride_X,
-                                                                 A,
-                                                                 i * lda + offset_Ain,
-                                                                 lda,
-                                                                 stride_A,
-                                                                 &one<T>,
-                                                                 B,
-                                                                 offset_Bin,
-                                                                 ldb,
-                                                                 stride_B,
-                                                                 batch_count);
+                        rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                            transB,
+                                                            transA,
+                                                            m,
+                                                            i,
+                                                            BLOCK,
+                                                            &negative_one<T>,
+                                                            (U)X,
+                                                            i * m,
+                                                            m,
+                                                            stride_X,
+                                                            A,
+                                                            i * lda + offset_Ain,
+                                                            lda,
+                                                            stride_A,
+                                                            &one<T>,
+                                                            B,
+                                                            offset_Bin,
+                                                            ldb,
+                                                            stride_B,
+                                                            batch_count);
                     }
                 }
             }
@@ -1009,12 +1294,15 @@ namespace
                                          V                 x_temp,
                                          rocblas_stride    stride_X)
     {
-        bool   parity     = (transA == rocblas_operation_none) ^ (uplo == rocblas_fill_upper);
-        size_t k          = side == rocblas_side_left ? m : n;
-        size_t R          = k / BLOCK;
-        size_t bsize      = side == rocblas_side_left ? n : m;
-        size_t W          = 1 + (bsize - 1) / B_chunk_size;
-        bool   arch_lt906 = handle->device_arch_id() < 906;
+        bool   parity = (transA == rocblas_operation_none) ^ (uplo == rocblas_fill_upper);
+        size_t k      = side == rocblas_side_left ? m : n;
+        size_t R      = k / BLOCK;
+        size_t bsize  = side == rocblas_side_left ? n : m;
+        size_t W      = 1 + (bsize - 1) / B_chunk_size;
+
+        // On arch >= 906, gemm_ex reads B and writes x_temp in one step. Batched gemm_ex copies
+        // the arrays of pointers to the host, so batched TRSM copies B and uses gemm instead.
+        bool use_gemm = BATCHED || handle->device_arch_id() < 906;
 
         for(size_t w = 0; w < W; w++)
         {
@@ -1028,7 +1316,7 @@ namespace
                     size_t j = parity ? r : q;
 
                     // copy a BLOCK*n piece we are solving at a time
-                    if(!r || arch_lt906)
+                    if(!r || use_gemm)
                         copy_block_unit<T>(handle,
                                            BLOCK,
                                            width,
@@ -1053,29 +1341,29 @@ namespace
                         else
                             offsetA = parity ? r * BLOCK * lda : BLOCK * (q * lda + q + 1);
 
-                        if(arch_lt906)
+                        if(use_gemm)
                         {
-                            rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                     transA,
-                                                                     rocblas_operation_none,
-                                                                     BLOCK,
-                                                                     width,
-                                                                     r * BLOCK,
-                                                                     &negative_one<T>,
-                                                                     A,
-                                                                     offsetA + offset_Ain,
-                                                                     lda,
-                                                                     stride_A,
-                                                                     (U)B,
-                                                                     offsetB + offset_Bin,
-                                                                     ldb,
-                                                                     stride_B,
-                                                                     alpha,
-                                                                     x_temp,
-                                                                     0,
-                                                                     BLOCK,
-                                                                     stride_X,
-                                                                     batch_count);
+                            rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                                transA,
+                                                                rocblas_operation_none,
+                                                                BLOCK,
+                                                                width,
+                                                                r * BLOCK,
+                                                                &negative_one<T>,
+                                                                A,
+                                                                offsetA + offset_Ain,
+                                                                lda,
+                                                                stride_A,
+                                                                (U)B,
+                                                                offsetB + offset_Bin,
+                                                                ldb,
+                                                                stride_B,
+                                                                alpha,
+                                                                x_temp,
+                                                                0,
+                                                                BLOCK,
+                                                                stride_X,
+                                                                batch_count);
                         }
                         else
                         {
@@ -1114,32 +1402,33 @@ namespace
                                                               BLOCK,
                                                               stride_X,
                                                               batch_count,
-                                                              compute_type);
+                                                              compute_type,
+                                                              flags);
                         }
                     }
 
-                    rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                             transA,
-                                                             rocblas_operation_none,
-                                                             BLOCK,
-                                                             width,
-                                                             BLOCK,
-                                                             r ? &one<T> : alpha,
-                                                             invA,
-                                                             j * BLOCK * BLOCK + offset_invAin,
-                                                             BLOCK,
-                                                             stride_invA,
-                                                             (U)x_temp,
-                                                             0,
-                                                             BLOCK,
-                                                             stride_X,
-                                                             &zero<T>,
-                                                             B,
-                                                             w * B_chunk_size * ldb + j * BLOCK
-                                                                 + offset_Bin,
-                                                             ldb,
-                                                             stride_B,
-                                                             batch_count);
+                    rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                        transA,
+                                                        rocblas_operation_none,
+                                                        BLOCK,
+                                                        width,
+                                                        BLOCK,
+                                                        r ? &one<T> : alpha,
+                                                        invA,
+                                                        j * BLOCK * BLOCK + offset_invAin,
+                                                        BLOCK,
+                                                        stride_invA,
+                                                        (U)x_temp,
+                                                        0,
+                                                        BLOCK,
+                                                        stride_X,
+                                                        &zero<T>,
+                                                        B,
+                                                        w * B_chunk_size * ldb + j * BLOCK
+                                                            + offset_Bin,
+                                                        ldb,
+                                                        stride_B,
+                                                        batch_count);
                 }
             }
             else
@@ -1150,7 +1439,7 @@ namespace
                     size_t j = parity ? q : r;
 
                     // copy a m*BLOCK piece we are solving at a time
-                    if(!r || arch_lt906)
+                    if(!r || use_gemm)
                         copy_block_unit<T>(handle,
                                            width,
                                            BLOCK,
@@ -1174,29 +1463,29 @@ namespace
                         else
                             offsetA = parity ? BLOCK * (q * lda + q + lda) : r * BLOCK;
 
-                        if(arch_lt906)
+                        if(use_gemm)
                         {
-                            rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                                     rocblas_operation_none,
-                                                                     transA,
-                                                                     width,
-                                                                     BLOCK,
-                                                                     r * BLOCK,
-                                                                     &negative_one<T>,
-                                                                     (U)B,
-                                                                     offsetB + offset_Bin,
-                                                                     ldb,
-                                                                     stride_B,
-                                                                     A,
-                                                                     offsetA + offset_Ain,
-                                                                     lda,
-                                                                     stride_A,
-                                                                     alpha,
-                                                                     x_temp,
-                                                                     0,
-                                                                     width,
-                                                                     stride_X,
-                                                                     batch_count);
+                            rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                                rocblas_operation_none,
+                                                                transA,
+                                                                width,
+                                                                BLOCK,
+                                                                r * BLOCK,
+                                                                &negative_one<T>,
+                                                                (U)B,
+                                                                offsetB + offset_Bin,
+                                                                ldb,
+                                                                stride_B,
+                                                                A,
+                                                                offsetA + offset_Ain,
+                                                                lda,
+                                                                stride_A,
+                                                                alpha,
+                                                                x_temp,
+                                                                0,
+                                                                width,
+                                                                stride_X,
+                                                                batch_count);
                         }
                         else
                         {
@@ -1235,32 +1524,33 @@ namespace
                                                               width,
                                                               stride_X,
                                                               batch_count,
-                                                              compute_type);
+                                                              compute_type,
+                                                              flags);
                         }
                     }
 
-                    rocblas_gemm_template<BATCHED, !BATCHED>(handle,
-                                                             rocblas_operation_none,
-                                                             transA,
-                                                             width,
-                                                             BLOCK,
-                                                             BLOCK,
-                                                             r ? &one<T> : alpha,
-                                                             U(x_temp),
-                                                             0,
-                                                             width,
-                                                             stride_X,
-                                                             invA,
-                                                             j * BLOCK * BLOCK + offset_invAin,
-                                                             BLOCK,
-                                                             stride_invA,
-                                                             &zero<T>,
-                                                             B,
-                                                             w * B_chunk_size * ldb
-                                                                 + j * BLOCK * ldb + offset_Bin,
-                                                             ldb,
-                                                             stride_B,
-                                                             batch_count);
+                    rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                        rocblas_operation_none,
+                                                        transA,
+                                                        width,
+                                                        BLOCK,
+                                                        BLOCK,
+                                                        r ? &one<T> : alpha,
+                                                        U(x_temp),
+                                                        0,
+                                                        width,
+                                                        stride_X,
+                                                        invA,
+                                                        j * BLOCK * BLOCK + offset_invAin,
+                                                        BLOCK,
+                                                        stride_invA,
+                                                        &zero<T>,
+                                                        B,
+                                                        w * B_chunk_size * ldb
+                                                            + j * BLOCK * ldb + offset_Bin,
+                                                        ldb,
+                                                        stride_B,
+                                                        batch_count);
                 }
             }
         }
@@ -1268,8 +1558,303 @@ namespace
         return rocblas_status_success;
     }
 
+    /* ===============recursive trsm========================================== */
+
+    // Triangles of at least TRSM_RECURSIVE_MIN_BLOCKS blocks are solved recursively, down to
+    // triangles of at most TRSM_RECURSIVE_LEAF_BLOCKS blocks, which use the blocked algorithm
+    constexpr rocblas_int TRSM_RECURSIVE_MIN_BLOCKS  = 16;
+    constexpr rocblas_int TRSM_RECURSIVE_LEAF_BLOCKS = 4;
+
+    // Setting ROCBLAS_TRSM_RECURSIVE to 0 or 1 forces the blocked or the recursive algorithm,
+    // to compare them in benchmarks
+    inline bool rocblas_trsm_use_recursive(rocblas_int k, rocblas_int block)
+    {
+        static const char* env = getenv("ROCBLAS_TRSM_RECURSIVE");
+        if(env && *env)
+            return atoi(env) != 0;
+        return k >= TRSM_RECURSIVE_MIN_BLOCKS * block;
+    }
+
+    // Splits op(A) in halves at a multiple of BLOCK, so that most of the flops are in one large
+    // gemm between the solves of the two halves. On the left with op(A) lower:
+    //
+    //   X1 = op(A11) \ (alpha * B1),  B2 = alpha * B2 - op(A21) * X1,  X2 = op(A22) \ B2
+    //
+    // The other cases solve the half which does not depend on the other one first. The
+    // inverted diagonal blocks in invA are those of the whole triangle, and k must be a
+    // multiple of BLOCK.
+    template <rocblas_int BLOCK, bool BATCHED, typename T, typename U, typename V>
+    rocblas_status rocblas_trsm_recursive(rocblas_handle    handle,
+                                          rocblas_side      side,
+                                          rocblas_fill      uplo,
+                                          rocblas_operation transA,
+                                          rocblas_diagonal  diag,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          const T*          alpha,
+                                          U                 A,
+                                          rocblas_int       offset_A,
+                                          rocblas_int       lda,
+                                          rocblas_stride    stride_A,
+                                          V                 B,
+                                          rocblas_int       offset_B,
+                                          rocblas_int       ldb,
+                                          rocblas_stride    stride_B,
+                                          rocblas_int       batch_count,
+                                          U                 invA,
+                                          rocblas_int       offset_invA,
+                                          rocblas_stride    stride_invA,
+                                          size_t            B_chunk_size,
+                                          V                 x_temp,
+                                          rocblas_stride    stride_X)
+    {
+        bool        left    = side == rocblas_side_left;
+        bool        notrans = transA == rocblas_operation_none;
+        rocblas_int k       = left ? m : n;
+
+        if(k <= TRSM_RECURSIVE_LEAF_BLOCKS * BLOCK)
+            return special_trsm_template<BLOCK, BATCHED>(handle,
+                                                         side,
+                                                         uplo,
+                                                         transA,
+                                                         diag,
+                                                         m,
+                                                         n,
+                                                         alpha,
+                                                         A,
+                                                         offset_A,
+                                                         lda,
+                                                         stride_A,
+                                                         B,
+                                                         offset_B,
+                                                         ldb,
+                                                         stride_B,
+                                                         batch_count,
+                                                         invA,
+                                                         offset_invA,
+                                                         stride_invA,
+                                                         B_chunk_size,
+                                                         x_temp,
+                                                         stride_X);
+
+        // The first half solved starts at o1 and has k1 rows, the second starts at o2
+        rocblas_int h         = (k / BLOCK + 1) / 2 * BLOCK;
+        bool        lower     = (uplo == rocblas_fill_lower) == notrans;
+        bool        low_first = lower == left;
+        rocblas_int o1        = low_first ? 0 : h;
+        rocblas_int o2        = low_first ? h : 0;
+        rocblas_int k1        = low_first ? h : k - h;
+        rocblas_int k2        = k - k1;
+
+        // Block of op(A) with rows r and columns c which couples the two halves
+        rocblas_int r        = left ? o2 : o1;
+        rocblas_int c        = left ? o1 : o2;
+        rocblas_int offset_C = offset_A + (notrans ? r + c * lda : c + r * lda);
+        rocblas_int offset_1 = offset_B + (left ? o1 : o1 * ldb);
+        rocblas_int offset_2 = offset_B + (left ? o2 : o2 * ldb);
+
+        rocblas_status status = rocblas_trsm_recursive<BLOCK, BATCHED>(handle,
+                                                                       side,
+                                                                       uplo,
+                                                                       transA,
+                                                                       diag,
+                                                                       left ? k1 : m,
+                                                                       left ? n : k1,
+                                                                       alpha,
+                                                                       A,
+                                                                       offset_A + o1 + o1 * lda,
+                                                                       lda,
+                                                                       stride_A,
+                                                                       B,
+                                                                       offset_1,
+                                                                       ldb,
+                                                                       stride_B,
+                                                                       batch_count,
+                                                                       invA,
+                                                                       offset_invA + o1 * BLOCK,
+                                                                       stride_invA,
+                                                                       B_chunk_size,
+                                                                       x_temp,
+                                                                       stride_X);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(left)
+            status = rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                         transA,
+                                                         rocblas_operation_none,
+                                                         k2,
+                                                         n,
+                                                         k1,
+                                                         &negative_one<T>,
+                                                         A,
+                                                         offset_C,
+                                                         lda,
+                                                         stride_A,
+                                                         (U)B,
+                                                         offset_1,
+                                                         ldb,
+                                                         stride_B,
+                                                         alpha,
+                                                         B,
+                                                         offset_2,
+                                                         ldb,
+                                                         stride_B,
+                                                         batch_count);
+        else
+            status = rocblas_trsm_gemm_template<BATCHED>(handle,
+                                                         rocblas_operation_none,
+                                                         transA,
+                                                         m,
+                                                         k2,
+                                                         k1,
+                                                         &negative_one<T>,
+                                                         (U)B,
+                                                         offset_1,
+                                                         ldb,
+                                                         stride_B,
+                                                         A,
+                                                         offset_C,
+                                                         lda,
+                                                         stride_A,
+                                                         alpha,
+                                                         B,
+                                                         offset_2,
+                                                         ldb,
+                                                         stride_B,
+                                                         batch_count);
+        if(status != rocblas_status_success)
+            return status;
+
+        return rocblas_trsm_recursive<BLOCK, BATCHED>(handle,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      left ? k2 : m,
+                                                      left ? n : k2,
+                                                      &one<T>,
+                                                      A,
+                                                      offset_A + o2 + o2 * lda,
+                                                      lda,
+                                                      stride_A,
+                                                      B,
+                                                      offset_2,
+                                                      ldb,
+                                                      stride_B,
+                                                      batch_count,
+                                                      invA,
+                                                      offset_invA + o2 * BLOCK,
+                                                      stride_invA,
+                                                      B_chunk_size,
+                                                      x_temp,
+                                                      stride_X);
+    }
+
 } // \namespace
 
+/**
+  *  Number of elements of temporary memory C used by rocblas_trtri_trsm_template to invert
+  *  the diagonal blocks of a k by k triangular matrix.
+  */
+template <rocblas_int BLOCK>
+inline size_t rocblas_trtri_trsm_temp_els(rocblas_int k)
+{
+    // When k < BLOCK, C is unnecessary for trtri
+    size_t c_temp_els = (k / BLOCK) * ((BLOCK / 2) * (BLOCK / 2));
+
+    // For the TRTRI last diagonal block we need remainder space if k % BLOCK != 0
+    if(k % BLOCK != 0)
+    {
+        // TODO: Make this more accurate -- right now it's much larger than necessary
+        size_t remainder_els = ROCBLAS_TRTRI_NB * BLOCK * 2;
+
+        // C is the maximum of the temporary space needed for TRTRI
+        c_temp_els = max(c_temp_els, remainder_els);
+    }
+
+    return c_temp_els;
+}
+
+/**
+  *  Sizes in bytes of the device memory used by rocblas_trsm_template, in the order of
+  *  handle->device_malloc in rocblas_trsm_template_mem: x_temp (shared with the TRTRI
+  *  temporary), the array of x_temp pointers, invA and the array of invA pointers.
+  *
+  *  With optimal == false, these are the minimum sizes, for which the solution is computed one
+  *  column (or row) of B at a time when k is a multiple of BLOCK.
+  */
+template <rocblas_int BLOCK, bool BATCHED, typename T>
+std::tuple<size_t, size_t, size_t, size_t> rocblas_trsm_workspace_sizes(rocblas_side side,
+                                                                        rocblas_int  m,
+                                                                        rocblas_int  n,
+                                                                        rocblas_int  batch_count,
+                                                                        bool         supplied_invA,
+                                                                        bool         optimal)
+{
+    // Small systems are solved by a fused kernel, without temporary device memory
+    if(rocblas_trsm_small(m, n) || !m || !n || !batch_count)
+        return std::make_tuple(0, 0, 0, 0);
+
+    rocblas_int k = side == rocblas_side_left ? m : n;
+
+    size_t invA_bytes   = 0;
+    size_t c_temp_bytes = 0;
+
+    // Only allocate bytes for invA if it is not supplied
+    if(!supplied_invA)
+    {
+        invA_bytes   = size_t(BLOCK) * k * sizeof(T) * batch_count;
+        c_temp_bytes = rocblas_trtri_trsm_temp_els<BLOCK>(k) * sizeof(T);
+    }
+
+    // Temporary solution matrix
+    size_t x_temp_bytes;
+    if(k % BLOCK == 0)
+    {
+        // Optimal B_chunk_size is the orthogonal dimension to k, and the minimum is 1
+        size_t B_chunk_size = optimal ? size_t(m) + size_t(n) - size_t(k) : 1;
+
+        // When k % BLOCK == 0, we only need BLOCK * B_chunk_size space
+        x_temp_bytes = BLOCK * B_chunk_size * sizeof(T) * batch_count;
+    }
+    else
+    {
+        // When k % BLOCK != 0, we need m * n space
+        x_temp_bytes = size_t(m) * n * sizeof(T) * batch_count;
+    }
+
+    // X and C temporaries can share space, so the maximum size is allocated
+    size_t x_c_temp_bytes = max(x_temp_bytes, c_temp_bytes);
+    size_t arrBytes       = BATCHED ? sizeof(T*) * batch_count : 0;
+    size_t xarrBytes      = BATCHED ? sizeof(T*) * batch_count : 0;
+
+    return std::make_tuple(x_c_temp_bytes, xarrBytes, invA_bytes, arrBytes);
+}
+
+/*! \brief Minimum and optimal sizes of the handle's device memory for TRSM. */
+template <rocblas_int BLOCK, bool BATCHED, typename T>
+void rocblas_trsm_workspace_size_template(rocblas_side side,
+                                          rocblas_int  m,
+                                          rocblas_int  n,
+                                          rocblas_int  batch_count,
+                                          bool         supplied_invA,
+                                          size_t*      minimum_size,
+                                          size_t*      optimal_size)
+{
+    size_t x_bytes, xarr_bytes, invA_bytes, arr_bytes;
+
+    std::tie(x_bytes, xarr_bytes, invA_bytes, arr_bytes)
+        = rocblas_trsm_workspace_sizes<BLOCK, BATCHED, T>(
+            side, m, n, batch_count, supplied_invA, false);
+    *minimum_size = _rocblas_handle::device_memory_size(x_bytes, xarr_bytes, invA_bytes, arr_bytes);
+
+    std::tie(x_bytes, xarr_bytes, invA_bytes, arr_bytes)
+        = rocblas_trsm_workspace_sizes<BLOCK, BATCHED, T>(
+            side, m, n, batch_count, supplied_invA, true);
+    *optimal_size = _rocblas_handle::device_memory_size(x_bytes, xarr_bytes, invA_bytes, arr_bytes);
+}
+
 /**
   *  The purpose of this function is to allocate memory for trsm. It is added to remove
   *  memory allocation from the rocblas_trsm_template function, but also allow code reuse
@@ -1277,6 +1862,9 @@ namespace
   *
   *  Note that for the batched version of trsm, we are also allocating memory to store the
   *  arrays of pointers for invA and x_temp (mem_x_temp_arr, mem_invA_arr).
+  *
+  *  If the optimal size cannot be allocated, the minimum size is allocated instead, optimal_mem
+  *  is set to false and rocblas_status_perf_degraded is returned.
   */
 template <rocblas_int BLOCK, bool BATCHED, typename T, typename U>
 rocblas_status rocblas_trsm_template_mem(rocblas_handle handle,
@@ -1288,19 +1876,22 @@ rocblas_status rocblas_trsm_template_mem(rocblas_handle handle,
                                          void*&         mem_x_temp_arr,
                                          void*&         mem_invA,
                                          void*&         mem_invA_arr,
+                                         bool&          optimal_mem,
                                          U              supplied_invA      = nullptr,
                                          rocblas_int    supplied_invA_size = 0)
 {
     rocblas_status perf_status = rocblas_status_success;
     rocblas_int    k           = side == rocblas_side_left ? m : n;
 
-    // Whether size is an exact multiple of blocksize
-    const bool exact_blocks = (k % BLOCK) == 0;
+    optimal_mem = true;
 
-    size_t invA_bytes   = 0;
-    size_t invA_els     = 0;
-    size_t c_temp_bytes = 0;
-    size_t c_temp_els   = 0;
+    // Small systems are solved by a fused kernel, without temporary device memory
+    if(rocblas_trsm_small(m, n))
+    {
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        mem_x_temp = mem_x_temp_arr = mem_invA = mem_invA_arr = nullptr;
+        return rocblas_status_success;
+    }
 
     // For user-supplied invA, check to make sure size is large enough
     // If not large enough, indicate degraded performance and ignore supplied invA
@@ -1314,56 +1905,10 @@ rocblas_status rocblas_trsm_template_mem(rocblas_handle handle,
         supplied_invA  = nullptr;
     }
 
-    if(!supplied_invA)
-    {
-        // Only allocate bytes for invA if supplied_invA == nullptr or supplied_invA_size is too small
-        invA_els   = BLOCK * k;
-        invA_bytes = invA_els * sizeof(T) * batch_count;
-
-        // When k < BLOCK, C is unnecessary for trtri
-        c_temp_els   = (k / BLOCK) * ((BLOCK / 2) * (BLOCK / 2));
-        c_temp_bytes = c_temp_els * sizeof(T);
-
-        // For the TRTRI last diagonal block we need remainder space if k % BLOCK != 0
-        if(!exact_blocks)
-        {
-            // TODO: Make this more accurate -- right now it's much larger than necessary
-            size_t remainder_els   = ROCBLAS_TRTRI_NB * BLOCK * 2;
-            size_t remainder_bytes = sizeof(T) * remainder_els;
-
-            // C is the maximum of the temporary space needed for TRTRI
-            c_temp_els   = max(c_temp_els, remainder_els);
-            c_temp_bytes = c_temp_els * sizeof(T);
-        }
-    }
-
-    // Chunk size for special algorithm
-    size_t B_chunk_size = 0;
-
-    // Temporary solution matrix
-    size_t x_temp_els;
-    size_t x_temp_bytes;
-
-    if(exact_blocks)
-    {
-        // Optimal B_chunk_size is the orthogonal dimension to k
-        B_chunk_size = size_t(m) + size_t(n) - size_t(k);
-
-        // When k % BLOCK == 0, we only need BLOCK * B_chunk_size space
-        x_temp_els   = BLOCK * B_chunk_size;
-        x_temp_bytes = x_temp_els * sizeof(T) * batch_count;
-    }
-    else
-    {
-        // When k % BLOCK != 0, we need m * n space
-        x_temp_els   = m * n;
-        x_temp_bytes = x_temp_els * sizeof(T) * batch_count;
-    }
-
-    // X and C temporaries can share space, so the maximum size is allocated
-    size_t x_c_temp_bytes = max(x_temp_bytes, c_temp_bytes);
-    size_t arrBytes       = BATCHED ? sizeof(T*) * batch_count : 0;
-    size_t xarrBytes      = BATCHED ? sizeof(T*) * batch_count : 0;
+    size_t x_c_temp_bytes, xarrBytes, invA_bytes, arrBytes;
+    std::tie(x_c_temp_bytes, xarrBytes, invA_bytes, arrBytes)
+        = rocblas_trsm_workspace_sizes<BLOCK, BATCHED, T>(
+            side, m, n, batch_count, supplied_invA != nullptr, true);
 
     // If this is a device memory size query, set optimal size and return changed status
     if(handle->is_device_memory_size_query())
@@ -1375,12 +1920,12 @@ rocblas_status rocblas_trsm_template_mem(rocblas_handle handle,
 
     if(!mem)
     {
-        if(exact_blocks)
+        // Fall back on the minimum size, which is smaller only when k % BLOCK == 0
+        if(k % BLOCK == 0)
         {
-            B_chunk_size   = 1; // Fall back on chunk size of 1 (like TRSV)
-            x_temp_els     = BLOCK;
-            x_temp_bytes   = x_temp_els * sizeof(T) * batch_count;
-            x_c_temp_bytes = max(x_temp_bytes, c_temp_bytes);
+            std::tie(x_c_temp_bytes, xarrBytes, invA_bytes, arrBytes)
+                = rocblas_trsm_workspace_sizes<BLOCK, BATCHED, T>(
+                    side, m, n, batch_count, supplied_invA != nullptr, false);
 
             mem = handle->device_malloc(x_c_temp_bytes, xarrBytes, invA_bytes, arrBytes);
         }
@@ -1388,6 +1933,7 @@ rocblas_status rocblas_trsm_template_mem(rocblas_handle handle,
             return rocblas_status_memory_error;
 
         // Mark performance as degraded
+        optimal_mem = false;
         perf_status = rocblas_status_perf_degraded;
 
         // One-time warning about degraded performance
@@ -1454,12 +2000,38 @@ rocblas_status rocblas_trsm_template(rocblas_handle    handle,
     // Temporarily switch to host pointer mode, saving current pointer mode, restored on return
     auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
-    // Get alpha
+    // Get alpha. A device alpha is not copied to the host, which would synchronize; instead B
+    // is scaled by alpha on the device and the solve uses alpha = 1.
     T alpha_h;
     if(saved_pointer_mode == rocblas_pointer_mode_host)
         alpha_h = *alpha;
     else
-        RETURN_IF_HIP_ERROR(hipMemcpy(&alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost));
+    {
+        if(m && n)
+            scale_block_unit(handle, m, n, alpha, B, ldb, stride_B, batch_count, offset_B);
+        alpha_h = 1;
+    }
+
+    // Small systems, such as many tiny batched systems, are solved by one fused launch. The
+    // diagonal block inversion and the gemms would each be a separate small launch.
+    if(rocblas_trsm_small(m, n))
+        return rocblas_trsm_small_template(handle,
+                                           side,
+                                           uplo,
+                                           transA,
+                                           diag,
+                                           m,
+                                           n,
+                                           alpha_h,
+                                           A,
+                                           offset_A,
+                                           lda,
+                                           stride_A,
+                                           B,
+                                           offset_B,
+                                           ldb,
+                                           stride_B,
+                                           batch_count);
 
     rocblas_status status = rocblas_status_success;
 
@@ -1511,29 +2083,55 @@ rocblas_status rocblas_trsm_template(rocblas_handle    handle,
 
     if(exact_blocks)
     {
-        status = special_trsm_template<BLOCK, BATCHED>(handle,
-                                                       side,
-                                                       uplo,
-                                                       transA,
-                                                       diag,
-                                                       m,
-                                                       n,
-                                                       &alpha_h,
-                                                       U(A),
-                                                       offset_A,
-                                                       lda,
-                                                       stride_A,
-                                                       V(B),
-                                                       offset_B,
-                                                       ldb,
-                                                       stride_B,
-                                                       batch_count,
-                                                       U(BATCHED ? invAarr : invA),
-                                                       offset_invA,
-                                                       stride_invA,
-                                                       B_chunk_size,
-                                                       V(BATCHED ? x_temparr : x_temp),
-                                                       x_temp_els);
+        // Large triangles are solved recursively, so that most of the flops are in large gemms
+        if(rocblas_trsm_use_recursive(k, BLOCK))
+            status = rocblas_trsm_recursive<BLOCK, BATCHED>(handle,
+                                                            side,
+                                                            uplo,
+                                                            transA,
+                                                            diag,
+                                                            m,
+                                                            n,
+                                                            &alpha_h,
+                                                            U(A),
+                                                            offset_A,
+                                                            lda,
+                                                            stride_A,
+                                                            V(B),
+                                                            offset_B,
+                                                            ldb,
+                                                            stride_B,
+                                                            batch_count,
+                                                            U(BATCHED ? invAarr : invA),
+                                                            offset_invA,
+                                                            stride_invA,
+                                                            B_chunk_size,
+                                                            V(BATCHED ? x_temparr : x_temp),
+                                                            x_temp_els);
+        else
+            status = special_trsm_template<BLOCK, BATCHED>(handle,
+                                                           side,
+                                                           uplo,
+                                                           transA,
+                                                           diag,
+                                                           m,
+                                                           n,
+                                                           &alpha_h,
+                                                           U(A),
+                                                           offset_A,
+                                                           lda,
+                                                           stride_A,
+                                                           V(B),
+                                                           offset_B,
+                                                           ldb,
+                                                           stride_B,
+                                                           batch_count,
+                                                           U(BATCHED ? invAarr : invA),
+                                                           offset_invA,
+                                                           stride_invA,
+                                                           B_chunk_size,
+                                                           V(BATCHED ? x_temparr : x_temp),
+                                                           x_temp_els);
     }
     else
     {
@@ -1601,4 +2199,75 @@ rocblas_status rocblas_trsm_template(rocblas_handle    handle,
     return status == rocblas_status_success ? perf_status : status;
 }
 
+// Allocates the temporary device memory and solves op(A)*X = alpha*B or X*op(A) = alpha*B,
+// after the arguments have been checked. invA is computed unless it is supplied.
+template <rocblas_int BLOCK, typename T>
+rocblas_status rocblas_trsm_solve_template(rocblas_handle    handle,
+                                           rocblas_side      side,
+                                           rocblas_fill      uplo,
+                                           rocblas_operation transA,
+                                           rocblas_diagonal  diag,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           T*                B,
+                                           rocblas_int       ldb,
+                                           const T*          supplied_invA,
+                                           rocblas_int       supplied_invA_size)
+{
+    //////////////////////
+    // MEMORY MANAGEMENT//
+    //////////////////////
+    void*          mem_x_temp;
+    void*          mem_x_temp_arr;
+    void*          mem_invA;
+    void*          mem_invA_arr;
+    bool           optimal_mem;
+    rocblas_status perf_status = rocblas_trsm_template_mem<BLOCK, false, T>(handle,
+                                                                            side,
+                                                                            m,
+                                                                            n,
+                                                                            1,
+                                                                            mem_x_temp,
+                                                                            mem_x_temp_arr,
+                                                                            mem_invA,
+                                                                            mem_invA_arr,
+                                                                            optimal_mem,
+                                                                            supplied_invA,
+                                                                            supplied_invA_size);
+
+    // If this was a device memory query or an error occurred, return status
+    if(perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+        return perf_status;
+
+    rocblas_status status = rocblas_trsm_template<BLOCK, false, T>(handle,
+                                                                   side,
+                                                                   uplo,
+                                                                   transA,
+                                                                   diag,
+                                                                   m,
+                                                                   n,
+                                                                   alpha,
+                                                                   A,
+                                                                   0,
+                                                                   lda,
+                                                                   0,
+                                                                   B,
+                                                                   0,
+                                                                   ldb,
+                                                                   0,
+                                                                   1,
+                                                                   optimal_mem,
+                                                                   mem_x_temp,
+                                                                   mem_x_temp_arr,
+                                                                   mem_invA,
+                                                                   mem_invA_arr,
+                                                                   supplied_invA,
+                                                                   supplied_invA_size);
+
+    return status != rocblas_status_success ? status : perf_status;
+}
+
 #endif
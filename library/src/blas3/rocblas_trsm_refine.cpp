@@ -0,0 +1,576 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "rocblas_trmm.hpp"
+#include "rocblas_trsm.hpp"
+#include "utility.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <tuple>
+
+/*
+ * Mixed precision TRSM with iterative refinement
+ *
+ * op(A)*X = alpha*B is solved in single precision, and the solution is refined in double
+ * precision (likewise for X*op(A) = alpha*B):
+ *
+ *   X  = op(A_s)^-1 * alpha*B
+ *   R  = alpha*B - op(A)*X      (double precision TRMM)
+ *   D  = op(A_s)^-1 * R         (single precision TRSM)
+ *   X += D
+ *
+ * until max|D| <= tolerance * max|X|. A_s is A rounded to single precision. Its diagonal
+ * blocks are inverted by the first solve, and reused by the solves for the corrections.
+ *
+ * Refinement converges when A is well conditioned. Otherwise, after max_iterations steps, or
+ * when the single precision solution overflows, B is solved again in double precision.
+ */
+
+namespace
+{
+    constexpr rocblas_int STRSM_BLOCK = 128;
+    constexpr rocblas_int DTRSM_BLOCK = 128;
+
+    constexpr rocblas_int TRSM_REFINE_DIM_X = 64;
+    constexpr rocblas_int TRSM_REFINE_DIM_Y = 4;
+
+    constexpr char rocblas_trsm_refine_name[] = "rocblas_dtrsm_refine";
+
+    // B = A, converted to the type of B
+    template <typename Ti, typename To>
+    __global__ void trsm_refine_copy_kernel(
+        rocblas_int m, rocblas_int n, const Ti* A, rocblas_int lda, To* B, rocblas_int ldb)
+    {
+        rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+        if(i < m && j < n)
+            B[i + ptrdiff_t(j) * ldb] = To(A[i + ptrdiff_t(j) * lda]);
+    }
+
+    // B0 = alpha * B, and R_s = B0 rounded to single precision
+    template <typename TScal>
+    __global__ void trsm_refine_scale_kernel(rocblas_int   m,
+                                             rocblas_int   n,
+                                             TScal         alpha_device_host,
+                                             const double* B,
+                                             rocblas_int   ldb,
+                                             double*       B0,
+                                             float*        R_s)
+    {
+        rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+        if(i < m && j < n)
+        {
+            auto   alpha = load_scalar(alpha_device_host);
+            double b     = alpha * B[i + ptrdiff_t(j) * ldb];
+
+            B0[i + ptrdiff_t(j) * m]  = b;
+            R_s[i + ptrdiff_t(j) * m] = float(b);
+        }
+    }
+
+    // R_s = B0 + R rounded to single precision, where R = -op(A)*X
+    __global__ void trsm_refine_residual_kernel(
+        rocblas_int m, rocblas_int n, const double* B0, const double* R, float* R_s)
+    {
+        rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+        if(i < m && j < n)
+        {
+            ptrdiff_t ij = i + ptrdiff_t(j) * m;
+            R_s[ij]      = float(B0[ij] + R[ij]);
+        }
+    }
+
+    // X += D, and norms = (max|D|, max|X|). The bits of non-negative doubles are ordered like
+    // their values, so the maxima are taken on the bits, with integer atomics between the
+    // workgroups. A NaN is greater than any other value, and so it is not lost.
+    template <rocblas_int NB>
+    __global__ void trsm_refine_update_kernel(rocblas_int         m,
+                                              rocblas_int         n,
+                                              const float*        D,
+                                              double*             X,
+                                              rocblas_int         ldx,
+                                              unsigned long long* norms)
+    {
+        __shared__ unsigned long long sD[NB];
+        __shared__ unsigned long long sX[NB];
+
+        rocblas_int tid = hipThreadIdx_y * hipBlockDim_x + hipThreadIdx_x;
+        rocblas_int i   = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        rocblas_int j   = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+        double d = 0, x = 0;
+        if(i < m && j < n)
+        {
+            d = D[i + ptrdiff_t(j) * m];
+            x = X[i + ptrdiff_t(j) * ldx] + d;
+
+            X[i + ptrdiff_t(j) * ldx] = x;
+        }
+        sD[tid] = __double_as_longlong(fabs(d));
+        sX[tid] = __double_as_longlong(fabs(x));
+
+        __syncthreads();
+
+        for(rocblas_int s = NB / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+            {
+                sD[tid] = sD[tid] > sD[tid + s] ? sD[tid] : sD[tid + s];
+                sX[tid] = sX[tid] > sX[tid + s] ? sX[tid] : sX[tid + s];
+            }
+            __syncthreads();
+        }
+
+        if(tid == 0)
+        {
+            atomicMax(norms, sD[0]);
+            atomicMax(norms + 1, sX[0]);
+        }
+    }
+
+    /* ============================================================================================ */
+
+    // Solves by iterative refinement, after the arguments have been checked. Sets converged to
+    // false if B has to be solved in double precision, in which case B holds alpha*B on return.
+    template <rocblas_int BLOCK>
+    rocblas_status rocblas_trsm_refine_template(rocblas_handle    handle,
+                                                rocblas_side      side,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation transA,
+                                                rocblas_diagonal  diag,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                const double*     alpha,
+                                                const double*     A,
+                                                rocblas_int       lda,
+                                                double*           B,
+                                                rocblas_int       ldb,
+                                                double            tolerance,
+                                                rocblas_int       max_iterations,
+                                                rocblas_int*      iterations,
+                                                bool&             converged)
+    {
+        rocblas_int k  = side == rocblas_side_left ? m : n;
+        size_t      mn = size_t(m) * n;
+
+        // Single precision TRSM, with the diagonal blocks of A_s inverted by the first solve
+        size_t x_bytes, xarr_bytes, invA_bytes, arr_bytes;
+        std::tie(x_bytes, xarr_bytes, invA_bytes, arr_bytes)
+            = rocblas_trsm_workspace_sizes<BLOCK, false, float>(side, m, n, 1, false, true);
+
+        size_t A_s_bytes   = sizeof(float) * k * k;
+        size_t R_s_bytes   = sizeof(float) * mn;
+        size_t B0_bytes    = sizeof(double) * mn;
+        size_t R_bytes     = sizeof(double) * mn;
+        size_t norms_bytes = sizeof(unsigned long long) * 2;
+
+        // The double precision solve, if refinement does not converge, allocates separately
+        if(handle->is_device_memory_size_query())
+        {
+            size_t refine_size = _rocblas_handle::device_memory_size(x_bytes,
+                                                                     xarr_bytes,
+                                                                     invA_bytes,
+                                                                     arr_bytes,
+                                                                     A_s_bytes,
+                                                                     R_s_bytes,
+                                                                     B0_bytes,
+                                                                     R_bytes,
+                                                                     norms_bytes);
+
+            std::tie(x_bytes, xarr_bytes, invA_bytes, arr_bytes)
+                = rocblas_trsm_workspace_sizes<BLOCK, false, double>(side, m, n, 1, false, true);
+            size_t solve_size
+                = _rocblas_handle::device_memory_size(x_bytes, xarr_bytes, invA_bytes, arr_bytes);
+
+            return handle->set_optimal_device_memory_size(std::max(refine_size, solve_size));
+        }
+
+        auto mem = handle->device_malloc(x_bytes,
+                                         xarr_bytes,
+                                         invA_bytes,
+                                         arr_bytes,
+                                         A_s_bytes,
+                                         R_s_bytes,
+                                         B0_bytes,
+                                         R_bytes,
+                                         norms_bytes);
+        if(!mem)
+            return rocblas_status_memory_error;
+
+        void *x_temp, *x_temparr, *invA, *invAarr, *A_s, *R_s, *B0, *R, *norms;
+        std::tie(x_temp, x_temparr, invA, invAarr, A_s, R_s, B0, R, norms) = mem;
+
+        hipStream_t rocblas_stream = handle->rocblas_stream;
+        dim3        threads(TRSM_REFINE_DIM_X, TRSM_REFINE_DIM_Y);
+        dim3        grid_A((k - 1) / TRSM_REFINE_DIM_X + 1, (k - 1) / TRSM_REFINE_DIM_Y + 1);
+        dim3        grid_B((m - 1) / TRSM_REFINE_DIM_X + 1, (n - 1) / TRSM_REFINE_DIM_Y + 1);
+
+        // A_s = A, and B0 = alpha*B with R_s = B0
+        hipLaunchKernelGGL((trsm_refine_copy_kernel<double, float>),
+                           grid_A,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           k,
+                           k,
+                           A,
+                           lda,
+                           (float*)A_s,
+                           k);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            hipLaunchKernelGGL(trsm_refine_scale_kernel<const double*>,
+                               grid_B,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               alpha,
+                               B,
+                               ldb,
+                               (double*)B0,
+                               (float*)R_s);
+        else
+            hipLaunchKernelGGL(trsm_refine_scale_kernel<double>,
+                               grid_B,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               *alpha,
+                               B,
+                               ldb,
+                               (double*)B0,
+                               (float*)R_s);
+
+        // The remaining scalars are host constants, whatever the pointer mode of the caller
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        // R_s = op(A_s)^-1 * R_s, with the inverted diagonal blocks of the first solve supplied
+        // to the others. Small systems are solved by a fused kernel, which does not use them.
+        auto solve_s = [&](bool first) {
+            const float* supplied_invA = first || !invA_bytes ? nullptr : (const float*)invA;
+            return rocblas_trsm_template<BLOCK, false, float>(handle,
+                                                              side,
+                                                              uplo,
+                                                              transA,
+                                                              diag,
+                                                              m,
+                                                              n,
+                                                              &one<float>,
+                                                              (const float*)A_s,
+                                                              0,
+                                                              k,
+                                                              0,
+                                                              (float*)R_s,
+                                                              0,
+                                                              m,
+                                                              0,
+                                                              1,
+                                                              true,
+                                                              x_temp,
+                                                              x_temparr,
+                                                              invA,
+                                                              invAarr,
+                                                              supplied_invA,
+                                                              BLOCK * k);
+        };
+
+        // X = op(A_s)^-1 * alpha*B, stored in B
+        rocblas_status status = solve_s(true);
+        if(status != rocblas_status_success)
+            return status;
+
+        hipLaunchKernelGGL((trsm_refine_copy_kernel<float, double>),
+                           grid_B,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           m,
+                           n,
+                           (const float*)R_s,
+                           m,
+                           B,
+                           ldb);
+
+        if(tolerance <= 0)
+            tolerance = std::sqrt(double(k)) * DBL_EPSILON;
+
+        converged   = false;
+        *iterations = 0;
+        while(*iterations < max_iterations)
+        {
+            // R = -op(A)*X, and R_s = alpha*B + R
+            status = rocblas_trmm_outofplace_template<false>(handle,
+                                                             side,
+                                                             uplo,
+                                                             transA,
+                                                             diag,
+                                                             m,
+                                                             n,
+                                                             &negative_one<double>,
+                                                             A,
+                                                             0,
+                                                             lda,
+                                                             0,
+                                                             (const double*)B,
+                                                             0,
+                                                             ldb,
+                                                             0,
+                                                             (double*)R,
+                                                             0,
+                                                             m,
+                                                             0,
+                                                             1,
+                                                             nullptr);
+            if(status != rocblas_status_success)
+                return status;
+
+            hipLaunchKernelGGL(trsm_refine_residual_kernel,
+                               grid_B,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               (const double*)B0,
+                               (const double*)R,
+                               (float*)R_s);
+
+            // D = op(A_s)^-1 * R_s, and X += D
+            status = solve_s(false);
+            if(status != rocblas_status_success)
+                return status;
+
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(norms, 0, norms_bytes, rocblas_stream));
+            hipLaunchKernelGGL((trsm_refine_update_kernel<TRSM_REFINE_DIM_X * TRSM_REFINE_DIM_Y>),
+                               grid_B,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               (const float*)R_s,
+                               B,
+                               ldb,
+                               (unsigned long long*)norms);
+
+            // The norms are the bits of doubles
+            double norms_h[2];
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(norms_h, norms, norms_bytes, hipMemcpyDeviceToHost, rocblas_stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(rocblas_stream));
+
+            ++*iterations;
+            if(norms_h[0] <= tolerance * norms_h[1])
+            {
+                converged = true;
+                return rocblas_status_success;
+            }
+            if(!std::isfinite(norms_h[0]) || !std::isfinite(norms_h[1]))
+                break;
+        }
+
+        // B = alpha*B, for the double precision solve
+        RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(B,
+                                             sizeof(double) * ldb,
+                                             B0,
+                                             sizeof(double) * m,
+                                             sizeof(double) * m,
+                                             n,
+                                             hipMemcpyDeviceToDevice,
+                                             rocblas_stream));
+        return rocblas_status_success;
+    }
+
+    /* ============================================================================================ */
+
+    template <rocblas_int BLOCK>
+    rocblas_status rocblas_trsm_refine_impl(rocblas_handle    handle,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            double*           B,
+                                            rocblas_int       ldb,
+                                            double            tolerance,
+                                            rocblas_int       max_iterations,
+                                            rocblas_int*      iterations)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        auto layer_mode = handle->layer_mode;
+        if(!handle->is_device_memory_size_query()
+           && (layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile)))
+        {
+            if(layer_mode & rocblas_layer_mode_log_trace)
+            {
+                if(handle->pointer_mode == rocblas_pointer_mode_host)
+                    log_trace(handle,
+                              rocblas_trsm_refine_name,
+                              side,
+                              uplo,
+                              transA,
+                              diag,
+                              m,
+                              n,
+                              log_trace_scalar_value(alpha),
+                              A,
+                              lda,
+                              B,
+                              ldb,
+                              tolerance,
+                              max_iterations);
+                else
+                    log_trace(handle,
+                              rocblas_trsm_refine_name,
+                              side,
+                              uplo,
+                              transA,
+                              diag,
+                              m,
+                              n,
+                              alpha,
+                              A,
+                              lda,
+                              B,
+                              ldb,
+                              tolerance,
+                              max_iterations);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_trsm_refine_name,
+                            "side",
+                            rocblas_side_letter(side),
+                            "uplo",
+                            rocblas_fill_letter(uplo),
+                            "transA",
+                            rocblas_transpose_letter(transA),
+                            "diag",
+                            rocblas_diag_letter(diag),
+                            "m",
+                            m,
+                            "n",
+                            n,
+                            "lda",
+                            lda,
+                            "ldb",
+                            ldb,
+                            "max_iterations",
+                            max_iterations);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_not_implemented;
+        if(m < 0 || n < 0 || max_iterations < 0)
+            return rocblas_status_invalid_size;
+
+        // A is of size lda*k
+        rocblas_int k = side == rocblas_side_left ? m : n;
+        if(lda < k || ldb < m)
+            return rocblas_status_invalid_size;
+
+        // quick return if possible.
+        // return status_size_unchanged if device memory size query
+        if(!m || !n)
+        {
+            if(handle->is_device_memory_size_query())
+                return rocblas_status_size_unchanged;
+            if(iterations)
+                *iterations = 0;
+            return rocblas_status_success;
+        }
+
+        if(!alpha || !A || !B || !iterations)
+            return rocblas_status_invalid_pointer;
+
+        bool           converged = false;
+        rocblas_status status    = rocblas_trsm_refine_template<BLOCK>(handle,
+                                                                    side,
+                                                                    uplo,
+                                                                    transA,
+                                                                    diag,
+                                                                    m,
+                                                                    n,
+                                                                    alpha,
+                                                                    A,
+                                                                    lda,
+                                                                    B,
+                                                                    ldb,
+                                                                    tolerance,
+                                                                    max_iterations,
+                                                                    iterations,
+                                                                    converged);
+        if(status != rocblas_status_success || converged)
+            return status;
+
+        // Refinement did not converge, and B now holds alpha*B. The workspace of the
+        // refinement has been released, so the double precision solve can allocate its own.
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        status = rocblas_trsm_solve_template<DTRSM_BLOCK, double>(
+            handle, side, uplo, transA, diag, m, n, &one<double>, A, lda, B, ldb, nullptr, 0);
+
+        return status == rocblas_status_success ? rocblas_status_perf_degraded : status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_dtrsm_refine(rocblas_handle    handle,
+                                    rocblas_side      side,
+                                    rocblas_fill      uplo,
+                                    rocblas_operation transA,
+                                    rocblas_diagonal  diag,
+                                    rocblas_int       m,
+                                    rocblas_int       n,
+                                    const double*     alpha,
+                                    const double*     A,
+                                    rocblas_int       lda,
+                                    double*           B,
+                                    rocblas_int       ldb,
+                                    double            tolerance,
+                                    rocblas_int       max_iterations,
+                                    rocblas_int*      iterations)
+{
+    return rocblas_trsm_refine_impl<STRSM_BLOCK>(handle,
+                                                 side,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 m,
+                                                 n,
+                                                 alpha,
+                                                 A,
+                                                 lda,
+                                                 B,
+                                                 ldb,
+                                                 tolerance,
+                                                 max_iterations,
+                                                 iterations);
+}
+
+} // extern "C"
@@ -205,14 +205,13 @@ namespace
                                                                                 mem_x_temp_arr,
                                                                                 mem_invA,
                                                                                 mem_invA_arr,
+                                                                                optimal_mem,
                                                                                 supplied_invA,
                                                                                 supplied_invA_size);
 
         if(perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
             return perf_status;
 
-        optimal_mem = perf_status == rocblas_status_success;
-
         rocblas_status status = rocblas_trsm_template<BLOCK, false, T>(handle,
                                                                        side,
                                                                        uplo,
@@ -84,6 +84,18 @@ namespace
                                                            (T*)mem);
     }
 
+    // Device memory used by TRTRI. The array of pointers of rocblas_trtri_batched is included,
+    // so that the size is enough for all of the TRTRI functions.
+    template <rocblas_int NB, typename T>
+    size_t rocblas_trtri_workspace_bytes(rocblas_int n, rocblas_int batch_count)
+    {
+        if(n <= NB || !batch_count)
+            return 0;
+
+        return _rocblas_handle::device_memory_size(
+            rocblas_trtri_temp_size<NB>(n, batch_count) * sizeof(T), sizeof(T*) * batch_count);
+    }
+
 }
 
 /*
@@ -119,4 +131,34 @@ rocblas_status rocblas_dtrtri(rocblas_handle   handle,
     return rocblas_trtri_impl<NB>(handle, uplo, diag, n, A, lda, invA, ldinvA);
 }
 
+rocblas_status rocblas_trtri_workspace_size(rocblas_handle   handle,
+                                            rocblas_int      n,
+                                            rocblas_int      batch_count,
+                                            rocblas_datatype compute_type,
+                                            size_t*          minimum_size,
+                                            size_t*          optimal_size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(!minimum_size || !optimal_size)
+        return rocblas_status_invalid_pointer;
+
+    constexpr rocblas_int NB = 16;
+    switch(compute_type)
+    {
+    case rocblas_datatype_f64_r:
+        *minimum_size = *optimal_size = rocblas_trtri_workspace_bytes<NB, double>(n, batch_count);
+        return rocblas_status_success;
+
+    case rocblas_datatype_f32_r:
+        *minimum_size = *optimal_size = rocblas_trtri_workspace_bytes<NB, float>(n, batch_count);
+        return rocblas_status_success;
+
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+
 } // extern "C"
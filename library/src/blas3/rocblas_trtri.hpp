@@ -6,9 +6,11 @@
 #define __ROCBLAS_TRTRI_HPP__
 
 #include "gemm.hpp"
+#include "gemm_batched_device.hpp"
 #include "handle.h"
 #include "rocblas.h"
 #include "utility.h"
+#include <algorithm>
 
 template <rocblas_int IB, typename T>
 __device__ void custom_trtri_device(rocblas_fill     uplo,
@@ -551,52 +553,142 @@ rocblas_status trtri_gemm_block(rocblas_handle handle,
                                 rocblas_int    offset_invAg2c = 0,
                                 rocblas_int    offset_C       = 0)
 {
-    T* host_A[batch_count];
-    T* host_invAg1[batch_count];
-    T* host_invAg2a[batch_count];
-    T* host_invAg2c[batch_count];
-    T* host_C[batch_count];
-    if(BATCHED)
-    {
-        RETURN_IF_HIP_ERROR(hipMemcpy(host_A, A, batch_count * sizeof(T*), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(host_invAg1, invAg1, batch_count * sizeof(T*), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(host_invAg2a, invAg2a, batch_count * sizeof(T*), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(host_invAg2c, invAg2c, batch_count * sizeof(T*), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(hipMemcpy(host_C, C, batch_count * sizeof(T*), hipMemcpyDeviceToHost));
-    }
-
     rocblas_status     status       = rocblas_status_success;
     static constexpr T one          = 1;
     static constexpr T zero         = 0;
     static constexpr T negative_one = -1;
 
+    // The scalars are host constants, whatever the pointer mode of the caller
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    // The arrays of pointers are read on the device, so that TRTRI does not synchronize with
+    // the host. All of the batches and sub-blocks are done by one launch for each gemm.
+    if(BATCHED)
+    {
+        // C = A21*invA11 (lower) or C = A12*invA22 (upper)
+        status = rocblas_gemm_batched_device_template(handle,
+                                                      rocblas_operation_none,
+                                                      rocblas_operation_none,
+                                                      M,
+                                                      N,
+                                                      N,
+                                                      &one,
+                                                      A,
+                                                      offset_A,
+                                                      ld_A,
+                                                      stride_A,
+                                                      invAg1,
+                                                      offset_invAg1,
+                                                      ld_invA,
+                                                      stride_invA,
+                                                      &zero,
+                                                      C,
+                                                      offset_C,
+                                                      ld_C,
+                                                      stride_C,
+                                                      batch_count,
+                                                      sub_blocks,
+                                                      sub_stride_A,
+                                                      sub_stride_invA,
+                                                      sub_stride_C);
+        if(status != rocblas_status_success)
+            return status;
+
+        // invA21 = -invA22 * C (lower) or invA12 = -invA11*C (upper)
+        return rocblas_gemm_batched_device_template(handle,
+                                                    rocblas_operation_none,
+                                                    rocblas_operation_none,
+                                                    M,
+                                                    N,
+                                                    M,
+                                                    &negative_one,
+                                                    invAg2a,
+                                                    offset_invAg2a,
+                                                    ld_invA,
+                                                    stride_invA,
+                                                    C,
+                                                    offset_C,
+                                                    ld_C,
+                                                    stride_C,
+                                                    &zero,
+                                                    invAg2c,
+                                                    offset_invAg2c,
+                                                    ld_invA,
+                                                    stride_invA,
+                                                    batch_count,
+                                                    sub_blocks,
+                                                    sub_stride_invA,
+                                                    sub_stride_C,
+                                                    sub_stride_invA);
+    }
+
+    // With one block for each batch, the strided batches are done by one launch for each gemm.
+    // C is shared by the batches when stride_C is 0, so they are then done one at a time.
+    if(sub_blocks == 1 && stride_C != 0)
+    {
+        const T* aptr       = load_ptr_batch(A, 0, offset_A, stride_A);
+        const T* invAg1ptr  = load_ptr_batch(invAg1, 0, offset_invAg1, stride_invA);
+        const T* invAg2ptr  = load_ptr_batch(invAg2a, 0, offset_invAg2a, stride_invA);
+        T*       cptr       = load_ptr_batch(C, 0, offset_C, stride_C);
+        T*       invAg2cptr = load_ptr_batch(invAg2c, 0, offset_invAg2c, stride_invA);
+
+        status = rocblas_gemm_template<false, true>(handle,
+                                                    rocblas_operation_none,
+                                                    rocblas_operation_none,
+                                                    M,
+                                                    N,
+                                                    N,
+                                                    &one,
+                                                    aptr,
+                                                    0,
+                                                    ld_A,
+                                                    stride_A,
+                                                    invAg1ptr,
+                                                    0,
+                                                    ld_invA,
+                                                    stride_invA,
+                                                    &zero,
+                                                    cptr,
+                                                    0,
+                                                    ld_C,
+                                                    stride_C,
+                                                    batch_count);
+        if(status != rocblas_status_success)
+            return status;
+
+        return rocblas_gemm_template<false, true>(handle,
+                                                  rocblas_operation_none,
+                                                  rocblas_operation_none,
+                                                  M,
+                                                  N,
+                                                  M,
+                                                  &negative_one,
+                                                  invAg2ptr,
+                                                  0,
+                                                  ld_invA,
+                                                  stride_invA,
+                                                  cptr,
+                                                  0,
+                                                  ld_C,
+                                                  stride_C,
+                                                  &zero,
+                                                  invAg2cptr,
+                                                  0,
+                                                  ld_invA,
+                                                  stride_invA,
+                                                  batch_count);
+    }
+
     // first batched gemm compute C = A21*invA11 (lower) or C = A12*invA22 (upper)
     // distance between each invA11 or invA22 is sub_stride_invA, sub_stride_A for each A21 or A12, C
     // of size IB * IB
     for(int b = 0; b < batch_count; b++)
     {
-        const T *aptr, *invAg1ptr, *invAg2ptr;
-        T *      cptr, *invAg2cptr;
-
-        if(BATCHED)
-        {
-            aptr       = load_ptr_batch(host_A, b, offset_A, stride_A);
-            invAg1ptr  = load_ptr_batch(host_invAg1, b, offset_invAg1, stride_invA);
-            invAg2ptr  = load_ptr_batch(host_invAg2a, b, offset_invAg2a, stride_invA);
-            cptr       = load_ptr_batch(host_C, b, offset_C, stride_C);
-            invAg2cptr = load_ptr_batch(host_invAg2c, b, offset_invAg2c, stride_invA);
-        }
-        else
-        {
-            aptr       = load_ptr_batch(A, b, offset_A, stride_A);
-            invAg1ptr  = load_ptr_batch(invAg1, b, offset_invAg1, stride_invA);
-            invAg2ptr  = load_ptr_batch(invAg2a, b, offset_invAg2a, stride_invA);
-            cptr       = load_ptr_batch(C, b, offset_C, stride_C);
-            invAg2cptr = load_ptr_batch(invAg2c, b, offset_invAg2c, stride_invA);
-        }
+        const T* aptr       = load_ptr_batch(A, b, offset_A, stride_A);
+        const T* invAg1ptr  = load_ptr_batch(invAg1, b, offset_invAg1, stride_invA);
+        const T* invAg2ptr  = load_ptr_batch(invAg2a, b, offset_invAg2a, stride_invA);
+        T*       cptr       = load_ptr_batch(C, b, offset_C, stride_C);
+        T*       invAg2cptr = load_ptr_batch(invAg2c, b, offset_invAg2c, stride_invA);
 
         // We are naively iterating through the batches, and uses sub-batches in a strided_batched style.
         status = rocblas_gemm_template<false, true>(handle,
@@ -986,11 +1078,30 @@ rocblas_status rocblas_trtri_large(rocblas_handle   handle,
     return rocblas_status_success;
 }
 
+// From this order on, TRTRI is done recursively, so that most of the work is in large GEMMs
+constexpr rocblas_int TRTRI_RECURSIVE_MIN_N = 512;
+
+// Order of the leading diagonal block when A is split in the recursion, a multiple of NB
+template <rocblas_int NB>
+constexpr rocblas_int rocblas_trtri_recursive_split(rocblas_int n)
+{
+    return (n / 2 + NB - 1) / NB * NB;
+}
+
 template <rocblas_int NB>
 constexpr size_t rocblas_trtri_temp_size(rocblas_int n, rocblas_int batch_count)
 {
     size_t size = 0;
-    if(n > NB * 2 && batch_count > 0)
+    if(n >= TRTRI_RECURSIVE_MIN_N && batch_count > 0)
+    {
+        // The product of the off-diagonal block, or more if needed further down the recursion
+        rocblas_int n1      = rocblas_trtri_recursive_split<NB>(n);
+        size_t      size_C  = size_t(n1) * (n - n1);
+        size_t      size_n1 = rocblas_trtri_temp_size<NB>(n1, 1);
+        size_t      size_n2 = rocblas_trtri_temp_size<NB>(n - n1, 1);
+        size                = std::max(size_C, std::max(size_n1, size_n2)) * batch_count;
+    }
+    else if(n > NB * 2 && batch_count > 0)
     {
         rocblas_int current_n = NB * 2;
         while(current_n * 2 <= n)
@@ -1004,6 +1115,181 @@ constexpr size_t rocblas_trtri_temp_size(rocblas_int n, rocblas_int batch_count)
     return size;
 }
 
+/*
+ * Recursive TRTRI
+ *
+ * With A11 of order n1 = rocblas_trtri_recursive_split<NB>(n),
+ *
+ *   [ A11   0  ]^-1   [       invA11           0    ]
+ *   [ A21  A22 ]    = [ -invA22*A21*invA11  invA22  ]
+ *
+ * and invA12 = -invA11*A12*invA22 if A is upper triangular. invA11 and invA22 are computed
+ * recursively, down to blocks smaller than TRTRI_RECURSIVE_MIN_N which are inverted by
+ * rocblas_trtri_large. The off-diagonal block takes two GEMMs of order n / 2 over all of the
+ * batches, so that the cost of large inversions is dominated by GEMM. C_tmp holds A21*invA11
+ * or A12*invA22, stride_C elements apart for each batch.
+ */
+template <rocblas_int NB, bool BATCHED, bool STRIDED, typename T, typename U, typename V>
+rocblas_status trtri_recursive_block(rocblas_handle   handle,
+                                     rocblas_fill     uplo,
+                                     rocblas_diagonal diag,
+                                     rocblas_int      n,
+                                     U                A,
+                                     rocblas_int      offset_A,
+                                     rocblas_int      lda,
+                                     rocblas_stride   stride_A,
+                                     V                invA,
+                                     rocblas_int      offset_invA,
+                                     rocblas_int      ldinvA,
+                                     rocblas_stride   stride_invA,
+                                     rocblas_int      batch_count,
+                                     V                C_tmp,
+                                     rocblas_stride   stride_C)
+{
+    if(n < TRTRI_RECURSIVE_MIN_N)
+        return rocblas_trtri_large<NB, BATCHED, STRIDED, T>(handle,
+                                                            uplo,
+                                                            diag,
+                                                            n,
+                                                            A,
+                                                            offset_A,
+                                                            lda,
+                                                            stride_A,
+                                                            0,
+                                                            invA,
+                                                            offset_invA,
+                                                            ldinvA,
+                                                            stride_invA,
+                                                            0,
+                                                            batch_count,
+                                                            1,
+                                                            C_tmp);
+
+    rocblas_int n1            = rocblas_trtri_recursive_split<NB>(n);
+    rocblas_int n2            = n - n1;
+    rocblas_int offset_invA22 = offset_invA + n1 * ldinvA + n1;
+    bool        lower         = uplo == rocblas_fill_lower;
+
+    // invA11
+    rocblas_status status = trtri_recursive_block<NB, BATCHED, STRIDED, T>(handle,
+                                                                           uplo,
+                                                                           diag,
+                                                                           n1,
+                                                                           A,
+                                                                           offset_A,
+                                                                           lda,
+                                                                           stride_A,
+                                                                           invA,
+                                                                           offset_invA,
+                                                                           ldinvA,
+                                                                           stride_invA,
+                                                                           batch_count,
+                                                                           C_tmp,
+                                                                           stride_C);
+    if(status != rocblas_status_success)
+        return status;
+
+    // invA22
+    status = trtri_recursive_block<NB, BATCHED, STRIDED, T>(handle,
+                                                            uplo,
+                                                            diag,
+                                                            n2,
+                                                            A,
+                                                            offset_A + n1 * lda + n1,
+                                                            lda,
+                                                            stride_A,
+                                                            invA,
+                                                            offset_invA22,
+                                                            ldinvA,
+                                                            stride_invA,
+                                                            batch_count,
+                                                            C_tmp,
+                                                            stride_C);
+    if(status != rocblas_status_success)
+        return status;
+
+    // C = A21*invA11, invA21 = -invA22*C (lower) or C = A12*invA22, invA12 = -invA11*C (upper)
+    rocblas_int m_C = lower ? n2 : n1;
+    return trtri_gemm_block<BATCHED, STRIDED, T>(handle,
+                                                 m_C,
+                                                 lower ? n1 : n2,
+                                                 (U)A,
+                                                 lda,
+                                                 stride_A,
+                                                 0,
+                                                 (U)invA,
+                                                 (U)invA,
+                                                 (V)invA,
+                                                 ldinvA,
+                                                 stride_invA,
+                                                 0,
+                                                 C_tmp,
+                                                 m_C,
+                                                 stride_C,
+                                                 0,
+                                                 batch_count,
+                                                 1,
+                                                 offset_A + (lower ? n1 : n1 * lda),
+                                                 lower ? offset_invA : offset_invA22,
+                                                 lower ? offset_invA22 : offset_invA,
+                                                 offset_invA + (lower ? n1 : n1 * ldinvA),
+                                                 0);
+}
+
+template <rocblas_int NB, bool BATCHED, bool STRIDED, typename T, typename U, typename V>
+rocblas_status rocblas_trtri_recursive(rocblas_handle   handle,
+                                       rocblas_fill     uplo,
+                                       rocblas_diagonal diag,
+                                       rocblas_int      n,
+                                       U                A,
+                                       rocblas_int      offset_A,
+                                       rocblas_int      lda,
+                                       rocblas_stride   stride_A,
+                                       V                invA,
+                                       rocblas_int      offset_invA,
+                                       rocblas_int      ldinvA,
+                                       rocblas_stride   stride_invA,
+                                       rocblas_int      batch_count,
+                                       V                C_tmp)
+{
+    // The recursion only writes the triangle of invA, so the other part is zeroed here
+    size_t sub_block_size       = 128;
+    size_t tri_elements_to_zero = num_non_tri_elements(n);
+    size_t num_sub_blocks       = (tri_elements_to_zero + sub_block_size - 1) / sub_block_size;
+    hipLaunchKernelGGL(rocblas_trtri_fill<T>,
+                       dim3(num_sub_blocks, batch_count, 1),
+                       dim3(sub_block_size, 1, 1),
+                       0,
+                       handle->rocblas_stream,
+                       handle,
+                       uplo == rocblas_fill_lower ? rocblas_fill_upper : rocblas_fill_lower,
+                       n,
+                       num_non_tri_elements(n),
+                       ldinvA,
+                       n * ldinvA,
+                       invA,
+                       offset_invA,
+                       stride_invA,
+                       1);
+
+    // The caller allocates rocblas_trtri_temp_size<NB>(n, 1) elements of C_tmp for each batch
+    return trtri_recursive_block<NB, BATCHED, STRIDED, T>(handle,
+                                                          uplo,
+                                                          diag,
+                                                          n,
+                                                          A,
+                                                          offset_A,
+                                                          lda,
+                                                          stride_A,
+                                                          invA,
+                                                          offset_invA,
+                                                          ldinvA,
+                                                          stride_invA,
+                                                          batch_count,
+                                                          C_tmp,
+                                                          rocblas_trtri_temp_size<NB>(n, 1));
+}
+
 template <rocblas_int NB, bool BATCHED, bool STRIDED, typename T, typename U, typename V>
 rocblas_status rocblas_trtri_template(rocblas_handle   handle,
                                       rocblas_fill     uplo,
@@ -1044,6 +1330,23 @@ rocblas_status rocblas_trtri_template(rocblas_handle   handle,
                                           batch_count,
                                           sub_batch_count);
     }
+    else if(n >= TRTRI_RECURSIVE_MIN_N && sub_batch_count == 1)
+    {
+        return rocblas_trtri_recursive<NB, BATCHED, STRIDED, T>(handle,
+                                                                uplo,
+                                                                diag,
+                                                                n,
+                                                                A,
+                                                                offset_A,
+                                                                lda,
+                                                                stride_A,
+                                                                invA,
+                                                                offset_invA,
+                                                                ldinvA,
+                                                                stride_invA,
+                                                                batch_count,
+                                                                C_tmp);
+    }
     else
     {
         return rocblas_trtri_large<NB, BATCHED, STRIDED, T>(handle,
@@ -99,31 +99,27 @@ namespace
             void* C_tmp_arr;
             std::tie(C_tmp, C_tmp_arr) = mem;
 
-            T* C_tmp_host[batch_count];
-            for(int b = 0; b < batch_count; b++)
-            {
-                C_tmp_host[b] = (T*)C_tmp + b * els;
-            }
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(C_tmp_arr, C_tmp_host, batch_count * sizeof(T*), hipMemcpyHostToDevice));
-
-            status = rocblas_trtri_large<NB, true, false, T>(handle,
-                                                             uplo,
-                                                             diag,
-                                                             n,
-                                                             A,
-                                                             0,
-                                                             lda,
-                                                             0,
-                                                             0,
-                                                             invA,
-                                                             0,
-                                                             ldinvA,
-                                                             0,
-                                                             0,
-                                                             batch_count,
-                                                             1,
-                                                             (T**)C_tmp_arr);
+            // Set up the array of pointers on the device, without a copy from the host
+            setup_batched_array<NB>(
+                handle->rocblas_stream, (T*)C_tmp, els, (T**)C_tmp_arr, batch_count);
+
+            status = rocblas_trtri_template<NB, true, false, T>(handle,
+                                                                uplo,
+                                                                diag,
+                                                                n,
+                                                                A,
+                                                                0,
+                                                                lda,
+                                                                0,
+                                                                0,
+                                                                invA,
+                                                                0,
+                                                                ldinvA,
+                                                                0,
+                                                                0,
+                                                                batch_count,
+                                                                1,
+                                                                (T**)C_tmp_arr);
         }
 
         return status;
@@ -10,6 +10,7 @@
 #include "handle.h"
 #include "logging.h"
 #include "rocblas.h"
+#include "rocblas_pack_int8x4.hpp"
 #include "utility.h"
 
 /////////////////
@@ -809,6 +810,112 @@ rocblas_status gemm_ex_typecasting(rocblas_handle    handle,
     }
 }
 
+// Bytes of temporary device memory used by gemm_ex to pack int8 A and B, followed by the
+// bytes used for the arrays of pointers to the packed matrices when BATCHED. Only int8
+// operands passed unpacked (rocblas_gemm_flags_unpacked_int8) are packed.
+template <bool BATCHED>
+inline std::array<size_t, 4> gemm_ex_pack_int8x4_sizes(rocblas_operation trans_a,
+                                                       rocblas_operation trans_b,
+                                                       rocblas_int       m,
+                                                       rocblas_int       n,
+                                                       rocblas_int       k,
+                                                       rocblas_datatype  a_type,
+                                                       rocblas_int       lda,
+                                                       rocblas_int       ldb,
+                                                       rocblas_int       batch_count,
+                                                       uint32_t          flags)
+{
+    bool pack = a_type == rocblas_datatype_i8_r && (flags & rocblas_gemm_flags_unpacked_int8)
+                && m > 0 && n > 0 && k > 0 && batch_count > 0;
+    bool pack_a = pack && trans_a == rocblas_operation_none;
+    bool pack_b = pack && trans_b != rocblas_operation_none;
+
+    return {{pack_a ? size_t(lda) * k * batch_count : 0,
+             pack_b ? size_t(ldb) * k * batch_count : 0,
+             pack_a && BATCHED ? sizeof(int8_t*) * batch_count : 0,
+             pack_b && BATCHED ? sizeof(int8_t*) * batch_count : 0}};
+}
+
+// Handles a device memory size query for gemm_ex
+template <bool BATCHED>
+inline rocblas_status rocblas_gemm_ex_device_memory_size(rocblas_handle    handle,
+                                                         rocblas_operation trans_a,
+                                                         rocblas_operation trans_b,
+                                                         rocblas_int       m,
+                                                         rocblas_int       n,
+                                                         rocblas_int       k,
+                                                         rocblas_datatype  a_type,
+                                                         rocblas_int       lda,
+                                                         rocblas_int       ldb,
+                                                         rocblas_int       batch_count,
+                                                         uint32_t          flags)
+{
+    auto sizes = gemm_ex_pack_int8x4_sizes<BATCHED>(
+        trans_a, trans_b, m, n, k, a_type, lda, ldb, batch_count, flags);
+    return handle->set_optimal_device_memory_size(sizes[0], sizes[1], sizes[2], sizes[3]);
+}
+
+// Packs the int8 operand x of gemm_ex, which has rows x k elements in op(x), into consecutive
+// matrices in P, and replaces x with the packed operand. When BATCHED, P_arr is set to point to
+// the packed matrices.
+template <bool BATCHED>
+rocblas_status gemm_ex_pack_int8x4(rocblas_handle  handle,
+                                   rocblas_int     rows,
+                                   rocblas_int     k,
+                                   const void*&    x,
+                                   rocblas_int&    offset_x,
+                                   rocblas_int     ld_x,
+                                   rocblas_stride& stride_x,
+                                   rocblas_int     batch_count,
+                                   void*           P,
+                                   void*           P_arr)
+{
+    rocblas_stride stride_p = rocblas_stride(ld_x) * k;
+    rocblas_status status;
+
+    if(BATCHED)
+        status = rocblas_pack_int8x4_template(handle,
+                                              rows,
+                                              k,
+                                              (const int8_t* const*)x,
+                                              offset_x,
+                                              ld_x,
+                                              stride_x,
+                                              (int8_t*)P,
+                                              ld_x,
+                                              stride_p,
+                                              batch_count);
+    else
+        status = rocblas_pack_int8x4_template(handle,
+                                              rows,
+                                              k,
+                                              (const int8_t*)x,
+                                              offset_x,
+                                              ld_x,
+                                              stride_x,
+                                              (int8_t*)P,
+                                              ld_x,
+                                              stride_p,
+                                              batch_count);
+    if(status != rocblas_status_success)
+        return status;
+
+    if(BATCHED)
+    {
+        setup_batched_array<256>(
+            handle->rocblas_stream, (int8_t*)P, stride_p, (int8_t**)P_arr, batch_count);
+        x = P_arr;
+    }
+    else
+    {
+        x = P;
+    }
+    offset_x = 0;
+    stride_x = stride_p;
+
+    return rocblas_status_success;
+}
+
 template <bool BATCHED>
 rocblas_status rocblas_gemm_ex_template(rocblas_handle    handle,
                                         rocblas_operation trans_a,
@@ -839,7 +946,8 @@ rocblas_status rocblas_gemm_ex_template(rocblas_handle    handle,
                                         rocblas_int       ldd,
                                         rocblas_stride    stride_d,
                                         rocblas_int       batch_count,
-                                        rocblas_datatype  compute_type)
+                                        rocblas_datatype  compute_type,
+                                        uint32_t          flags)
 {
     // Note: k==0 is not an early exit, since C still needs to be multiplied by beta
     if(!m || !n || !batch_count)
@@ -905,6 +1013,47 @@ rocblas_status rocblas_gemm_ex_template(rocblas_handle    handle,
         }
         else
         {
+            // Pack the operands passed unpacked into temporary device memory
+            auto sizes = gemm_ex_pack_int8x4_sizes<BATCHED>(
+                trans_a, trans_b, m, n, k, a_type, lda, ldb, batch_count, flags);
+            auto mem = handle->device_malloc(sizes[0], sizes[1], sizes[2], sizes[3]);
+            if(!mem)
+                return rocblas_status_memory_error;
+
+            void *packed_a, *packed_b, *packed_a_arr, *packed_b_arr;
+            std::tie(packed_a, packed_b, packed_a_arr, packed_b_arr) = mem;
+
+            if(packed_a)
+            {
+                rb_status = gemm_ex_pack_int8x4<BATCHED>(handle,
+                                                         m,
+                                                         k,
+                                                         a,
+                                                         offsetAin,
+                                                         lda,
+                                                         stride_a,
+                                                         batch_count,
+                                                         packed_a,
+                                                         packed_a_arr);
+                if(rb_status != rocblas_status_success)
+                    return rb_status;
+            }
+            if(packed_b)
+            {
+                rb_status = gemm_ex_pack_int8x4<BATCHED>(handle,
+                                                         n,
+                                                         k,
+                                                         b,
+                                                         offsetBin,
+                                                         ldb,
+                                                         stride_b,
+                                                         batch_count,
+                                                         packed_b,
+                                                         packed_b_arr);
+                if(rb_status != rocblas_status_success)
+                    return rb_status;
+            }
+
             // adjust by 4 for Tensile
             lda = (trans_a == rocblas_operation_none) ? lda : lda / 4;
             ldb = (trans_b == rocblas_operation_none) ? ldb / 4 : ldb;
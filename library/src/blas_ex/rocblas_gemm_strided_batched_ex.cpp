@@ -42,7 +42,10 @@ extern "C" rocblas_status rocblas_gemm_strided_batched_ex(rocblas_handle    hand
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+    // Temporary device memory is only used to pack int8 matrices
+    if(handle->is_device_memory_size_query())
+        return rocblas_gemm_ex_device_memory_size<false>(
+            handle, trans_a, trans_b, m, n, k, a_type, lda, ldb, batch_count, flags);
 
     auto layer_mode = handle->layer_mode;
     if(layer_mode
@@ -298,5 +301,6 @@ extern "C" rocblas_status rocblas_gemm_strided_batched_ex(rocblas_handle    hand
                                            ldd,
                                            stride_d,
                                            batch_count,
-                                           compute_type);
+                                           compute_type,
+                                           flags);
 }
@@ -0,0 +1,112 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_pack_int8x4.hpp"
+#include "handle.h"
+#include "logging.h"
+#include "rocblas.h"
+#include "utility.h"
+
+namespace
+{
+    template <bool STRIDED>
+    constexpr char rocblas_pack_int8x4_name[] = "rocblas_pack_int8x4";
+    template <>
+    constexpr char rocblas_pack_int8x4_name<true>[] = "rocblas_pack_int8x4_strided_batched";
+
+    template <bool STRIDED>
+    rocblas_status rocblas_pack_int8x4_impl(rocblas_handle handle,
+                                            rocblas_int    m,
+                                            rocblas_int    k,
+                                            const int8_t*  A,
+                                            rocblas_int    lda,
+                                            rocblas_stride stride_a,
+                                            int8_t*        A_packed,
+                                            rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+        {
+            if(STRIDED)
+                log_trace(handle,
+                          rocblas_pack_int8x4_name<STRIDED>,
+                          m,
+                          k,
+                          A,
+                          lda,
+                          stride_a,
+                          A_packed,
+                          batch_count);
+            else
+                log_trace(handle, rocblas_pack_int8x4_name<STRIDED>, m, k, A, lda, A_packed);
+        }
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+        {
+            if(STRIDED)
+                log_profile(handle,
+                            rocblas_pack_int8x4_name<STRIDED>,
+                            "M",
+                            m,
+                            "K",
+                            k,
+                            "lda",
+                            lda,
+                            "stride_a",
+                            stride_a,
+                            "batch_count",
+                            batch_count);
+            else
+                log_profile(handle, rocblas_pack_int8x4_name<STRIDED>, "M", m, "K", k, "lda", lda);
+        }
+
+        if(m < 0 || k < 0 || k % 4 != 0 || lda < m || lda < 1 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!m || !k || !batch_count)
+            return rocblas_status_success;
+
+        if(!A || !A_packed)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_pack_int8x4_template(
+            handle, m, k, A, 0, lda, stride_a, A_packed, lda, stride_a, batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_pack_int8x4(rocblas_handle handle,
+                                   rocblas_int    m,
+                                   rocblas_int    k,
+                                   const int8_t*  A,
+                                   rocblas_int    lda,
+                                   int8_t*        A_packed)
+{
+    return rocblas_pack_int8x4_impl<false>(handle, m, k, A, lda, 0, A_packed, 1);
+}
+
+rocblas_status rocblas_pack_int8x4_strided_batched(rocblas_handle handle,
+                                                   rocblas_int    m,
+                                                   rocblas_int    k,
+                                                   const int8_t*  A,
+                                                   rocblas_int    lda,
+                                                   rocblas_stride stride_a,
+                                                   int8_t*        A_packed,
+                                                   rocblas_int    batch_count)
+{
+    return rocblas_pack_int8x4_impl<true>(handle, m, k, A, lda, stride_a, A_packed, batch_count);
+}
+
+} // extern "C"
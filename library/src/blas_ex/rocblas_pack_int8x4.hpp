@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright 2019 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef __ROCBLAS_PACK_INT8X4_HPP__
+#define __ROCBLAS_PACK_INT8X4_HPP__
+
+#include "handle.h"
+#include "rocblas.h"
+#include "utility.h"
+
+/*
+ * Packing of int8 matrices for gemm_ex
+ *
+ * The int8 gemm_ex kernels read 4 consecutive values in the k dimension as one int8x4. A
+ * column major m x k matrix A, with k a multiple of 4, is packed so that each group of 4
+ * columns is stored row by row:
+ *
+ *   A_packed[4 * (i + (l / 4) * lda) + l % 4] = A[i + l * lda]
+ *
+ * The packed matrix has the same size and leading dimension as A. Rows i >= m of the packed
+ * matrix are not written.
+ */
+
+constexpr rocblas_int PACK_INT8X4_DIM_X = 64;
+constexpr rocblas_int PACK_INT8X4_DIM_Y = 4;
+
+// Each thread packs the 4 values in row i of one group of 4 columns
+template <typename U>
+__global__ void pack_int8x4_kernel(rocblas_int    m,
+                                   rocblas_int    k,
+                                   U              Aa,
+                                   rocblas_int    offset_a,
+                                   rocblas_int    lda,
+                                   rocblas_stride stride_a,
+                                   int8_t*        P,
+                                   rocblas_int    ldp,
+                                   rocblas_stride stride_p)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int l = (hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y) * 4;
+    if(i >= m || l >= k)
+        return;
+
+    const int8_t* A = load_ptr_batch(Aa, hipBlockIdx_z, offset_a, stride_a);
+    P += hipBlockIdx_z * stride_p + 4 * (i + ptrdiff_t(l / 4) * ldp);
+
+    for(rocblas_int c = 0; c < 4; c++)
+        P[c] = A[i + ptrdiff_t(l + c) * lda];
+}
+
+/*! \brief Packs batch_count m x k int8 matrices, which are strided or arrays of device
+    pointers depending on U, into strided packed matrices P. k must be a multiple of 4. */
+template <typename U>
+rocblas_status rocblas_pack_int8x4_template(rocblas_handle handle,
+                                            rocblas_int    m,
+                                            rocblas_int    k,
+                                            U              A,
+                                            rocblas_int    offset_a,
+                                            rocblas_int    lda,
+                                            rocblas_stride stride_a,
+                                            int8_t*        P,
+                                            rocblas_int    ldp,
+                                            rocblas_stride stride_p,
+                                            rocblas_int    batch_count)
+{
+    // Quick return
+    if(!m || !k || !batch_count)
+        return rocblas_status_success;
+
+    dim3 grid((m - 1) / PACK_INT8X4_DIM_X + 1, (k / 4 - 1) / PACK_INT8X4_DIM_Y + 1, batch_count);
+    dim3 threads(PACK_INT8X4_DIM_X, PACK_INT8X4_DIM_Y);
+
+    hipLaunchKernelGGL(pack_int8x4_kernel,
+                       grid,
+                       threads,
+                       0,
+                       handle->rocblas_stream,
+                       m,
+                       k,
+                       A,
+                       offset_a,
+                       lda,
+                       stride_a,
+                       P,
+                       ldp,
+                       stride_p);
+
+    return rocblas_status_success;
+}
+
+#endif // __ROCBLAS_PACK_INT8X4_HPP__
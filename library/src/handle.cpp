@@ -65,6 +65,12 @@ _rocblas_handle::_rocblas_handle()
 
     // Allocate device memory
     THROW_IF_HIP_ERROR((hipMalloc)(&device_memory, device_memory_size));
+
+    // Allocate the reduction tickets, which start out as zero
+    THROW_IF_HIP_ERROR(
+        (hipMalloc)(&reduction_tickets, sizeof(rocblas_int) * REDUCTION_TICKET_COUNT));
+    THROW_IF_HIP_ERROR(
+        hipMemset(reduction_tickets, 0, sizeof(rocblas_int) * REDUCTION_TICKET_COUNT));
 }
 
 /*******************************************************************************
@@ -80,6 +86,8 @@ _rocblas_handle::~_rocblas_handle()
     }
     if(device_memory)
         (hipFree)(device_memory);
+    if(reduction_tickets)
+        (hipFree)(reduction_tickets);
 }
 
 /*******************************************************************************
@@ -71,6 +71,14 @@ public:
     // default pointer_mode is on host
     rocblas_pointer_mode pointer_mode = rocblas_pointer_mode_host;
 
+    // default math_mode uses the precision of the data type
+    rocblas_math_mode math_mode = rocblas_default_math;
+
+    // completion tickets of the single-pass reductions, one per batch; they are zero between
+    // calls, because the last workgroup of each batch resets its ticket
+    static constexpr rocblas_int REDUCTION_TICKET_COUNT = 4096;
+    rocblas_int*                 reduction_tickets      = nullptr;
+
     // default logging_mode is no logging
     static rocblas_layer_mode layer_mode;
 
@@ -118,10 +126,7 @@ public:
         if(!device_memory_size_query)
             return rocblas_status_internal_error;
 
-        // Compute the total size, rounding up each size to multiples of MIN_CHUNK_SIZE
-        // TODO: Replace with C++17 fold expression eventually
-        size_t total = 0;
-        auto   dummy = {total += roundup_device_memory_size(size_t(sizes))...};
+        size_t total = device_memory_size(sizes...);
 
         if(total > device_memory_query_size)
         {
@@ -131,6 +136,19 @@ public:
         return rocblas_status_size_unchanged;
     }
 
+    // Returns the total size of device memory used by device_malloc(sizes...)
+    template <typename... Ss,
+              typename = typename std::enable_if<
+                  sizeof...(Ss) && conjunction<std::is_constructible<size_t, Ss>...>{}>::type>
+    static size_t device_memory_size(Ss... sizes)
+    {
+        // Compute the total size, rounding up each size to multiples of MIN_CHUNK_SIZE
+        // TODO: Replace with C++17 fold expression eventually
+        size_t total = 0;
+        auto   dummy = {total += roundup_device_memory_size(size_t(sizes))...};
+        return total;
+    }
+
     // Allocate one or more sizes
     template <typename... Ss,
               typename std::enable_if<sizeof...(Ss)
@@ -56,6 +56,38 @@ extern "C" rocblas_status rocblas_set_pointer_mode(rocblas_handle handle, rocbla
     return rocblas_status_success;
 }
 
+/*******************************************************************************
+ * ! \brief get math mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_math_mode(rocblas_handle handle, rocblas_math_mode* mode)
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->math_mode;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_math_mode", *mode);
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * ! \brief set math mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_math_mode(rocblas_handle handle, rocblas_math_mode mode)
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(mode != rocblas_default_math && mode != rocblas_xf32_bf16x3_math)
+        return rocblas_status_not_implemented;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_math_mode", mode);
+    handle->math_mode = mode;
+    return rocblas_status_success;
+}
+
 /*******************************************************************************
  * ! \brief create rocblas handle called before any rocblas library routines
  ******************************************************************************/
@@ -0,0 +1,30 @@
+#!/bin/bash
+# Compares the blocked and the recursive TRSM algorithms, which are forced with
+# ROCBLAS_TRSM_RECURSIVE=0 and ROCBLAS_TRSM_RECURSIVE=1
+bench=./rocblas-bench
+if [ ! -f ${bench} ]; then
+	echo ${bench} not found, exit...
+	exit 1
+else
+	echo ">>" $(realpath $(ldd ${bench} | grep rocblas | awk '{print $3;}'))
+fi
+
+for recursive in 0 1; do
+	echo "ROCBLAS_TRSM_RECURSIVE=${recursive}"
+
+	for i in {2048..32768..2048}; do
+		ROCBLAS_TRSM_RECURSIVE=${recursive} \
+		${bench} -f trsm -r d --side L --uplo L --transposeA N --diag U \
+		-m ${i} -n 1024 --lda ${i} --ldb ${i} \
+		--initialization trig_float \
+		--alpha 1 -i 1 2>&1 | egrep '[LR],[UL],[NT],[UN]|fault'
+	done
+
+	for i in {2048..32768..2048}; do
+		ROCBLAS_TRSM_RECURSIVE=${recursive} \
+		${bench} -f trsm -r d --side R --uplo L --transposeA T --diag U \
+		-m 1024 -n ${i} --lda ${i} --ldb 1024 \
+		--initialization trig_float \
+		--alpha 1 -i 1 2>&1 | egrep '[LR],[UL],[NT],[UN]|fault'
+	done
+done